@@ -0,0 +1,37 @@
+// ================================================================
+// ShadowAtlasTileClear.hlsl
+// - Shadow atlas의 특정 타일(Viewport 영역)만 초기화합니다.
+// - ClearDepthStencilView는 영역 지정이 불가능하므로, 캐싱된 타일을 보존하기 위해
+//   타일 크기의 삼각형을 그려 Depth = 1.0, Moments = 1.0으로 덮어씁니다.
+// - DepthFunc = ALWAYS 상태와 함께 사용해야 합니다.
+// ================================================================
+
+struct PS_INPUT
+{
+    float4 Position : SV_POSITION;
+};
+
+// ================================================================
+// Vertex Shader
+// - Vertex buffer 없이 Viewport 전체를 덮는 삼각형을 생성합니다.
+// ================================================================
+PS_INPUT mainVS(uint VertexID : SV_VertexID)
+{
+    PS_INPUT Output;
+
+    float2 Pos = float2((VertexID << 1) & 2, VertexID & 2);
+    // z = w = 1 -> Depth 1.0 (Far)
+    Output.Position = float4(Pos * 2.0f - 1.0f, 1.0f, 1.0f);
+    Output.Position.y *= -1.0f;
+
+    return Output;
+}
+
+// ================================================================
+// Pixel Shader
+// - ClearRenderTargetView에서 사용하던 값과 동일한 1.0으로 채웁니다.
+// ================================================================
+float4 mainPS(PS_INPUT Input) : SV_TARGET
+{
+    return float4(1.0f, 1.0f, 1.0f, 1.0f);
+}
@@ -15,13 +15,11 @@
 static const float PI = 3.14159265358979323846f;
 
 #define ATLASSIZE 8192.0f
-#define ATLASTILECOUNT 8.0f
-#define ATLASGRIDSIZE 1.0f / ATLASTILECOUNT
+// Atlas 타일 위치는 ShadowMapPass의 Atlas Packer가 texel 단위로 기록한다
+#define ATLASGRIDSIZE (1.0f / ATLASSIZE)
 
 #define GET_TILE_SIZE(resolution) (1.0f / (ATLASSIZE / resolution))
 
-#define MAX_POINT_LIGHT_NUM 8
-#define MAX_SPOTLIGHT_NUM 8
 
 // reflectance와 곱해지기 전
 // 표면에 도달한 빛의 조명 기여량
@@ -33,10 +31,26 @@ struct FIllumination
 };
 
 // Constant Buffers
+#if INSTANCED
+// 인스턴싱: 같은 메시/머티리얼을 공유하는 컴포넌트들의 World 행렬을 한 번의 Draw로 처리
+struct FInstanceData
+{
+    row_major float4x4 World;
+};
+
+StructuredBuffer<FInstanceData> InstanceDatas : register(t15);
+
+cbuffer InstanceOffset : register(b0)
+{
+    uint InstanceBaseIndex; // 이 Draw가 사용하는 InstanceDatas의 시작 위치 (SV_InstanceID는 0부터 시작)
+    uint3 InstancePadding;
+}
+#else
 cbuffer Model : register(b0)
 {
     row_major float4x4 World;
 }
+#endif
 
 cbuffer Camera : register(b1)
 {
@@ -184,6 +198,21 @@ StructuredBuffer<FShadowAtlasTilePos> ShadowAtlasDirectionalLightTilePos : regis
 StructuredBuffer<FShadowAtlasTilePos> ShadowAtlasSpotLightTilePos : register(t13);
 StructuredBuffer<FShadowAtlasPointLightTilePos> ShadowAtlasPointLightTilePos : register(t14);
 
+// Tile 위치 버퍼는 라이트 개수에 맞춰 커지므로, 버퍼 길이를 넘는 인덱스는 그림자 없이 처리한다
+bool HasSpotLightAtlasTile(uint LightIndex)
+{
+    uint Count, Stride;
+    ShadowAtlasSpotLightTilePos.GetDimensions(Count, Stride);
+    return LightIndex < Count;
+}
+
+bool HasPointLightAtlasTile(uint LightIndex)
+{
+    uint Count, Stride;
+    ShadowAtlasPointLightTilePos.GetDimensions(Count, Stride);
+    return LightIndex < Count;
+}
+
 SamplerState SamplerWrap : register(s0);
 SamplerComparisonState ShadowSampler : register(s1);
 SamplerState VarianceShadowSampler : register(s2);
@@ -205,6 +234,9 @@ struct VS_INPUT
     float4 Color : COLOR;
     float2 Tex : TEXCOORD0;
     float4 Tangent : TANGENT;
+#if INSTANCED
+    uint InstanceID : SV_InstanceID;
+#endif
 };
 
 struct PS_INPUT
@@ -465,7 +497,7 @@ float CalculateSpotPCFFactor(
 )
 {
     // --- 1. 유효성 검사 ---
-    if (LightInfo.CastShadow == 0 || LightIndex >= MAX_SPOTLIGHT_NUM)
+    if (LightInfo.CastShadow == 0 || !HasSpotLightAtlasTile(LightIndex))
     {
         return 1.0f;
     }
@@ -624,8 +656,8 @@ float CalculatePointPCFFactor(
     if (Light.CastShadow == 0)
         return 1.0f;
 
-    // Light의 개수가 규정된 상한을 초과하면 그림자 계산 스킵
-    if (LightIndex >= MAX_POINT_LIGHT_NUM)
+    // Tile 위치 버퍼 범위를 벗어나면 그림자 계산 스킵
+    if (!HasPointLightAtlasTile(LightIndex))
         return 1.0f;
 
     // Calculate direction from light to pixel (for cube map sampling)
@@ -823,7 +855,7 @@ float CalculateSpotVSMFactor(
 )
 {
     // --- 1. 기본 유효성 검사 ---
-    if (LightInfo.CastShadow == 0 || LightIndex >= MAX_SPOTLIGHT_NUM)
+    if (LightInfo.CastShadow == 0 || !HasSpotLightAtlasTile(LightIndex))
     {
         return 1.0f;
     }
@@ -870,7 +902,7 @@ float CalculatePointVSMFactor(
 )
 {
     // --- 1. 기본 유효성 검사 ---
-    if (LightInfo.CastShadow == 0 || LightIndex >= MAX_POINT_LIGHT_NUM)
+    if (LightInfo.CastShadow == 0 || !HasPointLightAtlasTile(LightIndex))
     {
         return 1.0f;
     }
@@ -1081,7 +1113,7 @@ float CalculateSpotSAVSMFactor(
 )
 {
     // --- 1. 기본 유효성 검사 ---
-    if (LightInfo.CastShadow == 0 || LightIndex >= MAX_SPOTLIGHT_NUM)
+    if (LightInfo.CastShadow == 0 || !HasSpotLightAtlasTile(LightIndex))
     {
         return 1.0f;
     }
@@ -1359,6 +1391,10 @@ float3 ComputeNormalMappedWorldNormal(float2 UV, float3 WorldNormal, float4 Worl
 PS_INPUT Uber_VS(VS_INPUT Input)
 {
     PS_INPUT Output;
+
+#if INSTANCED
+    float4x4 World = InstanceDatas[InstanceBaseIndex + Input.InstanceID].World;
+#endif
     
     Output.WorldPosition = mul(float4(Input.Position, 1.0f), World).xyz;
     Output.Position = mul(mul(mul(float4(Input.Position, 1.0f), World), View), Projection);
@@ -0,0 +1,29 @@
+#include "pch.h"
+
+namespace
+{
+	std::atomic<bool> bIsStdoutEnabled = false;
+}
+
+void UConsoleWindow::WriteLog(ELogType InType, const char* InStdoutPrefix, const char* InMessage)
+{
+	// 에러는 출력이 꺼져 있어도 stderr로 남겨 벤치마크 결과(stdout)와 섞이지 않게 함
+	if (InType == ELogType::Error)
+	{
+		fprintf(stderr, "%s%s\n", InStdoutPrefix, InMessage);
+	}
+	else if (bIsStdoutEnabled.load(std::memory_order_relaxed))
+	{
+		printf("%s%s\n", InStdoutPrefix, InMessage);
+	}
+}
+
+void UConsoleWindow::SetStdoutEnabled(bool bInEnabled)
+{
+	bIsStdoutEnabled.store(bInEnabled, std::memory_order_relaxed);
+}
+
+bool UConsoleWindow::IsStdoutEnabled()
+{
+	return bIsStdoutEnabled.load(std::memory_order_relaxed);
+}
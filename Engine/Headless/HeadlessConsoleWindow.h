@@ -0,0 +1,16 @@
+#pragma once
+
+/**
+ * @brief 헤드리스 빌드의 콘솔 윈도우
+ * UE_LOG 계열 매크로가 호출하는 WriteLog만 제공하며, ImGui 콘솔 없이 stdout으로만 출력합니다.
+ * 도구의 결과(stdout)에 정적 초기화 중의 클래스 등록 로그가 섞이지 않도록 기본으로 꺼져 있으며,
+ * 로그가 필요하면 SetStdoutEnabled(true)로 켭니다. (Error는 항상 stderr로 출력)
+ */
+class UConsoleWindow
+{
+public:
+	static void WriteLog(ELogType InType, const char* InStdoutPrefix, const char* InMessage);
+
+	static void SetStdoutEnabled(bool bInEnabled);
+	static bool IsStdoutEnabled();
+};
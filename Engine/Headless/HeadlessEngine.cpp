@@ -0,0 +1,5 @@
+#include "pch.h"
+
+// 헤드리스 빌드에는 UEditorEngine이 없으므로, 전역 포인터만 정의하고 월드는 호스트(벤치마크 등)가 GWorld에 직접 설정
+UEditorEngine* GEditor = nullptr;
+UWorld* GWorld = nullptr;
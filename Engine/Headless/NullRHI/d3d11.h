@@ -0,0 +1,50 @@
+#pragma once
+#include "Platform/Public/Platform.h"
+
+/**
+ * @brief 헤드리스 빌드에서 D3D11 타입을 대신하는 Null RHI 선언
+ * 코어 헤더가 멤버로 들고 있는 리소스 포인터(ID3D11Buffer* 등)가 컴파일되도록 인터페이스 이름만 선언합니다.
+ * 헤드리스 빌드는 WITH_RENDERER가 0이므로 D3D 호출은 없고, 이 포인터들은 항상 nullptr입니다.
+ */
+struct IUnknown
+{
+	virtual ~IUnknown() = default;
+	virtual ULONG AddRef() { return 1; }
+	virtual ULONG Release() { return 0; }
+};
+
+struct ID3D11Resource : IUnknown {};
+struct ID3D11Buffer : ID3D11Resource {};
+struct ID3D11Texture2D : ID3D11Resource {};
+struct ID3D11View : IUnknown {};
+struct ID3D11ShaderResourceView : ID3D11View {};
+struct ID3D11UnorderedAccessView : ID3D11View {};
+struct ID3D11RenderTargetView : ID3D11View {};
+struct ID3D11DepthStencilView : ID3D11View {};
+struct ID3D11SamplerState : IUnknown {};
+struct ID3D11ComputeShader : IUnknown {};
+struct ID3D11VertexShader : IUnknown {};
+struct ID3D11PixelShader : IUnknown {};
+struct ID3D11InputLayout : IUnknown {};
+struct ID3D11Device : IUnknown {};
+struct ID3D11DeviceContext : IUnknown {};
+
+enum D3D11_PRIMITIVE_TOPOLOGY
+{
+	D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+	D3D11_PRIMITIVE_TOPOLOGY_POINTLIST = 1,
+	D3D11_PRIMITIVE_TOPOLOGY_LINELIST = 2,
+	D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP = 3,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5
+};
+
+struct D3D11_VIEWPORT
+{
+	FLOAT TopLeftX;
+	FLOAT TopLeftY;
+	FLOAT Width;
+	FLOAT Height;
+	FLOAT MinDepth;
+	FLOAT MaxDepth;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+namespace Microsoft::WRL
+{
+	/**
+	 * @brief 참조 계수만 관리하는 최소한의 ComPtr
+	 */
+	template<typename T>
+	class ComPtr
+	{
+	public:
+		ComPtr() = default;
+		ComPtr(std::nullptr_t) {}
+		ComPtr(T* InPointer) : Pointer(InPointer) { if (Pointer) { Pointer->AddRef(); } }
+		ComPtr(const ComPtr& InOther) : ComPtr(InOther.Pointer) {}
+		ComPtr(ComPtr&& InOther) noexcept : Pointer(std::exchange(InOther.Pointer, nullptr)) {}
+		~ComPtr() { Reset(); }
+
+		ComPtr& operator=(ComPtr InOther) noexcept { std::swap(Pointer, InOther.Pointer); return *this; }
+
+		T* Get() const { return Pointer; }
+		T* operator->() const { return Pointer; }
+		T** GetAddressOf() { return &Pointer; }
+		T** ReleaseAndGetAddressOf() { Reset(); return &Pointer; }
+		explicit operator bool() const { return Pointer != nullptr; }
+
+		void Reset()
+		{
+			if (Pointer)
+			{
+				std::exchange(Pointer, nullptr)->Release();
+			}
+		}
+
+	private:
+		T* Pointer = nullptr;
+	};
+}
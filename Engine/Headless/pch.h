@@ -0,0 +1,85 @@
+#pragma once
+
+// 헤드리스(FutureEngineCore) 빌드용 미리 컴파일된 헤더
+// Engine/pch.h에서 Windows, D3D, Direct2D, ImGui와 에디터 UI 헤더를 빼고, 대신 Null RHI 타입과 헤드리스 콘솔을 포함
+
+#include "Platform/Public/Platform.h"
+
+// Null RHI (NullRHI/ 아래의 d3d11.h, wrl/client.h)
+#include <wrl/client.h>
+#include <d3d11.h>
+
+// Standard Library
+#include <cmath>
+#include <cassert>
+#include <cfloat>
+#include <cstdlib>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <functional>
+#include <filesystem>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <xmmintrin.h>
+
+// Global Included
+#include "Source/Global/Types.h"
+#include "Source/Global/Memory.h"
+#include "Source/Global/FrameArena.h"
+#include "Source/Global/Constant.h"
+#include "Source/Global/Enum.h"
+#include "Source/Global/Matrix.h"
+#include "Source/Global/Vector.h"
+#include "Source/Global/Quaternion.h"
+#include "Source/Global/Rotator.h"
+#include "Source/Global/CoreTypes.h"
+#include "Source/Global/Macro.h"
+#include "Source/Global/Function.h"
+#include "Source/Global/Color.h"
+#include "Source/Utility/Public/ScopeCycleCounter.h"
+#include "Source/Utility/Public/StructuredLog.h"
+#include "Source/Utility/Public/LogFormat.h"
+#include "Source/Editor/Public/EditorEngine.h"
+#include "Global/Delegate.h"
+#include "Global/WeakObjectPtr.h"
+#include "Source/Global/Octree.h"
+
+using std::clamp;
+using std::unordered_map;
+using std::to_string;
+using std::function;
+using std::wstring;
+using std::cout;
+using std::cerr;
+using std::min;
+using std::max;
+using std::exception;
+using std::stoul;
+using std::ofstream;
+using std::ifstream;
+using std::setw;
+using std::sort;
+using std::shared_ptr;
+using std::unique_ptr;
+using std::streamsize;
+using Microsoft::WRL::ComPtr;
+
+// File System
+namespace filesystem = std::filesystem;
+using filesystem::path;
+using filesystem::exists;
+using filesystem::create_directories;
+
+// Engine/pch.h에서는 ConsoleWindow.h(UIWindow.h)를 통해 포함되던 헤더
+#include "Source/Actor/Public/Actor.h"
+#include "HeadlessConsoleWindow.h"
+
+// DT Include
+#include "Source/Manager/Time/Public/TimeManager.h"
@@ -7,10 +7,14 @@
 #include "Component/Public/SceneComponent.h"
 #include "Component/Public/UUIDTextComponent.h"
 #include "Component/Public/ULuaScriptComponent.h"
+#if WITH_EDITOR
 #include "Editor/Public/Editor.h"
+#endif
 #include "Level/Public/Level.h"
 #include "Manager/Asset/Public/AssetManager.h"
+#if WITH_LUA
 #include "Manager/Lua/Public/LuaScriptManager.h"
+#endif
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_CLASS(AActor, UObject)
@@ -167,14 +171,14 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         for (UActorComponent* Component : OwnedComponents) 
         {
         	JSON ComponentJson;
-        	ComponentJson["Type"] = Component->GetClass()->GetName().ToString();
-        	ComponentJson["Name"] = Component->GetName().ToString();
+        	// JSON이 문자열을 한 번만 복사하도록 캐시된 이름을 그대로 넘긴다
+        	ComponentJson["Type"] = Component->GetClass()->GetName().ToStringView().data();
+        	ComponentJson["Name"] = Component->GetName().ToStringView().data();
 
 	        if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
         	{
         		USceneComponent* Parent = SceneComponent->GetAttachParent();
-        		FString ParentName = Parent ? Parent->GetName().ToString() : "";
-        		ComponentJson["ParentName"] = ParentName;
+        		ComponentJson["ParentName"] = Parent ? Parent->GetName().ToStringView().data() : "";
         	}
 
         	Component->Serialize(bInIsLoading, ComponentJson);
@@ -256,19 +260,19 @@ bool AActor::IsUniformScale() const
 	return false;
 }
 
-const FVector& AActor::GetActorLocation() const
+FVector AActor::GetActorLocation() const
 {
 	assert(RootComponent);
 	return RootComponent->GetRelativeLocation();
 }
 
-const FQuaternion& AActor::GetActorRotation() const
+FQuaternion AActor::GetActorRotation() const
 {
 	assert(RootComponent);
 	return RootComponent->GetRelativeRotation();
 }
 
-const FVector& AActor::GetActorScale3D() const
+FVector AActor::GetActorScale3D() const
 {
 	assert(RootComponent);
 	return RootComponent->GetRelativeScale3D();
@@ -374,10 +378,12 @@ bool AActor::RemoveComponent(UActorComponent* InComponentToDelete, bool bShouldD
         }
     }
 
+#if WITH_EDITOR
 	if (GEditor->GetEditorModule()->GetSelectedComponent() == InComponentToDelete)
 	{
 		GEditor->GetEditorModule()->SelectComponent(nullptr);
 	}
+#endif
 	OwnedComponents.erase(It); 
     SafeDelete(InComponentToDelete); 
     return true;
@@ -609,6 +615,7 @@ bool AActor::BindSelfLuaProperties()
 		return false;
 	}
 
+#if WITH_LUA
 	sol::table& LuaTable = LuaScriptComponent->GetLuaSelfTable();
 
 	if (!LuaTable.valid())
@@ -621,6 +628,9 @@ bool AActor::BindSelfLuaProperties()
 	LuaTable["Name"] = GetName().ToString();
 
 	return true;
+#else
+	return false;
+#endif
 }
 
 void AActor::PrintLocation() const
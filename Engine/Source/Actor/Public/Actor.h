@@ -43,9 +43,9 @@ public:
 
 	void SetRootComponent(USceneComponent* InOwnedComponents) { RootComponent = InOwnedComponents; }
 
-	const FVector& GetActorLocation() const;
-	const FQuaternion& GetActorRotation() const;
-	const FVector& GetActorScale3D() const;
+	FVector GetActorLocation() const;
+	FQuaternion GetActorRotation() const;
+	FVector GetActorScale3D() const;
 
 	template<class T>
 	T* CreateDefaultSubobject(const FName& InName = FName::None)
@@ -1,7 +1,9 @@
 #include "pch.h"
 #include "Component/Collision/Public/BoxComponent.h"
 #include "Utility/Public/JsonSerializer.h"
+#if WITH_EDITOR
 #include "Render/UI/Widget/Collision/Public/BoxComponentWidget.h"
+#endif
 
 IMPLEMENT_CLASS(UBoxComponent, UShapeComponent)
 
@@ -55,7 +57,11 @@ UObject* UBoxComponent::Duplicate()
 }
 UClass* UBoxComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
     return UBoxComponentWidget::StaticClass();
+#else
+    return nullptr;
+#endif
 }
 void UBoxComponent::DuplicateSubObjects(UObject* DuplicatedObject)
 {
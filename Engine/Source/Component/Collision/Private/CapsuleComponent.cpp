@@ -1,7 +1,9 @@
 #include "pch.h"
 #include "Component/Collision/Public/CapsuleComponent.h"
 #include "Utility/Public/JsonSerializer.h"
+#if WITH_EDITOR
 #include "Render/UI/Widget/Collision/Public/CapsuleComponentWidget.h"
+#endif
 IMPLEMENT_CLASS(UCapsuleComponent, UShapeComponent)
 
 static void UpdateCapsuleAABB(IBoundingVolume*& InOutVolume, bool& InOutOwns, float InHalfHeight, float InRadius)
@@ -51,7 +53,7 @@ FVector UCapsuleComponent::GetUpVector() const
         return FVector(0.0f, 0.0f, 1.0f);
     }
 
-    const FMatrix& WorldMatrix = this->GetWorldTransformMatrix();
+    const FMatrix WorldMatrix = this->GetWorldTransformMatrix();
 
     // 행벡터 시스템: 각 ROW가 basis vector
     // Row 2 = Z축 (Up Vector)
@@ -100,7 +102,11 @@ UObject* UCapsuleComponent::Duplicate()
 }
 UClass* UCapsuleComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
     return UCapsuleComponentWidget::StaticClass();
+#else
+    return nullptr;
+#endif
 }
 
 void UCapsuleComponent::DuplicateSubObjects(UObject* DuplicatedObject)
@@ -1,7 +1,9 @@
 #include "pch.h"
 #include "Component/Collision/Public/SphereComponent.h"
 #include "Utility/Public/JsonSerializer.h"
+#if WITH_EDITOR
 #include "Render/UI/Widget/Collision/Public/SphereComponentWidget.h"
+#endif
 IMPLEMENT_CLASS(USphereComponent, UShapeComponent)
 
 USphereComponent::USphereComponent()
@@ -56,7 +58,11 @@ UObject* USphereComponent::Duplicate()
 }
 UClass* USphereComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
     return USphereComponentWidget::StaticClass();
+#else
+    return nullptr;
+#endif
 }
 void USphereComponent::DuplicateSubObjects(UObject* DuplicatedObject)
 {
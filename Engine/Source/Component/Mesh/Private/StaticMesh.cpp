@@ -20,7 +20,7 @@ UStaticMesh::~UStaticMesh()
 	for (UMaterial* Material : Materials)
 	{
 		// Skip deletion of shared DefaultMaterial to prevent dangling pointer
-		if (Material && Material->GetName().ToString() != "DefaultMaterial")
+		if (Material && Material->GetName().ToStringView() != "DefaultMaterial")
 		{
 			SafeDelete(Material);
 		}
@@ -5,7 +5,9 @@
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/AABB.h"
+#if WITH_EDITOR
 #include "Render/UI/Widget/Public/StaticMeshComponentWidget.h"
+#endif
 #include "Utility/Public/JsonSerializer.h"
 #include "Texture/Public/Texture.h"
 
@@ -91,7 +93,11 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 UClass* UStaticMeshComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
 	return UStaticMeshComponentWidget::StaticClass();
+#else
+	return nullptr;
+#endif
 }
 
 void UStaticMeshComponent::SetStaticMesh(const FName& InObjPath)
@@ -1,7 +1,9 @@
 #include "pch.h"
 #include "Component/Public/AmbientLightComponent.h"
 
+#if WITH_EDITOR
 #include "Render/UI/Widget/Public/AmbientLightComponentWidget.h"
+#endif
 
 IMPLEMENT_CLASS(UAmbientLightComponent, ULightComponent)
 
@@ -19,7 +21,11 @@ UObject* UAmbientLightComponent::Duplicate()
 
 UClass* UAmbientLightComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
 	return UAmbientLightComponentWidget::StaticClass();
+#else
+	return nullptr;
+#endif
 }
 
 void UAmbientLightComponent::EnsureVisualizationIcon()
@@ -1,10 +1,16 @@
 #include "pch.h"
 #include "Component/Public/BillBoardComponent.h"
 #include "Manager/Asset/Public/AssetManager.h"
+#if WITH_RENDERER
 #include "Render/Renderer/Public/Renderer.h"
+#endif
 #include "Physics/Public/AABB.h"
+#if WITH_RENDERER
 #include "Render/Renderer/Public/RenderResourceFactory.h"
+#endif
+#if WITH_EDITOR
 #include "Render/UI/Widget/Public/SpriteSelectionWidget.h"
+#endif
 #include "Texture/Public/Texture.h"
 #include "Utility/Public/JsonSerializer.h"
 
@@ -111,7 +117,11 @@ void UBillBoardComponent::SetSpriteTint(const FVector& InTint, float Alpha)
 
 UClass* UBillBoardComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
     return USpriteSelectionWidget::StaticClass();
+#else
+    return nullptr;
+#endif
 }
 
 const FRenderState& UBillBoardComponent::GetClassDefaultRenderState()
@@ -6,7 +6,9 @@
 #include "Level/Public/Level.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/OBB.h"
+#if WITH_EDITOR
 #include "Render/UI/Widget/Public/DecalTextureSelectionWidget.h"
+#endif
 #include "Texture/Public/Texture.h"
 #include "Utility/Public/JsonSerializer.h"
 
@@ -124,7 +126,11 @@ void UDecalComponent::SetFadeTexture(UTexture* InFadeTexture)
 
 UClass* UDecalComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
     return UDecalTextureSelectionWidget::StaticClass();
+#else
+    return nullptr;
+#endif
 }
 
 UObject* UDecalComponent::Duplicate()
@@ -1,9 +1,13 @@
 #include "pch.h"
 #include "Component/Public/DirectionalLightComponent.h"
 
+#if WITH_EDITOR
 #include "Render/UI/Widget/Public/DirectionalLightComponentWidget.h"
+#endif
 #include "Utility/Public/JsonSerializer.h"
+#if WITH_RENDERER
 #include "Render/Renderer/Public/Renderer.h"
+#endif
 #include "Editor/Public/Camera.h"
 #include "Editor/Public/EditorPrimitive.h"
 #include "Component/Public/ActorComponent.h"
@@ -115,7 +119,11 @@ UObject* UDirectionalLightComponent::Duplicate()
 
 UClass* UDirectionalLightComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
     return UDirectionalLightComponentWidget::StaticClass();
+#else
+    return nullptr;
+#endif
 }
 
 FVector UDirectionalLightComponent::GetForwardVector() const
@@ -141,11 +149,13 @@ void UDirectionalLightComponent::RenderLightDirectionGizmo(UCamera* InCamera, co
     LightDirectionArrow.Rotation = LightRotation;
     LightDirectionArrow.Scale = FVector(FixedScale, FixedScale, FixedScale);
 
+#if WITH_RENDERER
     FRenderState RenderState;
     RenderState.FillMode = EFillMode::Solid;
     RenderState.CullMode = ECullMode::None;
 
     URenderer::GetInstance().RenderEditorPrimitive(LightDirectionArrow, RenderState);
+#endif
 }
 
 FDirectionalLightInfo UDirectionalLightComponent::GetDirectionalLightInfo() const
@@ -158,12 +168,12 @@ FDirectionalLightInfo UDirectionalLightComponent::GetDirectionalLightInfo() cons
 
     // Shadow parameters
     // Info.LightViewProjection = CachedShadowViewProjection; // Updated by ShadowMapPass
-    Info.CastShadow = GetCastShadows() ? 1u : 0u;
+    Info.CastShadow = (GetCastShadows() && GetShadowAtlasResolution() > 0.0f) ? 1u : 0u;
     Info.ShadowModeIndex = static_cast<uint32>(GetShadowModeIndex());
     Info.ShadowBias = GetShadowBias();
     Info.ShadowSlopeBias = GetShadowSlopeBias();
     Info.ShadowSharpen = GetShadowSharpen();
-    Info.Resolution = GetShadowResolutionScale();
+    Info.Resolution = GetShadowAtlasResolution();
 
     return Info;
 }
@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "Component/Public/HeightFogComponent.h"
+#if WITH_EDITOR
 #include "Render/UI/Widget/Public/HeightFogComponentWidget.h"
+#endif
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_CLASS(UHeightFogComponent, USceneComponent)
@@ -47,7 +49,11 @@ void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 UClass* UHeightFogComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
 	return UHeightFogComponentWidget::StaticClass();
+#else
+	return nullptr;
+#endif
 }
 
 UObject* UHeightFogComponent::Duplicate()
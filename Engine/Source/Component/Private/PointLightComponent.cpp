@@ -1,7 +1,9 @@
 ﻿#include "pch.h"
 #include "Component/Public/PointLightComponent.h"
 
+#if WITH_EDITOR
 #include "Render/UI/Widget/Public/PointLightComponentWidget.h"
+#endif
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_CLASS(UPointLightComponent, ULightComponent)
@@ -33,7 +35,11 @@ UObject* UPointLightComponent::Duplicate()
 
 UClass* UPointLightComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
     return UPointLightComponentWidget::StaticClass();
+#else
+    return nullptr;
+#endif
 }
 
 void UPointLightComponent::EnsureVisualizationIcon()
@@ -82,12 +88,12 @@ FPointLightInfo UPointLightComponent::GetPointlightInfo() const
 	Info.DistanceFalloffExponent = DistanceFalloffExponent;
 
 	// Shadow parameters
-	Info.CastShadow = GetCastShadows() ? 1u : 0u;
+	Info.CastShadow = (GetCastShadows() && GetShadowAtlasResolution() > 0.0f) ? 1u : 0u;
 	Info.ShadowModeIndex = static_cast<uint32>(GetShadowModeIndex());
 	Info.ShadowBias = GetShadowBias();
 	Info.ShadowSlopeBias = GetShadowSlopeBias();
 	Info.ShadowSharpen = GetShadowSharpen();
-	Info.Resolution = GetShadowResolutionScale();
+	Info.Resolution = GetShadowAtlasResolution();
 
 	return Info;
 }
@@ -7,6 +7,7 @@
 #include "Utility/Public/JsonSerializer.h"
 #include "Actor/Public/Actor.h"
 #include "Core/Public/Object.h"
+#include "Core/Public/ObjectIterator.h"
 #include "Level/Public/Level.h"
 #include "Component/Collision/Public/ShapeComponent.h"
 #include "Component/Collision/Public/BoxComponent.h"
@@ -104,36 +105,17 @@ void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax)
 		return;
 	}
 
-	if (bIsAABBCacheDirty)
+	// 부모의 이동은 이 컴포넌트의 MarkAsDirty를 거치지 않으므로 World 행렬 버전으로도 확인
+	const uint32 TransformVersion = GetWorldTransformVersion();
+	if (bIsAABBCacheDirty || CachedAABBTransformVersion != TransformVersion)
 	{
 		if (BoundingBox->GetType() == EBoundingVolumeType::AABB)
 		{
 			const FAABB* LocalAABB = static_cast<const FAABB*>(BoundingBox);
-			FVector LocalCorners[8] =
-			{
-				FVector(LocalAABB->Min.X, LocalAABB->Min.Y, LocalAABB->Min.Z), FVector(LocalAABB->Max.X, LocalAABB->Min.Y, LocalAABB->Min.Z),
-				FVector(LocalAABB->Min.X, LocalAABB->Max.Y, LocalAABB->Min.Z), FVector(LocalAABB->Max.X, LocalAABB->Max.Y, LocalAABB->Min.Z),
-				FVector(LocalAABB->Min.X, LocalAABB->Min.Y, LocalAABB->Max.Z), FVector(LocalAABB->Max.X, LocalAABB->Min.Y, LocalAABB->Max.Z),
-				FVector(LocalAABB->Min.X, LocalAABB->Max.Y, LocalAABB->Max.Z), FVector(LocalAABB->Max.X, LocalAABB->Max.Y, LocalAABB->Max.Z)
-			};
-
-			const FMatrix& WorldTransform = GetWorldTransformMatrix();
-			FVector WorldMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
-			FVector WorldMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-			for (int32 Idx = 0; Idx < 8; Idx++)
-			{
-				FVector4 WorldCorner = FVector4(LocalCorners[Idx].X, LocalCorners[Idx].Y, LocalCorners[Idx].Z, 1.0f) * WorldTransform;
-				WorldMin.X = min(WorldMin.X, WorldCorner.X);
-				WorldMin.Y = min(WorldMin.Y, WorldCorner.Y);
-				WorldMin.Z = min(WorldMin.Z, WorldCorner.Z);
-				WorldMax.X = max(WorldMax.X, WorldCorner.X);
-				WorldMax.Y = max(WorldMax.Y, WorldCorner.Y);
-				WorldMax.Z = max(WorldMax.Z, WorldCorner.Z);
-			}
+			const FAABB WorldAABB = LocalAABB->TransformBy(GetWorldTransformMatrix());
 
-			CachedWorldMin = WorldMin;
-			CachedWorldMax = WorldMax;
+			CachedWorldMin = WorldAABB.Min;
+			CachedWorldMax = WorldAABB.Max;
 		}
 		else if (BoundingBox->GetType() == EBoundingVolumeType::OBB ||
 			BoundingBox->GetType() == EBoundingVolumeType::SpotLight)
@@ -146,6 +128,7 @@ void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax)
 		}
 
 		bIsAABBCacheDirty = false;
+		CachedAABBTransformVersion = TransformVersion;
 	}
 
 	// 캐시된 값 반환
@@ -267,11 +250,10 @@ bool UPrimitiveComponent::IsOverlappingActor(const AActor* Other) const
 		return false;
 	}
 
-	// 전역 UObject 배열을 순회해 Other 액터의 프리미티브 컴포넌트만 골라서 판정
-	const TArray<UObject*>& Objects = GetUObjectArray();
-	for (UObject* Obj : Objects)
+	// 프리미티브 컴포넌트 클래스 리스트만 순회해 Other 액터의 컴포넌트를 골라서 판정
+	for (TObjectIterator<UPrimitiveComponent> It; It; ++It)
 	{
-		if (UPrimitiveComponent* OtherPrim = Cast<UPrimitiveComponent>(Obj))
+		if (UPrimitiveComponent* OtherPrim = *It)
 		{
 			if (OtherPrim == nullptr || OtherPrim == this)
 			{
@@ -310,7 +292,7 @@ void UPrimitiveComponent::UpdateOverlaps()
 		return;  // Owner가 없으면 충돌 검사 불가
 	}
 	// ========== 디버깅 로그 추가 ==========
-	//UE_LOG("UpdateOverlaps: Owner = %s", ThisOwner->GetName().ToString().c_str());
+	//UE_LOG("UpdateOverlaps: Owner = %s", ThisOwner->GetName().ToStringView().data());
 	// ========== 1차 충돌 검사: 옥트리 (Broad Phase) ==========
 
 	// Actor의 Outer는 Level이다
@@ -320,7 +302,7 @@ void UPrimitiveComponent::UpdateOverlaps()
 		UE_LOG("UpdateOverlaps: Level or Octree is nullptr!");
 		return;  // 옥트리가 없으면 검사 불가
 	}
-	//UE_LOG("UpdateOverlaps: Level = %s, Octree exists", Level->GetName().ToString().c_str());
+	//UE_LOG("UpdateOverlaps: Level = %s, Octree exists", Level->GetName().ToStringView().data());
 	FOctree* Octree = Level->GetStaticOctree();
 
 	// 이 컴포넌트의 AABB
@@ -329,84 +311,94 @@ void UPrimitiveComponent::UpdateOverlaps()
 	FAABB ThisAABB(ThisMin, ThisMax);
 
 	// 옥트리에서 AABB 겹치는 후보군 추출
-	TArray<UPrimitiveComponent*> Candidates;
-	Octree->QueryOverlap(ThisAABB, Candidates);
-	//UE_LOG("UpdateOverlaps: Octree candidates = %d", Candidates.size());
-	// 동적 오브젝트도 포함 (옥트리에 없는 움직이는 오브젝트들)
-	const TArray<UPrimitiveComponent*>& DynamicPrimitives = Level->GetDynamicPrimitives();
-	//UE_LOG("UpdateOverlaps: Dynamic primitives = %d", DynamicPrimitives.size());
-	for (UPrimitiveComponent* DynamicPrim : DynamicPrimitives)
+	// 컴포넌트마다 호출되므로 후보 배열은 Frame arena에 두고, 검사가 끝나면 되돌려 다음 컴포넌트가 같은 메모리를 쓴다
+	// 델리게이트 핸들러(Lua 포함)가 Frame arena에 할당한 메모리가 함께 되돌려지지 않도록, 이벤트는 이 범위를 벗어난 뒤 호출한다
 	{
-		if (DynamicPrim && DynamicPrim != this)
+		FFrameArenaMark ArenaMark;
+		TFrameArray<UPrimitiveComponent*> Candidates;
+		Octree->QueryOverlap(ThisAABB, Candidates);
+		//UE_LOG("UpdateOverlaps: Octree candidates = %d", Candidates.size());
+		// 동적 오브젝트도 포함 (옥트리에 없는 움직이는 오브젝트들)
+		const TArray<UPrimitiveComponent*>& DynamicPrimitives = Level->GetDynamicPrimitives();
+		//UE_LOG("UpdateOverlaps: Dynamic primitives = %d", DynamicPrimitives.size());
+		for (UPrimitiveComponent* DynamicPrim : DynamicPrimitives)
 		{
-			Candidates.push_back(DynamicPrim);
+			if (DynamicPrim && DynamicPrim != this)
+			{
+				Candidates.push_back(DynamicPrim);
+			}
 		}
-	}
-
-	//UE_LOG("UpdateOverlaps: Total candidates = %d", Candidates.size());
-	// ========== 2차 충돌 검사: Narrow Phase ==========
 
-	// ShapeComponent인지 확인 (Shape가 아니면 정밀 검사 불가)
-	UShapeComponent* ThisShape = Cast<UShapeComponent>(this);
-	if (!ThisShape)
-	{
-		return;  // Shape가 아니면 Narrow Phase 불가
-	}
+		//UE_LOG("UpdateOverlaps: Total candidates = %d", Candidates.size());
+		// ========== 2차 충돌 검사: Narrow Phase ==========
 
-	for (UPrimitiveComponent* Candidate : Candidates)
-	{
-		// 자기 자신 제외
-		if (Candidate == this)
+		// ShapeComponent인지 확인 (Shape가 아니면 정밀 검사 불가)
+		UShapeComponent* ThisShape = Cast<UShapeComponent>(this);
+		if (!ThisShape)
 		{
-			continue;
+			return;  // Shape가 아니면 Narrow Phase 불가
 		}
 
-		// Owner가 없는 컴포넌트 제외
-		if (!Candidate->GetOwner())
+		for (UPrimitiveComponent* Candidate : Candidates)
 		{
-			continue;
-		}
+			// 자기 자신 제외
+			if (Candidate == this)
+			{
+				continue;
+			}
 
-		// 같은 Actor 내부 컴포넌트끼리 제외 (필요 시 제거 가능)
-		if (ThisOwner && Candidate->GetOwner() == ThisOwner)
-		{
-			continue;
-		}
+			// Owner가 없는 컴포넌트 제외
+			if (!Candidate->GetOwner())
+			{
+				continue;
+			}
 
-		// 상대도 ShapeComponent여야 정밀 검사 가능
-		UShapeComponent* OtherShape = Cast<UShapeComponent>(Candidate);
-		if (!OtherShape)
-		{
-			continue;
-		}
+			// 같은 Actor 내부 컴포넌트끼리 제외 (필요 시 제거 가능)
+			if (ThisOwner && Candidate->GetOwner() == ThisOwner)
+			{
+				continue;
+			}
 
-		// Narrow Phase 충돌 검사
-		if (CollisionUtil::TestOverlap(ThisShape, OtherShape))
-		{
-			FOverlapInfo Info;
-			Info.OtherComponent = Candidate;
-			Info.OtherActor = Candidate->GetOwner();
-			OverlapInfos.push_back(Info);
+			// 상대도 ShapeComponent여야 정밀 검사 가능
+			UShapeComponent* OtherShape = Cast<UShapeComponent>(Candidate);
+			if (!OtherShape)
+			{
+				continue;
+			}
 
-			// ========== Hit 이벤트 처리 (블로킹 충돌) ==========
-			if (bGenerateHitEvents && bBlockComponent && Candidate->bBlockComponent)
+			// Narrow Phase 충돌 검사
+			if (CollisionUtil::TestOverlap(ThisShape, OtherShape))
 			{
-				// Hit 이벤트 발생 (양쪽이 모두 Block일 때)
-				FHitResult HitResult;
-				HitResult.Component = Candidate;
-				HitResult.Actor = Candidate->GetOwner();
-				HitResult.ImpactPoint = (GetWorldLocation() + Candidate->GetWorldLocation()) * 0.5f;
-				HitResult.ImpactNormal = (GetWorldLocation() - Candidate->GetWorldLocation()).GetNormalized();
-				HitResult.Distance = FVector::Dist(GetWorldLocation(), Candidate->GetWorldLocation());
-
-				FVector NormalImpulse = FVector::ZeroVector();  // 물리 엔진 연동 시 계산
-				//OnComponentHit.BroadCast(this, Candidate->GetOwner(), Candidate, NormalImpulse, HitResult);
-				// TODO(SDM): 디버그용 로그
-				TestDelegate.BroadCast(testvalue);
-				testvalue++;
+				FOverlapInfo Info;
+				Info.OtherComponent = Candidate;
+				Info.OtherActor = Candidate->GetOwner();
+				OverlapInfos.push_back(Info);
 			}
 		}
 	}
+
+	// ========== Hit 이벤트 처리 (블로킹 충돌) ==========
+	for (const FOverlapInfo& Info : OverlapInfos)
+	{
+		UPrimitiveComponent* Candidate = Info.OtherComponent;
+		if (bGenerateHitEvents && bBlockComponent && Candidate->bBlockComponent)
+		{
+			// Hit 이벤트 발생 (양쪽이 모두 Block일 때)
+			FHitResult HitResult;
+			HitResult.Component = Candidate;
+			HitResult.Actor = Candidate->GetOwner();
+			HitResult.ImpactPoint = (GetWorldLocation() + Candidate->GetWorldLocation()) * 0.5f;
+			HitResult.ImpactNormal = (GetWorldLocation() - Candidate->GetWorldLocation()).GetNormalized();
+			HitResult.Distance = FVector::Dist(GetWorldLocation(), Candidate->GetWorldLocation());
+
+			FVector NormalImpulse = FVector::ZeroVector();  // 물리 엔진 연동 시 계산
+			//OnComponentHit.BroadCast(this, Candidate->GetOwner(), Candidate, NormalImpulse, HitResult);
+			// TODO(SDM): 디버그용 로그
+			TestDelegate.BroadCast(testvalue);
+			testvalue++;
+		}
+	}
+
 	// ========== 델리게이트 호출: BeginOverlap / EndOverlap ==========
 
 	if (bGenerateOverlapEvents)
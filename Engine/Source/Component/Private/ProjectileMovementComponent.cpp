@@ -1,6 +1,8 @@
 ﻿#include "pch.h"
 #include "Component/Public/ProjectileMovementComponent.h"
+#if WITH_EDITOR
 #include "Render/UI/Widget/Public/ProjectileMovementComponentWidget.h"
+#endif
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_CLASS(UProjectileMovementComponent, UMovementComponent)
@@ -79,5 +81,9 @@ UObject* UProjectileMovementComponent::Duplicate()
 
 UClass* UProjectileMovementComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
     return UProjectileMovementComponentWidget::StaticClass();
+#else
+    return nullptr;
+#endif
 }
@@ -1,6 +1,8 @@
 ﻿#include "pch.h"
 #include "Component/Public/RotatingMovementComponent.h"
+#if WITH_EDITOR
 #include "Render/UI/Widget/Public/RotatingMovementComponentWidget.h"
+#endif
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_CLASS(URotatingMovementComponent, UMovementComponent)
@@ -60,5 +62,9 @@ UObject* URotatingMovementComponent::Duplicate()
 
 UClass* URotatingMovementComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
     return URotatingMovementComponentWidget::StaticClass();
+#else
+    return nullptr;
+#endif
 }
@@ -12,6 +12,12 @@ IMPLEMENT_CLASS(USceneComponent, UActorComponent)
 
 USceneComponent::USceneComponent()
 {
+	TransformIndex = FSceneTransformStore::GetInstance().Allocate(this);
+}
+
+USceneComponent::~USceneComponent()
+{
+	FSceneTransformStore::GetInstance().Free(TransformIndex);
 }
 
 void USceneComponent::BeginPlay()
@@ -33,21 +39,27 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	Super::Serialize(bInIsLoading, InOutHandle);
 
 	// 불러오기
+	FSceneTransformStore& TransformStore = FSceneTransformStore::GetInstance();
 	if (bInIsLoading)
 	{
-		FJsonSerializer::ReadVector(InOutHandle, "Location", RelativeLocation, FVector::ZeroVector());
+		FVector Location;
+		FJsonSerializer::ReadVector(InOutHandle, "Location", Location, FVector::ZeroVector());
+		TransformStore.SetLocalLocation(TransformIndex, Location);
+
 		FVector RotationEuler;
 		FJsonSerializer::ReadVector(InOutHandle, "Rotation", RotationEuler, FVector::ZeroVector());
-		RelativeRotation = FQuaternion::FromEuler(RotationEuler);
+		TransformStore.SetLocalRotation(TransformIndex, FQuaternion::FromEuler(RotationEuler));
 
-		FJsonSerializer::ReadVector(InOutHandle, "Scale", RelativeScale3D, FVector::OneVector());
+		FVector Scale;
+		FJsonSerializer::ReadVector(InOutHandle, "Scale", Scale, FVector::OneVector());
+		TransformStore.SetLocalScale(TransformIndex, Scale);
 	}
 	// 저장
 	else
 	{
-		InOutHandle["Location"] = FJsonSerializer::VectorToJson(RelativeLocation);
-		InOutHandle["Rotation"] = FJsonSerializer::VectorToJson(RelativeRotation.ToEuler());
-		InOutHandle["Scale"] = FJsonSerializer::VectorToJson(RelativeScale3D);
+		InOutHandle["Location"] = FJsonSerializer::VectorToJson(GetRelativeLocation());
+		InOutHandle["Rotation"] = FJsonSerializer::VectorToJson(GetRelativeRotation().ToEuler());
+		InOutHandle["Scale"] = FJsonSerializer::VectorToJson(GetRelativeScale3D());
 	}
 }
 
@@ -61,6 +73,7 @@ void USceneComponent::AttachToComponent(USceneComponent* Parent, bool bRemainTra
 
 	AttachParent = Parent;
 	Parent->AttachChildren.push_back(this);
+	FSceneTransformStore::GetInstance().SetParent(TransformIndex, Parent->TransformIndex);
 
 	MarkAsDirty();
 }
@@ -71,6 +84,9 @@ void USceneComponent::DetachFromComponent()
 	{
 		AttachParent->DetachChild(this);
 		AttachParent = nullptr;
+		FSceneTransformStore::GetInstance().SetParent(TransformIndex, FSceneTransformStore::INVALID_INDEX);
+
+		MarkAsDirty();
 	}
 }
 
@@ -82,9 +98,10 @@ void USceneComponent::DetachChild(USceneComponent* ChildToDetach)
 UObject* USceneComponent::Duplicate()
 {
 	USceneComponent* SceneComponent = Cast<USceneComponent>(Super::Duplicate());
-	SceneComponent->RelativeLocation = RelativeLocation;
-	SceneComponent->RelativeRotation = RelativeRotation;
-	SceneComponent->RelativeScale3D = RelativeScale3D;
+	FSceneTransformStore& TransformStore = FSceneTransformStore::GetInstance();
+	TransformStore.SetLocalLocation(SceneComponent->TransformIndex, GetRelativeLocation());
+	TransformStore.SetLocalRotation(SceneComponent->TransformIndex, GetRelativeRotation());
+	TransformStore.SetLocalScale(SceneComponent->TransformIndex, GetRelativeScale3D());
 	SceneComponent->MarkAsDirty();
 	return SceneComponent;
 }
@@ -96,18 +113,13 @@ void USceneComponent::DuplicateSubObjects(UObject* DuplicatedObject)
 
 void USceneComponent::MarkAsDirty()
 {
-	bIsTransformDirty = true;
-	bIsTransformDirtyInverse = true;
-
-	for (USceneComponent* Child : AttachChildren)
-	{
-		Child->MarkAsDirty();
-	}
+	// 자식은 부모의 WorldVersion이 바뀐 것으로 갱신 여부를 판단하므로 재귀적으로 표시할 필요가 없음
+	FSceneTransformStore::GetInstance().MarkLocalDirty(TransformIndex);
 }
 
 void USceneComponent::SetRelativeLocation(const FVector& Location)
 {
-	RelativeLocation = Location;
+	FSceneTransformStore::GetInstance().SetLocalLocation(TransformIndex, Location);
 	MarkAsDirty();
 
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(this))
@@ -118,7 +130,7 @@ void USceneComponent::SetRelativeLocation(const FVector& Location)
 
 void USceneComponent::SetRelativeRotation(const FQuaternion& Rotation)
 {
-	RelativeRotation = Rotation;
+	FSceneTransformStore::GetInstance().SetLocalRotation(TransformIndex, Rotation);
 	MarkAsDirty();
 
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(this))
@@ -129,7 +141,7 @@ void USceneComponent::SetRelativeRotation(const FQuaternion& Rotation)
 
 void USceneComponent::SetRelativeScale3D(const FVector& Scale)
 {
-	RelativeScale3D = Scale;
+	FSceneTransformStore::GetInstance().SetLocalScale(TransformIndex, Scale);
 	MarkAsDirty();
 
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(this))
@@ -138,45 +150,6 @@ void USceneComponent::SetRelativeScale3D(const FVector& Scale)
 	}
 }
 
-const FMatrix& USceneComponent::GetWorldTransformMatrix() const
-{
-	if (bIsTransformDirty)
-	{
-		WorldTransformMatrix = FMatrix::GetModelMatrix(RelativeLocation, RelativeRotation, RelativeScale3D);
-
-		if (AttachParent)
-		{
-			// Row-vector 시스템 (V * M): V * Local * Parent 순서
-			// Local 변환 먼저, 그 다음 Parent 변환
-			WorldTransformMatrix *= AttachParent->GetWorldTransformMatrix();
-		}
-
-		bIsTransformDirty = false;
-	}
-
-	return WorldTransformMatrix;
-}
-
-const FMatrix& USceneComponent::GetWorldTransformMatrixInverse() const
-{
-	if (bIsTransformDirtyInverse)
-	{
-		// (Local * Parent)^-1 = Parent^-1 * Local^-1
-		WorldTransformMatrixInverse = FMatrix::Identity();
-
-		if (AttachParent)
-		{
-			WorldTransformMatrixInverse *= AttachParent->GetWorldTransformMatrixInverse();
-		}
-
-		WorldTransformMatrixInverse *= FMatrix::GetModelMatrixInverse(RelativeLocation, RelativeRotation, RelativeScale3D);
-
-		bIsTransformDirtyInverse = false;
-	}
-
-	return WorldTransformMatrixInverse;
-}
-
 FVector USceneComponent::GetWorldLocation() const
 {
     return GetWorldTransformMatrix().GetLocation();
@@ -189,9 +162,9 @@ FQuaternion USceneComponent::GetWorldRotationAsQuaternion() const
         // 쿼터니언 곱셈 q1*q2는 "q2 먼저, q1 나중"
         // 행벡터 행렬: World = Local * Parent (Local 먼저, Parent 나중)
         // 쿼터니언: World = Parent * Local (순서 반대!)
-        return AttachParent->GetWorldRotationAsQuaternion() * RelativeRotation;
+        return AttachParent->GetWorldRotationAsQuaternion() * GetRelativeRotation();
     }
-    return RelativeRotation;
+    return GetRelativeRotation();
 }
 
 FVector USceneComponent::GetWorldRotation() const
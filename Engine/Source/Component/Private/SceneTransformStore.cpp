@@ -0,0 +1,364 @@
+#include "pch.h"
+#include "Component/Public/SceneTransformStore.h"
+#include "Component/Public/SceneComponent.h"
+
+uint32 FSceneTransformStore::Allocate(USceneComponent* InComponent)
+{
+	const uint32 Index = Num();
+
+	LocalLocations.push_back(FVector(0.0f, 0.0f, 0.0f));
+	LocalRotations.push_back(FQuaternion::Identity());
+	LocalScales.push_back(FVector(1.0f, 1.0f, 1.0f));
+	WorldMatrices.push_back(FMatrix::Identity());
+	WorldMatrixInverses.push_back(FMatrix::Identity());
+	ParentIndices.push_back(INVALID_INDEX);
+	WorldVersions.push_back(0);
+	ParentVersions.push_back(INVALID_INDEX);
+	InverseVersions.push_back(INVALID_INDEX);
+	LocalDirtyFlags.push_back(true);
+	Components.push_back(InComponent);
+
+	PreviousLocations.push_back(FVector(0.0f, 0.0f, 0.0f));
+	PreviousRotations.push_back(FQuaternion::Identity());
+	PreviousScales.push_back(FVector(1.0f, 1.0f, 1.0f));
+	InterpolationSkipFlags.push_back(bIsInSimulationStep);
+
+	bHasPendingChanges = true;
+	return Index;
+}
+
+void FSceneTransformStore::Free(uint32 InIndex)
+{
+	if (InIndex >= Num())
+	{
+		return;
+	}
+
+	// 해제된 슬롯은 재정렬 전까지 재사용하지 않으므로, 이 노드를 부모로 가리키는 자식의 인덱스도 그때까지 유효함
+	Components[InIndex] = nullptr;
+	bLayoutDirty = true;
+}
+
+void FSceneTransformStore::SetParent(uint32 InIndex, uint32 InParentIndex)
+{
+	ParentIndices[InIndex] = InParentIndex;
+	ParentVersions[InIndex] = INVALID_INDEX;
+	MarkLocalDirty(InIndex);
+
+	// 부모가 바뀌면 이전 Local 값과 기준 공간이 달라지므로 이번 스텝은 보간하지 않음
+	if (bIsInSimulationStep)
+	{
+		InterpolationSkipFlags[InIndex] = true;
+	}
+
+	if (InParentIndex != INVALID_INDEX && InParentIndex > InIndex)
+	{
+		bLayoutDirty = true;
+	}
+}
+
+const FMatrix& FSceneTransformStore::GetWorldMatrixInverse(uint32 InIndex)
+{
+	const uint32 Version = GetWorldVersion(InIndex);
+	if (InverseVersions[InIndex] != Version)
+	{
+		// (Local * Parent)^-1 = Parent^-1 * Local^-1
+		FMatrix Inverse = FMatrix::GetModelMatrixInverse(LocalLocations[InIndex], LocalRotations[InIndex], LocalScales[InIndex]);
+
+		const uint32 ParentIndex = ParentIndices[InIndex];
+		if (ParentIndex != INVALID_INDEX)
+		{
+			Inverse = GetWorldMatrixInverse(ParentIndex) * Inverse;
+		}
+
+		WorldMatrixInverses[InIndex] = Inverse;
+		InverseVersions[InIndex] = Version;
+	}
+
+	return WorldMatrixInverses[InIndex];
+}
+
+void FSceneTransformStore::UpdateWorldTransforms()
+{
+	if (bLayoutDirty)
+	{
+		Compact();
+	}
+
+	LastUpdatedCount = 0;
+	if (!bHasPendingChanges)
+	{
+		return;
+	}
+
+	// 부모가 항상 앞에 있으므로, 부모의 World 행렬은 자식을 만나기 전에 이미 최신 상태
+	const uint32 Count = Num();
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		const uint32 ParentIndex = ParentIndices[Index];
+		if (LocalDirtyFlags[Index] || (ParentIndex != INVALID_INDEX && ParentVersions[Index] != WorldVersions[ParentIndex]))
+		{
+			RecomputeWorldMatrix(Index);
+			++LastUpdatedCount;
+		}
+	}
+
+	bHasPendingChanges = false;
+}
+
+void FSceneTransformStore::BeginSimulationStep()
+{
+	ResetInterpolation();
+	bIsInSimulationStep = true;
+}
+
+void FSceneTransformStore::ResetInterpolation()
+{
+	PreviousLocations = LocalLocations;
+	PreviousRotations = LocalRotations;
+	PreviousScales = LocalScales;
+	std::fill(InterpolationSkipFlags.begin(), InterpolationSkipFlags.end(), static_cast<uint8>(false));
+}
+
+void FSceneTransformStore::ApplyInterpolation(float InAlpha)
+{
+	// 보간 중에 인덱스가 바뀌지 않도록 재정렬을 먼저 끝냄
+	if (bLayoutDirty)
+	{
+		Compact();
+	}
+
+	InterpolatedNodes.clear();
+	const float InverseAlpha = 1.0f - InAlpha;
+	const uint32 Count = Num();
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		if (!Components[Index] || InterpolationSkipFlags[Index])
+		{
+			continue;
+		}
+
+		const FVector& Location = LocalLocations[Index];
+		const FQuaternion& Rotation = LocalRotations[Index];
+		const FVector& Scale = LocalScales[Index];
+		const FVector& PreviousLocation = PreviousLocations[Index];
+		const FQuaternion& PreviousRotation = PreviousRotations[Index];
+		const FVector& PreviousScale = PreviousScales[Index];
+
+		const bool bIsRotationEqual = Rotation.X == PreviousRotation.X && Rotation.Y == PreviousRotation.Y &&
+			Rotation.Z == PreviousRotation.Z && Rotation.W == PreviousRotation.W;
+		if (Location == PreviousLocation && Scale == PreviousScale && bIsRotationEqual)
+		{
+			continue;
+		}
+
+		FInterpolatedNode Node;
+		Node.Index = Index;
+		Node.Component = Components[Index];
+		Node.SimulatedLocation = Location;
+		Node.SimulatedRotation = Rotation;
+		Node.SimulatedScale = Scale;
+		Node.InterpolatedLocation = PreviousLocation * InverseAlpha + Location * InAlpha;
+		Node.InterpolatedRotation = bIsRotationEqual ? Rotation : FQuaternion::Nlerp(PreviousRotation, Rotation, InAlpha);
+		Node.InterpolatedScale = PreviousScale * InverseAlpha + Scale * InAlpha;
+
+		LocalLocations[Index] = Node.InterpolatedLocation;
+		LocalRotations[Index] = Node.InterpolatedRotation;
+		LocalScales[Index] = Node.InterpolatedScale;
+		MarkLocalDirty(Index);
+
+		InterpolatedNodes.push_back(Node);
+	}
+
+	LastInterpolatedCount = static_cast<uint32>(InterpolatedNodes.size());
+}
+
+void FSceneTransformStore::RestoreSimulatedTransforms()
+{
+	const uint32 Count = Num();
+	for (const FInterpolatedNode& Node : InterpolatedNodes)
+	{
+		const uint32 Index = Node.Index;
+		if (Index >= Count || Components[Index] != Node.Component)
+		{
+			continue;
+		}
+
+		// 렌더링 중에 새로 설정된 값(에디터 UI 등)은 이전 값까지 함께 바뀌었으므로 그대로 유지
+		const FQuaternion& Rotation = LocalRotations[Index];
+		const bool bIsUnchanged = LocalLocations[Index] == Node.InterpolatedLocation && LocalScales[Index] == Node.InterpolatedScale &&
+			Rotation.X == Node.InterpolatedRotation.X && Rotation.Y == Node.InterpolatedRotation.Y &&
+			Rotation.Z == Node.InterpolatedRotation.Z && Rotation.W == Node.InterpolatedRotation.W;
+		if (!bIsUnchanged)
+		{
+			continue;
+		}
+
+		LocalLocations[Index] = Node.SimulatedLocation;
+		LocalRotations[Index] = Node.SimulatedRotation;
+		LocalScales[Index] = Node.SimulatedScale;
+		MarkLocalDirty(Index);
+	}
+
+	InterpolatedNodes.clear();
+}
+
+FMatrix FSceneTransformStore::ComposeLocalMatrix(const FVector& InLocation, const FQuaternion& InRotation, const FVector& InScale)
+{
+	// S * R * T를 행렬곱 없이 구성: 회전 행렬의 각 행에 스케일을 곱하고 마지막 행에 위치를 넣음
+	FMatrix Result = InRotation.ToRotationMatrix();
+	Result.V[0] = _mm_mul_ps(Result.V[0], _mm_set1_ps(InScale.X));
+	Result.V[1] = _mm_mul_ps(Result.V[1], _mm_set1_ps(InScale.Y));
+	Result.V[2] = _mm_mul_ps(Result.V[2], _mm_set1_ps(InScale.Z));
+	Result.V[3] = _mm_setr_ps(InLocation.X, InLocation.Y, InLocation.Z, 1.0f);
+	return Result;
+}
+
+void FSceneTransformStore::ResolveWorldMatrix(uint32 InIndex)
+{
+	const uint32 ParentIndex = ParentIndices[InIndex];
+	if (ParentIndex != INVALID_INDEX)
+	{
+		ResolveWorldMatrix(ParentIndex);
+		if (ParentVersions[InIndex] != WorldVersions[ParentIndex])
+		{
+			RecomputeWorldMatrix(InIndex);
+			return;
+		}
+	}
+
+	if (LocalDirtyFlags[InIndex])
+	{
+		RecomputeWorldMatrix(InIndex);
+	}
+}
+
+void FSceneTransformStore::RecomputeWorldMatrix(uint32 InIndex)
+{
+	// Row-vector 시스템 (V * M): V * Local * Parent 순서
+	FMatrix World = ComposeLocalMatrix(LocalLocations[InIndex], LocalRotations[InIndex], LocalScales[InIndex]);
+
+	const uint32 ParentIndex = ParentIndices[InIndex];
+	if (ParentIndex != INVALID_INDEX)
+	{
+		World = World * WorldMatrices[ParentIndex];
+		ParentVersions[InIndex] = WorldVersions[ParentIndex];
+	}
+
+	WorldMatrices[InIndex] = World;
+	++WorldVersions[InIndex];
+	LocalDirtyFlags[InIndex] = false;
+}
+
+void FSceneTransformStore::Compact()
+{
+	const uint32 Count = Num();
+
+	// 해제된 부모를 가리키는 노드는 루트로 만든다
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		const uint32 ParentIndex = ParentIndices[Index];
+		if (Components[Index] && ParentIndex != INVALID_INDEX && !Components[ParentIndex])
+		{
+			ParentIndices[Index] = INVALID_INDEX;
+			InterpolationSkipFlags[Index] = true;
+			MarkLocalDirty(Index);
+		}
+	}
+
+	// 노드별 깊이 계산 (부모가 뒤에 있을 수 있으므로 이미 계산된 조상까지 올라간 뒤 내려오며 채움)
+	TArray<uint32> Depths(Count, INVALID_INDEX);
+	uint32 MaxDepth = 0;
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		if (!Components[Index] || Depths[Index] != INVALID_INDEX)
+		{
+			continue;
+		}
+
+		uint32 Steps = 0;
+		uint32 Node = Index;
+		while (Depths[Node] == INVALID_INDEX && ParentIndices[Node] != INVALID_INDEX)
+		{
+			Node = ParentIndices[Node];
+			++Steps;
+		}
+
+		const uint32 BaseDepth = Depths[Node] == INVALID_INDEX ? 0 : Depths[Node];
+		Depths[Node] = BaseDepth;
+
+		uint32 Depth = BaseDepth + Steps;
+		MaxDepth = std::max(MaxDepth, Depth);
+		for (Node = Index; Depths[Node] == INVALID_INDEX; Node = ParentIndices[Node])
+		{
+			Depths[Node] = Depth--;
+		}
+	}
+
+	// 깊이별 Counting sort (같은 깊이 안에서는 기존 순서 유지)
+	TArray<uint32> DepthOffsets(MaxDepth + 2, 0);
+	uint32 LiveCount = 0;
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		if (Components[Index])
+		{
+			++DepthOffsets[Depths[Index] + 1];
+			++LiveCount;
+		}
+	}
+	for (uint32 Depth = 1; Depth < DepthOffsets.size(); ++Depth)
+	{
+		DepthOffsets[Depth] += DepthOffsets[Depth - 1];
+	}
+
+	TArray<uint32> NewOrder(LiveCount);
+	TArray<uint32> OldToNew(Count, INVALID_INDEX);
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		if (Components[Index])
+		{
+			const uint32 NewIndex = DepthOffsets[Depths[Index]]++;
+			NewOrder[NewIndex] = Index;
+			OldToNew[Index] = NewIndex;
+		}
+	}
+
+	Permute(LocalLocations, NewOrder);
+	Permute(LocalRotations, NewOrder);
+	Permute(LocalScales, NewOrder);
+	Permute(WorldMatrices, NewOrder);
+	Permute(WorldMatrixInverses, NewOrder);
+	Permute(ParentIndices, NewOrder);
+	Permute(WorldVersions, NewOrder);
+	Permute(ParentVersions, NewOrder);
+	Permute(InverseVersions, NewOrder);
+	Permute(LocalDirtyFlags, NewOrder);
+	Permute(Components, NewOrder);
+	Permute(PreviousLocations, NewOrder);
+	Permute(PreviousRotations, NewOrder);
+	Permute(PreviousScales, NewOrder);
+	Permute(InterpolationSkipFlags, NewOrder);
+
+	for (uint32 Index = 0; Index < LiveCount; ++Index)
+	{
+		if (ParentIndices[Index] != INVALID_INDEX)
+		{
+			ParentIndices[Index] = OldToNew[ParentIndices[Index]];
+		}
+		Components[Index]->TransformIndex = Index;
+	}
+
+	bLayoutDirty = false;
+}
+
+template<typename T>
+void FSceneTransformStore::Permute(TArray<T>& InOutArray, const TArray<uint32>& InNewOrder)
+{
+	TArray<T> Result;
+	Result.reserve(InNewOrder.size());
+	for (uint32 OldIndex : InNewOrder)
+	{
+		Result.push_back(InOutArray[OldIndex]);
+	}
+	InOutArray.swap(Result);
+}
@@ -1,8 +1,12 @@
 #include "pch.h"
 #include "Component/Public/SpotLightComponent.h"
+#if WITH_EDITOR
 #include "Render/UI/Widget/Public/SpotLightComponentWidget.h"
+#endif
 #include "Utility/Public/JsonSerializer.h"
+#if WITH_RENDERER
 #include "Render/Renderer/Public/Renderer.h"
+#endif
 #include "Editor/Public/Camera.h"
 #include "Editor/Public/EditorPrimitive.h"
 
@@ -47,7 +51,11 @@ UObject* USpotLightComponent::Duplicate()
 
 UClass* USpotLightComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
     return USpotLightComponentWidget::StaticClass();
+#else
+    return nullptr;
+#endif
 }
 
 FVector USpotLightComponent::GetForwardVector() const
@@ -112,11 +120,13 @@ void USpotLightComponent::RenderLightDirectionGizmo(UCamera* InCamera, const D3D
 	LightDirectionArrow.Rotation = LightRotation;
 	LightDirectionArrow.Scale = FVector(Scale, Scale, Scale);
 
+#if WITH_RENDERER
 	FRenderState RenderState;
 	RenderState.FillMode = EFillMode::Solid;
 	RenderState.CullMode = ECullMode::None;
 
 	URenderer::GetInstance().RenderEditorPrimitive(LightDirectionArrow, RenderState);
+#endif
 }
 
 FSpotLightInfo USpotLightComponent::GetSpotLightInfo() const
@@ -134,12 +144,12 @@ FSpotLightInfo USpotLightComponent::GetSpotLightInfo() const
 
     // Shadow parameters
     Info.LightViewProjection = CachedShadowViewProjection; // Updated by ShadowMapPass
-    Info.CastShadow = GetCastShadows() ? 1u : 0u;
+    Info.CastShadow = (GetCastShadows() && GetShadowAtlasResolution() > 0.0f) ? 1u : 0u;
     Info.ShadowModeIndex = static_cast<uint32>(GetShadowModeIndex());
     Info.ShadowBias = GetShadowBias();
     Info.ShadowSlopeBias = GetShadowSlopeBias();
     Info.ShadowSharpen = GetShadowSharpen();
-    Info.Resolution = GetShadowResolutionScale();
+    Info.Resolution = GetShadowAtlasResolution();
 
     return Info;
 }
@@ -1,8 +1,12 @@
 #include "pch.h"
 #include "Component/Public/TextComponent.h"
+#if WITH_EDITOR
 #include "Editor/Public/Editor.h"
+#endif
 #include "Manager/Asset/Public/AssetManager.h"
+#if WITH_EDITOR
 #include "Render/UI/Widget/Public/SetTextComponentWidget.h"
+#endif
 #include "Level/Public/Level.h"
 
 IMPLEMENT_CLASS(UTextComponent, UPrimitiveComponent)
@@ -42,7 +46,11 @@ void UTextComponent::SetText(const FString& InText)
 
 UClass* UTextComponent::GetSpecificWidgetClass() const
 {
+#if WITH_EDITOR
 	return USetTextComponentWidget::StaticClass();
+#else
+	return nullptr;
+#endif
 }
 
 UObject* UTextComponent::Duplicate()
@@ -1,7 +1,9 @@
 #include "pch.h"
 #include "Component/Public/ULuaScriptComponent.h"
+#if WITH_LUA
 #include "Manager/Lua/Public/LuaScriptManager.h"
 #include "Manager/Coroutine/Public/LuaCoroutineManager.h"
+#endif
 #include "Actor/Public/Actor.h"
 #include "Utility/Public/JsonSerializer.h"
 
@@ -37,7 +39,9 @@ UObject* ULuaScriptComponent::Duplicate()
         return nullptr;
     
     NewComponent->ScriptName = ScriptName;
+#if WITH_LUA
     NewComponent->SelfTable = SelfTable;
+#endif
     
     return NewComponent;
 }
@@ -72,6 +76,7 @@ void ULuaScriptComponent::BeginPlay()
         return;
     }
 
+#if WITH_LUA
     // Register with LuaScriptManager for hot-reload tracking
     FLuaScriptManager::GetInstance().RegisterComponent(this);
 
@@ -79,12 +84,14 @@ void ULuaScriptComponent::BeginPlay()
     {
         ActivateFunction("BeginPlay");
     }
+#endif
 }
 
 void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
 
+#if WITH_LUA
     // Safety check: Only tick if we have a valid owner
     AActor* Owner = GetOwner();
     if (!Owner || !SelfTable.valid() || !SelfTable["Tick"].valid())
@@ -100,12 +107,14 @@ void ULuaScriptComponent::TickComponent(float DeltaTime)
     }
 
     ActivateFunction("Tick", DeltaTime);
+#endif
 }
 
 void ULuaScriptComponent::EndPlay()
 {
     Super::EndPlay();
 
+#if WITH_LUA
     // FIRST: Invalidate the actor reference in Lua to prevent access
     if (SelfTable.valid())
     {
@@ -130,12 +139,17 @@ void ULuaScriptComponent::EndPlay()
 
     // Invalidate the Lua table to prevent any further access
     SelfTable = sol::nil;
+#else
+    ActiveCoroutineIDs.clear();
+#endif
 }
 
 void ULuaScriptComponent::SetScriptName(const FString& InScriptName)
 {
     ScriptName = InScriptName;
+#if WITH_LUA
     SelfTable = sol::table();
+#endif
 }
 
 bool ULuaScriptComponent::LoadScript()
@@ -146,6 +160,7 @@ bool ULuaScriptComponent::LoadScript()
         ScriptName = "Scripts/DefaultLevel/" + ClassName + ".lua";
     }
 
+#if WITH_LUA
     // Load from LuaScriptManager
     SelfTable = FLuaScriptManager::GetInstance().CreateLuaTable(ScriptName);
 
@@ -164,6 +179,10 @@ bool ULuaScriptComponent::LoadScript()
     }
 
     return true;
+#else
+    // Lua 없이 빌드된 경우 (헤드리스) 스크립트는 실행하지 않음
+    return false;
+#endif
 }
 
 void ULuaScriptComponent::RegisterCoroutine(int coroutineID)
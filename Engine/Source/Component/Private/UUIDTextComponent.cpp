@@ -1,7 +1,9 @@
 #include "pch.h"
 #include "Component/Public/UUIDTextComponent.h"
 #include "Component/Public/PrimitiveComponent.h"
+#if WITH_EDITOR
 #include "Editor/Public/Editor.h"
+#endif
 #include "Actor/Public/Actor.h"
 
 IMPLEMENT_CLASS(UUUIDTextComponent, UTextComponent)
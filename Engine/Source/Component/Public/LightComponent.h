@@ -128,6 +128,12 @@ public:
     /** @brief 실제 shadow map 해상도를 계산하여 반환합니다 (기본 1024 * scale). */
     uint32 GetShadowMapResolution() const { return static_cast<uint32>(1024.0f * ShadowResolutionScale); }
 
+    /** @brief 이번 프레임에 Shadow atlas에서 실제로 할당된 타일 해상도를 반환합니다 (0 = 할당 실패). */
+    float GetShadowAtlasResolution() const { return ShadowAtlasResolution; }
+
+    /** @brief Atlas Packer가 할당한 타일 해상도를 기록합니다. ShadowMapPass에서만 호출합니다. */
+    void SetShadowAtlasResolution(float InResolution) { ShadowAtlasResolution = InResolution; }
+
 protected:
     void UpdateVisualizationIconTint();
 
@@ -137,6 +143,9 @@ protected:
      * 0.25 = 256x256, 0.5 = 512x512, 1.0 = 1024x1024, 2.0 = 2048x2048, 4.0 = 4096x4096 */
     float ShadowResolutionScale = 1024.0f;
 
+    /** Atlas Packer가 화면 점유율과 Atlas 여유 공간에 따라 할당한 해상도 (ShadowResolutionScale 이하) */
+    float ShadowAtlasResolution = 0.0f;
+
     /** Depth bias for shadow acne prevention (0.0 ~ 0.1) */
     float ShadowBias = 0.005f;
 
@@ -41,6 +41,11 @@ public:
 
 	virtual const IBoundingVolume* GetBoundingBox();
 	void GetWorldAABB(FVector& OutMin, FVector& OutMax);
+	/** @brief 마지막으로 계산된 월드 AABB를 재계산 없이 반환 (트랜스폼 변경 직후에는 변경 전 영역) */
+	void GetCachedWorldAABB(FVector& OutMin, FVector& OutMax) const { OutMin = CachedWorldMin; OutMax = CachedWorldMax; }
+
+	/** @brief Level 등록 시 결정된 렌더 목록 타입 (등록 전에는 None) */
+	ERenderProxyType GetRenderProxyType() const { return RenderProxyType; }
 
 	virtual void MarkAsDirty() override;
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
@@ -75,6 +80,15 @@ protected:
 	mutable FVector CachedWorldMin;
 	mutable FVector CachedWorldMax;
 	mutable bool bIsAABBCacheDirty = true;
+	// 캐시 계산에 사용한 World 행렬의 버전 (부모가 움직여도 바뀜)
+	mutable uint32 CachedAABBTransformVersion = 0;
+
+private:
+	friend class ULevel;
+
+	// ULevel의 타입별 렌더 목록에서의 위치 (등록/해제 시 ULevel이 관리)
+	ERenderProxyType RenderProxyType = ERenderProxyType::None;
+	int32 RenderProxyIndex = -1;
 
 public:
 	virtual UObject* Duplicate() override;
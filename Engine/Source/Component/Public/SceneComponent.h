@@ -1,5 +1,6 @@
 #pragma once
 #include "Component/Public/ActorComponent.h"
+#include "Component/Public/SceneTransformStore.h"
 
 namespace json { class JSON; }
 using JSON = json::JSON;
@@ -12,6 +13,7 @@ class USceneComponent : public UActorComponent
 
 public:
 	USceneComponent();
+	~USceneComponent() override;
 
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime) override;
@@ -27,12 +29,15 @@ public:
 
 	bool IsUniformScale() const;
 	
-	const FVector& GetRelativeLocation() const { return RelativeLocation; }
-	const FQuaternion& GetRelativeRotation() const { return RelativeRotation; }
-	const FVector& GetRelativeScale3D() const { return RelativeScale3D; }
+	// 저장소 배열은 스폰(Allocate) 시 재할당되고 Compact 시 재정렬되므로, 참조가 아니라 값으로 반환한다
+	FVector GetRelativeLocation() const { return FSceneTransformStore::GetInstance().GetLocalLocation(TransformIndex); }
+	FQuaternion GetRelativeRotation() const { return FSceneTransformStore::GetInstance().GetLocalRotation(TransformIndex); }
+	FVector GetRelativeScale3D() const { return FSceneTransformStore::GetInstance().GetLocalScale(TransformIndex); }
 
-	const FMatrix& GetWorldTransformMatrix() const;
-	const FMatrix& GetWorldTransformMatrixInverse() const;
+	FMatrix GetWorldTransformMatrix() const { return FSceneTransformStore::GetInstance().GetWorldMatrix(TransformIndex); }
+	FMatrix GetWorldTransformMatrixInverse() const { return FSceneTransformStore::GetInstance().GetWorldMatrixInverse(TransformIndex); }
+	/** @brief World 행렬이 다시 계산될 때마다 바뀌는 값 (부모의 이동도 반영됨) */
+	uint32 GetWorldTransformVersion() const { return FSceneTransformStore::GetInstance().GetWorldVersion(TransformIndex); }
 
 	FVector GetWorldLocation() const;
     FVector GetWorldRotation() const;
@@ -48,14 +53,10 @@ public:
     void SetWorldScale3D(const FVector& NewScale);
 
 private:
-	mutable bool bIsTransformDirty = true;
-	mutable bool bIsTransformDirtyInverse = true;
-	mutable FMatrix WorldTransformMatrix;
-	mutable FMatrix WorldTransformMatrixInverse;
+	friend class FSceneTransformStore;
 
-	FVector RelativeLocation = FVector{ 0,0,0.f };
-	FQuaternion RelativeRotation = FQuaternion::Identity();
-	FVector RelativeScale3D = FVector{ 1.f,1.f,1.f };
+	// FSceneTransformStore에서의 위치 (Local TRS와 World 행렬은 저장소에 있음, 재정렬 시 저장소가 갱신)
+	uint32 TransformIndex = FSceneTransformStore::INVALID_INDEX;
 	bool bIsUniformScale = false;
 
 	// SceneComponent Hierarchy Section
@@ -0,0 +1,193 @@
+#pragma once
+#include "Global/Types.h"
+
+class USceneComponent;
+
+/**
+ * @brief 모든 USceneComponent의 트랜스폼을 SoA 배열로 보관하는 저장소
+ *
+ * Local TRS, World 행렬, 부모 인덱스를 컴포넌트마다 흩어두지 않고 연속된 배열에 모아두며,
+ * 배열은 항상 부모가 자식보다 앞에 오도록(깊이 순) 정렬됩니다. (계층이 바뀌면 다음 UpdateWorldTransforms에서 재정렬)
+ * USceneComponent는 자신의 인덱스만 들고 이 저장소를 조회/수정하는 View 역할을 합니다.
+ *
+ * Dirty 전파는 재귀 대신 버전 비교로 처리합니다.
+ * 노드의 World 행렬이 다시 계산될 때마다 WorldVersion이 올라가고, 자식은 계산에 사용한 부모 버전을 기억하므로
+ * 부모 순서대로 한 번 훑으면 (UpdateWorldTransforms) 바뀐 부모 아래의 모든 자식이 함께 갱신됩니다.
+ * 프레임 중간의 조회(GetWorldMatrix)는 부모 체인만 따라 올라가 필요한 노드만 즉시 계산합니다.
+ *
+ * 고정 스텝 시뮬레이션에서는 스텝마다 BeginSimulationStep이 Local TRS를 이전 값으로 보관하고,
+ * 렌더링 직전 ApplyInterpolation이 이전/현재 값을 보간해 World 행렬을 만든 뒤 RestoreSimulatedTransforms로 되돌립니다.
+ * 스텝 밖(에디터 기즈모, UI, 스폰 직후)에서 바뀐 값은 이전 값도 함께 바뀌어 보간 없이 바로 이동합니다.
+ *
+ * 메인 스레드 전용입니다.
+ */
+class FSceneTransformStore
+{
+public:
+	static constexpr uint32 INVALID_INDEX = 0xFFFFFFFFu;
+
+	// 종료 시점에 소멸되는 정적 컴포넌트가 있을 수 있으므로 프로세스가 끝날 때까지 해제하지 않음
+	static FSceneTransformStore& GetInstance()
+	{
+		static FSceneTransformStore* Instance = new FSceneTransformStore();
+		return *Instance;
+	}
+
+	/** @brief 새 노드를 배열 끝에 추가합니다. (Identity 트랜스폼, 부모 없음) */
+	uint32 Allocate(USceneComponent* InComponent);
+	/** @brief 노드를 비활성화합니다. 실제 제거와 인덱스 재배치는 다음 UpdateWorldTransforms에서 일어납니다. */
+	void Free(uint32 InIndex);
+
+	void SetParent(uint32 InIndex, uint32 InParentIndex);
+	uint32 GetParent(uint32 InIndex) const { return ParentIndices[InIndex]; }
+
+	const FVector& GetLocalLocation(uint32 InIndex) const { return LocalLocations[InIndex]; }
+	const FQuaternion& GetLocalRotation(uint32 InIndex) const { return LocalRotations[InIndex]; }
+	const FVector& GetLocalScale(uint32 InIndex) const { return LocalScales[InIndex]; }
+
+	void SetLocalLocation(uint32 InIndex, const FVector& InLocation)
+	{
+		LocalLocations[InIndex] = InLocation;
+		if (!bIsInSimulationStep)
+		{
+			PreviousLocations[InIndex] = InLocation;
+		}
+		MarkLocalDirty(InIndex);
+	}
+
+	void SetLocalRotation(uint32 InIndex, const FQuaternion& InRotation)
+	{
+		LocalRotations[InIndex] = InRotation;
+		if (!bIsInSimulationStep)
+		{
+			PreviousRotations[InIndex] = InRotation;
+		}
+		MarkLocalDirty(InIndex);
+	}
+
+	void SetLocalScale(uint32 InIndex, const FVector& InScale)
+	{
+		LocalScales[InIndex] = InScale;
+		if (!bIsInSimulationStep)
+		{
+			PreviousScales[InIndex] = InScale;
+		}
+		MarkLocalDirty(InIndex);
+	}
+
+	void MarkLocalDirty(uint32 InIndex)
+	{
+		LocalDirtyFlags[InIndex] = true;
+		bHasPendingChanges = true;
+	}
+
+	/** @brief World 행렬 (Local * Parent). 이전 갱신 이후 바뀐 내용이 있으면 부모 체인을 따라 필요한 만큼만 계산합니다. */
+	const FMatrix& GetWorldMatrix(uint32 InIndex)
+	{
+		if (bHasPendingChanges)
+		{
+			ResolveWorldMatrix(InIndex);
+		}
+		return WorldMatrices[InIndex];
+	}
+
+	const FMatrix& GetWorldMatrixInverse(uint32 InIndex);
+
+	/** @brief World 행렬이 다시 계산될 때마다 바뀌는 값 (World 행렬에서 파생된 캐시의 유효성 검사용) */
+	uint32 GetWorldVersion(uint32 InIndex)
+	{
+		if (bHasPendingChanges)
+		{
+			ResolveWorldMatrix(InIndex);
+		}
+		return WorldVersions[InIndex];
+	}
+
+	/**
+	 * @brief 바뀐 노드와 그 자손의 World 행렬을 부모 순서대로 한 번에 갱신합니다.
+	 * 프레임마다 컬링/렌더링 전에 한 번 호출하며, 이후 프레임이 끝날 때까지의 조회는 계산 없이 배열을 바로 읽습니다.
+	 */
+	void UpdateWorldTransforms();
+
+	/** @brief 고정 스텝 하나를 시작합니다. 현재 Local TRS가 보간의 이전 값이 됩니다. */
+	void BeginSimulationStep();
+	void EndSimulationStep() { bIsInSimulationStep = false; }
+	/** @brief 이전 값을 현재 Local TRS로 맞춥니다. (고정 스텝을 다시 켤 때 지난 스텝의 값으로 보간하지 않도록) */
+	void ResetInterpolation();
+
+	/**
+	 * @brief 마지막 스텝 전후의 Local TRS를 InAlpha로 보간한 값으로 바꿉니다. (렌더링 직전, UpdateWorldTransforms 전에 호출)
+	 * 렌더링이 끝나면 RestoreSimulatedTransforms로 시뮬레이션 값을 되돌려야 합니다.
+	 */
+	void ApplyInterpolation(float InAlpha);
+	/** @brief ApplyInterpolation으로 바꾼 노드를 시뮬레이션 값으로 되돌립니다. 그 사이 스텝 밖에서 새로 설정된 노드는 그대로 둡니다. */
+	void RestoreSimulatedTransforms();
+	/** @brief 마지막 ApplyInterpolation에서 보간한 노드 수 */
+	uint32 GetLastInterpolatedCount() const { return LastInterpolatedCount; }
+
+	uint32 Num() const { return static_cast<uint32>(Components.size()); }
+	/** @brief 마지막 UpdateWorldTransforms에서 다시 계산한 노드 수 */
+	uint32 GetLastUpdatedCount() const { return LastUpdatedCount; }
+
+	FSceneTransformStore(const FSceneTransformStore&) = delete;
+	FSceneTransformStore& operator=(const FSceneTransformStore&) = delete;
+
+private:
+	FSceneTransformStore() = default;
+	~FSceneTransformStore() = default;
+
+	static FMatrix ComposeLocalMatrix(const FVector& InLocation, const FQuaternion& InRotation, const FVector& InScale);
+
+	void ResolveWorldMatrix(uint32 InIndex);
+	void RecomputeWorldMatrix(uint32 InIndex);
+
+	/** @brief 비활성 노드를 제거하고 깊이 순으로 재정렬한 뒤 컴포넌트의 인덱스를 갱신합니다. */
+	void Compact();
+
+	template<typename T>
+	static void Permute(TArray<T>& InOutArray, const TArray<uint32>& InNewOrder);
+
+	// SoA 데이터 (같은 인덱스가 같은 노드)
+	TArray<FVector> LocalLocations;
+	TArray<FQuaternion> LocalRotations;
+	TArray<FVector> LocalScales;
+	TArray<FMatrix> WorldMatrices;
+	TArray<FMatrix> WorldMatrixInverses;
+	TArray<uint32> ParentIndices;
+	TArray<uint32> WorldVersions;
+	TArray<uint32> ParentVersions;		// World 행렬 계산에 사용한 부모의 WorldVersion
+	TArray<uint32> InverseVersions;		// 역행렬 계산 시점의 WorldVersion
+	TArray<uint8> LocalDirtyFlags;
+	TArray<USceneComponent*> Components;	// nullptr이면 해제된 노드
+
+	// 보간용 이전 스텝의 Local TRS
+	TArray<FVector> PreviousLocations;
+	TArray<FQuaternion> PreviousRotations;
+	TArray<FVector> PreviousScales;
+	// 스텝 도중 생성되었거나 부모가 바뀌어 이전 값과 비교할 수 없는 노드 (다음 BeginSimulationStep까지 보간 안 함)
+	TArray<uint8> InterpolationSkipFlags;
+
+	/**
+	 * @brief ApplyInterpolation이 바꾼 노드의 시뮬레이션 값과 보간 값
+	 */
+	struct FInterpolatedNode
+	{
+		uint32 Index;
+		USceneComponent* Component;	// 되돌릴 때 같은 노드인지 확인용 (역참조하지 않음)
+		FVector SimulatedLocation;
+		FQuaternion SimulatedRotation;
+		FVector SimulatedScale;
+		FVector InterpolatedLocation;
+		FQuaternion InterpolatedRotation;
+		FVector InterpolatedScale;
+	};
+	TArray<FInterpolatedNode> InterpolatedNodes;
+	uint32 LastInterpolatedCount = 0;
+	bool bIsInSimulationStep = false;
+
+	// 부모가 자식보다 뒤에 있거나 해제된 노드가 있어 재정렬이 필요함
+	bool bLayoutDirty = false;
+	// 마지막 UpdateWorldTransforms 이후 바뀐 노드가 있음 (없으면 조회 시 부모 체인 검사도 생략)
+	bool bHasPendingChanges = false;
+	uint32 LastUpdatedCount = 0;
+};
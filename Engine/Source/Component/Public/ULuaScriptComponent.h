@@ -1,5 +1,7 @@
 #pragma once
+#if WITH_LUA
 #include "sol/sol.hpp"
+#endif
 #include "Global/Types.h"
 #include "Component/Public/ActorComponent.h"
 #include <string>
@@ -32,22 +34,27 @@ public:
     // Script management
     FString GetScriptName() const { return ScriptName; }
     bool LoadScript();
-    
+
+#if WITH_LUA
     template<typename... Args>
     void ActivateFunction(const FString& FunctionName, Args&&... args);
     
     sol::table& GetLuaSelfTable() { return SelfTable; }
+#endif
     void SetScriptName(const FString& InScriptName);
 
 private:
     FString ScriptName;
+#if WITH_LUA
     sol::table SelfTable;
+#endif
     TArray<int> ActiveCoroutineIDs;  // Track coroutines started by this component
 
 public:
     void RegisterCoroutine(int coroutineID);
 };
 
+#if WITH_LUA
 template<typename ...Args>
 inline void ULuaScriptComponent::ActivateFunction(const FString& FunctionName, Args && ...args)
 {
@@ -61,3 +68,4 @@ inline void ULuaScriptComponent::ActivateFunction(const FString& FunctionName, A
         }
     }
 }
+#endif
@@ -2,18 +2,39 @@
 #include "Core/Public/Class.h"
 #include "Core/Public/Object.h"
 
+#include <stdexcept>
+
 using std::stringstream;
 
+/**
+ * @brief 클래스를 등록하고 IsChildOf에 사용할 조상 배열을 계산
+ * StaticClass()가 호출될 때마다 불리므로 이미 등록된 클래스는 바로 반환한다
+ * 부모 클래스는 생성자 인자(SuperClassName::StaticClass())를 평가하면서 먼저 등록되어 있다
+ */
 void UClass::SignUpClass(UClass* InClass)
 {
-	if (InClass)
+	if (InClass && !InClass->bIsSignedUp)
 	{
-		for (UClass* Class : GetAllClasses())
+		const UClass* Super = InClass->SuperClass;
+		if (Super)
 		{
-			if (Class == InClass) return;
+			assert(Super->bIsSignedUp && "UClass: 부모 클래스가 먼저 등록되어야 합니다");
+
+			// 조상 배열은 고정 크기이므로 Release 빌드에서도 넘치기 전에 중단한다
+			if (Super->ClassDepth + 1 >= MAX_CLASS_DEPTH)
+			{
+				throw std::runtime_error("UClass: inheritance depth of " + InClass->GetName().ToString() +
+					" exceeds MAX_CLASS_DEPTH (" + std::to_string(MAX_CLASS_DEPTH) + ")");
+			}
+
+			InClass->ClassDepth = Super->ClassDepth + 1;
+			std::copy(Super->SuperClassChain, Super->SuperClassChain + InClass->ClassDepth, InClass->SuperClassChain);
 		}
+		InClass->SuperClassChain[InClass->ClassDepth] = InClass;
+		InClass->bIsSignedUp = true;
+
 		GetAllClasses().emplace_back(InClass);
-		UE_LOG("UClass: Class registered: %s (Total: %llu)", InClass->GetName().ToString().data(), GetAllClasses().size());
+		UE_LOG("UClass: Class registered: %s (Total: %llu)", InClass->GetName().ToStringView().data(), GetAllClasses().size());
 	}
 }
 
@@ -61,40 +82,7 @@ TArray<UClass*>& UClass::GetAllClasses()
 UClass::UClass(const FName& InName, UClass* InSuperClass, size_t InClassSize, ClassConstructorType InConstructor, bool InIsAbstract)
 	: ClassName(InName), SuperClass(InSuperClass), ClassSize(InClassSize), Constructor(InConstructor), bIsAbstract(InIsAbstract)
 {
-	UE_LOG("UClass: 클래스 등록: %s", ClassName.ToString().data());
-}
-
-/**
- * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인
- * @param InClass 확인할 클래스
- * @return 하위 클래스이거나 같은 클래스면 true
- */
-bool UClass::IsChildOf(UClass* InClass) const
-{
-	if (!InClass)
-	{
-		return false;
-	}
-
-	// 자기 자신과 같은 클래스인 경우
-	if (this == InClass)
-	{
-		return true;
-	}
-
-	// 부모 클래스들을 거슬러 올라가면서 확인
-	const UClass* CurrentClass = this;
-	while (CurrentClass)
-	{
-		if (CurrentClass->ClassName == InClass->ClassName)
-		{
-			return true;
-		}
-
-		CurrentClass = CurrentClass->SuperClass;
-	}
-
-	return false;
+	UE_LOG("UClass: 클래스 등록: %s", ClassName.ToStringView().data());
 }
 
 /**
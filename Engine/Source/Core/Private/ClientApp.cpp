@@ -13,10 +13,12 @@
 #include "Manager/UI/Public/UIManager.h"
 #include "Manager/Config/Public/ConfigManager.h"
 #include "Render/Renderer/Public/Renderer.h"
+#include "Component/Public/SceneTransformStore.h"
 
 #include "Render/UI/Window/Public/ConsoleWindow.h"
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Utility/Public/ScopeCycleCounter.h"
+#include "Utility/Public/HitchDetector.h"
 #include "Manager/UI/Public/ViewportManager.h"
 
 #ifdef IS_OBJ_VIEWER
@@ -85,13 +87,21 @@ int FClientApp::InitializeSystem() const
 	// 현재 시간을 랜덤 시드로 설정
 	srand(static_cast<unsigned int>(time(NULL)));
 
+	FProfiler::GetInstance().SetCurrentThreadName("Main");
+
 	// Initialize By Get Instance
 	UTimeManager::GetInstance();
 	UInputManager::GetInstance();
-	FLuaScriptManager::GetInstance().StartUp(); // LuaManager 초기화
+	{
+		MEMORY_TAG_SCOPE(Lua)
+		FLuaScriptManager::GetInstance().StartUp(); // LuaManager 초기화
+	}
 	
 	auto& Renderer = URenderer::GetInstance();
-	Renderer.Init(Window->GetWindowHandle());
+	{
+		MEMORY_TAG_SCOPE(Render)
+		Renderer.Init(Window->GetWindowHandle());
+	}
 
 	UAssetManager::GetInstance().Initialize();
 
@@ -123,9 +133,11 @@ void FClientApp::UpdateSystem() const
 	auto& UIManager = UUIManager::GetInstance();
 	auto& Renderer = URenderer::GetInstance();
 	auto& LuaManager = FLuaScriptManager::GetInstance(); // LuaManager 인스턴스 가져오기
+	auto& TransformStore = FSceneTransformStore::GetInstance();
 	{
 		TIME_PROFILE(TimeManager)
 		TimeManager.Update();
+		FMemoryTracker::Update(DT);
 	}
 	{
 		TIME_PROFILE(InputManager)
@@ -135,23 +147,84 @@ void FClientApp::UpdateSystem() const
 		TIME_PROFILE(ViewportManager)
 		UViewportManager::GetInstance().Update();
 	}
+
+	const bool bIsFixedTimestep = TimeManager.IsFixedTimestepEnabled();
+	if (bIsFixedTimestep)
 	{
-		TIME_PROFILE(GEditor)
-		GEditor->Tick(DT);
+		// 고정 스텝: World와 Lua 코루틴을 스텝마다 번갈아 진행해야 프레임 시간과 무관하게 같은 궤적이 나옴
+		const FFixedStepClock& FixedStepClock = TimeManager.GetFixedStepClock();
+		const float StepSeconds = FixedStepClock.GetStepSeconds();
+		for (uint32 Step = 0; Step < FixedStepClock.GetSubstepCount(); ++Step)
+		{
+			TransformStore.BeginSimulationStep();
+			{
+				TIME_PROFILE(GEditor)
+				MEMORY_TAG_SCOPE(Level)
+				GEditor->TickWorlds(StepSeconds);
+			}
+			{
+				TIME_PROFILE(LuaManager)
+				MEMORY_TAG_SCOPE(Lua)
+				LuaManager.TickCoroutines(StepSeconds);
+			}
+			TransformStore.EndSimulationStep();
+		}
+		{
+			TIME_PROFILE(GEditor)
+			MEMORY_TAG_SCOPE(Level)
+			GEditor->TickEditor();
+		}
+		{
+			TIME_PROFILE(LuaManager)
+			MEMORY_TAG_SCOPE(Lua)
+			LuaManager.HotReloadLuaScript();
+		}
 	}
+	else
 	{
-		TIME_PROFILE(LuaManager) // LuaManager 업데이트 프로파일링
-		LuaManager.Tick(DT);
+		{
+			TIME_PROFILE(GEditor)
+			MEMORY_TAG_SCOPE(Level)
+			GEditor->Tick(DT);
+		}
+		{
+			TIME_PROFILE(LuaManager) // LuaManager 업데이트 프로파일링
+			MEMORY_TAG_SCOPE(Lua)
+			LuaManager.Tick(DT);
+		}
 	}
+
 	{
 		TIME_PROFILE(UIManager)
+		MEMORY_TAG_SCOPE(UI)
 		UIManager.Update();
 	}	
+
+	// 스텝 사이의 남은 시간만큼 보간한 Transform으로 그리고, 렌더링 후 시뮬레이션 값으로 되돌림
+	const bool bShouldInterpolate = bIsFixedTimestep && TimeManager.IsInterpolationEnabled();
+	{
+		// 이번 프레임에 움직인 컴포넌트의 World 행렬을 컬링 전에 한 번에 갱신
+		TIME_PROFILE(TransformUpdate)
+		if (bShouldInterpolate)
+		{
+			TransformStore.ApplyInterpolation(TimeManager.GetFixedStepClock().GetAlpha());
+		}
+		TransformStore.UpdateWorldTransforms();
+	}
 	{
 		TIME_PROFILE(Renderer)
+		MEMORY_TAG_SCOPE(Render)
 		Renderer.Update();
 	}
+	if (bShouldInterpolate)
+	{
+		TIME_PROFILE(TransformUpdate)
+		TransformStore.RestoreSimulatedTransforms();
+	}
 	UInputManager::GetInstance().ClearMouseWheelDelta();
+
+	// 이번 프레임의 임시 할당(TFrameArray)을 모두 비운다
+	FFrameArena::GetInstance().Reset();
 }
 
 /**
@@ -176,8 +249,9 @@ void FClientApp::MainLoop()
 	bool bIsExit = false;
 	while (!bIsExit)
 	{
-		TStatId StatId("DeltaTime");
-		FScopeCycleCounter CycleCounter(StatId);
+		// 한 프레임 전체가 프로파일러 호출 트리의 루트
+		static const TStatId FrameStatId("Frame");
+		FScopeCycleCounter CycleCounter(FrameStatId);
 		// Async Message Process
 		while (PeekMessage(&MainMessage, nullptr, 0, 0, PM_REMOVE))
 		{
@@ -197,7 +271,14 @@ void FClientApp::MainLoop()
 		// Game System Update
 		UpdateSystem();
 
-		UTimeManager::GetInstance().SetDeltaTime(static_cast<float>(CycleCounter.Finish()) / 1000.0f);
+		const double FrameMilliseconds = CycleCounter.Finish();
+		UTimeManager::GetInstance().SetDeltaTime(static_cast<float>(FrameMilliseconds) / 1000.0f);
+
+		// 이번 프레임에 닫힌 모든 구간을 노드별 기록으로 모음
+		FProfiler::GetInstance().EndFrame();
+
+		// 노드 기록이 이번 프레임 값으로 바뀐 뒤에 히치를 판정해야 원인 구간을 찾을 수 있음
+		FHitchDetector::GetInstance().AddFrame(FrameMilliseconds);
 	}
 }
 
@@ -1,13 +1,27 @@
 #include "pch.h"
 #include "Core/Public/Name.h"
-#include <algorithm> // for std::transform
-#include <cctype>    // for std::tolower
+
+namespace
+{
+	constexpr uint32 FNV_OFFSET_BASIS = 2166136261u;
+	constexpr uint32 FNV_PRIME = 16777619u;
+
+	// ASCII 대문자만 소문자로 접는다 (로케일 의존 없이 tolower와 같은 결과)
+	inline char FoldCase(char C)
+	{
+		return (C >= 'A' && C <= 'Z') ? static_cast<char>(C + ('a' - 'A')) : C;
+	}
+}
 
 FName::FName() : DisplayIndex(0), ComparisonIndex(0), Number(-1)
 {
 }
 
-FName::FName(const FString& Str)
+FName::FName(const FString& Str) : FName(std::string_view(Str)) { }
+
+FName::FName(const char* Str) : FName(Str ? std::string_view(Str) : std::string_view()) { }
+
+FName::FName(std::string_view Str)
 {
     TPair<int32, int32> Indices = FNameTable::GetInstance().FindOrAddName(Str);
     ComparisonIndex = Indices.first;
@@ -15,8 +29,6 @@ FName::FName(const FString& Str)
     Number = -1;
 }
 
-FName::FName(const char* Str) : FName(FString(Str)) { }
-
 /**
 * @brief NameTable에서 UniqueName을 만들 때 사용하는 생성자
 * 
@@ -46,12 +58,21 @@ int32 FName::Compare(const FName& Other) const
 
 FString FName::ToString() const
 {
-    FString BaseName = FNameTable::GetInstance().GetDisplayString(DisplayIndex);
+    return FString(ToStringView());
+}
+
+std::string_view FName::ToStringView() const
+{
     if (Number >= 0)
     {
-        return BaseName + "_" + to_string(Number);
+        return FNameTable::GetInstance().GetNumberedString(DisplayIndex, Number);
     }
-    return BaseName;
+    return FNameTable::GetInstance().GetDisplayStringView(DisplayIndex);
+}
+
+void FName::AppendString(FString& Out) const
+{
+    Out.append(ToStringView());
 }
 
 FString FName::ToBaseNameString() const
@@ -65,16 +86,221 @@ FName FName::GetNone()
 }
 const FName FName::None(0, 0, -1); 
 
-// FNameTable
+// FNamePool
+FNamePool::FNamePool(bool bInCaseInsensitive) : bCaseInsensitive(bInCaseInsensitive)
+{
+    FSlotTable* Table = new FSlotTable();
+    Table->Mask = 1024 - 1;
+    Table->Slots = new std::atomic<uint32>[Table->Mask + 1];
+    for (uint32 Index = 0; Index <= Table->Mask; ++Index)
+    {
+        Table->Slots[Index].store(0, std::memory_order_relaxed);
+    }
+    SlotTable.store(Table, std::memory_order_release);
+}
+
+FNamePool::~FNamePool()
+{
+    FSlotTable* Table = SlotTable.load(std::memory_order_acquire);
+    while (Table)
+    {
+        FSlotTable* Previous = Table->Previous;
+        delete[] Table->Slots;
+        delete Table;
+        Table = Previous;
+    }
+
+    const uint32 Count = EntryCount.load(std::memory_order_acquire);
+    for (uint32 Index = 0; Index < Count; ++Index)
+    {
+        if (FNumberedNameCache* Cache = GetEntry(static_cast<int32>(Index))->NumberedNames.load(std::memory_order_acquire))
+        {
+            for (std::atomic<std::atomic<const char*>*>& Bucket : Cache->Buckets)
+            {
+                delete[] Bucket.load(std::memory_order_acquire);
+            }
+            delete Cache;
+        }
+    }
+
+    for (std::atomic<FNameEntry*>& Chunk : EntryChunks)
+    {
+        delete[] Chunk.load(std::memory_order_acquire);
+    }
+
+    for (char* Block : StringBlocks)
+    {
+        delete[] Block;
+    }
+}
+
 /**
-* @brief FString 객체를 받아 풀에 없으면 반환
-* @param Str FName으로 등록되었는지 확인할 FString
-* @return DisplayIndex, ComparisonIndex
-*/
-FNameTable::FNameTable()
+ * @brief FNV-1a 해시, 대소문자 무시 Pool이면 ASCII 대문자를 접어서 계산하므로 소문자 복사본을 만들 필요가 없음
+ */
+uint32 FNamePool::Hash(std::string_view Str) const
+{
+    uint32 HashValue = FNV_OFFSET_BASIS;
+    if (bCaseInsensitive)
+    {
+        for (char C : Str)
+        {
+            HashValue = (HashValue ^ static_cast<uint8>(FoldCase(C))) * FNV_PRIME;
+        }
+    }
+    else
+    {
+        for (char C : Str)
+        {
+            HashValue = (HashValue ^ static_cast<uint8>(C)) * FNV_PRIME;
+        }
+    }
+    return HashValue;
+}
+
+bool FNamePool::Equals(const FNameEntry& Entry, std::string_view Str, uint32 InHash) const
+{
+    if (Entry.Hash != InHash || Entry.Length != Str.size())
+    {
+        return false;
+    }
+
+    if (!bCaseInsensitive)
+    {
+        return memcmp(Entry.Data, Str.data(), Str.size()) == 0;
+    }
+
+    for (size_t Index = 0; Index < Str.size(); ++Index)
+    {
+        if (FoldCase(Entry.Data[Index]) != FoldCase(Str[Index]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32 FNamePool::Find(std::string_view Str, uint32 InHash) const
+{
+    const FSlotTable* Table = SlotTable.load(std::memory_order_acquire);
+    for (uint32 SlotIndex = InHash & Table->Mask; ; SlotIndex = (SlotIndex + 1) & Table->Mask)
+    {
+        const uint32 SlotValue = Table->Slots[SlotIndex].load(std::memory_order_acquire);
+        if (SlotValue == 0)
+        {
+            return INDEX_NONE;
+        }
+
+        const int32 Index = static_cast<int32>(SlotValue - 1);
+        const FNameEntry* Entry = GetEntry(Index);
+        if (Entry && Equals(*Entry, Str, InHash))
+        {
+            return Index;
+        }
+    }
+}
+
+int32 FNamePool::Add(std::string_view Str, uint32 InHash, int32 InComparisonIndex)
+{
+    const uint32 Index = EntryCount.load(std::memory_order_relaxed);
+    const uint32 ChunkIndex = Index / ENTRIES_PER_CHUNK;
+    assert(ChunkIndex < MAX_ENTRY_CHUNKS && "FNamePool: 이름 수가 최대치를 넘었습니다");
+
+    FNameEntry* Chunk = EntryChunks[ChunkIndex].load(std::memory_order_relaxed);
+    if (!Chunk)
+    {
+        Chunk = new FNameEntry[ENTRIES_PER_CHUNK];
+        EntryChunks[ChunkIndex].store(Chunk, std::memory_order_release);
+    }
+
+    FNameEntry& Entry = Chunk[Index % ENTRIES_PER_CHUNK];
+    Entry.Data = StoreString(Str);
+    Entry.Length = static_cast<uint32>(Str.size());
+    Entry.Hash = InHash;
+    Entry.ComparisonIndex = InComparisonIndex;
+
+    // 항목을 다 채운 뒤에 개수와 슬롯을 게시해야 lock 없이 읽는 쪽이 완성된 항목만 본다
+    EntryCount.store(Index + 1, std::memory_order_release);
+
+    FSlotTable* Table = SlotTable.load(std::memory_order_relaxed);
+    if ((Index + 1) * 2 > Table->Mask + 1)
+    {
+        Grow();
+        Table = SlotTable.load(std::memory_order_relaxed);
+    }
+    InsertSlot(*Table, InHash, Index + 1);
+
+    return static_cast<int32>(Index);
+}
+
+const char* FNamePool::StoreString(std::string_view Str)
+{
+    // Null 종료 문자까지 저장해 c_str처럼 쓸 수 있게 한다
+    const size_t RequiredSize = Str.size() + 1;
+    if (RequiredSize > STRING_BLOCK_SIZE)
+    {
+        char* LargeBlock = new char[RequiredSize];
+        StringBlocks.push_back(LargeBlock);
+        memcpy(LargeBlock, Str.data(), Str.size());
+        LargeBlock[Str.size()] = '\0';
+        return LargeBlock;
+    }
+
+    if (!CurrentStringBlock || StringBlockOffset + RequiredSize > STRING_BLOCK_SIZE)
+    {
+        CurrentStringBlock = new char[STRING_BLOCK_SIZE];
+        StringBlocks.push_back(CurrentStringBlock);
+        StringBlockOffset = 0;
+    }
+
+    char* Destination = CurrentStringBlock + StringBlockOffset;
+    memcpy(Destination, Str.data(), Str.size());
+    Destination[Str.size()] = '\0';
+    StringBlockOffset += RequiredSize;
+    return Destination;
+}
+
+void FNamePool::Grow()
+{
+    FSlotTable* OldTable = SlotTable.load(std::memory_order_relaxed);
+
+    FSlotTable* NewTable = new FSlotTable();
+    NewTable->Mask = (OldTable->Mask + 1) * 2 - 1;
+    NewTable->Slots = new std::atomic<uint32>[NewTable->Mask + 1];
+    for (uint32 Index = 0; Index <= NewTable->Mask; ++Index)
+    {
+        NewTable->Slots[Index].store(0, std::memory_order_relaxed);
+    }
+
+    for (uint32 Index = 0; Index <= OldTable->Mask; ++Index)
+    {
+        const uint32 SlotValue = OldTable->Slots[Index].load(std::memory_order_relaxed);
+        if (SlotValue != 0)
+        {
+            InsertSlot(*NewTable, GetEntry(static_cast<int32>(SlotValue - 1))->Hash, SlotValue);
+        }
+    }
+
+    // 이전 테이블을 조회 중인 스레드가 있을 수 있으므로 해제하지 않고 연결만 해둔다
+    NewTable->Previous = OldTable;
+    SlotTable.store(NewTable, std::memory_order_release);
+}
+
+void FNamePool::InsertSlot(FSlotTable& Table, uint32 InHash, uint32 SlotValue)
+{
+    uint32 SlotIndex = InHash & Table.Mask;
+    while (Table.Slots[SlotIndex].load(std::memory_order_relaxed) != 0)
+    {
+        SlotIndex = (SlotIndex + 1) & Table.Mask;
+    }
+    Table.Slots[SlotIndex].store(SlotValue, std::memory_order_release);
+}
+
+// FNameTable
+FNameTable::FNameTable() : ComparisonPool(true), DisplayPool(false)
 {
-    ComparisonMap["None"] = 0;
-    DisplayMap["None"] = 0;
+    // 0번 인덱스는 항상 "None"
+    ComparisonPool.Add("None", ComparisonPool.Hash("None"));
+    DisplayPool.Add("None", DisplayPool.Hash("None"));
 }
 
 FNameTable::~FNameTable() = default;
@@ -85,65 +311,133 @@ FNameTable& FNameTable::GetInstance()
     return Instance;
 }
 
-TPair<int32, int32> FNameTable::FindOrAddName(const FString& Str)
+/**
+* @brief 이름을 비교용/표시용 Pool에서 찾고, 없으면 추가
+* @param Str FName으로 등록되었는지 확인할 문자열
+* @return ComparisonIndex, DisplayIndex
+*/
+TPair<int32, int32> FNameTable::FindOrAddName(std::string_view Str)
 {
-    FString LowerStr = ToLower(Str);
-
-    int32 ComparisonIndex;
-    auto ItComparison = ComparisonMap.find(LowerStr);
-    if (ItComparison != ComparisonMap.end())
-    {
-        ComparisonIndex = ItComparison->second;
-    }
-    else
+    // 대부분은 이미 같은 원문으로 등록된 이름이므로 표시용 Pool 한 번의 조회로 끝난다
+    const uint32 DisplayHash = DisplayPool.Hash(Str);
+    int32 DisplayIndex = DisplayPool.Find(Str, DisplayHash);
+    if (DisplayIndex != FNamePool::INDEX_NONE)
     {
-        ComparisonIndex = static_cast<int32>(ComparisonStringPool.size());
-        ComparisonStringPool.push_back(LowerStr);
-        ComparisonMap[LowerStr] = ComparisonIndex;
+        return { DisplayPool.GetEntry(DisplayIndex)->ComparisonIndex, DisplayIndex };
     }
 
-    int32 DisplayIndex;
-    auto ItDisplay = DisplayMap.find(Str);
-    if (ItDisplay != DisplayMap.end())
+    // 다른 스레드가 먼저 추가했을 수 있으므로 lock 안에서 다시 확인
+    std::lock_guard<std::mutex> Lock(WriteMutex);
+    DisplayIndex = DisplayPool.Find(Str, DisplayHash);
+    if (DisplayIndex != FNamePool::INDEX_NONE)
     {
-        DisplayIndex = ItDisplay->second;
+        return { DisplayPool.GetEntry(DisplayIndex)->ComparisonIndex, DisplayIndex };
     }
-    else
+
+    const uint32 ComparisonHash = ComparisonPool.Hash(Str);
+    int32 ComparisonIndex = ComparisonPool.Find(Str, ComparisonHash);
+    if (ComparisonIndex == FNamePool::INDEX_NONE)
     {
-        DisplayIndex = static_cast<int32>(DisplayStringPool.size());
-        DisplayStringPool.push_back(Str);
-        DisplayMap[Str] = DisplayIndex;
+        ComparisonIndex = ComparisonPool.Add(Str, ComparisonHash);
     }
 
+    DisplayIndex = DisplayPool.Add(Str, DisplayHash, ComparisonIndex);
     return { ComparisonIndex, DisplayIndex };
 }
 
-FName FNameTable::GetUniqueName(const FString& BaseStr)
+FName FNameTable::GetUniqueName(std::string_view BaseStr)
 {
     TPair<int32, int32> Indices = FindOrAddName(BaseStr);
     int32 DisplayIndex = Indices.second;
     int32 ComparisonIndex = Indices.first;
 
-    int32 Number = NextNumberMap[BaseStr];
-    NextNumberMap[BaseStr]++;
+    // 번호는 원문(표시용 이름)별로 발급
+    int32 Number = DisplayPool.GetEntry(DisplayIndex)->NextNumber.fetch_add(1, std::memory_order_relaxed);
 
     return FName(DisplayIndex, ComparisonIndex, Number);
 }
 
 FString FNameTable::GetDisplayString(int32 Idx) const
 {
-    if (Idx >= 0 && Idx < DisplayStringPool.size())
+    return FString(GetDisplayStringView(Idx));
+}
+
+std::string_view FNameTable::GetDisplayStringView(int32 Idx) const
+{
+    if (const FNameEntry* Entry = DisplayPool.GetEntry(Idx))
     {
-        return DisplayStringPool[Idx];
+        return Entry->GetView();
     }
-    static const FString EmptyString = "None";
-    return EmptyString;
+    return "None";
 }
 
-FString FNameTable::ToLower(const FString& Str) const
+std::string_view FNameTable::GetNumberedString(int32 Idx, int32 Number)
 {
-    FString LowerStr = Str;
-    std::transform(LowerStr.begin(), LowerStr.end(), LowerStr.begin(),
-        [](unsigned char C) { return std::tolower(C); });
-    return LowerStr;
-}
\ No newline at end of file
+    FNameEntry* Entry = DisplayPool.GetEntry(Idx);
+    if (!Entry || Number < 0)
+    {
+        return GetDisplayStringView(Idx);
+    }
+
+    // 번호 문자열 길이는 Base 길이 + '_' + 자릿수로 계산 (strlen 불필요)
+    uint32 DigitCount = 1;
+    for (int32 Remaining = Number; Remaining >= 10; Remaining /= 10)
+    {
+        ++DigitCount;
+    }
+    const size_t Length = Entry->Length + 1 + DigitCount;
+
+    uint32 Offset;
+    const uint32 BucketIndex = FNumberedNameCache::GetBucketIndex(static_cast<uint32>(Number), Offset);
+    if (BucketIndex >= FNumberedNameCache::BUCKET_COUNT)
+    {
+        // 캐시 범위를 넘는 번호는 보관만 하고 재사용하지 않음
+        std::lock_guard<std::mutex> Lock(WriteMutex);
+        FString Formatted(Entry->GetView());
+        Formatted.append("_").append(to_string(Number));
+        return { DisplayPool.StoreString(Formatted), Length };
+    }
+
+    // 이미 만든 문자열은 lock 없이 반환
+    FNumberedNameCache* Cache = Entry->NumberedNames.load(std::memory_order_acquire);
+    if (Cache)
+    {
+        if (std::atomic<const char*>* Bucket = Cache->Buckets[BucketIndex].load(std::memory_order_acquire))
+        {
+            if (const char* Cached = Bucket[Offset].load(std::memory_order_acquire))
+            {
+                return { Cached, Length };
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> Lock(WriteMutex);
+    Cache = Entry->NumberedNames.load(std::memory_order_relaxed);
+    if (!Cache)
+    {
+        Cache = new FNumberedNameCache();
+        Entry->NumberedNames.store(Cache, std::memory_order_release);
+    }
+
+    std::atomic<const char*>* Bucket = Cache->Buckets[BucketIndex].load(std::memory_order_relaxed);
+    if (!Bucket)
+    {
+        const uint32 BucketSize = FNumberedNameCache::FIRST_BUCKET_SIZE << BucketIndex;
+        Bucket = new std::atomic<const char*>[BucketSize];
+        for (uint32 Index = 0; Index < BucketSize; ++Index)
+        {
+            Bucket[Index].store(nullptr, std::memory_order_relaxed);
+        }
+        Cache->Buckets[BucketIndex].store(Bucket, std::memory_order_release);
+    }
+
+    const char* Cached = Bucket[Offset].load(std::memory_order_relaxed);
+    if (!Cached)
+    {
+        FString Formatted(Entry->GetView());
+        Formatted.append("_").append(to_string(Number));
+        Cached = DisplayPool.StoreString(Formatted);
+        Bucket[Offset].store(Cached, std::memory_order_release);
+    }
+    return { Cached, Length };
+}
@@ -6,50 +6,63 @@
 #include "Core/Public/EngineStatics.h"
 #include "Core/Public/Name.h"
 #include "Core/Public/NewObject.h"
+#include "Core/Public/ObjectPool.h"
 
 
 uint32 UEngineStatics::NextUUID = 0;
 
 uint32 UObject::GlobalSerialCounter = 0;
 
-TArray<UObject*>& GetUObjectArray()
+FUObjectArray& GetUObjectArray()
 {
-	static TArray<UObject*> GUObjectArray;	
+	static FUObjectArray GUObjectArray;
 	return GUObjectArray;
 }
 
-TArray<FObjectSlot>& GetUObjectSlotArray()
-{
-	static TArray<FObjectSlot> GUObjectSlotArray;
-	return GUObjectSlotArray;
-}
-
 IMPLEMENT_CLASS_BASE(UObject)
 
 UObject::UObject()
 	: Name(FName::GetNone()), Outer(nullptr)
 {
 	UUID = UEngineStatics::GenUUID();
-	
-	GetUObjectArray().emplace_back(this);
-	InternalIndex = static_cast<uint32>(GetUObjectArray().size()) - 1;
 
-	FObjectSlot Slot;
-	Slot.SerialNumber = ++GlobalSerialCounter;
-	Slot.bIsAlive = true;
-	GetUObjectSlotArray().emplace_back(Slot);
+	// 소멸된 객체의 슬롯을 재사용하며 SerialNumber를 새로 발급받는다
+	InternalIndex = GetUObjectArray().AllocateIndex(this);
 }
 
 UObject::~UObject()
 {
-	/** @todo: 이후에 리뷰 필요 */
+	GetUObjectArray().FreeIndex(InternalIndex);
+}
 
-	// std::vector에 맞는 올바른 인덱스 유효성 검사
-	if (InternalIndex < GetUObjectArray().size())
+void* UObject::operator new(size_t InSize)
+{
+	return FUObjectPool::GetInstance().Allocate(InSize);
+}
+
+void* UObject::operator new(size_t InSize, std::align_val_t InAlignment)
+{
+	// Pool 블록은 16바이트 정렬이므로 그보다 큰 정렬이 필요한 경우만 전역 할당자로 처리
+	if (static_cast<size_t>(InAlignment) > FUObjectPool::BLOCK_ALIGNMENT)
 	{
-		GetUObjectArray()[InternalIndex] = nullptr;
-		GetUObjectSlotArray()[InternalIndex].bIsAlive = false;
+		return ::operator new(InSize, InAlignment);
+	}
+	return FUObjectPool::GetInstance().Allocate(InSize);
+}
+
+void UObject::operator delete(void* InMemory, size_t InSize) noexcept
+{
+	FUObjectPool::GetInstance().Free(InMemory, InSize);
+}
+
+void UObject::operator delete(void* InMemory, size_t InSize, std::align_val_t InAlignment) noexcept
+{
+	if (static_cast<size_t>(InAlignment) > FUObjectPool::BLOCK_ALIGNMENT)
+	{
+		::operator delete(InMemory, InAlignment);
+		return;
 	}
+	FUObjectPool::GetInstance().Free(InMemory, InSize);
 }
 
 void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -142,7 +155,7 @@ void UObject::PropagateMemoryChange(uint64 InBytesDelta, uint32 InCountDelta)
 
 /**
  * @brief 해당 클래스가 현재 내 클래스의 조상 클래스인지 판단하는 함수
- * 내부적으로 재귀를 활용해서 부모를 계속 탐색한 뒤 결과를 반환한다
+ * UClass에 등록 시 계산된 조상 배열을 사용하므로 상속 깊이와 관계없이 상수 시간에 판정한다
  * @param InClass 판정할 Class
  * @return 판정 결과
  */
@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "Core/Public/ObjectPool.h"
+
+FUObjectPool& FUObjectPool::GetInstance()
+{
+	static FUObjectPool* Instance = new FUObjectPool();
+	return *Instance;
+}
+
+void* FUObjectPool::Allocate(size_t InSize)
+{
+	if (!IsPooledSize(InSize))
+	{
+		return ::operator new(InSize);
+	}
+
+	const size_t SizeClassIndex = GetSizeClassIndex(InSize);
+	const size_t BlockSize = GetBlockSize(SizeClassIndex);
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	FSizeClassPool& Pool = Pools[SizeClassIndex];
+	if (!Pool.FreeList)
+	{
+		AddSlab(Pool, BlockSize);
+	}
+
+	FFreeBlock* Block = Pool.FreeList;
+	Pool.FreeList = Block->Next;
+	--Pool.FreeBlocks;
+	++Pool.UsedBlocks;
+
+	// 전역 operator new와 같은 기준(요청 크기)으로 메모리 통계에 반영
+	FMemoryTracker::RecordAllocation(InSize, EMemoryTag::UObject);
+
+	return Block;
+}
+
+void FUObjectPool::Free(void* InMemory, size_t InSize)
+{
+	if (!InMemory)
+	{
+		return;
+	}
+
+	if (!IsPooledSize(InSize))
+	{
+		::operator delete(InMemory);
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	// 가장 최근에 해제된 블록을 먼저 재사용 (캐시에 남아있을 가능성이 높음)
+	FSizeClassPool& Pool = Pools[GetSizeClassIndex(InSize)];
+	FFreeBlock* Block = static_cast<FFreeBlock*>(InMemory);
+	Block->Next = Pool.FreeList;
+	Pool.FreeList = Block;
+	--Pool.UsedBlocks;
+	++Pool.FreeBlocks;
+
+	FMemoryTracker::RecordFree(InSize, EMemoryTag::UObject);
+}
+
+void FUObjectPool::AddSlab(FSizeClassPool& InPool, size_t InBlockSize)
+{
+	const size_t SlabSize = std::max(MIN_SLAB_SIZE, InBlockSize * MIN_BLOCKS_PER_SLAB);
+	const uint32 BlockCount = static_cast<uint32>(SlabSize / InBlockSize);
+
+	// Slab 자체는 통계에서 제외 (블록 단위로 Allocate/Free에서 집계)
+#ifdef _MSC_VER
+	char* Slab = static_cast<char*>(_aligned_malloc(SlabSize, BLOCK_ALIGNMENT));
+#else
+	char* Slab = static_cast<char*>(std::aligned_alloc(BLOCK_ALIGNMENT, SlabSize));
+#endif
+	InPool.Slabs.push_back(Slab);
+
+	for (uint32 i = BlockCount; i > 0; --i)
+	{
+		FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Slab + (i - 1) * InBlockSize);
+		Block->Next = InPool.FreeList;
+		InPool.FreeList = Block;
+	}
+	InPool.FreeBlocks += BlockCount;
+}
+
+void FUObjectPool::GetStats(TArray<FPoolStats>& OutStats) const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	OutStats.clear();
+	for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+	{
+		const FSizeClassPool& Pool = Pools[i];
+		if (Pool.Slabs.empty())
+		{
+			continue;
+		}
+
+		FPoolStats Stats;
+		Stats.BlockSize = GetBlockSize(i);
+		Stats.SlabCount = static_cast<uint32>(Pool.Slabs.size());
+		Stats.UsedBlocks = Pool.UsedBlocks;
+		Stats.FreeBlocks = Pool.FreeBlocks;
+		OutStats.push_back(Stats);
+	}
+}
+
+uint64 FUObjectPool::GetReservedBytes() const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	uint64 Bytes = 0;
+	for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+	{
+		const FSizeClassPool& Pool = Pools[i];
+		Bytes += static_cast<uint64>(Pool.Slabs.size()) * std::max(MIN_SLAB_SIZE, GetBlockSize(i) * MIN_BLOCKS_PER_SLAB);
+	}
+	return Bytes;
+}
@@ -0,0 +1,163 @@
+#include "pch.h"
+#include "Core/Public/UObjectArray.h"
+#include "Core/Public/Object.h"
+
+FUObjectArray::~FUObjectArray()
+{
+	for (FObjectSlot* Chunk : Chunks)
+	{
+		delete[] Chunk;
+	}
+	Chunks.clear();
+}
+
+uint32 FUObjectArray::AllocateIndex(UObject* InObject)
+{
+	uint32 Index;
+	if (FreeHead != INVALID_INDEX)
+	{
+		// 1. 소멸된 객체의 슬롯을 재사용
+		Index = FreeHead;
+		FreeHead = GetSlot(Index)->PrevIndex;
+	}
+	else
+	{
+		// 2. 비어있는 슬롯이 없으면 배열 끝에 추가 (필요하면 청크 할당)
+		if (SlotCount == Chunks.size() * CHUNK_SIZE)
+		{
+			Chunks.push_back(new FObjectSlot[CHUNK_SIZE]);
+		}
+		Index = SlotCount++;
+	}
+
+	FObjectSlot* Slot = GetSlot(Index);
+	Slot->Object = InObject;
+	Slot->SerialNumber = ++UObject::GlobalSerialCounter;
+	Slot->Class = nullptr;
+	AddToList(UnlinkedList, Index);
+
+	++LiveCount;
+	return Index;
+}
+
+void FUObjectArray::FreeIndex(uint32 InIndex)
+{
+	FObjectSlot* Slot = GetSlot(InIndex);
+	if (!Slot || !Slot->Object)
+	{
+		return;
+	}
+
+	RemoveFromList(GetList(Slot->Class), InIndex);
+
+	// SerialNumber는 재사용 시 새로 발급되므로, 비어있는 동안에도 이전 값과 달라지도록 0으로 둔다
+	// NextIndex는 순회 중인 TObjectIterator가 다음 객체를 찾을 수 있도록 남겨두고, Free list는 PrevIndex로 연결
+	Slot->Object = nullptr;
+	Slot->SerialNumber = 0;
+	Slot->Class = nullptr;
+	Slot->PrevIndex = FreeHead;
+	FreeHead = InIndex;
+
+	--LiveCount;
+}
+
+void FUObjectArray::LinkToClassList(UObject* InObject)
+{
+	if (!InObject)
+	{
+		return;
+	}
+
+	const uint32 Index = InObject->GetInternalIndex();
+	FObjectSlot* Slot = GetSlot(Index);
+	if (!Slot || Slot->Object != InObject)
+	{
+		return;
+	}
+
+	const UClass* Class = InObject->GetClass();
+	if (Slot->Class == Class)
+	{
+		return;
+	}
+
+	RemoveFromList(GetList(Slot->Class), Index);
+	Slot->Class = Class;
+	AddToList(GetList(Class), Index);
+}
+
+void FUObjectArray::GetObjectLists(const UClass* InClass, TArray<const FObjectList*>& OutLists) const
+{
+	OutLists.clear();
+	for (const auto& Pair : ClassLists)
+	{
+		if (Pair.second.Count > 0 && Pair.first->IsChildOf(InClass))
+		{
+			OutLists.push_back(&Pair.second);
+		}
+	}
+
+	if (UnlinkedList.Count > 0)
+	{
+		OutLists.push_back(&UnlinkedList);
+	}
+}
+
+FUObjectArray::FObjectList& FUObjectArray::GetList(const UClass* InClass)
+{
+	if (!InClass)
+	{
+		return UnlinkedList;
+	}
+
+	FObjectList& List = ClassLists[InClass];
+	List.Class = InClass;
+	return List;
+}
+
+void FUObjectArray::AddToList(FObjectList& InList, uint32 InIndex)
+{
+	// 생성 순서대로 순회되도록 끝에 붙인다
+	FObjectSlot* Slot = GetSlot(InIndex);
+	Slot->PrevIndex = InList.Tail;
+	Slot->NextIndex = INVALID_INDEX;
+
+	if (InList.Tail != INVALID_INDEX)
+	{
+		GetSlot(InList.Tail)->NextIndex = InIndex;
+	}
+	else
+	{
+		InList.Head = InIndex;
+	}
+
+	InList.Tail = InIndex;
+	++InList.Count;
+}
+
+void FUObjectArray::RemoveFromList(FObjectList& InList, uint32 InIndex)
+{
+	FObjectSlot* Slot = GetSlot(InIndex);
+
+	if (Slot->PrevIndex != INVALID_INDEX)
+	{
+		GetSlot(Slot->PrevIndex)->NextIndex = Slot->NextIndex;
+	}
+	else
+	{
+		InList.Head = Slot->NextIndex;
+	}
+
+	if (Slot->NextIndex != INVALID_INDEX)
+	{
+		GetSlot(Slot->NextIndex)->PrevIndex = Slot->PrevIndex;
+	}
+	else
+	{
+		InList.Tail = Slot->PrevIndex;
+	}
+
+	// NextIndex는 지우지 않음 (FreeIndex 참고), 다시 리스트에 들어갈 때 AddToList가 덮어씀
+	Slot->PrevIndex = INVALID_INDEX;
+	--InList.Count;
+}
@@ -15,6 +15,9 @@ class UClass
 public:
     // 생성자 함수 포인터 타입 정의
     typedef UObject* (*ClassConstructorType)();
+
+    // 지원하는 최대 상속 깊이 (UObject = 0, 넘으면 SignUpClass가 std::runtime_error를 던짐)
+    static constexpr uint32 MAX_CLASS_DEPTH = 16;
 public:
     static void SignUpClass(UClass* InClass);
     static UClass* FindClass(const FName& InClassName);
@@ -30,7 +33,17 @@ public:
     UClass* GetSuperClass() const { return SuperClass; }
     size_t GetClassSize() const { return ClassSize; }
     
-    bool IsChildOf(UClass* InClass) const;
+    uint32 GetClassDepth() const { return ClassDepth; }
+
+    /**
+     * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인 (같은 클래스면 true)
+     * 등록 시 계산한 조상 배열을 사용하므로 상속 깊이와 관계없이 비교 두 번으로 끝납니다.
+     */
+    bool IsChildOf(const UClass* InClass) const
+    {
+        return InClass && InClass->ClassDepth <= ClassDepth && SuperClassChain[InClass->ClassDepth] == InClass;
+    }
+
     UObject* CreateDefaultObject() const;
 
     bool IsAbstract() const { return bIsAbstract; }
@@ -41,6 +54,12 @@ private:
     size_t ClassSize;
     ClassConstructorType Constructor;
     bool bIsAbstract;
+
+    // SignUpClass에서 계산하는 상속 정보
+    // SuperClassChain[d]는 깊이 d의 조상 클래스 (SuperClassChain[ClassDepth] == this)
+    bool bIsSignedUp = false;
+    uint32 ClassDepth = 0;
+    const UClass* SuperClassChain[MAX_CLASS_DEPTH] = {};
 };
 
 /**
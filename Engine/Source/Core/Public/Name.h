@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
+#include <string_view>
+
 /**
  * @brief 오브젝트의 이름을 담당하는 구조체
  * 대소문자 관계 없는 비교 처리와 사용자가 직접 작성한 Display Name을 동시에 사용할 수 있음
@@ -12,6 +16,7 @@ public:
 	FName();
 	FName(const FString& Str);
 	FName(const char* Str);
+	FName(std::string_view Str);
 	FName(int32 InDisplayIndex, int32 InComparisonIndex, int32 InNumber);
 
 	bool operator==(const FName& Other) const;
@@ -19,6 +24,13 @@ public:
 
 	FString ToString() const;
 	FString ToBaseNameString() const;
+	/**
+	 * @brief 할당 없이 표시용 이름을 얻습니다. (번호가 있으면 "Base_Number", 처음 요청 시 한 번만 만들어 보관)
+	 * NameTable이 보관하는 문자열이므로 프로세스가 끝날 때까지 유효하고, data()는 null 종료되어 %s에 바로 쓸 수 있습니다.
+	 */
+	std::string_view ToStringView() const;
+	/** @brief 표시용 이름을 Out 뒤에 이어 붙입니다. */
+	void AppendString(FString& Out) const;
 
 	int32 GetComparisonIndex() const { return ComparisonIndex; }
 	int32 GetDisplayIndex() const { return DisplayIndex; }
@@ -55,6 +67,126 @@ namespace std {
 }
 
 
+/**
+ * @brief 번호가 붙은 이름("Base_Number")의 캐시
+ * Bucket k는 FIRST_BUCKET_SIZE << k개의 번호를 담으므로 Bucket 20개로 6천만 개 이상의 번호를 다룹니다.
+ */
+struct FNumberedNameCache
+{
+	static constexpr uint32 FIRST_BUCKET_SIZE = 64;
+	static constexpr uint32 BUCKET_COUNT = 20;
+
+	std::atomic<std::atomic<const char*>*> Buckets[BUCKET_COUNT] = {};
+
+	/** @return Number가 들어갈 Bucket, 범위를 넘으면 BUCKET_COUNT */
+	static uint32 GetBucketIndex(uint32 Number, uint32& OutOffset)
+	{
+		const uint32 Value = Number / FIRST_BUCKET_SIZE + 1;
+		uint32 Bucket = 0;
+		while ((Value >> (Bucket + 1)) != 0)
+		{
+			++Bucket;
+		}
+		OutOffset = Number - FIRST_BUCKET_SIZE * ((1u << Bucket) - 1);
+		return Bucket;
+	}
+};
+
+/**
+ * @brief 이름 문자열 하나 (Append-only pool에 보관되며 이동/해제되지 않음)
+ * @param Hash FNV-1a 해시 (비교용 Pool은 대소문자를 무시한 해시)
+ * @param ComparisonIndex 같은 이름의 비교용 인덱스 (표시용 Pool에서만 사용, 원문이 찾아지면 비교용 Pool은 조회하지 않음)
+ * @param NextNumber GetUniqueName이 다음에 붙일 번호 (표시용 Pool에서만 사용)
+ * @param NumberedNames 번호가 붙은 표시 문자열 캐시 (표시용 Pool에서만 사용, 처음 필요할 때 생성)
+ */
+struct FNameEntry
+{
+	const char* Data = nullptr;
+	uint32 Length = 0;
+	uint32 Hash = 0;
+	int32 ComparisonIndex = 0;
+	std::atomic<int32> NextNumber{ 0 };
+	std::atomic<FNumberedNameCache*> NumberedNames{ nullptr };
+
+	std::string_view GetView() const { return { Data, Length }; }
+};
+
+/**
+ * @brief 이름 문자열을 해시로 찾아 인덱스를 발급하는 Append-only pool
+ *
+ * 항목과 문자열은 청크 단위로 할당해 한 번 추가되면 주소가 바뀌지 않고, 해시 테이블 슬롯은 atomic으로 게시하므로
+ * 조회(Find, GetEntry)는 lock 없이 동작합니다. 추가(Add)는 FNameTable의 lock 안에서만 호출됩니다.
+ * 해시 테이블이 커질 때는 새 테이블을 만들어 교체하고, 이전 테이블은 조회 중인 스레드를 위해 해제하지 않습니다.
+ */
+class FNamePool
+{
+public:
+	static constexpr uint32 ENTRIES_PER_CHUNK = 4096;
+	static constexpr uint32 MAX_ENTRY_CHUNKS = 1024;
+	static constexpr size_t STRING_BLOCK_SIZE = 64 * 1024;
+	static constexpr int32 INDEX_NONE = -1;
+
+	explicit FNamePool(bool bInCaseInsensitive);
+	~FNamePool();
+	FNamePool(const FNamePool&) = delete;
+	FNamePool& operator=(const FNamePool&) = delete;
+
+	uint32 Hash(std::string_view Str) const;
+
+	/** @return 없으면 INDEX_NONE */
+	int32 Find(std::string_view Str, uint32 InHash) const;
+	/** @brief 없다고 확인된 이름을 추가합니다. (FNameTable의 lock 안에서만 호출) */
+	int32 Add(std::string_view Str, uint32 InHash, int32 InComparisonIndex = 0);
+
+	const FNameEntry* GetEntry(int32 Index) const
+	{
+		if (Index < 0 || static_cast<uint32>(Index) >= EntryCount.load(std::memory_order_acquire))
+		{
+			return nullptr;
+		}
+		return &EntryChunks[Index / ENTRIES_PER_CHUNK].load(std::memory_order_acquire)[Index % ENTRIES_PER_CHUNK];
+	}
+	FNameEntry* GetEntry(int32 Index)
+	{
+		return const_cast<FNameEntry*>(static_cast<const FNamePool*>(this)->GetEntry(Index));
+	}
+
+	uint32 Num() const { return EntryCount.load(std::memory_order_acquire); }
+
+	/** @brief 문자열을 null 종료하여 Pool에 복사합니다. (FNameTable의 lock 안에서만 호출) */
+	const char* StoreString(std::string_view Str);
+
+private:
+	/**
+	 * @brief Open addressing 해시 테이블 (슬롯 값은 항목 인덱스 + 1, 0은 빈 슬롯)
+	 */
+	struct FSlotTable
+	{
+		uint32 Mask = 0;
+		std::atomic<uint32>* Slots = nullptr;
+		FSlotTable* Previous = nullptr;		// 교체된 이전 테이블 (소멸 시 해제)
+	};
+
+	bool Equals(const FNameEntry& Entry, std::string_view Str, uint32 InHash) const;
+	void Grow();
+	static void InsertSlot(FSlotTable& Table, uint32 InHash, uint32 SlotValue);
+
+	bool bCaseInsensitive;
+
+	std::atomic<FNameEntry*> EntryChunks[MAX_ENTRY_CHUNKS] = {};
+	std::atomic<uint32> EntryCount{ 0 };
+	std::atomic<FSlotTable*> SlotTable{ nullptr };
+
+	TArray<char*> StringBlocks;
+	char* CurrentStringBlock = nullptr;
+	size_t StringBlockOffset = 0;
+};
+
+/**
+ * @brief FName의 문자열 테이블
+ * 비교용(대소문자 무시)과 표시용(원문) Pool을 따로 두며, 두 Pool 모두 0번은 "None"입니다.
+ * 이미 등록된 이름의 조회는 lock이나 임시 문자열 없이 끝나고, 새 이름을 추가할 때만 lock을 잡습니다.
+ */
 class FNameTable
 {
 public:
@@ -63,18 +195,19 @@ public:
 public:
 	FNameTable();
 	~FNameTable();
-	TPair<int32, int32> FindOrAddName(const FString& Str);
-	FName GetUniqueName(const FString& BaseStr);
+	TPair<int32, int32> FindOrAddName(std::string_view Str);
+	FName GetUniqueName(std::string_view BaseStr);
 
 	FString GetDisplayString(int32 Idx) const;
+	std::string_view GetDisplayStringView(int32 Idx) const;
+	/** @brief Idx 이름에 "_Number"를 붙인 문자열 (이미 만든 문자열은 lock 없이 반환) */
+	std::string_view GetNumberedString(int32 Idx, int32 Number);
 
-private:
-	FString ToLower(const FString& Str) const;
-
-	TArray<FString> ComparisonStringPool;
-	TArray<FString> DisplayStringPool;
+	uint32 GetComparisonNameCount() const { return ComparisonPool.Num(); }
+	uint32 GetDisplayNameCount() const { return DisplayPool.Num(); }
 
-	TMap<FString, int32> ComparisonMap;
-	TMap<FString, int32> DisplayMap;
-	TMap<FString, int32> NextNumberMap;
-};
\ No newline at end of file
+private:
+	FNamePool ComparisonPool;
+	FNamePool DisplayPool;
+	std::mutex WriteMutex;
+};
@@ -13,6 +13,8 @@ T* NewObject(UObject* InOuter = nullptr)
 {
 	static_assert(is_base_of_v<UObject, T>, "생성할 클래스는 UObject를 반드시 상속 받아야 합니다");
 	T* NewObject = new T();
+	// 생성이 끝나 GetClass()가 최종 클래스를 반환하므로 클래스별 리스트에 연결
+	GetUObjectArray().LinkToClassList(NewObject);
 	NewObject->SetName(FNameTable::GetInstance().GetUniqueName(NewObject->GetClass()->GetName().ToString()));
 	NewObject->SetOuter(InOuter);
 	return NewObject;
@@ -25,6 +27,7 @@ inline UObject* NewObject(UClass* ClassToCreate, UObject* InOuter = nullptr)
        
 	if (NewObject)
 	{
+		GetUObjectArray().LinkToClassList(NewObject);
 		FName NewName = FNameTable::GetInstance().GetUniqueName(ClassToCreate->GetName().ToString());
 		NewObject->SetName(NewName);
 		NewObject->SetOuter(InOuter);
@@ -1,10 +1,12 @@
 #pragma once
 #include "Class.h"
 #include "Name.h"
+#include "UObjectArray.h"
+
+#include <new>
 
 namespace json { class JSON; }
 using JSON = json::JSON;
-struct FObjectSlot;
 
 UCLASS()
 class UObject
@@ -17,6 +19,13 @@ public:
 	UObject();
 	virtual ~UObject();
 
+	// 모든 UObject는 크기별 Slab pool(FUObjectPool)에서 할당되어 같은 클래스끼리 연속된 메모리에 배치됨
+	// 가상 소멸자를 통해 delete 시 실제 타입의 크기가 전달되므로 Sized delete만 제공
+	static void* operator new(size_t InSize);
+	static void* operator new(size_t InSize, std::align_val_t InAlignment);
+	static void operator delete(void* InMemory, size_t InSize) noexcept;
+	static void operator delete(void* InMemory, size_t InSize, std::align_val_t InAlignment) noexcept;
+
 	// 가상 함수 (인터페이스)
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle);
 
@@ -197,6 +206,5 @@ bool IsValid(const UObject* InObject)
 	return InObject && IsA<T>(InObject);
 }
 
-TArray<UObject*>& GetUObjectArray();
-TArray<FObjectSlot>& GetUObjectSlotArray();
+FUObjectArray& GetUObjectArray();
 
@@ -1,13 +1,26 @@
 #pragma once
 
 #include "Core/Public/Object.h"
+
+/**
+ * @brief TObject 타입(하위 클래스 포함)의 살아있는 객체만 순회하는 Iterator
+ * 전역 배열 전체가 아니라 클래스별 리스트를 따라가므로 소멸된 슬롯이나 다른 클래스의 객체는 방문하지 않습니다.
+ *
+ * 다음 객체는 ++ 시점에 현재 슬롯에서 찾으므로, 순회 중 현재 객체(와 그에 딸린 다음 객체들)를 소멸시켜도
+ * 소멸된 슬롯이 남겨둔 NextIndex를 따라 남은 객체를 이어서 방문합니다.
+ * 현재 슬롯이 ++ 전에 새 객체로 재사용되었으면 방문 시점에 기록한 다음 슬롯에서 같은 방식으로 이어갑니다.
+ * 도착한 슬롯은 SerialNumber와 리스트 클래스로 다시 검증하므로 다른 타입의 객체를 방문하지 않으며,
+ * 두 위치 모두 재사용되어 이어갈 수 없으면 해당 클래스 리스트의 나머지를 건너뜁니다.
+ * 순회 중 새로 만든 객체는 방문이 보장되지 않습니다.
+ */
 template<typename TObject>
 class TObjectIterator
 {
 public:
 	TObjectIterator() : UObjectArray(GetUObjectArray())
 	{
-		CurrentIndex = 0;
+		UObjectArray.GetObjectLists(TObject::StaticClass(), ObjectLists);
+		StartSerialNumber = UObject::GlobalSerialCounter;
 		AdvanceToNextValidObject();
 	}
 
@@ -28,7 +41,6 @@ public:
 
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
 		AdvanceToNextValidObject();
 		return *this;
 	}
@@ -53,19 +65,107 @@ private:
 	void AdvanceToNextValidObject()
 	{
 		CurrentObject = nullptr;
-		while (CurrentIndex < UObjectArray.size())
+		while (ListIndex < ObjectLists.size())
 		{
-			UObject* Obj = UObjectArray[CurrentIndex];
-			if (Obj && Obj->IsA(TObject::StaticClass()))
+			const uint32 Index = FindNextIndex();
+			if (Index == FUObjectArray::INVALID_INDEX)
+			{
+				// 현재 리스트를 다 돌았으면 다음 클래스 리스트로
+				++ListIndex;
+				CurrentIndex = FUObjectArray::INVALID_INDEX;
+				continue;
+			}
+
+			const FObjectSlot* Slot = UObjectArray.GetSlot(Index);
+			CurrentIndex = Index;
+			CurrentSerialNumber = Slot->SerialNumber;
+			PrefetchIndex = Slot->NextIndex;
+			PrefetchSerialNumber = PrefetchIndex != FUObjectArray::INVALID_INDEX ? UObjectArray.GetSlot(PrefetchIndex)->SerialNumber : 0;
+
+			// 클래스 리스트의 객체는 이미 TObject 타입이 보장되며, 미분류 리스트만 IsA 검사가 필요
+			if (Slot->Class || (Slot->Object && Slot->Object->IsA(TObject::StaticClass())))
 			{
-				CurrentObject = Cast<TObject>(Obj);
+				CurrentObject = static_cast<TObject*>(Slot->Object);
 				return;
 			}
-			++CurrentIndex;
 		}
 	}
 
-	int32 CurrentIndex;
+	/**
+	 * @brief 현재 리스트에서 마지막으로 방문한 슬롯의 다음 슬롯을 찾습니다.
+	 * @return 리스트의 끝이거나 안전하게 이어갈 수 없으면 INVALID_INDEX
+	 */
+	uint32 FindNextIndex() const
+	{
+		if (CurrentIndex == FUObjectArray::INVALID_INDEX)
+		{
+			return ObjectLists[ListIndex]->Head;
+		}
+
+		uint32 NextIndex;
+		if (ResolveNextIndex(CurrentIndex, CurrentSerialNumber, true, NextIndex))
+		{
+			return NextIndex;
+		}
+
+		// 현재 슬롯이 재사용되었으면 방문 시점에 읽어둔 다음 슬롯부터 다시 찾음
+		if (PrefetchIndex != FUObjectArray::INVALID_INDEX &&
+			ResolveNextIndex(PrefetchIndex, PrefetchSerialNumber, false, NextIndex))
+		{
+			return NextIndex;
+		}
+		return FUObjectArray::INVALID_INDEX;
+	}
+
+	/**
+	 * @brief InIndex 슬롯(방문 당시 InSerialNumber)을 기준으로 이어서 방문할 슬롯을 구합니다.
+	 * @param bInSkipSelf 기준 슬롯이 아직 살아있을 때 그 다음 슬롯을 반환할지 (false면 기준 슬롯 자신)
+	 * @return 기준 슬롯이나 도착한 슬롯이 재사용되어 연결을 신뢰할 수 없으면 false
+	 */
+	bool ResolveNextIndex(uint32 InIndex, uint32 InSerialNumber, bool bInSkipSelf, uint32& OutIndex) const
+	{
+		const FUObjectArray::FObjectList* List = ObjectLists[ListIndex];
+		const FObjectSlot* Slot = UObjectArray.GetSlot(InIndex);
+		if (Slot->SerialNumber == InSerialNumber)
+		{
+			// 살아있으면 리스트 연결을 그대로 따라감 (미분류 리스트에서 클래스 리스트로 옮겨졌다면 이 리스트는 종료)
+			OutIndex = Slot->Class != List->Class ? FUObjectArray::INVALID_INDEX : bInSkipSelf ? Slot->NextIndex : InIndex;
+			return true;
+		}
+
+		if (Slot->SerialNumber != 0)
+		{
+			return false;
+		}
+
+		// 소멸된 슬롯은 소멸 당시의 NextIndex를 남겨두므로, 살아있는 슬롯이 나올 때까지 따라감
+		uint32 Index = Slot->NextIndex;
+		while (Index != FUObjectArray::INVALID_INDEX)
+		{
+			Slot = UObjectArray.GetSlot(Index);
+			if (Slot->SerialNumber != 0)
+			{
+				// 순회 시작 이후 할당된 슬롯(재사용 포함)이나 다른 리스트의 슬롯이면 연결을 신뢰할 수 없음
+				if (Slot->SerialNumber > StartSerialNumber || Slot->Class != List->Class)
+				{
+					return false;
+				}
+				break;
+			}
+			Index = Slot->NextIndex;
+		}
+
+		OutIndex = Index;
+		return true;
+	}
+
+	FUObjectArray& UObjectArray;
+	TArray<const FUObjectArray::FObjectList*> ObjectLists;
+	uint32 ListIndex = 0;
+	uint32 CurrentIndex = FUObjectArray::INVALID_INDEX;
+	uint32 CurrentSerialNumber = 0;
+	uint32 PrefetchIndex = FUObjectArray::INVALID_INDEX;
+	uint32 PrefetchSerialNumber = 0;
+	uint32 StartSerialNumber = 0;
 	TObject* CurrentObject = nullptr;
-	TArray<UObject*>& UObjectArray;
 };
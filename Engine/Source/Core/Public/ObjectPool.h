@@ -0,0 +1,77 @@
+#pragma once
+#include "Global/Types.h"
+
+#include <mutex>
+
+/**
+ * @brief UObject 전용 크기별 Slab 할당자
+ *
+ * UObject::operator new/delete가 사용하며, 객체 크기를 16바이트 단위로 올림한 Size class마다 Slab pool을 둡니다.
+ * 같은 클래스의 객체는 항상 같은 pool에서 연속된 블록으로 할당되고, 소멸 시 pool의 Free list로 돌아가 다음 생성에 재사용됩니다.
+ * Slab은 해제하지 않고 재사용합니다. (PIE에서 생성/소멸이 반복되어도 힙 단편화가 생기지 않음)
+ *
+ * MAX_POOLED_SIZE보다 큰 객체는 전역 operator new로 처리합니다.
+ */
+class FUObjectPool
+{
+public:
+	static constexpr size_t BLOCK_ALIGNMENT = 16;
+	static constexpr size_t MAX_POOLED_SIZE = 4096;
+	static constexpr size_t SIZE_CLASS_COUNT = MAX_POOLED_SIZE / BLOCK_ALIGNMENT;
+	static constexpr size_t MIN_SLAB_SIZE = 64 * 1024;
+	static constexpr uint32 MIN_BLOCKS_PER_SLAB = 16;
+
+	/**
+	 * @brief Size class 하나의 통계
+	 */
+	struct FPoolStats
+	{
+		size_t BlockSize = 0;
+		uint32 SlabCount = 0;
+		uint32 UsedBlocks = 0;
+		uint32 FreeBlocks = 0;
+	};
+
+	static FUObjectPool& GetInstance();
+
+	void* Allocate(size_t InSize);
+	void Free(void* InMemory, size_t InSize);
+
+	static bool IsPooledSize(size_t InSize) { return InSize > 0 && InSize <= MAX_POOLED_SIZE; }
+
+	/** @brief 사용 중인 Size class의 통계를 모읍니다. */
+	void GetStats(TArray<FPoolStats>& OutStats) const;
+	/** @brief Slab으로 확보한 전체 바이트 수 */
+	uint64 GetReservedBytes() const;
+
+	FUObjectPool(const FUObjectPool&) = delete;
+	FUObjectPool& operator=(const FUObjectPool&) = delete;
+
+private:
+	// 종료 시점에 소멸되는 정적 UObject가 있으므로 pool은 프로세스가 끝날 때까지 해제하지 않음
+	FUObjectPool() = default;
+	~FUObjectPool() = default;
+
+	// Free list 노드 (비어있는 블록의 앞부분을 재사용)
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	struct FSizeClassPool
+	{
+		FFreeBlock* FreeList = nullptr;
+		TArray<void*> Slabs;
+		uint32 UsedBlocks = 0;
+		uint32 FreeBlocks = 0;
+	};
+
+	static size_t GetSizeClassIndex(size_t InSize) { return (InSize + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT - 1; }
+	static size_t GetBlockSize(size_t InSizeClassIndex) { return (InSizeClassIndex + 1) * BLOCK_ALIGNMENT; }
+
+	/** @brief 새 Slab을 할당해 모든 블록을 Free list에 연결합니다. (주소 순서대로 꺼내지도록 역순으로 연결) */
+	void AddSlab(FSizeClassPool& InPool, size_t InBlockSize);
+
+	FSizeClassPool Pools[SIZE_CLASS_COUNT];
+	mutable std::mutex Mutex;
+};
@@ -0,0 +1,101 @@
+#pragma once
+#include "Global/Types.h"
+
+class UObject;
+class UClass;
+
+/**
+ * @brief UObject 전역 배열의 슬롯
+ * 살아있는 슬롯은 같은 클래스의 객체끼리 PrevIndex/NextIndex로 연결되고 (Intrusive list),
+ * 비어있는 슬롯은 PrevIndex로 Free list에 연결됩니다.
+ * 비어있는 슬롯의 NextIndex는 소멸 당시 리스트의 다음 인덱스를 그대로 남겨, 순회 중 현재 객체가 소멸되어도 TObjectIterator가 이어서 진행할 수 있습니다.
+ * @param SerialNumber 슬롯이 재사용될 때마다 바뀌므로 TWeakObjectPtr가 이전 객체를 구분할 수 있음 (비어있는 동안은 0)
+ */
+struct FObjectSlot
+{
+	UObject* Object = nullptr;
+	uint32 SerialNumber = 0;
+	const UClass* Class = nullptr;		// nullptr이면 아직 클래스 리스트에 연결되지 않은 객체
+	uint32 PrevIndex = 0;
+	uint32 NextIndex = 0;
+};
+
+/**
+ * @brief 슬롯을 재사용하는 청크 단위 UObject 배열
+ *
+ * - 소멸된 객체의 인덱스는 Free list로 돌려받아 다음 객체에 재사용하므로, 배열 크기는 동시에 살아있던 객체 수의 최댓값을 넘지 않습니다.
+ * - 청크 단위로 할당하므로 배열이 커져도 기존 슬롯의 주소가 바뀌지 않습니다.
+ * - 살아있는 객체는 클래스별 리스트로 관리되어 TObjectIterator가 해당 클래스의 객체만 방문합니다.
+ *
+ * UObject 생성자 시점에는 가상 함수로 최종 클래스를 알 수 없으므로, 새 객체는 '미분류' 리스트에 들어갔다가
+ * 생성이 끝난 뒤(NewObject) LinkToClassList로 자기 클래스의 리스트에 옮겨집니다.
+ */
+class FUObjectArray
+{
+public:
+	static constexpr uint32 INVALID_INDEX = 0xFFFFFFFFu;
+	static constexpr uint32 CHUNK_SIZE = 16 * 1024;
+
+	/**
+	 * @brief 같은 클래스(또는 미분류) 객체들의 리스트
+	 */
+	struct FObjectList
+	{
+		const UClass* Class = nullptr;		// nullptr이면 미분류 리스트
+		uint32 Head = INVALID_INDEX;
+		uint32 Tail = INVALID_INDEX;
+		uint32 Count = 0;
+	};
+
+	FUObjectArray() = default;
+	~FUObjectArray();
+	FUObjectArray(const FUObjectArray&) = delete;
+	FUObjectArray& operator=(const FUObjectArray&) = delete;
+
+	/** @brief 빈 슬롯을 배정하고 SerialNumber를 새로 발급합니다. (미분류 리스트에 연결) */
+	uint32 AllocateIndex(UObject* InObject);
+	/** @brief 슬롯을 비우고 Free list에 돌려줍니다. */
+	void FreeIndex(uint32 InIndex);
+	/** @brief 생성이 끝난 객체를 실제 클래스의 리스트로 옮깁니다. */
+	void LinkToClassList(UObject* InObject);
+
+	FObjectSlot* GetSlot(uint32 InIndex)
+	{
+		return InIndex < SlotCount ? &Chunks[InIndex / CHUNK_SIZE][InIndex % CHUNK_SIZE] : nullptr;
+	}
+	const FObjectSlot* GetSlot(uint32 InIndex) const
+	{
+		return InIndex < SlotCount ? &Chunks[InIndex / CHUNK_SIZE][InIndex % CHUNK_SIZE] : nullptr;
+	}
+	UObject* GetObject(uint32 InIndex) const
+	{
+		const FObjectSlot* Slot = GetSlot(InIndex);
+		return Slot ? Slot->Object : nullptr;
+	}
+
+	/** @brief 한 번이라도 사용된 슬롯 수 (살아있는 객체 + Free list) */
+	uint32 Num() const { return SlotCount; }
+	uint32 GetLiveCount() const { return LiveCount; }
+	uint32 GetFreeCount() const { return SlotCount - LiveCount; }
+	uint64 GetAllocatedBytes() const { return static_cast<uint64>(Chunks.size()) * CHUNK_SIZE * sizeof(FObjectSlot); }
+
+	/**
+	 * @brief InClass 또는 그 하위 클래스의 객체 리스트를 모읍니다.
+	 * 미분류 리스트는 클래스를 알 수 없으므로 항상 포함됩니다. (방문 시 IsA로 확인 필요)
+	 */
+	void GetObjectLists(const UClass* InClass, TArray<const FObjectList*>& OutLists) const;
+	const FObjectList& GetUnlinkedList() const { return UnlinkedList; }
+
+private:
+	FObjectList& GetList(const UClass* InClass);
+	void AddToList(FObjectList& InList, uint32 InIndex);
+	void RemoveFromList(FObjectList& InList, uint32 InIndex);
+
+	TArray<FObjectSlot*> Chunks;
+	uint32 SlotCount = 0;
+	uint32 LiveCount = 0;
+	uint32 FreeHead = INVALID_INDEX;
+
+	TMap<const UClass*, FObjectList> ClassLists;
+	FObjectList UnlinkedList;
+};
@@ -617,8 +617,8 @@ void UEditor::ProcessMouseInput()
 			const int32 MouseX = static_cast<int32>(MousePos.X - ViewportInfo.TopLeftX);
 			const int32 MouseY = static_cast<int32>(MousePos.Y - ViewportInfo.TopLeftY);
 
-			TStatId StatId("Picking");
-			FScopeCycleCounter PickCounter(StatId);
+			static const TStatId PickingStatId("Picking");
+			FScopeCycleCounter PickCounter(PickingStatId);
 			PrimitiveCollided = ObjectPicker.PickPrimitiveFromHitProxy(CurrentCamera, MouseX, MouseY);
 			ActorPicked = PrimitiveCollided ? PrimitiveCollided->GetOwner() : nullptr;
 			float ElapsedMs = static_cast<float>(PickCounter.Finish());
@@ -1188,12 +1188,12 @@ FVector UEditor::GetGizmoDragScale(UCamera* InActiveCamera, FRay& WorldRay)
 
 void UEditor::SelectActor(AActor* InActor)
 {
-	if (InActor == SelectedActor) return;
+	if (InActor == GetSelectedActor()) return;
 
 	// 이전 선택 해제 (모든 컴포넌트)
-	if (SelectedActor)
+	if (GetSelectedActor())
 	{
-		for (UActorComponent* Component : SelectedActor->GetOwnedComponents())
+		for (UActorComponent* Component : GetSelectedActor()->GetOwnedComponents())
 		{
 			if (Component)
 			{
@@ -1205,10 +1205,10 @@ void UEditor::SelectActor(AActor* InActor)
 
 	SelectedActor = InActor;
 
-	if (SelectedActor)
+	if (GetSelectedActor())
 	{
 		// Actor 선택 시 모든 컴포넌트 하이라이팅
-		for (UActorComponent* Component : SelectedActor->GetOwnedComponents())
+		for (UActorComponent* Component : GetSelectedActor()->GetOwnedComponents())
 		{
 			if (Component)
 			{
@@ -1218,8 +1218,8 @@ void UEditor::SelectActor(AActor* InActor)
 
 		// Gizmo는 RootComponent에 부착
 		SelectedComponent = InActor->GetRootComponent();
-		Gizmo.SetSelectedComponent(Cast<USceneComponent>(SelectedComponent));
-		UUIManager::GetInstance().OnSelectedComponentChanged(SelectedComponent);
+		Gizmo.SetSelectedComponent(Cast<USceneComponent>(GetSelectedComponent()));
+		UUIManager::GetInstance().OnSelectedComponentChanged(GetSelectedComponent());
 	}
 	else
 	{
@@ -1232,9 +1232,9 @@ void UEditor::SelectActor(AActor* InActor)
 void UEditor::SelectActorAndComponent(AActor* InActor, UActorComponent* InComponent)
 {
 	// 이전 Actor의 모든 컴포넌트 선택 해제
-	if (SelectedActor && SelectedActor != InActor)
+	if (GetSelectedActor() && GetSelectedActor() != InActor)
 	{
-		for (UActorComponent* Component : SelectedActor->GetOwnedComponents())
+		for (UActorComponent* Component : GetSelectedActor()->GetOwnedComponents())
 		{
 			if (Component)
 			{
@@ -1242,10 +1242,10 @@ void UEditor::SelectActorAndComponent(AActor* InActor, UActorComponent* InCompon
 			}
 		}
 	}
-	else if (SelectedActor == InActor)
+	else if (GetSelectedActor() == InActor)
 	{
 		// 같은 Actor 내에서 컴포넌트만 변경: 기존 모든 컴포넌트 해제
-		for (UActorComponent* Component : SelectedActor->GetOwnedComponents())
+		for (UActorComponent* Component : GetSelectedActor()->GetOwnedComponents())
 		{
 			if (Component)
 			{
@@ -1261,22 +1261,22 @@ void UEditor::SelectActorAndComponent(AActor* InActor, UActorComponent* InCompon
 
 void UEditor::SelectComponent(UActorComponent* InComponent)
 {
-	if (InComponent == SelectedComponent) return;
+	if (InComponent == GetSelectedComponent()) return;
 
 	// Component 선택 시 단일 컴포넌트만 하이라이팅
-	if (SelectedComponent)
+	if (GetSelectedComponent())
 	{
-		SelectedComponent->OnDeselected();
+		GetSelectedComponent()->OnDeselected();
 	}
 
 	SelectedComponent = InComponent;
-	if (SelectedComponent)
+	if (GetSelectedComponent())
 	{
-		SelectedComponent->OnSelected();
-		Gizmo.SetSelectedComponent(Cast<USceneComponent>(SelectedComponent));
+		GetSelectedComponent()->OnSelected();
+		Gizmo.SetSelectedComponent(Cast<USceneComponent>(GetSelectedComponent()));
 		// 컴포넌트 선택 모드 진입 + SelectedActor 동기화
 		bIsActorSelected = false;
-		if (AActor* Owner = SelectedComponent->GetOwner())
+		if (AActor* Owner = GetSelectedComponent()->GetOwner())
 		{
 			SelectedActor = Owner;
 		}
@@ -1285,7 +1285,7 @@ void UEditor::SelectComponent(UActorComponent* InComponent)
 	{
 		Gizmo.SetSelectedComponent(nullptr);
 	}
-	UUIManager::GetInstance().OnSelectedComponentChanged(SelectedComponent);
+	UUIManager::GetInstance().OnSelectedComponentChanged(GetSelectedComponent());
 }
 
 bool UEditor::GetComponentFocusTarget(UActorComponent* Component, FVector& OutCenter, float& OutRadius)
@@ -1440,12 +1440,12 @@ void UEditor::FocusOnSelectedActor()
 	bool bSuccess = false;
 
 	// Component 선택 모드: 선택된 Component에 포커싱
-	if (!bIsActorSelected && SelectedComponent)
+	if (!bIsActorSelected && GetSelectedComponent())
 	{
 		if (bIsOrtho)
 		{
 			// Ortho 뷰: 로컬 원점(0,0,0) 사용
-			if (USceneComponent* SceneComp = Cast<USceneComponent>(SelectedComponent))
+			if (USceneComponent* SceneComp = Cast<USceneComponent>(GetSelectedComponent()))
 			{
 				Center = SceneComp->GetWorldLocation();
 				BoundingRadius = 50.0f;
@@ -1455,17 +1455,17 @@ void UEditor::FocusOnSelectedActor()
 		else
 		{
 			// Perspective 뷰: AABB 중심 사용
-			bSuccess = GetComponentFocusTarget(SelectedComponent, Center, BoundingRadius);
+			bSuccess = GetComponentFocusTarget(GetSelectedComponent(), Center, BoundingRadius);
 		}
 	}
 
 	// Actor 선택 모드: Actor 전체에 포커싱
-	else if (SelectedActor)
+	else if (GetSelectedActor())
 	{
 		if (bIsOrtho)
 		{
 			// Ortho 뷰: RootComponent의 월드 위치 사용
-			if (USceneComponent* RootComp = SelectedActor->GetRootComponent())
+			if (USceneComponent* RootComp = GetSelectedActor()->GetRootComponent())
 			{
 				Center = RootComp->GetWorldLocation();
 				BoundingRadius = 100.0f;
@@ -1475,7 +1475,7 @@ void UEditor::FocusOnSelectedActor()
 		else
 		{
 			// Perspective 뷰: AABB 중심 사용
-			bSuccess = GetActorFocusTarget(SelectedActor, Center, BoundingRadius);
+			bSuccess = GetActorFocusTarget(GetSelectedActor(), Center, BoundingRadius);
 		}
 	}
 
@@ -1531,11 +1531,11 @@ void UEditor::FocusOnSelectedActor()
 			float Distance = BoundingRadius / sinf(HalfFovRadian);
 
 			// EditorIcon이나 Billboard는 작은 스프라이트이므로 더 가까이
-			if (UEditorIconComponent* IconComp = Cast<UEditorIconComponent>(SelectedComponent))
+			if (UEditorIconComponent* IconComp = Cast<UEditorIconComponent>(GetSelectedComponent()))
 			{
 				Distance = min(Distance, 200.0f);
 			}
-			else if (UBillBoardComponent* BillboardComp = Cast<UBillBoardComponent>(SelectedComponent))
+			else if (UBillBoardComponent* BillboardComp = Cast<UBillBoardComponent>(GetSelectedComponent()))
 			{
 				Distance = min(Distance, 200.0f);
 			}
@@ -1818,7 +1818,7 @@ AActor* UEditor::DuplicateActor(AActor* InSourceActor)
 void UEditor::TogglePilotMode()
 {
 	// 진입 조건 검사
-	if (!SelectedActor)
+	if (!GetSelectedActor())
 	{
 		UE_LOG_WARNING("Pilot Mode: No actor selected");
 		return;
@@ -1850,7 +1850,7 @@ void UEditor::TogglePilotMode()
 
 	// Pilot Mode 진입
 	bIsPilotMode = true;
-	PilotedActor = SelectedActor;
+	PilotedActor = GetSelectedActor();
 	PilotModeViewportIndex = LastClickedIdx;
 
 	// 현재 카메라 위치 저장, 이후 해제 시 복원 예정
@@ -1871,7 +1871,7 @@ void UEditor::TogglePilotMode()
 		PilotModeFixedGizmoLocation = ActorLocation;
 		Gizmo.SetFixedLocation(PilotModeFixedGizmoLocation);
 
-		UE_LOG_INFO("Pilot Mode: Entered (Actor: %s)", PilotedActor->GetName().ToString().data());
+		UE_LOG_INFO("Pilot Mode: Entered (Actor: %s)", PilotedActor->GetName().ToStringView().data());
 	}
 }
 
@@ -1944,7 +1944,7 @@ void UEditor::ExitPilotMode()
 
 	if (PilotedActor)
 	{
-		UE_LOG_INFO("Pilot Mode: Exited (Actor: %s)", PilotedActor->GetName().ToString().data());
+		UE_LOG_INFO("Pilot Mode: Exited (Actor: %s)", PilotedActor->GetName().ToStringView().data());
 	}
 
 	// 기즈모 고정 위치 해제
@@ -56,6 +56,15 @@ UEditorEngine::~UEditorEngine()
  * @brief WorldContext를 순회하며 World의 Tick을 처리, EditorModule Update
  */
 void UEditorEngine::Tick(float DeltaSeconds)
+{
+    TickWorlds(DeltaSeconds);
+    TickEditor();
+}
+
+/**
+ * @brief WorldContext를 순회하며 World의 Tick만 처리 (고정 스텝에서는 스텝마다 호출)
+ */
+void UEditorEngine::TickWorlds(float DeltaSeconds)
 {
     for (FWorldContext& Context : WorldContexts)
     {
@@ -76,7 +85,13 @@ void UEditorEngine::Tick(float DeltaSeconds)
             }
         }
     }
+}
 
+/**
+ * @brief EditorModule Update (프레임마다 한 번)
+ */
+void UEditorEngine::TickEditor()
+{
     if (EditorModule)
     {
         EditorModule->Update();
@@ -219,6 +234,7 @@ UWorld* UEditorEngine::GetWorldForViewport(int32 ViewportIndex)
  */
 bool UEditorEngine::LoadLevel(const FString& InFilePath)
 {
+    MEMORY_TAG_SCOPE(Level)
     UE_LOG("GEditor: Loading Level: %s", InFilePath.data());
     
     // PIE 실행 시 PIE 종료 후 로직 실행
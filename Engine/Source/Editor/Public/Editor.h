@@ -41,8 +41,8 @@ public:
 
 	// Getter & Setter
 	EViewModeIndex GetViewMode() const { return CurrentViewMode; }
-	AActor* GetSelectedActor() const { return SelectedActor; }
-	UActorComponent* GetSelectedComponent() const { return SelectedComponent; }
+	AActor* GetSelectedActor() const { return SelectedActor.Get(); }
+	UActorComponent* GetSelectedComponent() const { return SelectedComponent.Get(); }
 	bool IsPilotMode() const { return bIsPilotMode; }
 	AActor* GetPilotedActor() const { return PilotedActor; }
 	UBatchLines* GetBatchLines() { return &BatchLines; }
@@ -55,8 +55,9 @@ public:
 
 private:
 	UObjectPicker ObjectPicker;
-	AActor* SelectedActor = nullptr; // 선택된 액터
-	UActorComponent* SelectedComponent = nullptr; // 선택된 컴포넌트
+	// 선택 대상이 다른 경로로 삭제되어도 댕글링되지 않도록 약한 포인터로 보관 (Get 시 SerialNumber 비교)
+	TWeakObjectPtr<AActor> SelectedActor; // 선택된 액터
+	TWeakObjectPtr<UActorComponent> SelectedComponent; // 선택된 컴포넌트
 
 	// 선택 타입 (Actor vs Component)
 	bool bIsActorSelected = true; // true: Actor 선택 (Root Component), false: Component 선택
@@ -41,6 +41,8 @@ public:
     ~UEditorEngine() override;
 
     void Tick(float DeltaSeconds);
+    void TickWorlds(float DeltaSeconds);
+    void TickEditor();
 
     // PIE Management
     void StartPIE();
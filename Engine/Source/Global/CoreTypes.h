@@ -2,6 +2,7 @@
 #include "Global/Vector.h"
 #include "Global/Matrix.h"
 #include "Global/Types.h"
+#include "Platform/Public/Platform.h"
 #include "Core/Public/Name.h"
 #include <Texture/Public/Material.h>
 
@@ -195,10 +196,3 @@ struct FGlobalLightConstant
 	FAmbientLightInfo Ambient;
 	FDirectionalLightInfo Directional;
 };
-
-// UObject 생존 여부 검사용 구조체
-struct FObjectSlot
-{
-	uint32 SerialNumber = 0;
-	bool bIsAlive = false;
-};
@@ -1,2 +1,14 @@
 ﻿#include "pch.h"
 #include "Global/Delegate.h"
+
+#include <atomic>
+
+FDelegateHandle FDelegateHandle::GenerateNewHandle()
+{
+	// 0은 무효 핸들이므로 1부터 발급
+	static std::atomic<uint64> NextId{ 1 };
+
+	FDelegateHandle Handle;
+	Handle.Id = NextId.fetch_add(1, std::memory_order_relaxed);
+	return Handle;
+}
@@ -1,9 +1,34 @@
 ﻿#pragma once
+#include <cstddef>
 #include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include "Global/Types.h"
 #include "Global/WeakObjectPtr.h"
 //#include "Render/UI/Window/Public/ConsoleWindow.h"
 
+/**
+ * @brief 델리게이트에 등록된 핸들러를 가리키는 핸들
+ * Add/AddDynamic이 반환하며, Remove에 넘겨 해당 핸들러만 해제할 수 있습니다.
+ * 발급 번호는 전역으로 증가하므로 다른 델리게이트의 핸들과 겹치지 않습니다.
+ */
+class FDelegateHandle
+{
+public:
+    FDelegateHandle() = default;
+
+    bool IsValid() const { return Id != 0; }
+    void Reset() { Id = 0; }
+
+    bool operator==(const FDelegateHandle& Other) const { return Id == Other.Id; }
+    bool operator!=(const FDelegateHandle& Other) const { return Id != Other.Id; }
+
+    static FDelegateHandle GenerateNewHandle();
+
+private:
+    uint64 Id = 0;
+};
 
 template<typename... Args>
 class TDelegate
@@ -11,46 +36,235 @@ class TDelegate
 public:
     using HandlerType = std::function<void(Args...)>;
 
-    // 람다, 일반 함수 등록
-    void Add(const HandlerType& Handler);
+    TDelegate() = default;
+    TDelegate(const TDelegate&) = delete;
+    TDelegate& operator=(const TDelegate&) = delete;
 
-    // 클래스 멤버 함수 등록
+    // 람다, 일반 함수 등록 (작은 람다는 힙 할당 없이 내부 버퍼에 저장)
+    template<typename FunctorType>
+    FDelegateHandle Add(FunctorType&& Handler);
+
+    // 클래스 멤버 함수 등록 (객체가 소멸되면 호출되지 않음)
     template<typename T>
-    void AddDynamic(T* Instance, void(T::*Func)(Args...));
+    FDelegateHandle AddDynamic(T* Instance, void(T::*Func)(Args...));
+
+    // 핸들로 등록된 핸들러 하나를 해제
+    bool Remove(FDelegateHandle Handle);
+    // AddDynamic으로 InInstance에 등록된 핸들러를 모두 해제
+    void RemoveAll(const void* InInstance);
 
-    // 등록된 모든 핸들러 실행
-    void BroadCast(Args... InArgs);
+    // 등록된 모든 핸들러 실행 (인자를 복사하지 않고 각 핸들러에 그대로 전달)
+    // 실행 중에 Add/Remove/Clear를 호출해도 안전하며, 실행 중에 추가된 핸들러는 다음 BroadCast부터 호출됨
+    template<typename... CallArgs>
+    void BroadCast(CallArgs&&... InArgs);
 
     void Clear();
     uint32 Num() const;
+    bool IsBound() const { return Num() > 0; }
 
 private:
-    TArray<HandlerType> Handlers;
+    /**
+     * @brief Small buffer 최적화된 타입 소거 호출 객체
+     * INLINE_SIZE 이하의 호출 객체(멤버 함수 포인터 + TWeakObjectPtr, 캡처가 적은 람다)는 내부 버퍼에 저장합니다.
+     */
+    class FCallable
+    {
+    public:
+        static constexpr size_t INLINE_SIZE = 32;
+
+        FCallable() = default;
+        template<typename FunctorType>
+        explicit FCallable(FunctorType&& InFunctor);
+        FCallable(FCallable&& Other) noexcept;
+        FCallable& operator=(FCallable&& Other) noexcept;
+        ~FCallable() { Reset(); }
+
+        FCallable(const FCallable&) = delete;
+        FCallable& operator=(const FCallable&) = delete;
+
+        void Invoke(Args... InArgs) const { InvokeFunc(GetStorage(), std::forward<Args>(InArgs)...); }
+        void Reset();
+        bool IsSet() const { return Ops != nullptr; }
+
+    private:
+        using FInvokeFunc = void (*)(void* Storage, Args... InArgs);
+
+        struct FOps
+        {
+            void (*MoveTo)(void* Source, void* Destination);
+            void (*Destroy)(void* Storage);
+        };
+
+        // bInline이 false면 Storage에는 힙에 할당한 호출 객체의 포인터가 들어있음
+        template<typename FunctorType, bool bInline>
+        struct TOps;
+
+        void* GetStorage() const { return const_cast<void*>(static_cast<const void*>(Storage)); }
+
+        // 호출은 매 BroadCast마다 일어나므로 Ops를 거치지 않도록 따로 보관
+        FInvokeFunc InvokeFunc = nullptr;
+        const FOps* Ops = nullptr;
+        alignas(std::max_align_t) unsigned char Storage[INLINE_SIZE];
+    };
+
+    struct FBinding
+    {
+        FCallable Callable;
+        FDelegateHandle Handle;
+        const void* Instance = nullptr;	// AddDynamic으로 등록된 객체 (RemoveAll용)
+    };
+
+    FDelegateHandle AddBinding(FCallable&& InCallable, const void* InInstance);
+    // BroadCast가 끝난 뒤 해제된 핸들러를 지우고 실행 중 추가된 핸들러를 합침
+    void FlushPendingChanges();
+
+    TArray<FBinding> Bindings;
+    TArray<FBinding> PendingBindings;
+    uint32 BroadcastDepth = 0;
+    bool bHasRemovedBindings = false;
+};
+
+// FCallable
+template <typename ... Args>
+template <typename FunctorType, bool bInline>
+struct TDelegate<Args...>::FCallable::TOps
+{
+    static FunctorType& Get(void* Storage)
+    {
+        if constexpr (bInline)
+        {
+            return *static_cast<FunctorType*>(Storage);
+        }
+        else
+        {
+            return **static_cast<FunctorType**>(Storage);
+        }
+    }
+
+    static void Invoke(void* Storage, Args... InArgs)
+    {
+        Get(Storage)(std::forward<Args>(InArgs)...);
+    }
+
+    static void MoveTo(void* Source, void* Destination)
+    {
+        // Inline 저장이면 Destination 버퍼에 이동 생성, 힙 저장이면 포인터만 옮김
+        if constexpr (bInline)
+        {
+            new (Destination) FunctorType(std::move(Get(Source)));
+            Get(Source).~FunctorType();
+        }
+        else
+        {
+            *static_cast<FunctorType**>(Destination) = *static_cast<FunctorType**>(Source);
+        }
+    }
+
+    static void Destroy(void* Storage)
+    {
+        if constexpr (bInline)
+        {
+            Get(Storage).~FunctorType();
+        }
+        else
+        {
+            delete &Get(Storage);
+        }
+    }
+
+    static constexpr FOps Table = { &MoveTo, &Destroy };
 };
 
 template <typename ... Args>
-void TDelegate<Args...>::Add(const HandlerType& Handler)
+template <typename FunctorType>
+TDelegate<Args...>::FCallable::FCallable(FunctorType&& InFunctor)
 {
-    Handlers.emplace_back(Handler);
+    using DecayedType = std::decay_t<FunctorType>;
+    constexpr bool bFitsInline = sizeof(DecayedType) <= INLINE_SIZE && alignof(DecayedType) <= alignof(std::max_align_t)
+        && std::is_nothrow_move_constructible<DecayedType>::value;
+
+    if constexpr (bFitsInline)
+    {
+        new (Storage) DecayedType(std::forward<FunctorType>(InFunctor));
+    }
+    else
+    {
+        *reinterpret_cast<DecayedType**>(Storage) = new DecayedType(std::forward<FunctorType>(InFunctor));
+    }
+    InvokeFunc = &TOps<DecayedType, bFitsInline>::Invoke;
+    Ops = &TOps<DecayedType, bFitsInline>::Table;
+}
+
+template <typename ... Args>
+TDelegate<Args...>::FCallable::FCallable(FCallable&& Other) noexcept
+{
+    *this = std::move(Other);
+}
+
+template <typename ... Args>
+typename TDelegate<Args...>::FCallable& TDelegate<Args...>::FCallable::operator=(FCallable&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        Reset();
+        if (Other.Ops)
+        {
+            InvokeFunc = Other.InvokeFunc;
+            Ops = Other.Ops;
+            Ops->MoveTo(Other.GetStorage(), GetStorage());
+            Other.InvokeFunc = nullptr;
+            Other.Ops = nullptr;
+        }
+    }
+    return *this;
+}
+
+template <typename ... Args>
+void TDelegate<Args...>::FCallable::Reset()
+{
+    if (Ops)
+    {
+        Ops->Destroy(GetStorage());
+        InvokeFunc = nullptr;
+        Ops = nullptr;
+    }
+}
+
+// TDelegate
+template <typename ... Args>
+template <typename FunctorType>
+FDelegateHandle TDelegate<Args...>::Add(FunctorType&& Handler)
+{
+    // 비어있는 std::function은 등록하지 않음 (기존 BroadCast의 if (Handler) 검사와 같은 동작)
+    if constexpr (std::is_same<std::decay_t<FunctorType>, HandlerType>::value)
+    {
+        if (!Handler)
+        {
+            return FDelegateHandle();
+        }
+    }
+
+    return AddBinding(FCallable(std::forward<FunctorType>(Handler)), nullptr);
 }
 
 template <typename ... Args>
 template <typename T>
-void TDelegate<Args...>::AddDynamic(T* Instance, void(T::* Func)(Args...))
+FDelegateHandle TDelegate<Args...>::AddDynamic(T* Instance, void(T::* Func)(Args...))
 {
     if (Instance == nullptr)
     {
         //UE_LOG("AddDynamic : Instance nullptr");
-        return;
+        return FDelegateHandle();
     }
 
     TWeakObjectPtr<T> WeakInstance(Instance);
 
-    HandlerType BoundHandler = [WeakInstance, Func](Args... InArgs)
+    // TWeakObjectPtr(8바이트) + 멤버 함수 포인터(최대 16바이트)이므로 내부 버퍼에 들어감
+    auto BoundHandler = [WeakInstance, Func](Args... InArgs)
     {
-        if (WeakInstance.IsValid())
+        if (T* Object = WeakInstance.Get())
         {
-            (WeakInstance.Get()->*Func)(InArgs...);
+            (Object->*Func)(std::forward<Args>(InArgs)...);
         }
         else
         {
@@ -58,30 +272,165 @@ void TDelegate<Args...>::AddDynamic(T* Instance, void(T::* Func)(Args...))
         }
     };
 
-    Handlers.emplace_back(std::move(BoundHandler));
+    return AddBinding(FCallable(std::move(BoundHandler)), Instance);
+}
+
+template <typename ... Args>
+FDelegateHandle TDelegate<Args...>::AddBinding(FCallable&& InCallable, const void* InInstance)
+{
+    FBinding Binding;
+    Binding.Callable = std::move(InCallable);
+    Binding.Handle = FDelegateHandle::GenerateNewHandle();
+    Binding.Instance = InInstance;
+    const FDelegateHandle Handle = Binding.Handle;
+
+    // 실행 중에 Bindings가 재할당되면 실행 중인 호출 객체가 이동되므로 따로 모아뒀다가 끝난 뒤 합친다
+    if (BroadcastDepth > 0)
+    {
+        PendingBindings.emplace_back(std::move(Binding));
+    }
+    else
+    {
+        Bindings.emplace_back(std::move(Binding));
+    }
+    return Handle;
 }
 
 template <typename ... Args>
-void TDelegate<Args...>::BroadCast(Args... InArgs)
+bool TDelegate<Args...>::Remove(FDelegateHandle Handle)
 {
-    for (const auto& Handler : Handlers)
+    if (!Handle.IsValid())
+    {
+        return false;
+    }
+
+    for (TArray<FBinding>* List : { &Bindings, &PendingBindings })
     {
-        if (Handler)
+        for (auto It = List->begin(); It != List->end(); ++It)
         {
-            Handler(InArgs...);
+            if (It->Handle != Handle)
+            {
+                continue;
+            }
+
+            if (BroadcastDepth > 0)
+            {
+                // 실행 중에는 지우지 않고 무효 표시만 함 (끝난 뒤 정리)
+                It->Handle.Reset();
+                bHasRemovedBindings = true;
+            }
+            else
+            {
+                List->erase(It);
+            }
+            return true;
         }
     }
-    
+    return false;
+}
+
+template <typename ... Args>
+void TDelegate<Args...>::RemoveAll(const void* InInstance)
+{
+    if (InInstance == nullptr)
+    {
+        return;
+    }
+
+    for (TArray<FBinding>* List : { &Bindings, &PendingBindings })
+    {
+        for (FBinding& Binding : *List)
+        {
+            if (Binding.Instance == InInstance)
+            {
+                Binding.Handle.Reset();
+                bHasRemovedBindings = true;
+            }
+        }
+    }
+
+    if (BroadcastDepth == 0)
+    {
+        FlushPendingChanges();
+    }
+}
+
+template <typename ... Args>
+template <typename... CallArgs>
+void TDelegate<Args...>::BroadCast(CallArgs&&... InArgs)
+{
+    ++BroadcastDepth;
+
+    // 실행 중 추가된 핸들러는 PendingBindings로 가므로 Bindings의 크기와 주소는 바뀌지 않음
+    const size_t Count = Bindings.size();
+    for (size_t Index = 0; Index < Count; ++Index)
+    {
+        const FBinding& Binding = Bindings[Index];
+        if (Binding.Handle.IsValid())
+        {
+            // 여러 핸들러에 같은 인자를 넘기므로 forward하지 않고 lvalue로 전달
+            Binding.Callable.Invoke(InArgs...);
+        }
+    }
+
+    if (--BroadcastDepth == 0)
+    {
+        FlushPendingChanges();
+    }
+}
+
+template <typename ... Args>
+void TDelegate<Args...>::FlushPendingChanges()
+{
+    if (bHasRemovedBindings)
+    {
+        Bindings.erase(std::remove_if(Bindings.begin(), Bindings.end(),
+            [](const FBinding& Binding) { return !Binding.Handle.IsValid(); }), Bindings.end());
+        PendingBindings.erase(std::remove_if(PendingBindings.begin(), PendingBindings.end(),
+            [](const FBinding& Binding) { return !Binding.Handle.IsValid(); }), PendingBindings.end());
+        bHasRemovedBindings = false;
+    }
+
+    if (!PendingBindings.empty())
+    {
+        for (FBinding& Binding : PendingBindings)
+        {
+            Bindings.emplace_back(std::move(Binding));
+        }
+        PendingBindings.clear();
+    }
 }
 
 template <typename ... Args>
 void TDelegate<Args...>::Clear()
 {
-    Handlers.clear();
+    if (BroadcastDepth > 0)
+    {
+        for (FBinding& Binding : Bindings)
+        {
+            Binding.Handle.Reset();
+        }
+        PendingBindings.clear();
+        bHasRemovedBindings = true;
+        return;
+    }
+
+    Bindings.clear();
+    PendingBindings.clear();
+    bHasRemovedBindings = false;
 }
 
 template <typename ... Args>
 uint32 TDelegate<Args...>::Num() const
 {
-    return Handlers.size();
+    uint32 Count = 0;
+    for (const FBinding& Binding : Bindings)
+    {
+        Count += Binding.Handle.IsValid() ? 1 : 0;
+    }
+    for (const FBinding& Binding : PendingBindings)
+    {
+        Count += Binding.Handle.IsValid() ? 1 : 0;
+    }
+    return Count;
 }
@@ -123,6 +123,21 @@ enum class EPrimitiveType : uint8
 };
 DECLARE_UINT8_ENUM_REFLECTION(EPrimitiveType)
 
+/**
+ * @brief Level에 등록된 Primitive가 속한 렌더 목록
+ * ULevel::RegisterComponent에서 한 번만 결정되며, 렌더링 시 타입 캐스팅 없이 분류하는 데 사용합니다.
+ */
+enum class ERenderProxyType : uint8
+{
+	None = 0,	// 렌더 목록에 속하지 않음 (Shape 등)
+	StaticMesh,
+	BillBoard,
+	EditorIcon,
+	Text,
+	UUIDText,
+	Decal,
+};
+
 /**
  * @brief RasterizerState Enum
  */
@@ -146,23 +146,29 @@ namespace EnumReflection
 	constexpr ConstexprStringView GetEnumNameRaw() noexcept
 	{
 #if defined(_MSC_VER)
+		// MSVC: "constexpr_string_view __cdecl EnumReflection::GetEnumNameRaw<enum EKeyInput,EKeyInput::W>(void)"
+		// 마지막 콤마 뒤부터 > 앞까지가 enum 값
 		ConstexprStringView FunctionName = __FUNCSIG__;
+		constexpr char Separator = ',';
+		constexpr char Terminator = '>';
 #elif defined(__clang__) || defined(__GNUC__)
+		// GCC: "... [with EnumType = EKeyInput; EnumType Value = EKeyInput::W]" (Clang은 ';' 대신 ',')
+		// 마지막 = 뒤부터 ] 앞까지가 enum 값
 		ConstexprStringView FunctionName = __PRETTY_FUNCTION__;
+		constexpr char Separator = '=';
+		constexpr char Terminator = ']';
 #else
 		return {};
 #endif
 
-		// MSVC: "constexpr_string_view __cdecl EnumReflection::GetEnumNameRaw<enum EKeyInput,EKeyInput::W>(void)"
-		// 마지막 콤마 뒤부터 > 앞까지가 enum 값
-		auto LastComma = FunctionName.find_last_of(',');
-		if (LastComma == string_view::npos)
+		auto LastSeparator = FunctionName.find_last_of(Separator);
+		if (LastSeparator == string_view::npos)
 		{
 			return {};
 		}
 
-		auto Start = LastComma + 1;
-		auto End = FunctionName.find('>', Start);
+		auto Start = LastSeparator + 1;
+		auto End = FunctionName.find(Terminator, Start);
 		if (End == string_view::npos) return {};
 
 		auto RawName = FunctionName.substr(Start, End - Start).trim();
@@ -177,6 +183,13 @@ namespace EnumReflection
 		return RawName;
 	}
 
+	/**
+	 * enum 값마다 하나씩 생기는 null-terminated 이름 저장소
+	 * (constexpr 함수 안의 static 변수는 C++23부터 표준이므로 변수 템플릿으로 둠)
+	 */
+	template <typename EnumType, EnumType Value>
+	inline constexpr EnumNameHolder<EnumType, Value, GetEnumNameRaw<EnumType, Value>().size()> EnumNameStorage{GetEnumNameRaw<EnumType, Value>()};
+
 	/**
 	 * null-terminated enum 네임 반환
 	 */
@@ -186,10 +199,7 @@ namespace EnumReflection
 		constexpr auto RawName = GetEnumNameRaw<EnumType, Value>();
 		if (RawName.empty()) return "";
 
-		// 정확한 크기 계산
-		constexpr size_t NameSize = RawName.size();
-		static constexpr EnumNameHolder<EnumType, Value, NameSize> holder{RawName};
-		return holder.data;
+		return EnumNameStorage<EnumType, Value>.data;
 	}
 
 	/**
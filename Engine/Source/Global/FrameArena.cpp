@@ -0,0 +1,130 @@
+#include "pch.h"
+#include "Global/FrameArena.h"
+
+FFrameArena& FFrameArena::GetInstance()
+{
+	static FFrameArena Instance;
+	return Instance;
+}
+
+FFrameArena::~FFrameArena()
+{
+	for (FBlock& Block : Blocks)
+	{
+		::operator delete(Block.Memory);
+	}
+	Blocks.clear();
+}
+
+void* FFrameArena::Allocate(size_t InSize, size_t InAlignment)
+{
+	if (InSize == 0)
+	{
+		InSize = 1;
+	}
+
+	if (CurrentBlock < Blocks.size())
+	{
+		FBlock& Block = Blocks[CurrentBlock];
+		const uintptr_t Base = reinterpret_cast<uintptr_t>(Block.Memory);
+		const uintptr_t Aligned = (Base + CurrentOffset + InAlignment - 1) & ~(static_cast<uintptr_t>(InAlignment) - 1);
+		const size_t NewOffset = static_cast<size_t>(Aligned - Base) + InSize;
+		if (NewOffset <= Block.Size)
+		{
+			CurrentOffset = NewOffset;
+			return reinterpret_cast<void*>(Aligned);
+		}
+	}
+
+	return AllocateFromNextBlock(InSize, InAlignment);
+}
+
+void* FFrameArena::AllocateFromNextBlock(size_t InSize, size_t InAlignment)
+{
+	UpdatePeak();
+
+	// 현재 블록에 들어가지 않으면 뒤에 남아있는 블록 중 들어갈 수 있는 블록을 사용 (Rewind 이후 재사용)
+	const size_t RequiredSize = InSize + InAlignment;
+	uint32 NextBlock = Blocks.empty() ? 0 : CurrentBlock + 1;
+	while (NextBlock < Blocks.size() && Blocks[NextBlock].Size < RequiredSize)
+	{
+		++NextBlock;
+	}
+
+	if (NextBlock >= Blocks.size())
+	{
+		FBlock NewBlock;
+		NewBlock.Size = RequiredSize > DEFAULT_BLOCK_SIZE ? RequiredSize : DEFAULT_BLOCK_SIZE;
+		NewBlock.Memory = static_cast<uint8*>(::operator new(NewBlock.Size));
+		Blocks.push_back(NewBlock);
+		NextBlock = static_cast<uint32>(Blocks.size() - 1);
+		++BlockAllocationCount;
+	}
+
+	CurrentBlock = NextBlock;
+	CurrentOffset = 0;
+	return Allocate(InSize, InAlignment);
+}
+
+void FFrameArena::Rewind(const FMarker& InMarker)
+{
+	UpdatePeak();
+	CurrentBlock = InMarker.BlockIndex;
+	CurrentOffset = InMarker.Offset;
+}
+
+void FFrameArena::Reset()
+{
+	UpdatePeak();
+	LastFramePeakBytes = FramePeakBytes;
+	FramePeakBytes = 0;
+
+	// 블록이 여러 개로 나뉘었으면 다음 프레임부터는 하나에 모두 들어가도록 합친다
+	if (Blocks.size() > 1)
+	{
+		const size_t TotalSize = GetCapacity();
+		for (FBlock& Block : Blocks)
+		{
+			::operator delete(Block.Memory);
+		}
+		Blocks.clear();
+
+		FBlock MergedBlock;
+		MergedBlock.Size = TotalSize;
+		MergedBlock.Memory = static_cast<uint8*>(::operator new(TotalSize));
+		Blocks.push_back(MergedBlock);
+		++BlockAllocationCount;
+	}
+
+	CurrentBlock = 0;
+	CurrentOffset = 0;
+}
+
+size_t FFrameArena::GetUsedBytes() const
+{
+	size_t UsedBytes = CurrentOffset;
+	for (uint32 Index = 0; Index < CurrentBlock && Index < Blocks.size(); ++Index)
+	{
+		UsedBytes += Blocks[Index].Size;
+	}
+	return UsedBytes;
+}
+
+size_t FFrameArena::GetCapacity() const
+{
+	size_t Capacity = 0;
+	for (const FBlock& Block : Blocks)
+	{
+		Capacity += Block.Size;
+	}
+	return Capacity;
+}
+
+void FFrameArena::UpdatePeak()
+{
+	const size_t UsedBytes = GetUsedBytes();
+	if (UsedBytes > FramePeakBytes)
+	{
+		FramePeakBytes = UsedBytes;
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 한 프레임 동안만 쓰이는 임시 메모리용 선형(Bump) 할당자
+ *
+ * 할당은 현재 블록의 오프셋을 밀어내기만 하고, 개별 해제는 하지 않으며 프레임 끝(Reset)에 한꺼번에 비웁니다.
+ * 한 프레임에 블록이 여러 개 필요했다면 Reset에서 그 합만큼의 블록 하나로 합치므로,
+ * 사용량이 안정되면 프레임마다 힙 할당이 일어나지 않습니다.
+ *
+ * 메인 스레드 전용이며, 할당받은 메모리는 Reset 이후 사용하면 안 됩니다.
+ * 소멸자가 필요 없는 타입(포인터, POD)만 담는 것을 전제로 합니다.
+ */
+class FFrameArena
+{
+public:
+	static constexpr size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+	static constexpr size_t DEFAULT_ALIGNMENT = 16;
+
+	/**
+	 * @brief 되감기 위치 (FFrameArenaMark가 사용)
+	 */
+	struct FMarker
+	{
+		uint32 BlockIndex = 0;
+		size_t Offset = 0;
+	};
+
+	static FFrameArena& GetInstance();
+
+	void* Allocate(size_t InSize, size_t InAlignment = DEFAULT_ALIGNMENT);
+
+	/** @brief 프레임 끝에서 호출, 모든 할당을 비웁니다. (ClientApp 메인 루프) */
+	void Reset();
+
+	FMarker GetMarker() const { return { CurrentBlock, CurrentOffset }; }
+	/** @brief Marker 이후의 할당을 되돌립니다. Marker 이후에 할당된 컨테이너가 모두 소멸된 뒤에만 호출해야 합니다. */
+	void Rewind(const FMarker& InMarker);
+
+	size_t GetUsedBytes() const;
+	size_t GetCapacity() const;
+	/** @brief 직전 프레임에 사용한 최대 바이트 수 */
+	size_t GetLastFramePeakBytes() const { return LastFramePeakBytes; }
+	/** @brief 블록이 부족해 새로 할당한 누적 횟수 (안정되면 더 이상 증가하지 않음) */
+	uint32 GetBlockAllocationCount() const { return BlockAllocationCount; }
+
+	FFrameArena(const FFrameArena&) = delete;
+	FFrameArena& operator=(const FFrameArena&) = delete;
+
+private:
+	FFrameArena() = default;
+	~FFrameArena();
+
+	struct FBlock
+	{
+		uint8* Memory = nullptr;
+		size_t Size = 0;
+	};
+
+	void* AllocateFromNextBlock(size_t InSize, size_t InAlignment);
+	void UpdatePeak();
+
+	TArray<FBlock> Blocks;
+	uint32 CurrentBlock = 0;
+	size_t CurrentOffset = 0;
+
+	size_t FramePeakBytes = 0;
+	size_t LastFramePeakBytes = 0;
+	uint32 BlockAllocationCount = 0;
+};
+
+/**
+ * @brief FFrameArena를 사용하는 STL 호환 Allocator
+ * 상태가 없으므로 모든 인스턴스가 같다고 비교되고, deallocate는 아무 일도 하지 않습니다.
+ */
+template<typename T>
+class TFrameAllocator
+{
+public:
+	using value_type = T;
+
+	TFrameAllocator() noexcept = default;
+	template<typename U>
+	TFrameAllocator(const TFrameAllocator<U>&) noexcept {}
+
+	T* allocate(size_t InCount)
+	{
+		const size_t Alignment = alignof(T) > FFrameArena::DEFAULT_ALIGNMENT ? alignof(T) : FFrameArena::DEFAULT_ALIGNMENT;
+		return static_cast<T*>(FFrameArena::GetInstance().Allocate(InCount * sizeof(T), Alignment));
+	}
+
+	void deallocate(T*, size_t) noexcept {}
+
+	template<typename U>
+	bool operator==(const TFrameAllocator<U>&) const noexcept { return true; }
+	template<typename U>
+	bool operator!=(const TFrameAllocator<U>&) const noexcept { return false; }
+};
+
+/**
+ * @brief 프레임 끝까지만 유효한 임시 배열
+ */
+template<typename T>
+using TFrameArray = TArray<T, TFrameAllocator<T>>;
+
+/**
+ * @brief 범위를 벗어나면 그 안에서 한 Arena 할당을 되돌립니다.
+ * 한 프레임에 여러 번 호출되는 함수(UpdateOverlaps 등)의 임시 배열이 프레임 내내 쌓이지 않도록 합니다.
+ * 범위 안의 TFrameArray는 이 객체보다 나중에 선언되어 먼저 소멸되어야 합니다.
+ */
+class FFrameArenaMark
+{
+public:
+	FFrameArenaMark() : Marker(FFrameArena::GetInstance().GetMarker()) {}
+	~FFrameArenaMark() { FFrameArena::GetInstance().Rewind(Marker); }
+
+	FFrameArenaMark(const FFrameArenaMark&) = delete;
+	FFrameArenaMark& operator=(const FFrameArenaMark&) = delete;
+
+private:
+	FFrameArena::FMarker Marker;
+};
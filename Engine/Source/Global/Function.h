@@ -56,6 +56,7 @@ void SafeRelease(T*& ComObj)
 	}
 }
 
+#ifdef _WIN32
 /**
  * @brief wstring을 멀티바이트 FString으로 변환합니다.
  * @param InString 변환할 FString
@@ -138,3 +139,79 @@ static string ConvertCP949ToUTF8(const char* InANSIString)
 
 	return UTF8String;
 }
+#else
+// 헤드리스(비 Windows) 빌드: Win32 변환 API 대신 UTF-8과 wchar_t(UTF-32) 사이를 직접 변환
+
+/**
+ * @brief wstring을 UTF-8 FString으로 변환합니다.
+ */
+inline FString WideStringToString(const wstring& InString)
+{
+	FString OutString;
+	OutString.reserve(InString.size());
+	for (const wchar_t Character : InString)
+	{
+		const uint32 CodePoint = static_cast<uint32>(Character);
+		if (CodePoint < 0x80)
+		{
+			OutString.push_back(static_cast<char>(CodePoint));
+		}
+		else if (CodePoint < 0x800)
+		{
+			OutString.push_back(static_cast<char>(0xC0 | (CodePoint >> 6)));
+			OutString.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			OutString.push_back(static_cast<char>(0xE0 | (CodePoint >> 12)));
+			OutString.push_back(static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			OutString.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+		}
+		else
+		{
+			OutString.push_back(static_cast<char>(0xF0 | (CodePoint >> 18)));
+			OutString.push_back(static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3F)));
+			OutString.push_back(static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			OutString.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+		}
+	}
+	return OutString;
+}
+
+/**
+ * @brief UTF-8 FString을 wstring으로 변환합니다. (잘못된 바이트는 U+FFFD)
+ */
+inline wstring StringToWideString(const FString& InString)
+{
+	wstring OutString;
+	OutString.reserve(InString.size());
+	for (size_t Index = 0; Index < InString.size();)
+	{
+		const uint8 Lead = static_cast<uint8>(InString[Index]);
+		const uint32 Length = Lead < 0x80 ? 1 : (Lead >> 5) == 0x6 ? 2 : (Lead >> 4) == 0xE ? 3 : (Lead >> 3) == 0x1E ? 4 : 0;
+		if (Length == 0 || Index + Length > InString.size())
+		{
+			OutString.push_back(static_cast<wchar_t>(0xFFFD));
+			++Index;
+			continue;
+		}
+
+		uint32 CodePoint = Length == 1 ? Lead : Lead & (0x7F >> Length);
+		for (uint32 Offset = 1; Offset < Length; ++Offset)
+		{
+			CodePoint = (CodePoint << 6) | (static_cast<uint8>(InString[Index + Offset]) & 0x3F);
+		}
+		OutString.push_back(static_cast<wchar_t>(CodePoint));
+		Index += Length;
+	}
+	return OutString;
+}
+
+/**
+ * @brief 헤드리스 빌드는 CP949 코드 페이지가 없으므로 입력을 UTF-8로 간주합니다.
+ */
+inline string ConvertCP949ToUTF8(const char* InANSIString)
+{
+	return InANSIString ? string(InANSIString) : string();
+}
+#endif
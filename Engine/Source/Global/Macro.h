@@ -3,86 +3,46 @@
 #define DT UTimeManager::GetInstance().GetDeltaTime()
 
 // UE_LOG Macro 시스템
-// 기본 UE_LOG (Info 타입)
-#define UE_LOG(fmt, ...) \
-    do { \
-        printf(fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog("" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
-
-// 로그 타입별 매크로들
-#define UE_LOG_INFO(fmt, ...) \
-    do { \
-        printf("[INFO] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Info, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
-
-#define UE_LOG_WARNING(fmt, ...) \
-    do { \
-        printf("[WARNING] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Warning, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
-
-#define UE_LOG_ERROR(fmt, ...) \
-    do { \
-        printf("[ERROR] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Error, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
-
-#define UE_LOG_SUCCESS(fmt, ...) \
+// 포맷 리터럴의 지정자 개수와 인자 타입을 컴파일 타임에 검사 (LogFormat.h)
+#define UE_LOG_VALIDATE_FORMAT(fmt, ...) \
+    static_assert(LogFormat::IsValidFormat("" fmt), "UE_LOG: invalid or unsupported format specifier ('*' width, %n, trailing '%')"); \
+    static_assert(LogFormat::CountSpecifiers("" fmt) == decltype(LogFormat::MakeArgumentList(__VA_ARGS__))::COUNT, \
+        "UE_LOG: format specifier count does not match argument count"); \
+    static_assert(LogFormat::AreArgumentsCompatible("" fmt, decltype(LogFormat::MakeArgumentList(__VA_ARGS__)){}), \
+        "UE_LOG: argument type does not match its format specifier")
+
+// 검사 후 호출 지점마다 미리 분해해 둔 세그먼트로 한 번만 포맷하고, stdout과 콘솔에 같은 메시지를 전달
+#define UE_LOG_IMPL(Type, Prefix, fmt, ...) \
     do { \
-        printf("[SUCCESS] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Success, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        UE_LOG_VALIDATE_FORMAT(fmt, ##__VA_ARGS__); \
+        static constexpr auto UELogParsedFormat = LogFormat::ParseFormat<LogFormat::CountSegments("" fmt)>("" fmt); \
+        LogFormat::FMessageBuffer UELogMessage; \
+        LogFormat::FormatTo(UELogMessage, UELogParsedFormat.Segments, UELogParsedFormat.SEGMENT_COUNT, "" fmt, ##__VA_ARGS__); \
+        UConsoleWindow::WriteLog(Type, Prefix, UELogMessage.GetData()); \
     } while(0)
 
-#define UE_LOG_SYSTEM(fmt, ...) \
-    do { \
-        printf("[SYSTEM] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::System, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
-
-#define UE_LOG_DEBUG(fmt, ...) \
-    do { \
-        printf("[DEBUG] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Debug, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
-
-#define UE_LOG_COMMAND(fmt, ...) \
-    do { \
-        printf("[CMD] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Command, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
-
-#define UE_LOG_TERMINAL(fmt, ...) \
-    do { \
-        printf("[TERMINAL] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Terminal, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
+// 기본 UE_LOG (Info 타입)
+#define UE_LOG(fmt, ...) UE_LOG_IMPL(ELogType::Info, "", fmt, ##__VA_ARGS__)
 
-#define UE_LOG_TERMINAL_ERROR(fmt, ...) \
+// 로그 타입별 매크로들
+#define UE_LOG_INFO(fmt, ...) UE_LOG_IMPL(ELogType::Info, "[INFO] ", fmt, ##__VA_ARGS__)
+#define UE_LOG_WARNING(fmt, ...) UE_LOG_IMPL(ELogType::Warning, "[WARNING] ", fmt, ##__VA_ARGS__)
+#define UE_LOG_ERROR(fmt, ...) UE_LOG_IMPL(ELogType::Error, "[ERROR] ", fmt, ##__VA_ARGS__)
+#define UE_LOG_SUCCESS(fmt, ...) UE_LOG_IMPL(ELogType::Success, "[SUCCESS] ", fmt, ##__VA_ARGS__)
+#define UE_LOG_SYSTEM(fmt, ...) UE_LOG_IMPL(ELogType::System, "[SYSTEM] ", fmt, ##__VA_ARGS__)
+#define UE_LOG_DEBUG(fmt, ...) UE_LOG_IMPL(ELogType::Debug, "[DEBUG] ", fmt, ##__VA_ARGS__)
+#define UE_LOG_COMMAND(fmt, ...) UE_LOG_IMPL(ELogType::Command, "[CMD] ", fmt, ##__VA_ARGS__)
+#define UE_LOG_TERMINAL(fmt, ...) UE_LOG_IMPL(ELogType::Terminal, "[TERMINAL] ", fmt, ##__VA_ARGS__)
+#define UE_LOG_TERMINAL_ERROR(fmt, ...) UE_LOG_IMPL(ELogType::TerminalError, "[TERMINAL_ERROR] ", fmt, ##__VA_ARGS__)
+
+// 지연 포맷 구조화 로그: 자주 호출되는 지점용 (Type은 ELogType 이름, 예: UE_LOG_DEFERRED(Success, "..."))
+// 포맷 문자열은 호출 지점마다 한 번 등록하고 이후에는 인자 값만 바이너리로 기록하며,
+// 콘솔에는 바로 출력되지 않고 "log recent" 명령이나 .ulog 디코딩 때 포맷됨
+#define UE_LOG_DEFERRED(Type, fmt, ...) \
     do { \
-        printf("[TERMINAL_ERROR] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::TerminalError, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        UE_LOG_VALIDATE_FORMAT(fmt, ##__VA_ARGS__); \
+        static const uint32 UELogFormatId = FStructuredLog::GetInstance().RegisterFormat(ELogType::Type, "" fmt, __FILE__, __LINE__); \
+        FStructuredLog::GetInstance().Record(UELogFormatId, ##__VA_ARGS__); \
     } while(0)
 
 
@@ -17,15 +17,6 @@ FMatrix FMatrix::DxToUE = FMatrix(
 		0.0f, 0.0f, 0.0f, 1.0f,
 	});
 
-/**
-* @brief float 타입의 배열을 사용한 FMatrix의 기본 생성자
-*/
-FMatrix::FMatrix()
-	: Data{ {0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0} }
-{
-}
-
-
 /**
 * @brief float 타입의 param을 사용한 FMatrix의 기본 생성자
 */
@@ -57,55 +48,6 @@ FMatrix::FMatrix(const FVector4& x, const FVector4& y, const FVector4& z)
 {
 }
 
-/**
-* @brief 항등행렬
-*/
-FMatrix FMatrix::Identity()
-{
-	return FMatrix(
-		1, 0, 0, 0,
-		0, 1, 0, 0,
-		0, 0, 1, 0,
-		0, 0, 0, 1);
-}
-
-
-/**
-* @brief 두 행렬곱을 진행한 행렬을 반환하는 연산자 함수
-*/
-FMatrix FMatrix::operator*(const FMatrix& InOtherMatrix) const
-{
-	FMatrix Result;
-
-	for (int32 i = 0; i < 4; ++i)
-	{
-		// Result의 i번째 행을 0으로 초기화
-		__m128 Res = _mm_setzero_ps();
-
-		// A의 i번째 행과 B의 각 열의 내적 계산
-		for (int32 k = 0; k < 4; ++k)
-		{
-			// A[i][k]를 4개 레인에 브로드캐스트
-			__m128 Scalar = _mm_set1_ps(Data[i][k]);
-
-			// B의 k번째 행 (또는 전치된 B의 k번째 열)
-			__m128 OtherRow = InOtherMatrix.V[k];
-
-			// 병렬 곱셈 후 누적
-			Res = _mm_add_ps(Res, _mm_mul_ps(Scalar, OtherRow));
-		}
-
-		Result.V[i] = Res;
-	}
-
-	return Result;
-}
-
-void FMatrix::operator*=(const FMatrix& InOtherMatrix)
-{
-	*this = (*this) * InOtherMatrix;
-}
-
 FVector4 FMatrix::operator[](uint32 i) const
 {
 	// 잘못된 index를 전달받으면 빈 벡터를 반환
@@ -182,12 +124,12 @@ FMatrix FMatrix::RotationMatrix(const FVector& InOtherVector)
 
 	float SP, SY, SR;
 	float CP, CY, CR;
-	SP = std::sinf(pitch);
-	CP = std::cosf(pitch);
-	SY = std::sinf(yaw);
-	CY = std::cosf(yaw);
-	SR = std::sinf(roll);
-	CR = std::cosf(roll);
+	SP = std::sin(pitch);
+	CP = std::cos(pitch);
+	SY = std::sin(yaw);
+	CY = std::cos(yaw);
+	SR = std::sin(roll);
+	CR = std::cos(roll);
 
 	// UE 표준 (Reference: RotationTranslationMatrix.h:72-85)
 	FMatrix Result;
@@ -239,8 +181,8 @@ FMatrix FMatrix::RotationMatrixInverse(const FVector& InOtherVector)
 FMatrix FMatrix::RotationX(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	Result.Data[1][1] = C;
 	Result.Data[1][2] = S;
@@ -256,8 +198,8 @@ FMatrix FMatrix::RotationX(float Radian)
 FMatrix FMatrix::RotationY(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	Result.Data[0][0] = C;
 	Result.Data[0][2] = -S;
@@ -273,8 +215,8 @@ FMatrix FMatrix::RotationY(float Radian)
 FMatrix FMatrix::RotationZ(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	// Left-Handed 좌표계에서 Z축 회전
 	Result.Data[0][0] = C;
@@ -327,30 +269,6 @@ FMatrix FMatrix::GetModelMatrixInverse(const FVector& Location, const FQuaternio
     return modelMatrixInverse;
 }
 
-FVector4 FMatrix::VectorMultiply(const FVector4& V, const FMatrix& M)
-{
-	FVector4 result = {};
-	result.X = (V.X * M.Data[0][0]) + (V.Y * M.Data[1][0]) + (V.Z * M.Data[2][0]) + (V.W * M.Data[3][0]);
-	result.Y = (V.X * M.Data[0][1]) + (V.Y * M.Data[1][1]) + (V.Z * M.Data[2][1]) + (V.W * M.Data[3][1]);
-	result.Z = (V.X * M.Data[0][2]) + (V.Y * M.Data[1][2]) + (V.Z * M.Data[2][2]) + (V.W * M.Data[3][2]);
-	result.W = (V.X * M.Data[0][3]) + (V.Y * M.Data[1][3]) + (V.Z * M.Data[2][3]) + (V.W * M.Data[3][3]);
-
-
-	return result;
-}
-
-FVector FMatrix::VectorMultiply(const FVector& V, const FMatrix& M)
-{
-	FVector result = {};
-	result.X = (V.X * M.Data[0][0]) + (V.Y * M.Data[1][0]) + (V.Z * M.Data[2][0]);
-	result.Y = (V.X * M.Data[0][1]) + (V.Y * M.Data[1][1]) + (V.Z * M.Data[2][1]);
-	result.Z = (V.X * M.Data[0][2]) + (V.Y * M.Data[1][2]) + (V.Z * M.Data[2][2]);
-	//result.W = (V.X * M.Data[0][3]) + (V.Y * M.Data[1][3]) + (V.Z * M.Data[2][3]) + (V.W * M.Data[3][3]);
-
-
-	return result;
-}
-
 // Create an orthographic projection matrix (Left-Handed)
 FMatrix FMatrix::CreateOrthoLH(float Left, float Right, float Bottom, float Top, float Near, float Far)
 {
@@ -396,43 +314,6 @@ FMatrix FMatrix::CreateLookAtLH(const FVector& Eye, const FVector& Target, const
 	return Result;
 }
 
-FMatrix FMatrix::Transpose() const
-{
-	// 1. 4개 행을 SIMD 레지스터에 로드
-	__m128 Row0 = V[0];
-	__m128 Row1 = V[1];
-	__m128 Row2 = V[2];
-	__m128 Row3 = V[3];
-
-	// 2. 1단계 셔플: 0/1행, 2/3행을 묶어 하위/상위 요소를 교차
-	__m128 T0 = _mm_unpacklo_ps(Row0, Row1); // (M00, M10, M01, M11)
-	__m128 T1 = _mm_unpackhi_ps(Row0, Row1); // (M02, M12, M03, M13)
-	__m128 T2 = _mm_unpacklo_ps(Row2, Row3); // (M20, M30, M21, M31)
-	__m128 T3 = _mm_unpackhi_ps(Row2, Row3); // (M22, M32, M23, M33)
-
-	// 3. 2단계 셔플: 중간 결과를 조합하여 최종 전치된 행(원래 행렬의 열)을 만듦
-	FMatrix Result;
-
-	// Result.V[0] = (M00, M10, M20, M30) - 기존 0열
-	Result.V[0] = _mm_shuffle_ps(T0, T2, _MM_SHUFFLE(1, 0, 1, 0));
-
-	// Result.V[1] = (M01, M11, M21, M31) - 기존 1열
-	Result.V[1] = _mm_shuffle_ps(T0, T2, _MM_SHUFFLE(3, 2, 3, 2));
-
-	// Result.V[2] = (M02, M12, M22, M32) - 기존 2열
-	Result.V[2] = _mm_shuffle_ps(T1, T3, _MM_SHUFFLE(1, 0, 1, 0));
-
-	// Result.V[3] = (M03, M13, M23, M33) - 기존 3열
-	Result.V[3] = _mm_shuffle_ps(T1, T3, _MM_SHUFFLE(3, 2, 3, 2));
-
-	return Result;
-}
-
-FVector FMatrix::GetLocation() const
-{
-    return FVector(Data[3][0], Data[3][1], Data[3][2]);
-}
-
 FVector FMatrix::GetRotation() const
 {
     // Assuming the angles are in radians.
@@ -449,15 +330,6 @@ FVector FMatrix::GetScale() const
                    sqrtf(Data[2][0] * Data[2][0] + Data[2][1] * Data[2][1] + Data[2][2] * Data[2][2]));
 }
 
-FVector FMatrix::TransformPosition(const FVector& V) const
-{
-    return FVector(
-        V.X * Data[0][0] + V.Y * Data[1][0] + V.Z * Data[2][0] + Data[3][0],
-        V.X * Data[0][1] + V.Y * Data[1][1] + V.Z * Data[2][1] + Data[3][1],
-        V.X * Data[0][2] + V.Y * Data[1][2] + V.Z * Data[2][2] + Data[3][2]
-    );
-}
-
 FMatrix FMatrix::CreateFromRotator(const FRotator& InRotator)
 {
     float PitchRad = FVector::GetDegreeToRadian(InRotator.Pitch);
@@ -467,42 +339,91 @@ FMatrix FMatrix::CreateFromRotator(const FRotator& InRotator)
     return RotationZ(RollRad) * RotationY(YawRad) * RotationX(PitchRad);
 }
 
+/**
+ * @brief 아핀 변환(회전/스케일 + 이동) 행렬의 역행렬
+ * 3x3 부분의 역행렬은 두 행끼리의 외적(여인수)을 전치하고 행렬식으로 나눠 구하고, 이동은 -T * (3x3)^-1로 구합니다.
+ * 행렬식이 0에 가까우면 항등행렬을 반환합니다.
+ */
 FMatrix FMatrix::Inverse() const
 {
-    FMatrix Result;
+	// (Y, Z, X) 순서로 회전
+	auto RotateYZX = [](__m128 InV) { return _mm_shuffle_ps(InV, InV, _MM_SHUFFLE(3, 0, 2, 1)); };
+	auto Cross = [&RotateYZX](__m128 InA, __m128 InB)
+	{
+		const __m128 Result = _mm_sub_ps(_mm_mul_ps(InA, RotateYZX(InB)), _mm_mul_ps(RotateYZX(InA), InB));
+		return RotateYZX(Result);
+	};
 
-    float Det = Data[0][0] * (Data[1][1] * Data[2][2] - Data[1][2] * Data[2][1])
-              - Data[0][1] * (Data[1][0] * Data[2][2] - Data[1][2] * Data[2][0])
-              + Data[0][2] * (Data[1][0] * Data[2][1] - Data[1][1] * Data[2][0]);
+	const __m128 C0 = Cross(V[1], V[2]);
+	const __m128 C1 = Cross(V[2], V[0]);
+	const __m128 C2 = Cross(V[0], V[1]);
 
-    if (std::abs(Det) < 1e-6f)
-    {
-        return FMatrix::Identity();
-    }
+	// Det = Row0 · (Row1 x Row2)
+	alignas(16) float DotProduct[4];
+	_mm_store_ps(DotProduct, _mm_mul_ps(V[0], C0));
+	const float Det = DotProduct[0] + DotProduct[1] + DotProduct[2];
 
-    float InvDet = 1.0f / Det;
+	if (std::abs(Det) < 1e-6f)
+	{
+		return FMatrix::Identity();
+	}
 
-    Result.Data[0][0] = (Data[1][1] * Data[2][2] - Data[1][2] * Data[2][1]) * InvDet;
-    Result.Data[0][1] = (Data[0][2] * Data[2][1] - Data[0][1] * Data[2][2]) * InvDet;
-    Result.Data[0][2] = (Data[0][1] * Data[1][2] - Data[0][2] * Data[1][1]) * InvDet;
-    Result.Data[0][3] = 0.0f;
+	// 여인수 행렬을 전치하면 (C0, C1, C2)가 역행렬의 열이 됨
+	__m128 Row0 = C0;
+	__m128 Row1 = C1;
+	__m128 Row2 = C2;
+	__m128 Row3 = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(Row0, Row1, Row2, Row3);
 
-    Result.Data[1][0] = (Data[1][2] * Data[2][0] - Data[1][0] * Data[2][2]) * InvDet;
-    Result.Data[1][1] = (Data[0][0] * Data[2][2] - Data[0][2] * Data[2][0]) * InvDet;
-    Result.Data[1][2] = (Data[0][2] * Data[1][0] - Data[0][0] * Data[1][2]) * InvDet;
-    Result.Data[1][3] = 0.0f;
+	// W 성분은 0으로 (원래 행렬의 W 열은 사용하지 않음)
+	const __m128 InvDet = _mm_setr_ps(1.0f / Det, 1.0f / Det, 1.0f / Det, 0.0f);
 
-    Result.Data[2][0] = (Data[1][0] * Data[2][1] - Data[1][1] * Data[2][0]) * InvDet;
-    Result.Data[2][1] = (Data[0][1] * Data[2][0] - Data[0][0] * Data[2][1]) * InvDet;
-    Result.Data[2][2] = (Data[0][0] * Data[1][1] - Data[0][1] * Data[1][0]) * InvDet;
-    Result.Data[2][3] = 0.0f;
+	FMatrix Result;
+	Result.V[0] = _mm_mul_ps(Row0, InvDet);
+	Result.V[1] = _mm_mul_ps(Row1, InvDet);
+	Result.V[2] = _mm_mul_ps(Row2, InvDet);
 
-    Result.Data[3][0] = -(Result.Data[0][0] * Data[3][0] + Result.Data[1][0] * Data[3][1] + Result.Data[2][0] * Data[3][2]);
-    Result.Data[3][1] = -(Result.Data[0][1] * Data[3][0] + Result.Data[1][1] * Data[3][1] + Result.Data[2][1] * Data[3][2]);
-    Result.Data[3][2] = -(Result.Data[0][2] * Data[3][0] + Result.Data[1][2] * Data[3][1] + Result.Data[2][2] * Data[3][2]);
-    Result.Data[3][3] = 1.0f;
+	// 이동: -(Tx * Row0 + Ty * Row1 + Tz * Row2), W = 1
+	const __m128 Translation = _mm_setr_ps(Data[3][0], Data[3][1], Data[3][2], 0.0f);
+	__m128 InverseTranslation = _mm_mul_ps(_mm_shuffle_ps(Translation, Translation, _MM_SHUFFLE(0, 0, 0, 0)), Result.V[0]);
+	InverseTranslation = _mm_add_ps(InverseTranslation, _mm_mul_ps(_mm_shuffle_ps(Translation, Translation, _MM_SHUFFLE(1, 1, 1, 1)), Result.V[1]));
+	InverseTranslation = _mm_add_ps(InverseTranslation, _mm_mul_ps(_mm_shuffle_ps(Translation, Translation, _MM_SHUFFLE(2, 2, 2, 2)), Result.V[2]));
+	Result.V[3] = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), InverseTranslation);
 
-    return Result;
+	return Result;
+}
+
+void FMatrix::TransformPositions(const FVector* InPositions, FVector* OutPositions, size_t InCount) const
+{
+	const __m128 Row0 = V[0];
+	const __m128 Row1 = V[1];
+	const __m128 Row2 = V[2];
+	const __m128 Row3 = V[3];
+
+	for (size_t Index = 0; Index < InCount; ++Index)
+	{
+		const FVector& Position = InPositions[Index];
+		__m128 Result = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Position.X), Row0), Row3);
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Position.Y), Row1));
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Position.Z), Row2));
+		OutPositions[Index] = MatrixSIMD::StoreVector3(Result);
+	}
+}
+
+void FMatrix::TransformVectors(const FVector* InVectors, FVector* OutVectors, size_t InCount) const
+{
+	const __m128 Row0 = V[0];
+	const __m128 Row1 = V[1];
+	const __m128 Row2 = V[2];
+
+	for (size_t Index = 0; Index < InCount; ++Index)
+	{
+		const FVector& Vector = InVectors[Index];
+		__m128 Result = _mm_mul_ps(_mm_set1_ps(Vector.X), Row0);
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Vector.Y), Row1));
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Vector.Z), Row2));
+		OutVectors[Index] = MatrixSIMD::StoreVector3(Result);
+	}
 }
 
 FQuaternion FMatrix::ToQuaternion() const
@@ -549,22 +470,6 @@ FQuaternion FMatrix::ToQuaternion() const
 
 
 
-// PSM helper functions
-FVector4 FMatrix::TransformVector4(const FVector4& V) const
-{
-    return V * (*this);
-}
-
-FVector FMatrix::TransformVector(const FVector& V) const
-{
-    // Transform vector without translation (direction vector)
-    return FVector(
-        V.X * Data[0][0] + V.Y * Data[1][0] + V.Z * Data[2][0],
-        V.X * Data[0][1] + V.Y * Data[1][1] + V.Z * Data[2][1],
-        V.X * Data[0][2] + V.Y * Data[1][2] + V.Z * Data[2][2]
-    );
-}
-
 FMatrix FMatrix::CreatePerspectiveLH(float Width, float Height, float Near, float Far)
 {
     FMatrix Result;
@@ -1,8 +1,7 @@
 #pragma once
+#include "Global/Vector.h"
 
 struct FRotator;
-struct FVector;
-struct FVector4;
 struct FQuaternion;
 
 struct FMatrix
@@ -128,6 +127,15 @@ struct FMatrix
 	FVector4 TransformVector4(const FVector4& V) const;
 	FVector TransformVector(const FVector& V) const;
 
+	/**
+	 * @brief 위치 배열을 한 번에 변환 (행렬 행을 한 번만 로드, InPositions와 OutPositions는 같은 배열이어도 됨)
+	 */
+	void TransformPositions(const FVector* InPositions, FVector* OutPositions, size_t InCount) const;
+	/**
+	 * @brief 방향 벡터 배열을 한 번에 변환 (이동 성분 무시)
+	 */
+	void TransformVectors(const FVector* InVectors, FVector* OutVectors, size_t InCount) const;
+
 	// Additional projection matrix creation functions
 	static FMatrix CreatePerspectiveLH(float Width, float Height, float Near, float Far);
 	static FMatrix CreatePerspectiveFovLH(float FovY, float AspectRatio, float Near, float Far);
@@ -137,3 +145,124 @@ struct FMatrix
 	static FMatrix CreateFromRotator(const FRotator& InRotator);
 	FQuaternion ToQuaternion() const;
 };
+
+/*
+ * 자주 호출되는 연산은 호출 비용 없이 인라인되도록 헤더에 정의
+ * Row-vector 시스템 (V * M): 결과 = X * Row0 + Y * Row1 + Z * Row2 + W * Row3
+ */
+namespace MatrixSIMD
+{
+	inline __m128 LoadVector3(const FVector& InVector, float InW)
+	{
+		return _mm_setr_ps(InVector.X, InVector.Y, InVector.Z, InW);
+	}
+
+	inline FVector StoreVector3(__m128 InV)
+	{
+		alignas(16) float Result[4];
+		_mm_store_ps(Result, InV);
+		return FVector(Result[0], Result[1], Result[2]);
+	}
+
+	inline __m128 MultiplyRows(__m128 InV, const FMatrix& InMatrix)
+	{
+		__m128 Result = _mm_mul_ps(_mm_shuffle_ps(InV, InV, _MM_SHUFFLE(0, 0, 0, 0)), InMatrix.V[0]);
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_shuffle_ps(InV, InV, _MM_SHUFFLE(1, 1, 1, 1)), InMatrix.V[1]));
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_shuffle_ps(InV, InV, _MM_SHUFFLE(2, 2, 2, 2)), InMatrix.V[2]));
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_shuffle_ps(InV, InV, _MM_SHUFFLE(3, 3, 3, 3)), InMatrix.V[3]));
+		return Result;
+	}
+}
+
+/**
+* @brief float 타입의 배열을 사용한 FMatrix의 기본 생성자
+*/
+inline FMatrix::FMatrix()
+{
+	V[0] = V[1] = V[2] = V[3] = _mm_setzero_ps();
+}
+
+/**
+* @brief 항등행렬
+*/
+inline FMatrix FMatrix::Identity()
+{
+	FMatrix Result;
+	Result.V[0] = _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f);
+	Result.V[1] = _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f);
+	Result.V[2] = _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f);
+	Result.V[3] = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+	return Result;
+}
+
+/**
+* @brief 두 행렬곱을 진행한 행렬을 반환하는 연산자 함수
+* Result의 i번째 행 = (A의 i번째 행) * B
+*/
+inline FMatrix FMatrix::operator*(const FMatrix& InOtherMatrix) const
+{
+	FMatrix Result;
+	Result.V[0] = MatrixSIMD::MultiplyRows(V[0], InOtherMatrix);
+	Result.V[1] = MatrixSIMD::MultiplyRows(V[1], InOtherMatrix);
+	Result.V[2] = MatrixSIMD::MultiplyRows(V[2], InOtherMatrix);
+	Result.V[3] = MatrixSIMD::MultiplyRows(V[3], InOtherMatrix);
+	return Result;
+}
+
+inline void FMatrix::operator*=(const FMatrix& InOtherMatrix)
+{
+	*this = (*this) * InOtherMatrix;
+}
+
+inline FMatrix FMatrix::Transpose() const
+{
+	// 1단계 셔플: 0/1행, 2/3행을 묶어 하위/상위 요소를 교차
+	const __m128 T0 = _mm_unpacklo_ps(V[0], V[1]); // (M00, M10, M01, M11)
+	const __m128 T1 = _mm_unpackhi_ps(V[0], V[1]); // (M02, M12, M03, M13)
+	const __m128 T2 = _mm_unpacklo_ps(V[2], V[3]); // (M20, M30, M21, M31)
+	const __m128 T3 = _mm_unpackhi_ps(V[2], V[3]); // (M22, M32, M23, M33)
+
+	// 2단계 셔플: 원래 행렬의 열을 행으로
+	FMatrix Result;
+	Result.V[0] = _mm_shuffle_ps(T0, T2, _MM_SHUFFLE(1, 0, 1, 0));
+	Result.V[1] = _mm_shuffle_ps(T0, T2, _MM_SHUFFLE(3, 2, 3, 2));
+	Result.V[2] = _mm_shuffle_ps(T1, T3, _MM_SHUFFLE(1, 0, 1, 0));
+	Result.V[3] = _mm_shuffle_ps(T1, T3, _MM_SHUFFLE(3, 2, 3, 2));
+	return Result;
+}
+
+inline FVector4 FMatrix::VectorMultiply(const FVector4& InVector, const FMatrix& InMatrix)
+{
+	return FVector4(MatrixSIMD::MultiplyRows(InVector.V, InMatrix));
+}
+
+inline FVector FMatrix::VectorMultiply(const FVector& InVector, const FMatrix& InMatrix)
+{
+	return MatrixSIMD::StoreVector3(MatrixSIMD::MultiplyRows(MatrixSIMD::LoadVector3(InVector, 0.0f), InMatrix));
+}
+
+inline FVector FMatrix::GetLocation() const
+{
+	return FVector(Data[3][0], Data[3][1], Data[3][2]);
+}
+
+inline FVector FMatrix::TransformPosition(const FVector& InVector) const
+{
+	return MatrixSIMD::StoreVector3(MatrixSIMD::MultiplyRows(MatrixSIMD::LoadVector3(InVector, 1.0f), *this));
+}
+
+inline FVector4 FMatrix::TransformVector4(const FVector4& InVector) const
+{
+	return FVector4(MatrixSIMD::MultiplyRows(InVector.V, *this));
+}
+
+inline FVector FMatrix::TransformVector(const FVector& InVector) const
+{
+	// 방향 벡터이므로 이동 성분(W = 0) 제외
+	return MatrixSIMD::StoreVector3(MatrixSIMD::MultiplyRows(MatrixSIMD::LoadVector3(InVector, 0.0f), *this));
+}
+
+inline FVector4 FVector4::operator*(const FMatrix& InMatrix) const
+{
+	return FVector4(MatrixSIMD::MultiplyRows(V, InMatrix));
+}
@@ -1,13 +1,160 @@
 #include "pch.h"
 #include "Global/Memory.h"
 
+#include <atomic>
 #include <new>
 
 using std::align_val_t;
 
-// XXX(KHJ): Atomic 처리할 필요가 있을까?
-uint32 TotalAllocationBytes = 0;
-uint32 TotalAllocationCount = 0;
+namespace
+{
+	constexpr size_t MEMORY_TAG_COUNT = static_cast<size_t>(EMemoryTag::Count);
+
+	/**
+	 * @brief 스레드 하나의 태그별 카운터
+	 * 소유 스레드만 쓰고 Update만 읽으므로 relaxed load/store로 충분하다 (x86에서는 일반 mov/add)
+	 */
+	struct FThreadMemoryCounters
+	{
+		std::atomic<int64> Bytes[MEMORY_TAG_COUNT];
+		std::atomic<int64> Counts[MEMORY_TAG_COUNT];
+		std::atomic<uint64> Allocations[MEMORY_TAG_COUNT];
+		FThreadMemoryCounters* Next = nullptr;
+	};
+
+	// 스레드가 종료되어도 카운터는 합산에 필요하므로 해제하지 않는다
+	std::atomic<FThreadMemoryCounters*> GThreadCountersHead{ nullptr };
+
+	thread_local FThreadMemoryCounters* GThreadCounters = nullptr;
+	thread_local EMemoryTag GCurrentMemoryTag = EMemoryTag::Untagged;
+
+	FMemoryTagStats GMemoryTagStats[MEMORY_TAG_COUNT];
+	FMemoryTagStats GMemoryTotalStats;
+
+	FThreadMemoryCounters& GetThreadCounters()
+	{
+		if (!GThreadCounters)
+		{
+			// operator new를 거치면 재귀하므로 malloc으로 직접 할당
+			void* Memory = malloc(sizeof(FThreadMemoryCounters));
+			FThreadMemoryCounters* Counters = new (Memory) FThreadMemoryCounters();
+			for (size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+			{
+				Counters->Bytes[i].store(0, std::memory_order_relaxed);
+				Counters->Counts[i].store(0, std::memory_order_relaxed);
+				Counters->Allocations[i].store(0, std::memory_order_relaxed);
+			}
+
+			Counters->Next = GThreadCountersHead.load(std::memory_order_relaxed);
+			while (!GThreadCountersHead.compare_exchange_weak(Counters->Next, Counters, std::memory_order_release, std::memory_order_relaxed))
+			{
+			}
+			GThreadCounters = Counters;
+		}
+		return *GThreadCounters;
+	}
+
+	template <typename T>
+	void AddRelaxed(std::atomic<T>& InCounter, T InDelta)
+	{
+		InCounter.store(InCounter.load(std::memory_order_relaxed) + InDelta, std::memory_order_relaxed);
+	}
+}
+
+const char* GetMemoryTagName(EMemoryTag InTag)
+{
+	switch (InTag)
+	{
+	case EMemoryTag::Untagged:	return "Untagged";
+	case EMemoryTag::UObject:	return "UObject";
+	case EMemoryTag::Render:	return "Render";
+	case EMemoryTag::Asset:		return "Asset";
+	case EMemoryTag::Lua:		return "Lua";
+	case EMemoryTag::Level:		return "Level";
+	case EMemoryTag::UI:		return "UI";
+	case EMemoryTag::Log:		return "Log";
+	default:					return "Unknown";
+	}
+}
+
+void FMemoryTracker::RecordAllocation(size_t InSize, EMemoryTag InTag)
+{
+	FThreadMemoryCounters& Counters = GetThreadCounters();
+	const size_t TagIndex = static_cast<size_t>(InTag);
+	AddRelaxed<int64>(Counters.Bytes[TagIndex], static_cast<int64>(InSize));
+	AddRelaxed<int64>(Counters.Counts[TagIndex], 1);
+	AddRelaxed<uint64>(Counters.Allocations[TagIndex], 1);
+}
+
+void FMemoryTracker::RecordFree(size_t InSize, EMemoryTag InTag)
+{
+	FThreadMemoryCounters& Counters = GetThreadCounters();
+	const size_t TagIndex = static_cast<size_t>(InTag);
+	AddRelaxed<int64>(Counters.Bytes[TagIndex], -static_cast<int64>(InSize));
+	AddRelaxed<int64>(Counters.Counts[TagIndex], -1);
+}
+
+EMemoryTag FMemoryTracker::GetCurrentTag()
+{
+	return GCurrentMemoryTag;
+}
+
+void FMemoryTracker::SetCurrentTag(EMemoryTag InTag)
+{
+	GCurrentMemoryTag = InTag;
+}
+
+void FMemoryTracker::Update(float InDeltaSeconds)
+{
+	int64 Bytes[MEMORY_TAG_COUNT] = {};
+	int64 Counts[MEMORY_TAG_COUNT] = {};
+	uint64 Allocations[MEMORY_TAG_COUNT] = {};
+
+	for (FThreadMemoryCounters* Counters = GThreadCountersHead.load(std::memory_order_acquire); Counters; Counters = Counters->Next)
+	{
+		for (size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+		{
+			Bytes[i] += Counters->Bytes[i].load(std::memory_order_relaxed);
+			Counts[i] += Counters->Counts[i].load(std::memory_order_relaxed);
+			Allocations[i] += Counters->Allocations[i].load(std::memory_order_relaxed);
+		}
+	}
+
+	auto UpdateStats = [InDeltaSeconds](FMemoryTagStats& OutStats, int64 InBytes, int64 InCount, uint64 InAllocations)
+	{
+		// 다른 스레드의 카운터를 읽는 사이에 할당/해제가 끼어들면 잠깐 음수가 될 수 있음
+		OutStats.LiveBytes = static_cast<uint64>(std::max<int64>(InBytes, 0));
+		OutStats.LiveCount = static_cast<uint64>(std::max<int64>(InCount, 0));
+		OutStats.SampledPeakBytes = std::max(OutStats.SampledPeakBytes, OutStats.LiveBytes);
+		if (InDeltaSeconds > 0.0f)
+		{
+			OutStats.AllocationsPerSecond = static_cast<float>(InAllocations - OutStats.TotalAllocations) / InDeltaSeconds;
+		}
+		OutStats.TotalAllocations = InAllocations;
+	};
+
+	int64 TotalBytes = 0;
+	int64 TotalCount = 0;
+	uint64 TotalAllocations = 0;
+	for (size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+	{
+		UpdateStats(GMemoryTagStats[i], Bytes[i], Counts[i], Allocations[i]);
+		TotalBytes += Bytes[i];
+		TotalCount += Counts[i];
+		TotalAllocations += Allocations[i];
+	}
+	UpdateStats(GMemoryTotalStats, TotalBytes, TotalCount, TotalAllocations);
+}
+
+const FMemoryTagStats& FMemoryTracker::GetTagStats(EMemoryTag InTag)
+{
+	return GMemoryTagStats[static_cast<size_t>(InTag)];
+}
+
+const FMemoryTagStats& FMemoryTracker::GetTotalStats()
+{
+	return GMemoryTotalStats;
+}
 
 /**
  * @brief 전역 메모리 관리를 위한 메모리 할당자 오버로딩 함수
@@ -16,16 +163,13 @@ uint32 TotalAllocationCount = 0;
  */
 void* operator new(size_t InSize)
 {
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
-
-	// Debug Print
-	// printf("New: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        InSize, TotalAllocationBytes, TotalAllocationCount);
+	const EMemoryTag Tag = FMemoryTracker::GetCurrentTag();
+	FMemoryTracker::RecordAllocation(InSize, Tag);
 
 	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(malloc(sizeof(AllocHeader) + InSize));
 	MemoryHeader->size = InSize;
 	MemoryHeader->bIsAligned = false;
+	MemoryHeader->Tag = Tag;
 
 	return MemoryHeader + 1;
 }
@@ -42,33 +186,17 @@ void operator delete(void* InMemory) noexcept
 	}
 
 	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(InMemory) - 1;
-	size_t MemoryAllocSize = MemoryHeader->size;
-
-	// Debug Print
-	// printf("Delete: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        MemoryAllocSize, TotalAllocationBytes, TotalAllocationCount);
-
-	if (TotalAllocationCount > 0)
-	{
-		--TotalAllocationCount;
-	}
-	else
-	{
-		assert(!u8"allocation 처리한 객체보다 더 많은 수를 해제할 수 없음");
-	}
 
-	if (TotalAllocationBytes >= MemoryAllocSize)
-	{
-		TotalAllocationBytes -= static_cast<uint32>(MemoryAllocSize);
-	}
-	else
-	{
-		assert(!u8"allocation 처리한 메모리보다 더 많은 양의 메모리를 해제할 수 없음");
-	}
+	// 할당 시점의 태그(헤더에 보관)로 되돌린다
+	FMemoryTracker::RecordFree(MemoryHeader->size, MemoryHeader->Tag);
 
 	if (MemoryHeader->bIsAligned)
 	{
+#ifdef _MSC_VER
 		_aligned_free(MemoryHeader);
+#else
+		free(MemoryHeader);
+#endif
 	}
 	else
 	{
@@ -96,6 +224,17 @@ void operator delete[](void* InMemory) noexcept
 	::operator delete(InMemory);
 }
 
+// 크기를 받는 해제 함수(C++14)도 교체해야 GCC/Clang에서 헤더 없이 free하지 않음 (MSVC는 기본 구현이 위 함수로 전달)
+void operator delete(void* InMemory, size_t InSize) noexcept
+{
+	::operator delete(InMemory);
+}
+
+void operator delete[](void* InMemory, size_t InSize) noexcept
+{
+	::operator delete(InMemory);
+}
+
 // C++17에서 추가로 제공된 Align된 메모리에 대한 오버로딩 함수
 // SIMD 타입이 추후 필요한 것으로 보고 미리 구현해 둠
 
@@ -103,8 +242,8 @@ void* operator new(size_t InSize, align_val_t InAlignment)
 {
 	size_t Alignment = static_cast<size_t>(InAlignment);
 
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	const EMemoryTag Tag = FMemoryTracker::GetCurrentTag();
+	FMemoryTracker::RecordAllocation(InSize, Tag);
 
 	// XXX(KHJ): 헤더 크기도 정렬에 맞춰 패딩을 고려해야 할 수 있음
 	size_t TotalSize = sizeof(AllocHeader) + InSize;
@@ -116,12 +255,13 @@ void* operator new(size_t InSize, align_val_t InAlignment)
 #ifdef _MSC_VER
 	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(_aligned_malloc(AlignedTotalSize, Alignment));
 #else
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(aligned_malloc(Alignment, AlignedTotalSize));
+	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(std::aligned_alloc(Alignment, AlignedTotalSize));
 #endif
 
 	// 실제 할당된 크기를 저장
 	MemoryHeader->size = InSize;
 	MemoryHeader->bIsAligned = true;
+	MemoryHeader->Tag = Tag;
 
 	return MemoryHeader + 1;
 }
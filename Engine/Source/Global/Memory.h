@@ -1,11 +1,88 @@
 #pragma once
 
-extern uint32 TotalAllocationBytes;
-extern uint32 TotalAllocationCount;
+/**
+ * @brief 메모리 사용처 구분용 태그
+ * FScopedMemoryTag(MEMORY_TAG_SCOPE)로 범위를 지정하면 해당 스레드에서 그 범위 안의 할당이 태그별로 집계됩니다.
+ */
+enum class EMemoryTag : uint8
+{
+	Untagged,
+	UObject,	// FUObjectPool에서 할당된 UObject
+	Render,
+	Asset,
+	Lua,
+	Level,
+	UI,
+	Log,
+
+	Count
+};
+
+const char* GetMemoryTagName(EMemoryTag InTag);
 
 struct AllocHeader
 {
 	size_t size;
 	bool bIsAligned;
+	EMemoryTag Tag;
+};
+
+/**
+ * @brief 태그 하나의 메모리 통계 (FMemoryTracker::Update 시점의 값)
+ */
+struct FMemoryTagStats
+{
+	uint64 LiveBytes = 0;
+	uint64 SampledPeakBytes = 0;		// Update(프레임) 시점에 관측한 LiveBytes의 최댓값, 프레임 사이에 잡혔다 풀린 순간 피크는 포함하지 않음
+	uint64 LiveCount = 0;
+	uint64 TotalAllocations = 0;		// 누적 할당 횟수
+	float AllocationsPerSecond = 0.0f;
+};
+
+/**
+ * @brief 스레드별 64비트 카운터로 할당을 추적하는 메모리 트래커
+ *
+ * 할당/해제는 자기 스레드의 카운터만 갱신하므로 (relaxed atomic load/store, lock이나 RMW 없음) 스레드 간 경합이 없고,
+ * 전체 통계는 Update에서 모든 스레드의 카운터를 합산해 만듭니다.
+ * 다른 스레드에서 해제된 메모리는 해제한 스레드의 카운터가 음수가 되지만 합산하면 정확합니다.
+ */
+class FMemoryTracker
+{
+public:
+	static void RecordAllocation(size_t InSize, EMemoryTag InTag);
+	static void RecordFree(size_t InSize, EMemoryTag InTag);
+
+	static EMemoryTag GetCurrentTag();
+	static void SetCurrentTag(EMemoryTag InTag);
+
+	/** @brief 모든 스레드의 카운터를 합산해 통계를 갱신합니다. (메인 스레드에서 프레임마다 호출) */
+	static void Update(float InDeltaSeconds);
+
+	static const FMemoryTagStats& GetTagStats(EMemoryTag InTag);
+	static const FMemoryTagStats& GetTotalStats();
+};
+
+/**
+ * @brief 범위 안의 할당에 태그를 지정하고, 범위를 벗어나면 이전 태그로 되돌립니다.
+ */
+class FScopedMemoryTag
+{
+public:
+	explicit FScopedMemoryTag(EMemoryTag InTag) : PreviousTag(FMemoryTracker::GetCurrentTag())
+	{
+		FMemoryTracker::SetCurrentTag(InTag);
+	}
+
+	~FScopedMemoryTag()
+	{
+		FMemoryTracker::SetCurrentTag(PreviousTag);
+	}
+
+	FScopedMemoryTag(const FScopedMemoryTag&) = delete;
+	FScopedMemoryTag& operator=(const FScopedMemoryTag&) = delete;
+
+private:
+	EMemoryTag PreviousTag;
 };
 
+#define MEMORY_TAG_SCOPE(Tag) FScopedMemoryTag Tag##MemoryTagScope(EMemoryTag::Tag);
@@ -157,16 +157,17 @@ void FOctree::GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) cons
 	}
 }
 
-TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount)
+void FOctree::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount, TFrameArray<UPrimitiveComponent*>& OutCandidates)
 {
-	TArray<UPrimitiveComponent*> Candidates = GWorld->GetLevel()->GetDynamicPrimitives();
-	Candidates.reserve(MaxPrimitiveCount);
+	const TArray<UPrimitiveComponent*>& DynamicPrimitives = GWorld->GetLevel()->GetDynamicPrimitives();
+	OutCandidates.assign(DynamicPrimitives.begin(), DynamicPrimitives.end());
+	OutCandidates.reserve(MaxPrimitiveCount);
 	FNodeQueue NodeQueue;
 
 	float RootDistance = this->GetBoundingBox().GetCenterDistanceSquared(FindPos);
 	NodeQueue.push({ RootDistance, this });
 
-	while (!NodeQueue.empty() && Candidates.size() < MaxPrimitiveCount)
+	while (!NodeQueue.empty() && OutCandidates.size() < MaxPrimitiveCount)
 	{
 		FOctree* CurrentNode = NodeQueue.top().second;
 		NodeQueue.pop();
@@ -175,7 +176,7 @@ TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindP
 		{
 			for (UPrimitiveComponent* Primitive : CurrentNode->GetPrimitives())
 			{
-				Candidates.push_back(Primitive);
+				OutCandidates.push_back(Primitive);
 			}
 		}
 		else
@@ -191,8 +192,6 @@ TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindP
 			}
 		}
 	}
-
-	return Candidates;
 }
 
 void FOctree::Subdivide(UPrimitiveComponent* InPrimitive)
@@ -289,7 +288,7 @@ void FOctree::DeepCopy(FOctree* OutOctree) const
 	}
 }
 
-void FOctree::QueryOverlap(const FAABB& QueryBox, TArray<UPrimitiveComponent*>& OutCandidates) const
+void FOctree::QueryOverlap(const FAABB& QueryBox, TFrameArray<UPrimitiveComponent*>& OutCandidates) const
 {
 	if (!BoundingBox.IsIntersected(QueryBox))
 	{
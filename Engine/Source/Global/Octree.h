@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Physics/Public/AABB.h"
+#include "Global/FrameArena.h"
 
 class UPrimitiveComponent;
 
@@ -22,7 +23,7 @@ public:
 	void DeepCopy(FOctree* OutOctree) const;
 
 	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
-	TArray<UPrimitiveComponent*> FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount);
+	void FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount, TFrameArray<UPrimitiveComponent*>& OutCandidates);
 
 	const FAABB& GetBoundingBox() const { return BoundingBox; }
 	void SetBoundingBox(const FAABB& InAABB) { BoundingBox = InAABB; }
@@ -30,7 +31,7 @@ public:
 	const TArray<UPrimitiveComponent*>& GetPrimitives() const { return Primitives; }
 	TArray<FOctree*>& GetChildren() { return Children; }
 	const TArray<FOctree*>& GetChildren() const { return Children; } 
-	void QueryOverlap(const FAABB& QueryBox, TArray<UPrimitiveComponent*>& OutCandidates) const;
+	void QueryOverlap(const FAABB& QueryBox, TFrameArray<UPrimitiveComponent*>& OutCandidates) const;
 private:
 	bool IsLeaf() const { return Children[0] == nullptr; }
 	void Subdivide(UPrimitiveComponent* InPrimitive);
@@ -44,6 +45,6 @@ private:
 
 using FNodeQueue = std::priority_queue<
 	std::pair<float, FOctree*>,
-	std::vector<std::pair<float, FOctree*>>,
+	TFrameArray<std::pair<float, FOctree*>>,
 	std::greater<std::pair<float, FOctree*>>
 >;
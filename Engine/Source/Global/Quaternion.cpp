@@ -232,6 +232,23 @@ FQuaternion FQuaternion::MakeFromDirection(const FVector& Direction)
 	return FromAxisAngle(Axis, AngleRad);
 }
 
+FQuaternion FQuaternion::Nlerp(const FQuaternion& A, const FQuaternion& B, float Alpha)
+{
+	// q와 -q는 같은 회전이므로 내적이 음수면 B를 뒤집어 짧은 쪽으로 보간
+	const float Dot = A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W;
+	const float Sign = Dot < 0.0f ? -1.0f : 1.0f;
+	const float InverseAlpha = 1.0f - Alpha;
+
+	FQuaternion Result(
+		A.X * InverseAlpha + B.X * Sign * Alpha,
+		A.Y * InverseAlpha + B.Y * Sign * Alpha,
+		A.Z * InverseAlpha + B.Z * Sign * Alpha,
+		A.W * InverseAlpha + B.W * Sign * Alpha
+	);
+	Result.Normalize();
+	return Result;
+}
+
 FVector FQuaternion::RotateVector(const FQuaternion& q, const FVector& v)
 {
 	FQuaternion p(v.X, v.Y, v.Z, 0.0f);
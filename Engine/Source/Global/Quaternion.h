@@ -28,6 +28,8 @@ struct FQuaternion
 	FQuaternion Conjugate() const { return FQuaternion(-X, -Y, -Z, W); }
 	FQuaternion Inverse() const { FQuaternion c = Conjugate(); float n = X * X + Y * Y + Z * Z + W * W; return (n > 0) ? FQuaternion(c.X / n, c.Y / n, c.Z / n, c.W / n) : FQuaternion(); }
 	static FQuaternion MakeFromDirection(const FVector& Direction);
+	/** @brief 최단 경로 선형 보간 후 정규화 (스텝 사이처럼 각도 차이가 작은 보간용) */
+	static FQuaternion Nlerp(const FQuaternion& A, const FQuaternion& B, float Alpha);
 	static FVector RotateVector(const FQuaternion& q, const FVector& v);
 	FVector RotateVector(const FVector& V) const;
 };
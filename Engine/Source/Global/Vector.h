@@ -12,17 +12,18 @@ struct FVector
 	/**
 	 * @brief FVector 기본 생성자
 	 */
-	FVector();
+	FVector() : X(0), Y(0), Z(0) {}
 
 	/**
 	 * @brief FVector의 멤버값을 Param으로 넘기는 생성자
 	 */
-	FVector(float InX, float InY, float InZ);
+	FVector(float InX, float InY, float InZ) : X(InX), Y(InY), Z(InZ) {}
 
 	/**
 	 * @brief FVector를 Param으로 넘기는 생성자
 	 */
-	FVector(const FVector& InOther);
+	FVector(const FVector& InOther) = default;
+	FVector& operator=(const FVector& InOther) = default;
 
 	// FVector4 -> FVector 변환 생성자 (W는 사용하지 않음)
 	FVector(const struct FVector4& InOther);
@@ -35,51 +36,69 @@ struct FVector
 	/**
 	 * @brief 두 벡터를 더한 새로운 벡터를 반환하는 함수
 	 */
-	FVector operator+(const FVector& InOther) const;
+	FVector operator+(const FVector& InOther) const { return { X + InOther.X, Y + InOther.Y, Z + InOther.Z }; }
 
 	/**
 	 * @brief 두 벡터를 뺀 새로운 벡터를 반환하는 함수
 	 */
-	FVector operator-(const FVector& InOther) const;
+	FVector operator-(const FVector& InOther) const { return { X - InOther.X, Y - InOther.Y, Z - InOther.Z }; }
 	
 	/**
 	 * @brief 두 벡터를 곱한 새로운 벡터를 반환하는 함수
 	 */
-	FVector operator*(const FVector& InOther) const;
+	FVector operator*(const FVector& InOther) const { return { X * InOther.X, Y * InOther.Y, Z * InOther.Z }; }
 
 	/**
 	 * @brief 두 벡터를 나눈 새로운 벡터를 반환하는 함수
 	 */
-	FVector operator/(const FVector& InOther) const;
+	FVector operator/(const FVector& InOther) const { return { X / InOther.X, Y / InOther.Y, Z / InOther.Z }; }
 
 	/**
 	 * @brief 자신의 벡터에서 배율을 곱한 백테를 반환하는 함수
 	 */
-	FVector operator*(float InRatio) const;
+	FVector operator*(float InRatio) const { return { X * InRatio, Y * InRatio, Z * InRatio }; }
 
 	/**
 	 * @brief 자신의 벡터에 다른 벡터를 가산하는 함수
 	 */
-	FVector& operator+=(const FVector& InOther);
+	FVector& operator+=(const FVector& InOther)
+	{
+		X += InOther.X;
+		Y += InOther.Y;
+		Z += InOther.Z;
+		return *this;
+	}
 
 	/**
 	 * @brief 자신의 벡터에서 다른 벡터를 감산하는 함수
 	 */
-	FVector& operator-=(const FVector& InOther);
+	FVector& operator-=(const FVector& InOther)
+	{
+		X -= InOther.X;
+		Y -= InOther.Y;
+		Z -= InOther.Z;
+		return *this;
+	}
 
 	/**
 	 * @brief 자신의 벡터에서 배율을 곱한 뒤 자신을 반환
 	 */
-	FVector& operator*=(float InRatio);
+	FVector& operator*=(float InRatio)
+	{
+		X *= InRatio;
+		Y *= InRatio;
+		Z *= InRatio;
+		return *this;
+	}
 
 	/**
 	 * @brief 자신의 벡터의 각 성분의 부호를 반전한 값을 반환
 	 */
 	FVector operator-() const { return {-X, -Y, -Z}; }
 
-	bool operator==(const FVector& InOther) const;
+	bool operator==(const FVector& InOther) const { return X == InOther.X && Y == InOther.Y && Z == InOther.Z; }
 
-	bool operator!=(const FVector& InOther) const;
+	bool operator!=(const FVector& InOther) const { return !(*this == InOther); }
 
 	/**
 	 * @brief 벡터의 길이 연산 함수
@@ -215,34 +234,35 @@ struct FVector2
 	/**
 	 * @brief FVector2 기본 생성자
 	 */
-	FVector2();
+	FVector2() : X(0), Y(0) {}
 
 	/**
 	 * @brief FVector2의 멤버값을 Param으로 넘기는 생성자
 	 */
-	FVector2(float InX, float InY);
+	FVector2(float InX, float InY) : X(InX), Y(InY) {}
 
 	/**
 	 * @brief FVector2를 Param으로 넘기는 생성자
 	 */
-	FVector2(const FVector2& InOther);
+	FVector2(const FVector2& InOther) = default;
+	FVector2& operator=(const FVector2& InOther) = default;
 
 	/**
 	 * @brief 두 벡터를 더한 새로운 벡터를 반환하는 함수
 	 */
-	FVector2 operator+(const FVector2& InOther) const;
+	FVector2 operator+(const FVector2& InOther) const { return { X + InOther.X, Y + InOther.Y }; }
 
 	/**
 	 * @brief 두 벡터를 뺀 새로운 벡터를 반환하는 함수
 	 */
-	FVector2 operator-(const FVector2& InOther) const;
+	FVector2 operator-(const FVector2& InOther) const { return { X - InOther.X, Y - InOther.Y }; }
 
-	FVector2 operator-() const;
+	FVector2 operator-() const { return { -X, -Y }; }
 
 	/**
 	 * @brief 자신의 벡터에서 배율을 곱한 백터를 반환하는 함수
 	 */
-	FVector2 operator*(const float Ratio) const;
+	FVector2 operator*(const float Ratio) const { return { X * Ratio, Y * Ratio }; }
 
 	/**
 	 * @brief 벡터의 길이 연산 함수
@@ -304,50 +324,69 @@ struct alignas(16) FVector4
 	 */
 	constexpr FVector4(const FVector4& InOther) : X(InOther.X), Y(InOther.Y), Z(InOther.Z), W(InOther.W) {}
 
+	FVector4& operator=(const FVector4& InOther)
+	{
+		V = InOther.V;
+		return *this;
+	}
+
+	/**
+	 * @brief SIMD 레지스터로부터 만드는 생성자
+	 */
+	explicit FVector4(__m128 InV) : V(InV) {}
+
 	/**
 	 * @brief 두 벡터를 더한 새로운 벡터를 반환하는 함수
 	 */
-	FVector4 operator+(const FVector4& InOtherVector) const;
+	FVector4 operator+(const FVector4& InOtherVector) const { return FVector4(_mm_add_ps(V, InOtherVector.V)); }
 
 	/**
-	 * @brief 벡터와 행렬곱
+	 * @brief 벡터와 행렬곱 (Matrix.h에 정의)
 	 */
 	FVector4 operator*(const FMatrix& InMatrix) const;
 
 	/**
 	 * @brief 두 벡터를 뺀 새로운 벡터를 반환하는 함수
 	 */
-	FVector4 operator-(const FVector4& InOtherVector) const;
+	FVector4 operator-(const FVector4& InOtherVector) const { return FVector4(_mm_sub_ps(V, InOtherVector.V)); }
 
 	/**
 	 * @brief 자신의 벡터에 배율을 곱한 값을 반환하는 함수
 	 */
-	FVector4 operator*(float InRatio) const;
+	FVector4 operator*(float InRatio) const { return FVector4(_mm_mul_ps(V, _mm_set1_ps(InRatio))); }
 
 	/**
 	 * @brief 자신의 벡터에 스칼라를 나눈 값을  반환하는 함수
 	 */
-	FVector4 operator/(float Scalar) const;
+	FVector4 operator/(float Scalar) const
+	{
+		// divide with zero 방지
+		if (Scalar >= -0.0001f && Scalar <= 0.0001f)
+		{
+			return FVector4();
+		}
+		return FVector4(_mm_div_ps(V, _mm_set1_ps(Scalar)));
+	}
 
 	/**
 	 * @brief 자신의 벡터에 다른 벡터를 가산하는 함수
 	 */
-	void operator+=(const FVector4& InOtherVector);
+	void operator+=(const FVector4& InOtherVector) { V = _mm_add_ps(V, InOtherVector.V); }
 
 	/**
 	 * @brief 자신의 벡터에 다른 벡터를 감산하는 함수
 	 */
-	void operator-=(const FVector4& InOtherVector);
+	void operator-=(const FVector4& InOtherVector) { V = _mm_sub_ps(V, InOtherVector.V); }
 
 	/**
 	 * @brief 자신의 벡터에 배율을 곱하는 함수
 	 */
-	void operator*=(float Ratio);
+	void operator*=(float Ratio) { V = _mm_mul_ps(V, _mm_set1_ps(Ratio)); }
 
 	/**
 	 * @brief 자신의 벡터를 스칼라로 나누는 함수
 	 */
-	void operator/=(float Scalar);
+	void operator/=(float Scalar) { V = _mm_div_ps(V, _mm_set1_ps(Scalar)); }
 
 	float Length() const
 	{
@@ -398,3 +437,27 @@ struct alignas(16) FVector4
 };
 
 FArchive& operator<<(FArchive& Ar, FVector4& Vector);
+
+inline FVector::FVector(const FVector4& InOther)
+	: X(InOther.X), Y(InOther.Y), Z(InOther.Z)
+{
+}
+
+// 동차좌표 → 3D 변환 (W 분할)
+inline FVector FVector::FromHomogeneous(const FVector4& InOther)
+{
+	const float W = InOther.W;
+	if (fabsf(W) > 1e-6f)
+	{
+		return FVector(InOther.X / W, InOther.Y / W, InOther.Z / W);
+	}
+	// W가 0에 가까우면 분모 방지: XYZ만 사용
+	return FVector(InOther.X, InOther.Y, InOther.Z);
+}
+
+inline void FVector::operator=(const FVector4& InOther)
+{
+	X = InOther.X;
+	Y = InOther.Y;
+	Z = InOther.Z;
+}
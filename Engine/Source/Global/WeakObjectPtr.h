@@ -1,29 +1,45 @@
 ﻿#pragma once
 //#include "Render/UI/Window/Public/ConsoleWindow.h"
 
+/**
+ * @brief UObject를 소유하지 않고 참조하는 약한 포인터
+ *
+ * 객체 인덱스(하위 32비트)와 SerialNumber(상위 32비트)를 64비트 핸들 하나로 묶어 저장합니다.
+ * 슬롯이 해제되면 SerialNumber가 0이 되고 재사용 시 새 값이 발급되므로,
+ * 유효성 검사는 슬롯의 SerialNumber를 한 번 읽어 비교하는 것으로 끝납니다. (포인터 역참조 없음)
+ */
 template<typename T>
 class TWeakObjectPtr
 {
 public:
-    TWeakObjectPtr() : ObjectIndex(InValidIndex), SerialNumber(0) {}
+    TWeakObjectPtr() : Handle(InvalidHandle) {}
     TWeakObjectPtr(T* InObject) { Set(InObject); }
 
     void Set(T* InObject);
     bool IsValid() const;
     T* Get() const;
-    void Reset();    
+    void Reset();
 
-    T* operator->() { return Get(); }
+    /** @brief 인덱스와 SerialNumber를 묶은 64비트 핸들 (해시 키 등으로 사용) */
+    uint64 GetHandle() const { return Handle; }
+    uint32 GetObjectIndex() const { return static_cast<uint32>(Handle); }
+    uint32 GetSerialNumber() const { return static_cast<uint32>(Handle >> 32); }
+
+    T* operator->() const { return Get(); }
     T& operator*() const { return *Get(); }
     bool operator==(const TWeakObjectPtr<T>& Other) const;
     bool operator!=(const TWeakObjectPtr<T>& Other) const;
 
 private:
-    uint32 ObjectIndex;
-    uint32 SerialNumber;
+    static uint64 MakeHandle(uint32 InIndex, uint32 InSerialNumber)
+    {
+        return (static_cast<uint64>(InSerialNumber) << 32) | InIndex;
+    }
 
-    // nullptr인 경우 InValidIndex
-    static constexpr uint32 InValidIndex = std::numeric_limits<uint32>::max();
+    uint64 Handle;
+
+    // nullptr인 경우 인덱스는 INVALID_INDEX, SerialNumber는 0
+    static constexpr uint64 InvalidHandle = 0xFFFFFFFFull; // FUObjectArray::INVALID_INDEX
 };
 
 template <typename T>
@@ -32,65 +48,47 @@ void TWeakObjectPtr<T>::Set(T* InObject)
     // 유효 객체의 인덱스와 시리얼번호 등록
     if (InObject)
     {
-        ObjectIndex = InObject->GetInternalIndex();
-        SerialNumber = GetUObjectSlotArray()[ObjectIndex].SerialNumber;
+        const uint32 ObjectIndex = InObject->GetInternalIndex();
+        Handle = MakeHandle(ObjectIndex, GetUObjectArray().GetSlot(ObjectIndex)->SerialNumber);
     }
     // nullptr의 경우 초기화
     else
     {
-        ObjectIndex = InValidIndex;
-        SerialNumber = 0;
+        Handle = InvalidHandle;
     }
-    
 }
 
 template <typename T>
 bool TWeakObjectPtr<T>::IsValid() const
 {
-    const auto& Slots = GetUObjectSlotArray();
-    const auto& Objects = GetUObjectArray();
-
-    // nullptr이거나 현재 포인터의 Index와 Slot의 크기가 일치하지 않으면 유효하지 않음
-    if (ObjectIndex >= Slots.size() || ObjectIndex == InValidIndex)
-    {
-        //UE_LOG("TWeakObjectPtr : Index Out of Range or Empty");
-        return false;
-    }
-    
-    const FObjectSlot& Slot = Slots[ObjectIndex];
-
-    // Slot 검사
-    if (!Slot.bIsAlive || Slot.SerialNumber != SerialNumber)
-    {
-        //UE_LOG("TWeakObjectPtr : Dead or SerialNumber mismatch");
-        return false;
-    }
-
-    return Objects[ObjectIndex] != nullptr;
+    // 인덱스가 배열 범위를 벗어나면 (nullptr 포함) Slot이 없음
+    // 해제된 슬롯의 SerialNumber는 0이고 유효한 SerialNumber는 1부터 발급되므로 비교만으로 충분함
+    const FObjectSlot* Slot = GetUObjectArray().GetSlot(GetObjectIndex());
+    return Slot && Slot->SerialNumber == GetSerialNumber();
 }
 
 template <typename T>
 T* TWeakObjectPtr<T>::Get() const
 {
-    if (!IsValid())
+    const FObjectSlot* Slot = GetUObjectArray().GetSlot(GetObjectIndex());
+    if (!Slot || Slot->SerialNumber != GetSerialNumber())
     {
         return nullptr;
     }
 
-    return static_cast<T*>(GetUObjectArray()[ObjectIndex]);
+    return static_cast<T*>(Slot->Object);
 }
 
 template <typename T>
 void TWeakObjectPtr<T>::Reset()
 {
-    ObjectIndex = InValidIndex;
-    SerialNumber = 0;
+    Handle = InvalidHandle;
 }
 
 template <typename T>
 bool TWeakObjectPtr<T>::operator==(const TWeakObjectPtr<T>& Other) const
 {
-    return (ObjectIndex == Other.ObjectIndex) && (SerialNumber == Other.SerialNumber);
+    return Handle == Other.Handle;
 }
 
 template <typename T>
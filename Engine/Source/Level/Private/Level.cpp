@@ -6,16 +6,30 @@
 #include "Component/Public/DirectionalLightComponent.h"
 #include "Component/Public/AmbientLightComponent.h"
 #include "Component/Public/SpotLightComponent.h"
+#include "Component/Public/BillBoardComponent.h"
+#include "Component/Public/DecalComponent.h"
+#include "Component/Public/EditorIconComponent.h"
+#include "Component/Public/HeightFogComponent.h"
+#include "Component/Public/UUIDTextComponent.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Component/Collision/Public/ShapeComponent.h"
 #include "Core/Public/Object.h"
+#if WITH_EDITOR
 #include "Editor/Public/Editor.h"
 #include "Render/UI/Viewport/Public/Viewport.h"
+#endif
 #include "Global/Octree.h"
 #include "Level/Public/Level.h"
+#if WITH_EDITOR
 #include "Manager/Config/Public/ConfigManager.h"
+#endif
+#if WITH_RENDERER
 #include "Render/Renderer/Public/Renderer.h"
+#endif
 #include "Utility/Public/JsonSerializer.h"
+#if WITH_EDITOR
 #include "Manager/UI/Public/ViewportManager.h"
+#endif
 #include <json.hpp>
 
 IMPLEMENT_CLASS(ULevel, UObject)
@@ -46,7 +60,12 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	if (bInIsLoading)
 	{
 		LightComponents.clear();
+		SpotLightComponents.clear();
+		PointLightComponents.clear();
+		DirectionalLightComponents.clear();
+		AmbientLightComponents.clear();
 		ShapeComponents.clear();
+		ClearRenderProxies();
 
 		// 동적 오브젝트 추적 정보 초기화
 		DynamicPrimitiveMap.clear();
@@ -55,6 +74,7 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 			DynamicPrimitiveQueue.pop();
 		}
 		OctreeInsertRetryCount.clear();
+		DirtyPrimitiveBounds.clear();
 		// 옥트리 완전 초기화
 		if (StaticOctree)
 		{
@@ -80,8 +100,10 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 			}
 		}
 
+#if WITH_EDITOR
 		// 뷰포트 카메라 정보 로드
 		UViewportManager::GetInstance().SerializeViewports(bInIsLoading, InOutHandle);
+#endif
 	}
 	// 저장
 	else
@@ -93,15 +115,17 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		for (AActor* Actor : LevelActors)
 		{
 			JSON ActorJson;
-			ActorJson["Type"] = Actor->GetClass()->GetName().ToString();
+			ActorJson["Type"] = Actor->GetClass()->GetName().ToStringView().data();
 			Actor->Serialize(bInIsLoading, ActorJson); 
 
 			ActorsJson[std::to_string(Actor->GetUUID())] = ActorJson;
 		}
 		InOutHandle["Actors"] = ActorsJson;
 
+#if WITH_EDITOR
 		// 뷰포트 카메라 정보 저장
 		UViewportManager::GetInstance().SerializeViewports(bInIsLoading, InOutHandle);
+#endif
 	}
 }
 
@@ -157,6 +181,10 @@ void ULevel::RegisterComponent(UActorComponent* InComponent)
 
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(InComponent))
 	{
+		FVector WorldMin, WorldMax;
+		PrimitiveComponent->GetWorldAABB(WorldMin, WorldMax);
+		DirtyPrimitiveBounds.emplace_back(WorldMin, WorldMax);
+
 		// StaticOctree에 먼저 삽입 시도
 		if (!(StaticOctree->Insert(PrimitiveComponent)))
 		{
@@ -167,6 +195,8 @@ void ULevel::RegisterComponent(UActorComponent* InComponent)
 		{
 			ShapeComponents.push_back(Shape);
 		}
+
+		AddRenderProxy(PrimitiveComponent);
 	}
 	else if (auto LightComponent = Cast<ULightComponent>(InComponent))
 	{
@@ -175,22 +205,33 @@ void ULevel::RegisterComponent(UActorComponent* InComponent)
 			if (auto SpotLightComponent = Cast<USpotLightComponent>(PointLightComponent))
 			{
 				LightComponents.push_back(SpotLightComponent);
+				SpotLightComponents.push_back(SpotLightComponent);
 			}
 			else
 			{
 				LightComponents.push_back(PointLightComponent);
+				PointLightComponents.push_back(PointLightComponent);
 			}
 		}
 		if (auto DirectionalLightComponent = Cast<UDirectionalLightComponent>(LightComponent))
 		{
 			LightComponents.push_back(DirectionalLightComponent);
+			DirectionalLightComponents.push_back(DirectionalLightComponent);
 		}
 		if (auto AmbientLightComponent = Cast<UAmbientLightComponent>(LightComponent))
 		{
 			LightComponents.push_back(AmbientLightComponent);
+			AmbientLightComponents.push_back(AmbientLightComponent);
 		}
 	}
-	UE_LOG("Level: '%s' 컴포넌트를 씬에 등록했습니다.", InComponent->GetName().ToString().data());
+	else if (auto HeightFogComponent = Cast<UHeightFogComponent>(InComponent))
+	{
+		if (std::find(HeightFogComponents.begin(), HeightFogComponents.end(), HeightFogComponent) == HeightFogComponents.end())
+		{
+			HeightFogComponents.push_back(HeightFogComponent);
+		}
+	}
+	UE_LOG_DEFERRED(Info, "Level: '%s' 컴포넌트를 씬에 등록했습니다.", InComponent->GetName().ToStringView().data());
 }
 
 void ULevel::UnregisterComponent(UActorComponent* InComponent)
@@ -207,6 +248,10 @@ void ULevel::UnregisterComponent(UActorComponent* InComponent)
 
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(InComponent))
 	{
+		FVector WorldMin, WorldMax;
+		PrimitiveComponent->GetWorldAABB(WorldMin, WorldMax);
+		DirtyPrimitiveBounds.emplace_back(WorldMin, WorldMax);
+
 		// StaticOctree에서 제거 시도
 		StaticOctree->Remove(PrimitiveComponent);
 	
@@ -219,6 +264,8 @@ void ULevel::UnregisterComponent(UActorComponent* InComponent)
 				ShapeComponents.end()
 			);
 		}
+
+		RemoveRenderProxy(PrimitiveComponent);
 	}
 	else if (auto LightComponent = Cast<ULightComponent>(InComponent))
 	{
@@ -227,9 +274,150 @@ void ULevel::UnregisterComponent(UActorComponent* InComponent)
 			std::remove(LightComponents.begin(), LightComponents.end(), LightComponent),
 			LightComponents.end()
 		);
+		SpotLightComponents.erase(
+			std::remove(SpotLightComponents.begin(), SpotLightComponents.end(), LightComponent),
+			SpotLightComponents.end()
+		);
+		PointLightComponents.erase(
+			std::remove(PointLightComponents.begin(), PointLightComponents.end(), LightComponent),
+			PointLightComponents.end()
+		);
+		DirectionalLightComponents.erase(
+			std::remove(DirectionalLightComponents.begin(), DirectionalLightComponents.end(), LightComponent),
+			DirectionalLightComponents.end()
+		);
+		AmbientLightComponents.erase(
+			std::remove(AmbientLightComponents.begin(), AmbientLightComponents.end(), LightComponent),
+			AmbientLightComponents.end()
+		);
+	}
+	else if (auto HeightFogComponent = Cast<UHeightFogComponent>(InComponent))
+	{
+		HeightFogComponents.erase(
+			std::remove(HeightFogComponents.begin(), HeightFogComponents.end(), HeightFogComponent),
+			HeightFogComponents.end()
+		);
+	}
+}
+
+/*-----------------------------------------------------------------------------
+	Render Proxy Management
+-----------------------------------------------------------------------------*/
+
+void ULevel::AddRenderProxy(UPrimitiveComponent* InComponent)
+{
+	// 타입 판별은 등록 시 한 번만 수행한다 (렌더링 시에는 RenderProxyType만 사용)
+	if (auto StaticMesh = Cast<UStaticMeshComponent>(InComponent))
+	{
+		InComponent->RenderProxyType = ERenderProxyType::StaticMesh;
+		AddToProxyList(StaticMeshComponents, StaticMesh);
+	}
+	else if (auto BillBoard = Cast<UBillBoardComponent>(InComponent))
+	{
+		InComponent->RenderProxyType = ERenderProxyType::BillBoard;
+		AddToProxyList(BillBoardComponents, BillBoard);
+	}
+	else if (auto EditorIcon = Cast<UEditorIconComponent>(InComponent))
+	{
+		InComponent->RenderProxyType = ERenderProxyType::EditorIcon;
+		AddToProxyList(EditorIconComponents, EditorIcon);
+	}
+	else if (auto UUIDText = Cast<UUUIDTextComponent>(InComponent))
+	{
+		InComponent->RenderProxyType = ERenderProxyType::UUIDText;
+		AddToProxyList(UUIDTextComponents, UUIDText);
+	}
+	else if (auto Text = Cast<UTextComponent>(InComponent))
+	{
+		InComponent->RenderProxyType = ERenderProxyType::Text;
+		AddToProxyList(TextComponents, Text);
+	}
+	else if (auto Decal = Cast<UDecalComponent>(InComponent))
+	{
+		InComponent->RenderProxyType = ERenderProxyType::Decal;
+		AddToProxyList(DecalComponents, Decal);
+	}
+	else
+	{
+		InComponent->RenderProxyType = ERenderProxyType::None;
 	}
 }
 
+void ULevel::RemoveRenderProxy(UPrimitiveComponent* InComponent)
+{
+	switch (InComponent->RenderProxyType)
+	{
+	case ERenderProxyType::StaticMesh:
+		RemoveFromProxyList(StaticMeshComponents, static_cast<UStaticMeshComponent*>(InComponent));
+		break;
+	case ERenderProxyType::BillBoard:
+		RemoveFromProxyList(BillBoardComponents, static_cast<UBillBoardComponent*>(InComponent));
+		break;
+	case ERenderProxyType::EditorIcon:
+		RemoveFromProxyList(EditorIconComponents, static_cast<UEditorIconComponent*>(InComponent));
+		break;
+	case ERenderProxyType::UUIDText:
+		RemoveFromProxyList(UUIDTextComponents, static_cast<UUUIDTextComponent*>(InComponent));
+		break;
+	case ERenderProxyType::Text:
+		RemoveFromProxyList(TextComponents, static_cast<UTextComponent*>(InComponent));
+		break;
+	case ERenderProxyType::Decal:
+		RemoveFromProxyList(DecalComponents, static_cast<UDecalComponent*>(InComponent));
+		break;
+	default:
+		break;
+	}
+}
+
+void ULevel::ClearRenderProxies()
+{
+	StaticMeshComponents.clear();
+	BillBoardComponents.clear();
+	EditorIconComponents.clear();
+	TextComponents.clear();
+	UUIDTextComponents.clear();
+	DecalComponents.clear();
+	HeightFogComponents.clear();
+}
+
+template<typename T>
+void ULevel::AddToProxyList(TArray<T*>& InOutList, T* InComponent)
+{
+	UPrimitiveComponent* Primitive = InComponent;
+
+	// 이미 이 목록에 등록된 컴포넌트는 무시 (AActor::RegisterComponent와 AddLevelComponent의 중복 호출 대비)
+	const int32 Index = Primitive->RenderProxyIndex;
+	if (Index >= 0 && Index < static_cast<int32>(InOutList.size()) && InOutList[Index] == InComponent)
+	{
+		return;
+	}
+
+	Primitive->RenderProxyIndex = static_cast<int32>(InOutList.size());
+	InOutList.push_back(InComponent);
+}
+
+template<typename T>
+void ULevel::RemoveFromProxyList(TArray<T*>& InOutList, T* InComponent)
+{
+	UPrimitiveComponent* Primitive = InComponent;
+
+	const int32 Index = Primitive->RenderProxyIndex;
+	if (Index < 0 || Index >= static_cast<int32>(InOutList.size()) || InOutList[Index] != InComponent)
+	{
+		return;
+	}
+
+	// 마지막 원소를 빈 자리로 옮겨 O(1)로 제거
+	UPrimitiveComponent* Moved = InOutList.back();
+	InOutList[Index] = InOutList.back();
+	Moved->RenderProxyIndex = Index;
+	InOutList.pop_back();
+
+	Primitive->RenderProxyIndex = -1;
+	Primitive->RenderProxyType = ERenderProxyType::None;
+}
+
 void ULevel::AddActorToLevel(AActor* InActor)
 {
 	if (!InActor)
@@ -275,6 +463,7 @@ bool ULevel::DestroyActor(AActor* InActor)
 		LevelActors.pop_back();
 	}
 
+#if WITH_EDITOR
 	// Remove Actor Selection
 	UEditor* Editor = GEditor->GetEditorModule();
 	if (Editor->GetSelectedActor() == InActor)
@@ -282,6 +471,7 @@ bool ULevel::DestroyActor(AActor* InActor)
 		Editor->SelectActor(nullptr);
 		Editor->SelectComponent(nullptr);
 	}
+#endif
 
 	// Remove
 	SafeDelete(InActor);
@@ -293,6 +483,12 @@ void ULevel::UpdatePrimitiveInOctree(UPrimitiveComponent* InComponent)
 {
 	if (!StaticOctree->Remove(InComponent))
 		return;
+
+	// 정적 상태였던 위치도 변경 영역으로 기록 (이동 이후의 위치는 DynamicPrimitives로 추적됨)
+	FVector WorldMin, WorldMax;
+	InComponent->GetCachedWorldAABB(WorldMin, WorldMax);
+	DirtyPrimitiveBounds.emplace_back(WorldMin, WorldMax);
+
 	OnPrimitiveUpdated(InComponent);
 }
 
@@ -327,7 +523,9 @@ void ULevel::UpdateOctree()
 	{
 		return;
 	}
-	
+
+	TIME_PROFILE(UpdateOctree)
+
 	uint32 Count = 0;
 	FDynamicPrimitiveQueue NotInsertedQueue;
 	
@@ -369,7 +567,7 @@ void ULevel::UpdateOctree()
 					{
 						// 10회 실패 시 추적 중단
 						UE_LOG_WARNING("UpdateOctree: Component '%s'가 옥트리 영역 밖으로 벗어나 추적을 중단합니다.",
-							Component->GetName().ToString().data());
+							Component->GetName().ToStringView().data());
 
 						DynamicPrimitiveMap.erase(It);
 						OctreeInsertRetryCount.erase(Component);
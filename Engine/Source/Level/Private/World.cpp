@@ -3,7 +3,9 @@
 #include "Level/Public/Level.h"
 #include "Actor/Public/AmbientLight.h"
 #include "Utility/Public/JsonSerializer.h"
+#if WITH_EDITOR
 #include "Manager/Config/Public/ConfigManager.h"
+#endif
 #include "Manager/Path/Public/PathManager.h"
 
 IMPLEMENT_CLASS(UWorld, UObject)
@@ -69,6 +71,8 @@ void UWorld::Tick(float DeltaTimes)
 		return;
 	}
 
+	TIME_PROFILE(WorldTick)
+
 	// 스폰 / 삭제 처리
 	FlushPendingDestroy();
 
@@ -141,7 +145,9 @@ bool UWorld::LoadLevel(path InLevelFilePath)
 		SwitchToLevel(NewLevel);
 		NewLevel->Serialize(true, LevelJson);
 
+#if WITH_EDITOR
 		UConfigManager::GetInstance().SetLastUsedLevelPath(InLevelFilePath.string());
+#endif
 		BeginPlay();
 	}
 	catch (const exception& Exception)
@@ -266,7 +272,7 @@ void UWorld::FlushPendingDestroy()
 	{
 		if (!Level->DestroyActor(ActorToDestroy))
 		{
-			UE_LOG_ERROR("World: Actor 삭제에 실패했습니다: %s", ActorToDestroy->GetName().ToString().c_str());
+			UE_LOG_ERROR("World: Actor 삭제에 실패했습니다: %s", ActorToDestroy->GetName().ToStringView().data());
 		}
 	}
 }
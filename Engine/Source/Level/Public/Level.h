@@ -2,6 +2,7 @@
 #include "Core/Public/Object.h"
 #include "Editor/Public/Camera.h"
 #include "Global/Enum.h"
+#include "Physics/Public/AABB.h"
 
 namespace json { class JSON; }
 using JSON = json::JSON;
@@ -10,7 +11,17 @@ class UWorld;
 class AActor;
 class UPrimitiveComponent;
 class UPointLightComponent;
+class USpotLightComponent;
+class UDirectionalLightComponent;
+class UAmbientLightComponent;
 class ULightComponent;
+class UStaticMeshComponent;
+class UBillBoardComponent;
+class UEditorIconComponent;
+class UTextComponent;
+class UUUIDTextComponent;
+class UDecalComponent;
+class UHeightFogComponent;
 class FOctree;
 class UShapeComponent;
 
@@ -83,6 +94,19 @@ private:
 	-----------------------------------------------------------------------------*/
 public:
 	void UpdateOctree();
+
+	/**
+	 * @brief 마지막 ClearDirtyPrimitiveBounds 이후 변경(등록/해제/정적 상태에서 이동)된 프리미티브의 이전 월드 AABB 목록
+	 * 현재 움직이고 있는 프리미티브의 영역은 GetDynamicPrimitives()로 얻을 수 있으며,
+	 * 두 정보를 합치면 이번 프레임에 내용이 바뀐 공간을 알 수 있습니다. (Shadow map 캐시 무효화에 사용)
+	 */
+	const TArray<FAABB>& GetDirtyPrimitiveBounds() const { return DirtyPrimitiveBounds; }
+
+	/**
+	 * @brief 변경 영역을 소비한 쪽(렌더러)이 프레임 끝에 호출합니다.
+	 * World Tick(서브스텝 포함)마다 비우면 FlushPendingDestroy나 앞선 스텝에서 기록된 영역이 그림자 패스에 닿기 전에 사라집니다.
+	 */
+	void ClearDirtyPrimitiveBounds() { DirtyPrimitiveBounds.clear(); }
 	
 private:
 
@@ -117,6 +141,9 @@ private:
 
 	/** @brief 각 UPrimitiveComponent가 움직인 가장 마지막 시간을 기록 */
 	TMap<UPrimitiveComponent*, float> DynamicPrimitiveMap;
+
+	/** @brief 렌더러가 소비한 뒤 ClearDirtyPrimitiveBounds로 초기화되는 변경 영역 목록 */
+	TArray<FAABB> DirtyPrimitiveBounds;
 	
 	/*-----------------------------------------------------------------------------
 		Lighting Management
@@ -124,8 +151,54 @@ private:
 public:
 	const TArray<ULightComponent*>& GetLightComponents() const { return LightComponents; } 
 
+	// 타입별 라이트 목록 (등록 순서 유지)
+	const TArray<USpotLightComponent*>& GetSpotLightComponents() const { return SpotLightComponents; }
+	const TArray<UPointLightComponent*>& GetPointLightComponents() const { return PointLightComponents; }
+	const TArray<UDirectionalLightComponent*>& GetDirectionalLightComponents() const { return DirectionalLightComponents; }
+	const TArray<UAmbientLightComponent*>& GetAmbientLightComponents() const { return AmbientLightComponents; }
+
 private:
 	TArray<ULightComponent*> LightComponents;
+	TArray<USpotLightComponent*> SpotLightComponents;
+	TArray<UPointLightComponent*> PointLightComponents;	// Spot Light는 포함하지 않음
+	TArray<UDirectionalLightComponent*> DirectionalLightComponents;
+	TArray<UAmbientLightComponent*> AmbientLightComponents;
+
+	/*-----------------------------------------------------------------------------
+		Render Proxy Management
+	-----------------------------------------------------------------------------*/
+public:
+	/**
+	 * @brief 타입별 렌더 목록
+	 * RegisterComponent에서 컴포넌트 타입을 한 번만 판별해 보관하므로,
+	 * 렌더링 시에는 캐스팅이나 Actor 순회 없이 배열을 그대로 순회하면 됩니다.
+	 * 가시성(IsVisible) 판정은 포함하지 않으며 순서는 보장하지 않습니다.
+	 */
+	const TArray<UStaticMeshComponent*>& GetStaticMeshComponents() const { return StaticMeshComponents; }
+	const TArray<UBillBoardComponent*>& GetBillBoardComponents() const { return BillBoardComponents; }
+	const TArray<UEditorIconComponent*>& GetEditorIconComponents() const { return EditorIconComponents; }
+	const TArray<UTextComponent*>& GetTextComponents() const { return TextComponents; }
+	const TArray<UUUIDTextComponent*>& GetUUIDTextComponents() const { return UUIDTextComponents; }
+	const TArray<UDecalComponent*>& GetDecalComponents() const { return DecalComponents; }
+	const TArray<UHeightFogComponent*>& GetHeightFogComponents() const { return HeightFogComponents; }
+
+private:
+	void AddRenderProxy(UPrimitiveComponent* InComponent);
+	void RemoveRenderProxy(UPrimitiveComponent* InComponent);
+	void ClearRenderProxies();
+
+	template<typename T>
+	void AddToProxyList(TArray<T*>& InOutList, T* InComponent);
+	template<typename T>
+	void RemoveFromProxyList(TArray<T*>& InOutList, T* InComponent);
+
+	TArray<UStaticMeshComponent*> StaticMeshComponents;
+	TArray<UBillBoardComponent*> BillBoardComponents;
+	TArray<UEditorIconComponent*> EditorIconComponents;
+	TArray<UTextComponent*> TextComponents;	// UUID Text는 포함하지 않음
+	TArray<UUUIDTextComponent*> UUIDTextComponents;
+	TArray<UDecalComponent*> DecalComponents;
+	TArray<UHeightFogComponent*> HeightFogComponents;
 
 	/*-----------------------------------------------------------------------------
 		Collision Management
@@ -1,12 +1,16 @@
 #include "pch.h"
 #include "Manager/Asset/Public/AssetManager.h"
+#if WITH_RENDERER
 #include "Render/Renderer/Public/Renderer.h"
+#endif
 #include "Component/Mesh/Public/VertexDatas.h"
 #include "Physics/Public/AABB.h"
 #include "Texture/Public/Texture.h"
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Path/Public/PathManager.h"
+#if WITH_RENDERER
 #include "Render/Renderer/Public/RenderResourceFactory.h"
+#endif
 
 IMPLEMENT_SINGLETON_CLASS(UAssetManager, UObject)
 UAssetManager::UAssetManager()
@@ -18,6 +22,7 @@ UAssetManager::~UAssetManager() = default;
 
 void UAssetManager::Initialize()
 {
+	MEMORY_TAG_SCOPE(Asset)
 	TextureManager->LoadAllTexturesFromDirectory(UPathManager::GetInstance().GetDataPath());
 	// Data 폴더 속 모든 .obj 파일 로드 및 캐싱
 	LoadAllObjStaticMesh();
@@ -30,11 +35,14 @@ void UAssetManager::Initialize()
 	VertexDatas.emplace(EPrimitiveType::Sprite, &VerticesVerticalSquare);
 
 	IndexDatas.emplace(EPrimitiveType::Sprite, &IndicesVerticalSquare);
+#if WITH_RENDERER
 	IndexBuffers.emplace(EPrimitiveType::Sprite,
 		FRenderResourceFactory::CreateIndexBuffer(IndicesVerticalSquare.data(), static_cast<int>(IndicesVerticalSquare.size()) * sizeof(uint32)));
+#endif
 
 	NumIndices.emplace(EPrimitiveType::Sprite, static_cast<uint32>(IndicesVerticalSquare.size()));
 	
+#if WITH_RENDERER
 	// TArray.GetData(), TArray.Num()*sizeof(FVertexSimple), TArray.GetTypeSize()
 	VertexBuffers.emplace(EPrimitiveType::Torus, FRenderResourceFactory::CreateVertexBuffer(
 		VerticesTorus.data(), static_cast<int>(VerticesTorus.size() * sizeof(FNormalVertex))));
@@ -48,6 +56,7 @@ void UAssetManager::Initialize()
 		VerticesLine.data(), static_cast<int>(VerticesLine.size() * sizeof(FNormalVertex))));
 	VertexBuffers.emplace(EPrimitiveType::Sprite, FRenderResourceFactory::CreateVertexBuffer(
 		VerticesVerticalSquare.data(), static_cast<int>(VerticesVerticalSquare.size() * sizeof(FNormalVertex))));
+#endif
 
 	NumVertices.emplace(EPrimitiveType::Torus, static_cast<uint32>(VerticesTorus.size()));
 	NumVertices.emplace(EPrimitiveType::Arrow, static_cast<uint32>(VerticesArrow.size()));
@@ -155,10 +164,10 @@ void UAssetManager::LoadAllObjStaticMesh()
 		UStaticMesh* LoadedMesh = FObjManager::LoadObjStaticMesh(ObjPath, Config);
 
 		// 로드에 성공했는지 확인합니다.
+		// StaticMeshCache 등록(소유권)은 LoadObjStaticMesh가 이미 수행함
+		// 여기서 다시 emplace하면 키가 있을 때 새로 만든 unique_ptr 노드가 버려지며 메시가 해제되므로 하지 않음
 		if (LoadedMesh)
 		{
-			StaticMeshCache.emplace(ObjPath, LoadedMesh);
-
 			StaticMeshVertexBuffers.emplace(ObjPath, this->CreateVertexBuffer(LoadedMesh->GetVertices()));
 			StaticMeshIndexBuffers.emplace(ObjPath, this->CreateIndexBuffer(LoadedMesh->GetIndices()));
 		}
@@ -185,12 +194,21 @@ ID3D11Buffer* UAssetManager::GetIndexBuffer(FName InObjPath)
 
 ID3D11Buffer* UAssetManager::CreateVertexBuffer(TArray<FNormalVertex> InVertices)
 {
+#if WITH_RENDERER
 	return FRenderResourceFactory::CreateVertexBuffer(InVertices.data(), static_cast<int>(InVertices.size()) * sizeof(FNormalVertex));
+#else
+	// 헤드리스 빌드에서는 GPU 버퍼 없이 CPU 메시 데이터만 유지
+	return nullptr;
+#endif
 }
 
 ID3D11Buffer* UAssetManager::CreateIndexBuffer(TArray<uint32> InIndices)
 {
+#if WITH_RENDERER
 	return FRenderResourceFactory::CreateIndexBuffer(InIndices.data(), static_cast<int>(InIndices.size()) * sizeof(uint32));
+#else
+	return nullptr;
+#endif
 }
 
 TArray<FNormalVertex>* UAssetManager::GetVertexData(EPrimitiveType InType)
@@ -12,7 +12,7 @@
 static FORCEINLINE FVector MakeFallbackTangent(const FVector& N)
 {
 	// N과 덜 평행한 기준축 선택
-	const FVector Pick = (abs(N.Z) < 0.999f) ? FVector(0.f, 0.f, 1.f) : FVector(0.f, 1.f, 0.f);
+	const FVector Pick = (std::abs(N.Z) < 0.999f) ? FVector(0.f, 0.f, 1.f) : FVector(0.f, 1.f, 0.f);
 	FVector T = Cross(Pick, N);
 	T.Normalize();
 	return T;
@@ -133,6 +133,8 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		return Iter->second.get();
 	}
 
+	TIME_PROFILE(LoadObjStaticMesh)
+
 	/** #1. '.obj' 파일로부터 오브젝트 정보를 로드 */
 	FObjInfo ObjInfo;
 	if (!FObjImporter::LoadObj(PathFileName.ToString(), &ObjInfo, Config))
@@ -1,9 +1,11 @@
 ﻿#include "pch.h"
 #include "Manager/Asset/Public/TextureManager.h"
-#include "Render/Renderer/Public/RenderResourceFactory.h"
 #include "Texture/Public/Texture.h"
+#if WITH_RENDERER
+#include "Render/Renderer/Public/RenderResourceFactory.h"
 #include <DirectXTK/DDSTextureLoader.h>
 #include <DirectXTK/WICTextureLoader.h>
+#endif
 
 #include "Manager/Path/Public/PathManager.h"
 
@@ -51,13 +53,16 @@ UTexture* FTextureManager::LoadTexture(const FName& InFilePath)
     }
 
     // Not Cached
+    TIME_PROFILE(LoadTexture)
     ComPtr<ID3D11ShaderResourceView> SRV = CreateTextureFromFile(AbsolutePath.string());
 
+#if WITH_RENDERER
     if (!DefaultSampler)
     {
         DefaultSampler = FRenderResourceFactory::CreateSamplerState(D3D11_FILTER_MIN_MAG_MIP_LINEAR, D3D11_TEXTURE_ADDRESS_CLAMP);
         UE_LOG("[TextureManager] Default Sampler Create");
     }
+#endif
     
     UTexture* Texture = NewObject<UTexture>();
     Texture->SetFilePath(CacheKey);
@@ -76,11 +81,11 @@ void FTextureManager::LoadAllTexturesFromDirectory(const path& InDirectoryPath)
 {
     if (!std::filesystem::exists(InDirectoryPath) || !std::filesystem::is_directory(InDirectoryPath))
     {
-        UE_LOG_ERROR("[TextureManager] 디렉토리를 찾을 수 없습니다: %ls", InDirectoryPath.c_str());
+        UE_LOG_ERROR("[TextureManager] 디렉토리를 찾을 수 없습니다: %ls", InDirectoryPath.wstring().c_str());
         return;
     }
 
-    UE_LOG("[TextureManager] %ls 디렉토리에서 텍스처 로드를 시작합니다...", InDirectoryPath.c_str());
+    UE_LOG("[TextureManager] %ls 디렉토리에서 텍스처 로드를 시작합니다...", InDirectoryPath.wstring().c_str());
 
     // 가져올 확장자 목록
     const TSet<FString> SupportedExtensions = { ".png", ".dds", ".jpg", ".jpeg", ".bmp", ".tiff" };
@@ -98,10 +103,8 @@ void FTextureManager::LoadAllTexturesFromDirectory(const path& InDirectoryPath)
         if (SupportedExtensions.count(Extension))
         {
             FName TextureName(FilePath.string());
-            UTexture* Texture = LoadTexture(TextureName);
-            Texture->GetTextureSRV()->AddRef();
-            int temp = Texture->GetTextureSRV()->Release();
-            int y =1;
+            // 로드에 실패해도 SRV가 없는 UTexture로 캐싱되므로 SRV를 가정하지 않음
+            LoadTexture(TextureName);
         }
     }
 
@@ -115,6 +118,10 @@ const TMap<FName, UTexture*>& FTextureManager::GetTextureCache() const
 
 ComPtr<ID3D11ShaderResourceView> FTextureManager::CreateTextureFromFile(const path& InFilePath)
 {
+#if !WITH_RENDERER
+    // 헤드리스 빌드에서는 텍스처 경로만 캐싱하고 GPU 리소스는 만들지 않음
+    return nullptr;
+#else
     URenderer& Renderer = URenderer::GetInstance();
     ID3D11Device* Device = Renderer.GetDevice();
     ID3D11DeviceContext* DeviceContext = Renderer.GetDeviceContext();
@@ -141,7 +148,7 @@ ComPtr<ID3D11ShaderResourceView> FTextureManager::CreateTextureFromFile(const pa
 
             if (SUCCEEDED(ResultHandle))
             {
-                UE_LOG_SUCCESS("TextureManager: DDS 텍스처 로드 성공 - %ls", InFilePath.c_str());
+                UE_LOG_DEFERRED(Success, "TextureManager: DDS 텍스처 로드 성공 - %ls", InFilePath.c_str());
             }
             else
             {
@@ -156,7 +163,7 @@ ComPtr<ID3D11ShaderResourceView> FTextureManager::CreateTextureFromFile(const pa
 
             if (SUCCEEDED(ResultHandle))
             {
-                UE_LOG_SUCCESS("TextureManager: WIC 텍스처 로드 성공 - %ls", InFilePath.c_str());
+                UE_LOG_DEFERRED(Success, "TextureManager: WIC 텍스처 로드 성공 - %ls", InFilePath.c_str());
             }
             else
             {
@@ -170,4 +177,5 @@ ComPtr<ID3D11ShaderResourceView> FTextureManager::CreateTextureFromFile(const pa
         return nullptr;
     }
     return SUCCEEDED(ResultHandle) ? TextureSRV : nullptr;
+#endif
 }
@@ -168,7 +168,7 @@ struct FObjImporter
 	 * @param Config Configuration options for the import process.
 	 * @return True if the file was loaded and parsed successfully, false otherwise.
 	 */
-	static bool LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config = {});
+	static bool LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config);
 
 	/**
 	 * @brief Loads and parses a .mtl material library file.
@@ -8,34 +8,6 @@
 #include <iostream>
 #include <algorithm>
 
-// Helper function to safely check if an Actor pointer is valid
-// Separated to avoid C2712 error (can't use __try with objects that have destructors)
-namespace
-{
-    bool IsActorPointerValid(AActor* actor)
-    {
-        if (!actor)
-        {
-            return false;
-        }
-
-#ifdef _WIN32
-        __try
-        {
-            // Try to access a member to verify it's not freed memory
-            return !actor->IsPendingDestroy();
-        }
-        __except (EXCEPTION_EXECUTE_HANDLER)
-        {
-            // Access violation - actor is freed memory
-            return false;
-        }
-#else
-        return !actor->IsPendingDestroy();
-#endif
-    }
-}
-
 // Singleton instance
 FLuaCoroutineManager& FLuaCoroutineManager::GetInstance()
 {
@@ -99,18 +71,10 @@ void FLuaCoroutineManager::Tick(float deltaTime)
             continue;
         }
 
-        // Check if 'this' (the actor pointer) is still valid
-        sol::object thisObj = info.OwnerTable["this"];
-        if (!thisObj.valid() || !thisObj.is<AActor*>())
-        {
-            std::cout << "[Coroutine] Coroutine " << info.ID << " stopped (actor destroyed)" << std::endl;
-            it = ActiveCoroutines.erase(it);
-            continue;
-        }
-
-        // CRITICAL: Check if the Actor pointer is actually valid (not freed)
-        AActor* actor = thisObj.as<AActor*>();
-        if (!IsActorPointerValid(actor))
+        // Check if the owning Actor is still alive
+        // OwnerActor is a weak handle, so a freed Actor is rejected by its serial number without touching freed memory
+        AActor* actor = info.OwnerActor.Get();
+        if (!actor || actor->IsPendingDestroy())
         {
             std::cout << "[Coroutine] Coroutine " << info.ID << " stopped (actor freed or pending destroy)" << std::endl;
             it = ActiveCoroutines.erase(it);
@@ -248,6 +212,13 @@ int FLuaCoroutineManager::StartCoroutine(sol::table scriptTable, const std::stri
     // Add to active coroutines (store thread to keep it alive!)
     ActiveCoroutines.emplace_back(coroutineID, std::move(coThread), std::move(co), scriptTable);
 
+    // Capture 'this' (the owning Actor) once as a weak handle for the per-frame validity check
+    sol::object thisObj = scriptTable["this"];
+    if (thisObj.valid() && thisObj.is<AActor*>())
+    {
+        ActiveCoroutines.back().OwnerActor = thisObj.as<AActor*>();
+    }
+
     // Register coroutine with component if provided
     if (ownerComponent)
     {
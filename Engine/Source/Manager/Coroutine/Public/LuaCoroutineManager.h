@@ -4,6 +4,7 @@
 #include <memory>
 
 // Forward declaration
+class AActor;
 class ULuaScriptComponent;
 
 class FLuaCoroutineManager
@@ -55,6 +56,7 @@ private:
         sol::thread Thread;                 // Must keep the thread alive!
         sol::coroutine Coroutine;
         sol::table OwnerTable;              // The 'self' table (SelfTable from component)
+        TWeakObjectPtr<AActor> OwnerActor;  // OwnerTable["this"], captured at start (generation-checked, no raw pointer access)
         ECoroutineState State;
         float WaitTime;                     // For wait(seconds)
         sol::function WaitCondition;        // For wait_until(condition)
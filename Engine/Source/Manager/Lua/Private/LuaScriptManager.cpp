@@ -204,9 +204,18 @@ void FLuaScriptManager::ShutDown()
 void FLuaScriptManager::Tick(float deltaTime)
 {
     // Hot reload check (optional)
-    HotReloadLuaScript();
+    {
+        TIME_PROFILE(LuaHotReload)
+        HotReloadLuaScript();
+    }
 
     // Update coroutines
+    TickCoroutines(deltaTime);
+}
+
+void FLuaScriptManager::TickCoroutines(float deltaTime)
+{
+    TIME_PROFILE(LuaCoroutines)
     FLuaCoroutineManager::GetInstance().Tick(deltaTime);
 }
 
@@ -21,6 +21,8 @@ public:
 
     // Called every frame
     void Tick(float deltaTime);
+    // Advances coroutines only (called once per fixed step)
+    void TickCoroutines(float deltaTime);
 
     // For LuaComponent to register/unregister themselves
     void RegisterComponent(ULuaScriptComponent* component);
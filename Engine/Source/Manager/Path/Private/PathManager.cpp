@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Manager/Path/Public/PathManager.h"
+#include "Platform/Public/PlatformFile.h"
 
 IMPLEMENT_SINGLETON_CLASS(UPathManager, UObject)
 
@@ -26,12 +27,17 @@ void UPathManager::Init()
  */
 void UPathManager::InitializeRootPath()
 {
-	// Get Execution File Path
-	wchar_t ProgramPath[MAX_PATH];
-	GetModuleFileNameW(nullptr, ProgramPath, MAX_PATH);
-
 	// Add Root Path
-	RootPath = path(ProgramPath).parent_path();
+	RootPath = FPlatformFile::GetExecutablePath().parent_path();
+}
+
+void UPathManager::SetRootPath(const path& InRootPath)
+{
+	RootPath = InRootPath;
+	GetEssentialPath();
+	ValidateAndCreateDirectories();
+
+	UE_LOG("PathManager: Root Path Overridden: %s", RootPath.string().c_str());
 }
 
 /**
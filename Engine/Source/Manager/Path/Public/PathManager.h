@@ -10,6 +10,8 @@ class UPathManager :
 
 public:
 	void Init();
+	// 실행 파일 위치 대신 지정한 경로를 Root로 사용 (헤드리스 도구가 저장소의 Data/Asset을 직접 쓸 때)
+	void SetRootPath(const path& InRootPath);
 
 	// Base Path
 	const path& GetRootPath() const { return RootPath; }
@@ -0,0 +1,58 @@
+#include "pch.h"
+#include "Manager/Time/Public/FixedStepClock.h"
+
+namespace
+{
+	constexpr uint64 NANOSECONDS_PER_SECOND = 1000000000ull;
+
+	// 창을 끌거나 디버거에 멈춰 있던 프레임이 누적기를 크게 부풀리지 않도록 한 프레임에 더할 수 있는 상한
+	constexpr double MAX_FRAME_SECONDS = 1.0;
+}
+
+FFixedStepClock::FFixedStepClock()
+	: MaxSubsteps(DEFAULT_MAX_SUBSTEPS)
+{
+	SetStepsPerSecond(DEFAULT_STEPS_PER_SECOND);
+}
+
+uint32 FFixedStepClock::Advance(double InFrameSeconds)
+{
+	const double FrameSeconds = std::clamp(InFrameSeconds, 0.0, MAX_FRAME_SECONDS);
+	AccumulatedNanoseconds += static_cast<uint64>(FrameSeconds * static_cast<double>(NANOSECONDS_PER_SECOND) + 0.5);
+
+	uint64 Steps = AccumulatedNanoseconds / StepNanoseconds;
+	AccumulatedNanoseconds -= Steps * StepNanoseconds;
+
+	if (Steps > MaxSubsteps)
+	{
+		DroppedStepCount += Steps - MaxSubsteps;
+		Steps = MaxSubsteps;
+	}
+
+	SubstepCount = static_cast<uint32>(Steps);
+	StepCount += Steps;
+	return SubstepCount;
+}
+
+void FFixedStepClock::Reset()
+{
+	AccumulatedNanoseconds = 0;
+	SubstepCount = 0;
+	StepCount = 0;
+	DroppedStepCount = 0;
+}
+
+void FFixedStepClock::SetStepsPerSecond(uint32 InStepsPerSecond)
+{
+	StepsPerSecond = std::clamp<uint32>(InStepsPerSecond, 1, 1000);
+	StepSeconds = 1.0f / static_cast<float>(StepsPerSecond);
+	StepNanoseconds = (NANOSECONDS_PER_SECOND + StepsPerSecond / 2) / StepsPerSecond;
+
+	// 스텝 길이가 줄어든 경우에도 Alpha가 [0, 1)을 유지하도록
+	AccumulatedNanoseconds %= StepNanoseconds;
+}
+
+void FFixedStepClock::SetMaxSubsteps(uint32 InMaxSubsteps)
+{
+	MaxSubsteps = std::max<uint32>(InMaxSubsteps, 1);
+}
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Manager/Time/Public/TimeManager.h"
+#include "Component/Public/SceneTransformStore.h"
 #include "Utility/Public/ScopeCycleCounter.h"
 
 IMPLEMENT_SINGLETON_CLASS(UTimeManager, UObject)
@@ -24,4 +25,23 @@ void UTimeManager::Update()
 	{
 		GameTime += DeltaTime;
 	}
+
+	if (bIsFixedTimestepEnabled)
+	{
+		// 일시 정지 중에는 스텝 없이 보간 비율만 유지
+		FixedStepClock.Advance(bIsPaused ? 0.0 : DeltaTime);
+	}
+}
+
+void UTimeManager::SetFixedTimestepEnabled(bool bInEnabled)
+{
+	if (bIsFixedTimestepEnabled == bInEnabled)
+	{
+		return;
+	}
+
+	// 다시 켤 때 이전에 남은 누적 시간으로 스텝이 몰리지 않도록 초기화
+	bIsFixedTimestepEnabled = bInEnabled;
+	FixedStepClock.Reset();
+	FSceneTransformStore::GetInstance().ResetInterpolation();
 }
@@ -0,0 +1,58 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 고정 스텝 시뮬레이션 시계 (누적기 방식)
+ *
+ * 프레임마다 Advance로 실제 경과 시간을 누적기에 더하고, 누적된 만큼의 고정 스텝 수를 돌려줍니다.
+ * 남은 시간은 다음 프레임으로 넘어가며, 그 비율(GetAlpha)로 이전/현재 스텝 사이를 보간해 렌더링합니다.
+ *
+ * 누적기는 정수 나노초로 계산하므로 오차가 쌓이지 않으며, 시뮬레이션은 항상 GetStepSeconds 간격으로만 진행되어
+ * 프레임 시간이 달라도 같은 스텝 수 뒤의 결과가 같습니다.
+ * 한 프레임이 MaxSubsteps보다 많은 스텝을 요구하면 넘치는 스텝은 버려(DroppedStepCount) 스텝 처리가 다음 프레임을 더 늦추는 악순환을 막습니다.
+ */
+class FFixedStepClock
+{
+public:
+	static constexpr uint32 DEFAULT_STEPS_PER_SECOND = 60;
+	static constexpr uint32 DEFAULT_MAX_SUBSTEPS = 5;
+
+	FFixedStepClock();
+
+	/**
+	 * @brief 프레임 시간을 누적하고 이번 프레임에 실행할 스텝 수를 반환합니다.
+	 * @param InFrameSeconds 지난 프레임의 실제 경과 시간 (음수는 0으로 취급)
+	 */
+	uint32 Advance(double InFrameSeconds);
+
+	/** @brief 누적기와 스텝 통계를 초기화합니다. (스텝 설정은 유지) */
+	void Reset();
+
+	void SetStepsPerSecond(uint32 InStepsPerSecond);
+	uint32 GetStepsPerSecond() const { return StepsPerSecond; }
+	void SetMaxSubsteps(uint32 InMaxSubsteps);
+	uint32 GetMaxSubsteps() const { return MaxSubsteps; }
+
+	/** @brief 스텝 하나의 시뮬레이션 시간 (모든 스텝에 같은 값을 넘겨야 결과가 재현됨) */
+	float GetStepSeconds() const { return StepSeconds; }
+	/** @brief 마지막 Advance가 반환한 스텝 수 */
+	uint32 GetSubstepCount() const { return SubstepCount; }
+	/** @brief 마지막 스텝 이후 누적된 시간의 비율 [0, 1) */
+	float GetAlpha() const { return static_cast<float>(static_cast<double>(AccumulatedNanoseconds) / static_cast<double>(StepNanoseconds)); }
+
+	/** @brief Reset 이후 실행한 총 스텝 수 */
+	uint64 GetStepCount() const { return StepCount; }
+	/** @brief MaxSubsteps 제한으로 버린 총 스텝 수 */
+	uint64 GetDroppedStepCount() const { return DroppedStepCount; }
+
+private:
+	uint32 StepsPerSecond;
+	uint32 MaxSubsteps;
+	float StepSeconds;
+	uint64 StepNanoseconds;
+
+	uint64 AccumulatedNanoseconds = 0;
+	uint32 SubstepCount = 0;
+	uint64 StepCount = 0;
+	uint64 DroppedStepCount = 0;
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Public/Object.h"
+#include "Manager/Time/Public/FixedStepClock.h"
 
 using std::chrono::high_resolution_clock;
 
@@ -24,12 +25,29 @@ public:
 	void PauseGame() { bIsPaused = true; }
 	void ResumeGame() { bIsPaused = false; }
 
+	/**
+	 * @brief 고정 스텝 시뮬레이션 (기본 비활성)
+	 * 켜져 있으면 Update가 지난 프레임 시간을 FixedStepClock에 누적하고, ClientApp은 월드와 코루틴을
+	 * GetSubstepCount()번 GetStepSeconds() 간격으로 진행한 뒤 Alpha로 보간한 트랜스폼으로 렌더링합니다.
+	 * 카메라, UI 등 시뮬레이션이 아닌 부분은 계속 DeltaTime을 사용합니다.
+	 */
+	void SetFixedTimestepEnabled(bool bInEnabled);
+	bool IsFixedTimestepEnabled() const { return bIsFixedTimestepEnabled; }
+	void SetInterpolationEnabled(bool bInEnabled) { bIsInterpolationEnabled = bInEnabled; }
+	bool IsInterpolationEnabled() const { return bIsInterpolationEnabled; }
+	FFixedStepClock& GetFixedStepClock() { return FixedStepClock; }
+	const FFixedStepClock& GetFixedStepClock() const { return FixedStepClock; }
+
 private:
 	float GameTime;
 	float DeltaTime;
 
 	bool bIsPaused;
 
+	FFixedStepClock FixedStepClock;
+	bool bIsFixedTimestepEnabled = false;
+	bool bIsInterpolationEnabled = true;
+
 	void Initialize();
 	void CalculateFPS();
 };
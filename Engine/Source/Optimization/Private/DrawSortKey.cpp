@@ -0,0 +1,106 @@
+#include "pch.h"
+#include "Optimization/Public/DrawSortKey.h"
+
+uint32 DrawSortKey::QuantizeDepth(float InDistance, float InMaxDistance)
+{
+	if (InMaxDistance <= 0.0f || InDistance <= 0.0f)
+	{
+		return 0;
+	}
+
+	const float Normalized = std::min(InDistance / InMaxDistance, 1.0f);
+	const float Bucket = std::sqrt(Normalized) * static_cast<float>(MaxValue(DEPTH_BITS));
+	return static_cast<uint32>(Bucket);
+}
+
+uint32 FSortKeyIdTable::GetId(uint64 InKey)
+{
+	auto It = Ids.find(InKey);
+	if (It != Ids.end())
+	{
+		return It->second;
+	}
+
+	const uint32 NewId = std::min(static_cast<uint32>(Ids.size()) + 1, MaxId);
+	Ids.emplace(InKey, NewId);
+	return NewId;
+}
+
+void DrawSortKey::RadixSort(const TArray<uint64>& InKeys, TArray<uint32>& OutOrder, TArray<uint32>& InOutScratch)
+{
+	const uint32 Count = static_cast<uint32>(InKeys.size());
+	OutOrder.resize(Count);
+	InOutScratch.resize(Count);
+
+	for (uint32 i = 0; i < Count; ++i)
+	{
+		OutOrder[i] = i;
+	}
+
+	if (Count < 2)
+	{
+		return;
+	}
+
+	// 8비트씩 8번, 하위 바이트부터 counting sort (각 단계가 안정 정렬이므로 전체도 안정 정렬)
+	uint32 Histogram[256];
+	for (uint32 Shift = 0; Shift < 64; Shift += 8)
+	{
+		std::memset(Histogram, 0, sizeof(Histogram));
+		for (uint32 i = 0; i < Count; ++i)
+		{
+			++Histogram[(InKeys[i] >> Shift) & 0xFF];
+		}
+
+		// 모든 키의 이 바이트가 같으면 순서가 바뀌지 않으므로 건너뛴다 (사용하지 않는 상위 필드가 대부분 해당)
+		if (Histogram[(InKeys[0] >> Shift) & 0xFF] == Count)
+		{
+			continue;
+		}
+
+		uint32 Offset = 0;
+		for (uint32& Bucket : Histogram)
+		{
+			const uint32 BucketCount = Bucket;
+			Bucket = Offset;
+			Offset += BucketCount;
+		}
+
+		for (uint32 i = 0; i < Count; ++i)
+		{
+			const uint32 Index = OutOrder[i];
+			InOutScratch[Histogram[(InKeys[Index] >> Shift) & 0xFF]++] = Index;
+		}
+
+		OutOrder.swap(InOutScratch);
+	}
+}
+
+FDrawStateChangeCount DrawSortKey::CountStateChanges(const TArray<uint64>& InKeys, const TArray<uint32>* InOrder)
+{
+	FDrawStateChangeCount Result;
+
+	bool bFirst = true;
+	uint64 PrevKey = 0;
+	const uint32 Count = static_cast<uint32>(InKeys.size());
+	for (uint32 i = 0; i < Count; ++i)
+	{
+		const uint64 Key = InKeys[InOrder ? (*InOrder)[i] : i];
+
+		// 첫 Draw는 모든 상태를 바인딩해야 하므로 변경으로 센다
+		auto Changed = [&](uint32 InShift, uint32 InBits)
+		{
+			return bFirst || GetField(Key, InShift, InBits) != GetField(PrevKey, InShift, InBits);
+		};
+
+		if (Changed(SHADER_SHIFT, SHADER_BITS) || Changed(PASS_SHIFT, PASS_BITS)) { ++Result.ShaderChanges; }
+		if (Changed(TEXTURE_SET_SHIFT, TEXTURE_SET_BITS)) { ++Result.TextureSetChanges; }
+		if (Changed(MATERIAL_SHIFT, MATERIAL_BITS)) { ++Result.MaterialChanges; }
+		if (Changed(MESH_SHIFT, MESH_BITS)) { ++Result.MeshChanges; }
+
+		PrevKey = Key;
+		bFirst = false;
+	}
+
+	return Result;
+}
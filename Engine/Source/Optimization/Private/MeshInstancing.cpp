@@ -0,0 +1,76 @@
+#include "pch.h"
+#include "Optimization/Public/MeshInstancing.h"
+#include "Optimization/Public/DrawSortKey.h"
+
+uint64 FMeshInstanceBatcher::MakeBatchKey(uint64 InSortKey, uint32 InSectionIndex)
+{
+	using namespace DrawSortKey;
+
+	const bool bUniqueIds =
+		GetField(InSortKey, MESH_SHIFT, MESH_BITS) < MaxValue(MESH_BITS)
+		&& GetField(InSortKey, MATERIAL_SHIFT, MATERIAL_BITS) < MaxValue(MATERIAL_BITS)
+		&& GetField(InSortKey, TEXTURE_SET_SHIFT, TEXTURE_SET_BITS) < MaxValue(TEXTURE_SET_BITS);
+	if (!bUniqueIds || InSectionIndex > MaxValue(DEPTH_BITS))
+	{
+		return NO_BATCH;
+	}
+
+	const uint64 DepthMask = MaxValue(DEPTH_BITS) << DEPTH_SHIFT;
+	return (InSortKey & ~DepthMask) | (static_cast<uint64>(InSectionIndex) << DEPTH_SHIFT);
+}
+
+void FMeshInstanceBatcher::Build(const TArray<uint64>& InBatchKeys, const TArray<uint32>& InOrder)
+{
+	Batches.clear();
+	InstanceCommands.resize(InOrder.size());
+	CommandBatches.resize(InOrder.size());
+	BatchIndices.clear();
+	InstancedBatchCount = 0;
+	InstanceBufferCount = 0;
+
+	// 1. 제출 순서대로 보며 처음 등장한 키마다 묶음을 만들고 인스턴스 수를 센다
+	for (uint32 i = 0; i < InOrder.size(); ++i)
+	{
+		const uint64 Key = InBatchKeys[InOrder[i]];
+
+		uint32 BatchIndex = static_cast<uint32>(Batches.size());
+		if (Key != NO_BATCH)
+		{
+			auto Result = BatchIndices.emplace(Key, BatchIndex);
+			BatchIndex = Result.first->second;
+		}
+
+		if (BatchIndex == Batches.size())
+		{
+			Batches.emplace_back();
+		}
+
+		if (++Batches[BatchIndex].InstanceCount == 2)
+		{
+			++InstancedBatchCount;
+		}
+		CommandBatches[i] = BatchIndex;
+	}
+
+	// 2. 묶음마다 연속된 구간을 배정하고, 인스턴싱 묶음에는 인스턴스 버퍼 구간도 배정한다
+	uint32 Offset = 0;
+	for (FInstanceBatch& Batch : Batches)
+	{
+		Batch.FirstInstance = Offset;
+		Offset += Batch.InstanceCount;
+
+		if (Batch.IsInstanced())
+		{
+			Batch.InstanceBufferOffset = InstanceBufferCount;
+			InstanceBufferCount += Batch.InstanceCount;
+		}
+		Batch.InstanceCount = 0;
+	}
+
+	// 3. 제출 순서를 유지하며 각 구간에 command를 채운다
+	for (uint32 i = 0; i < InOrder.size(); ++i)
+	{
+		FInstanceBatch& Batch = Batches[CommandBatches[i]];
+		InstanceCommands[Batch.FirstInstance + Batch.InstanceCount++] = InOrder[i];
+	}
+}
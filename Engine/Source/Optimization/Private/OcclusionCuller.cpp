@@ -16,7 +16,7 @@ void COcclusionCuller::InitializeCuller(const FMatrix& ViewMatrix, const FMatrix
     CurrentViewProj = ViewMatrix * ProjectionMatrix;
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos)
+const TArray<UPrimitiveComponent*>& COcclusionCuller::PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos)
 {    
     Frame++;
     // 0. Primitive AABB 데이터 채우기
@@ -40,8 +40,9 @@ TArray<UPrimitiveComponent*> COcclusionCuller::PerformCulling(const TArray<UPrim
 
     // 1. 오클루더 동적 선택
     ULevel* CurrentLevel = GWorld->GetLevel();
-    TArray<UPrimitiveComponent*> OccluderCandidates = CurrentLevel->GetStaticOctree()->FindNearestPrimitives(CameraPos, static_cast<uint32>(AllPrimitives.size()) / 10);
-    TArray<UPrimitiveComponent*> SelectedOccluders = SelectOccluders(OccluderCandidates, CameraPos);
+    TFrameArray<UPrimitiveComponent*> OccluderCandidates;
+    CurrentLevel->GetStaticOctree()->FindNearestPrimitives(CameraPos, static_cast<uint32>(AllPrimitives.size()) / 10, OccluderCandidates);
+    const TArray<UPrimitiveComponent*>& SelectedOccluders = SelectOccluders(OccluderCandidates, CameraPos);
 
     // 2. CPU Z-Buffer 구성
     RasterizeOccluders(SelectedOccluders, CameraPos);
@@ -59,7 +60,7 @@ TArray<UPrimitiveComponent*> COcclusionCuller::PerformCulling(const TArray<UPrim
     return VisibleMeshComponents;
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::SelectOccluders(const TArray<UPrimitiveComponent*>& Candidates, const FVector& CameraPos)
+const TArray<UPrimitiveComponent*>& COcclusionCuller::SelectOccluders(const TFrameArray<UPrimitiveComponent*>& Candidates, const FVector& CameraPos)
 {
     FilteredOccluders.clear();
 
@@ -84,7 +85,7 @@ void COcclusionCuller::RasterizeOccluders(const TArray<UPrimitiveComponent*>& Se
     {
         if (OccluderComp->CachedFrame != Frame) { continue; }
         // 1. AABB를 12개 삼각형의 월드 정점 리스트로 변환
-        TArray<FVector> BoxTriangles = ConvertAABBToTriangles(OccluderComp);
+        const TArray<FVector>& BoxTriangles = ConvertAABBToTriangles(OccluderComp);
 
         // 2. CPU 래스터라이징
         for (uint32 Idx = 0; Idx < BoxTriangles.size(); Idx += 3)
@@ -362,7 +363,7 @@ void COcclusionCuller::RasterizeTriangle(const FVector& P1, const FVector& P2, c
     }
 }
 
-TArray<FVector> COcclusionCuller::ConvertAABBToTriangles(UPrimitiveComponent* Prim)
+const TArray<FVector>& COcclusionCuller::ConvertAABBToTriangles(UPrimitiveComponent* Prim)
 {
     Triangles.clear();
 
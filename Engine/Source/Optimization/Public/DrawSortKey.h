@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Global/Types.h"
+
+/**
+ * @brief 64비트 Draw 정렬 키
+ *
+ * 상태 변경 비용이 큰 항목일수록 상위 비트에 배치하여, 키 순서대로 그리면
+ * 비싼 상태(셰이더, 텍스처 바인딩)부터 묶이도록 합니다.
+ *
+ * | Pass (4) | Shader (8) | TextureSet (12) | Material (12) | Mesh (16) | Depth (12) |
+ *
+ * 각 필드는 FSortKeyIdTable로 프레임마다 발급한 작은 정수 ID를 사용합니다.
+ * Depth는 같은 상태 안에서 앞에서 뒤로(front-to-back) 그려 Early-Z를 활용하기 위한 값입니다.
+ */
+namespace DrawSortKey
+{
+	constexpr uint32 PASS_BITS = 4;
+	constexpr uint32 SHADER_BITS = 8;
+	constexpr uint32 TEXTURE_SET_BITS = 12;
+	constexpr uint32 MATERIAL_BITS = 12;
+	constexpr uint32 MESH_BITS = 16;
+	constexpr uint32 DEPTH_BITS = 12;
+
+	constexpr uint32 DEPTH_SHIFT = 0;
+	constexpr uint32 MESH_SHIFT = DEPTH_SHIFT + DEPTH_BITS;
+	constexpr uint32 MATERIAL_SHIFT = MESH_SHIFT + MESH_BITS;
+	constexpr uint32 TEXTURE_SET_SHIFT = MATERIAL_SHIFT + MATERIAL_BITS;
+	constexpr uint32 SHADER_SHIFT = TEXTURE_SET_SHIFT + TEXTURE_SET_BITS;
+	constexpr uint32 PASS_SHIFT = SHADER_SHIFT + SHADER_BITS;
+
+	static_assert(PASS_SHIFT + PASS_BITS == 64, "Draw sort key must fill exactly 64 bits");
+
+	constexpr uint64 MaxValue(uint32 InBits) { return (1ull << InBits) - 1; }
+
+	constexpr uint64 GetField(uint64 InKey, uint32 InShift, uint32 InBits) { return (InKey >> InShift) & MaxValue(InBits); }
+
+	/** @brief 각 필드를 비트 폭에 맞게 잘라 하나의 키로 합칩니다. */
+	constexpr uint64 Make(uint32 InPass, uint32 InShader, uint32 InTextureSet, uint32 InMaterial, uint32 InMesh, uint32 InDepth)
+	{
+		return ((InPass & MaxValue(PASS_BITS)) << PASS_SHIFT)
+			| ((InShader & MaxValue(SHADER_BITS)) << SHADER_SHIFT)
+			| ((InTextureSet & MaxValue(TEXTURE_SET_BITS)) << TEXTURE_SET_SHIFT)
+			| ((InMaterial & MaxValue(MATERIAL_BITS)) << MATERIAL_SHIFT)
+			| ((InMesh & MaxValue(MESH_BITS)) << MESH_SHIFT)
+			| ((InDepth & MaxValue(DEPTH_BITS)) << DEPTH_SHIFT);
+	}
+
+	/**
+	 * @brief 카메라 거리를 [0, 2^DEPTH_BITS) 범위로 양자화합니다.
+	 * 가까운 거리를 더 촘촘하게 나누기 위해 제곱근 분포를 사용합니다.
+	 */
+	uint32 QuantizeDepth(float InDistance, float InMaxDistance);
+}
+
+/**
+ * @brief 프레임 단위로 객체(포인터, 해시)에 작은 정수 ID를 발급하는 테이블
+ * 처음 등장한 순서대로 1부터 발급하며, 상한을 넘으면 마지막 ID를 공유합니다. (정렬 효율만 떨어지고 결과는 정확함)
+ */
+class FSortKeyIdTable
+{
+public:
+	explicit FSortKeyIdTable(uint32 InBits) : MaxId(static_cast<uint32>(DrawSortKey::MaxValue(InBits))) {}
+
+	uint32 GetId(uint64 InKey);
+	void Reset() { Ids.clear(); }
+	uint32 Num() const { return static_cast<uint32>(Ids.size()); }
+
+private:
+	TMap<uint64, uint32> Ids;
+	uint32 MaxId;
+};
+
+/**
+ * @brief 정렬 키 순서로 그렸을 때 발생하는 상태 변경 횟수
+ */
+struct FDrawStateChangeCount
+{
+	uint32 ShaderChanges = 0;
+	uint32 TextureSetChanges = 0;
+	uint32 MaterialChanges = 0;
+	uint32 MeshChanges = 0;
+
+	uint32 GetTotal() const { return ShaderChanges + TextureSetChanges + MaterialChanges + MeshChanges; }
+};
+
+namespace DrawSortKey
+{
+	/**
+	 * @brief 8비트 단위 LSD Radix sort (안정 정렬이므로 같은 키는 입력 순서를 유지하여 결과가 결정적)
+	 * @param InKeys 정렬할 키 (변경하지 않음)
+	 * @param OutOrder 키 오름차순으로 정렬된 인덱스
+	 * @param InOutScratch 임시 버퍼 (프레임 간 재사용하여 할당을 피함)
+	 */
+	void RadixSort(const TArray<uint64>& InKeys, TArray<uint32>& OutOrder, TArray<uint32>& InOutScratch);
+
+	/**
+	 * @brief 주어진 순서대로 그렸을 때의 상태 변경 횟수를 셉니다.
+	 * @param InOrder nullptr이면 InKeys의 원래 순서를 사용
+	 */
+	FDrawStateChangeCount CountStateChanges(const TArray<uint64>& InKeys, const TArray<uint32>* InOrder = nullptr);
+}
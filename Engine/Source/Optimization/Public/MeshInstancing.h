@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Global/Types.h"
+
+/**
+ * @brief 인스턴싱 Draw 한 번에 해당하는 묶음
+ * GetInstanceCommands()의 [FirstInstance, FirstInstance + InstanceCount) 구간이 이 묶음의 Draw command입니다.
+ */
+struct FInstanceBatch
+{
+	/** @brief 인스턴스 버퍼를 쓰지 않는 묶음(인스턴스 1개)의 InstanceBufferOffset */
+	static constexpr uint32 NO_INSTANCE_BUFFER = ~0u;
+
+	uint32 FirstInstance = 0;
+	uint32 InstanceCount = 0;
+
+	/** @brief PackInstanceBuffer()로 채운 버퍼에서 이 묶음의 시작 위치 (셰이더의 InstanceBaseIndex) */
+	uint32 InstanceBufferOffset = NO_INSTANCE_BUFFER;
+
+	bool IsInstanced() const { return InstanceCount > 1; }
+};
+
+/**
+ * @brief 같은 상태(메시 섹션, 머티리얼, 텍스처, 셰이더)를 공유하는 Draw command를 인스턴싱 묶음으로 모읍니다.
+ *
+ * 렌더링 리소스에 의존하지 않으므로 GPU 없이도 결과를 검증할 수 있습니다.
+ * 묶음은 정렬 순서에서 처음 등장한 순서대로 만들어지고, 묶음 안의 command도 정렬 순서를 유지합니다.
+ * (정렬 키 순서대로 상태가 바뀌고, 같은 묶음 안에서는 앞에서 뒤로 그려짐)
+ */
+class FMeshInstanceBatcher
+{
+public:
+	/** @brief 이 키를 가진 command는 다른 command와 묶지 않습니다. */
+	static constexpr uint64 NO_BATCH = ~0ull;
+
+	/**
+	 * @brief Draw 정렬 키의 Depth 필드를 섹션 번호로 바꿔 묶음 키를 만듭니다. (나머지 상태가 모두 같아야 함께 그릴 수 있음)
+	 * ID가 포화되면 서로 다른 객체가 같은 ID를 공유할 수 있으므로 NO_BATCH를 반환합니다.
+	 */
+	static uint64 MakeBatchKey(uint64 InSortKey, uint32 InSectionIndex);
+
+	/**
+	 * @param InBatchKeys command별 묶음 키 (키가 같으면 하나의 인스턴싱 Draw로 그릴 수 있음)
+	 * @param InOrder 제출 순서 (정렬된 command 인덱스)
+	 */
+	void Build(const TArray<uint64>& InBatchKeys, const TArray<uint32>& InOrder);
+
+	const TArray<FInstanceBatch>& GetBatches() const { return Batches; }
+	const TArray<uint32>& GetInstanceCommands() const { return InstanceCommands; }
+
+	/** @brief 인스턴스가 2개 이상인 묶음의 개수 */
+	uint32 GetInstancedBatchCount() const { return InstancedBatchCount; }
+
+	/** @brief 인스턴스 버퍼에 들어갈 항목 수 (인스턴스가 2개 이상인 묶음의 command 수 합) */
+	uint32 GetInstanceBufferCount() const { return InstanceBufferCount; }
+
+	/**
+	 * @brief 인스턴스가 2개 이상인 묶음의 command별 데이터를 묶음 순서대로 채웁니다.
+	 * 각 묶음의 데이터는 OutBuffer[InstanceBufferOffset, InstanceBufferOffset + InstanceCount) 구간에 놓입니다.
+	 * @param InGetElement command 인덱스를 받아 버퍼 항목(예: World 행렬)을 반환
+	 */
+	template<typename TElement, typename TGetElement>
+	void PackInstanceBuffer(TArray<TElement>& OutBuffer, TGetElement&& InGetElement) const
+	{
+		OutBuffer.clear();
+		OutBuffer.reserve(InstanceBufferCount);
+		for (const FInstanceBatch& Batch : Batches)
+		{
+			if (!Batch.IsInstanced()) { continue; }
+
+			for (uint32 i = 0; i < Batch.InstanceCount; ++i)
+			{
+				OutBuffer.push_back(InGetElement(InstanceCommands[Batch.FirstInstance + i]));
+			}
+		}
+	}
+
+private:
+	TArray<FInstanceBatch> Batches;
+	TArray<uint32> InstanceCommands;
+	uint32 InstancedBatchCount = 0;
+	uint32 InstanceBufferCount = 0;
+
+	// 프레임마다 재사용하는 임시 버퍼
+	TMap<uint64, uint32> BatchIndices;
+	TArray<uint32> CommandBatches;
+};
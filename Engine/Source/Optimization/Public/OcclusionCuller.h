@@ -20,9 +20,9 @@ public:
      * @brief 오클루전 컬링의 전체 프로세스를 실행하고 최종 가시 오브젝트 목록을 반환
      * @param AllStaticMeshes 프러스텀 컬링을 통과한 모든 스태틱 메시 목록
      * @param CameraPos 현재 카메라 위치
-     * @return 렌더링되어야 할 UPrimitiveComponent 목록
+     * @return 렌더링되어야 할 UPrimitiveComponent 목록 (내부 배열을 재사용하므로 다음 PerformCulling 호출 전까지 유효)
      */
-    TArray<UPrimitiveComponent*> PerformCulling(const TArray<UPrimitiveComponent*>& AllStaticMeshes, const FVector& CameraPos);
+    const TArray<UPrimitiveComponent*>& PerformCulling(const TArray<UPrimitiveComponent*>& AllStaticMeshes, const FVector& CameraPos);
 
     // Constants
     static constexpr int Z_BUFFER_WIDTH = 256;
@@ -35,7 +35,7 @@ private:
     * @param AllCandidates 가까운 곳의 Occluders 후보
     * @return 오클루더로 선정된 UPrimitiveComponent 목록
     */
-    TArray<UPrimitiveComponent*> SelectOccluders(const TArray<UPrimitiveComponent*>& AllCandidates, const FVector& CameraPos);
+    const TArray<UPrimitiveComponent*>& SelectOccluders(const TFrameArray<UPrimitiveComponent*>& AllCandidates, const FVector& CameraPos);
 
     void RasterizeOccluders(const TArray<UPrimitiveComponent*>& SelectedOccluders, const FVector& CameraPos);
 
@@ -62,7 +62,7 @@ private:
     /**
      * @brief PrimitiveComponent의 AABB를 12개의 삼각형 정점으로 변환
      */
-    TArray<FVector> ConvertAABBToTriangles(class UPrimitiveComponent* PrimitiveComp);
+    const TArray<FVector>& ConvertAABBToTriangles(class UPrimitiveComponent* PrimitiveComp);
 
     TArray<float> CPU_ZBuffer;
     FMatrix CurrentViewProj;
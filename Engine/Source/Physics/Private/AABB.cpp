@@ -1,6 +1,67 @@
 #include "pch.h"
 #include "Physics/Public/AABB.h"
 
+namespace
+{
+	/**
+	 * @brief 변환에 쓰는 행렬 행 (Row-vector 시스템이므로 결과 = X * Row0 + Y * Row1 + Z * Row2 + Row3)
+	 */
+	struct FAABBTransformRows
+	{
+		__m128 Rows[4];
+		__m128 AbsRows[3];
+
+		explicit FAABBTransformRows(const FMatrix& InMatrix)
+		{
+			// 부호 비트만 켜진 값과 andnot 하면 절댓값
+			const __m128 SignMask = _mm_set1_ps(-0.0f);
+			for (int32 Index = 0; Index < 3; ++Index)
+			{
+				Rows[Index] = InMatrix.V[Index];
+				AbsRows[Index] = _mm_andnot_ps(SignMask, InMatrix.V[Index]);
+			}
+			Rows[3] = InMatrix.V[3];
+		}
+
+		void Transform(const FAABB& InBox, FAABB& OutBox) const
+		{
+			const __m128 Min = MatrixSIMD::LoadVector3(InBox.Min, 0.0f);
+			const __m128 Max = MatrixSIMD::LoadVector3(InBox.Max, 0.0f);
+			const __m128 Half = _mm_set1_ps(0.5f);
+			const __m128 Center = _mm_mul_ps(_mm_add_ps(Min, Max), Half);
+			const __m128 Extent = _mm_mul_ps(_mm_sub_ps(Max, Min), Half);
+
+			__m128 WorldCenter = Rows[3];
+			WorldCenter = _mm_add_ps(WorldCenter, _mm_mul_ps(_mm_shuffle_ps(Center, Center, _MM_SHUFFLE(0, 0, 0, 0)), Rows[0]));
+			WorldCenter = _mm_add_ps(WorldCenter, _mm_mul_ps(_mm_shuffle_ps(Center, Center, _MM_SHUFFLE(1, 1, 1, 1)), Rows[1]));
+			WorldCenter = _mm_add_ps(WorldCenter, _mm_mul_ps(_mm_shuffle_ps(Center, Center, _MM_SHUFFLE(2, 2, 2, 2)), Rows[2]));
+
+			__m128 WorldExtent = _mm_mul_ps(_mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(0, 0, 0, 0)), AbsRows[0]);
+			WorldExtent = _mm_add_ps(WorldExtent, _mm_mul_ps(_mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(1, 1, 1, 1)), AbsRows[1]));
+			WorldExtent = _mm_add_ps(WorldExtent, _mm_mul_ps(_mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(2, 2, 2, 2)), AbsRows[2]));
+
+			OutBox.Min = MatrixSIMD::StoreVector3(_mm_sub_ps(WorldCenter, WorldExtent));
+			OutBox.Max = MatrixSIMD::StoreVector3(_mm_add_ps(WorldCenter, WorldExtent));
+		}
+	};
+}
+
+FAABB FAABB::TransformBy(const FMatrix& InMatrix) const
+{
+	FAABB Result;
+	FAABBTransformRows(InMatrix).Transform(*this, Result);
+	return Result;
+}
+
+void FAABB::TransformBy(const FMatrix& InMatrix, const FAABB* InBoxes, FAABB* OutBoxes, size_t InCount)
+{
+	const FAABBTransformRows TransformRows(InMatrix);
+	for (size_t Index = 0; Index < InCount; ++Index)
+	{
+		TransformRows.Transform(InBoxes[Index], OutBoxes[Index]);
+	}
+}
+
 float FAABB::GetCenterDistanceSquared(const FVector& Point) const
 {
     FVector Center = GetCenter();
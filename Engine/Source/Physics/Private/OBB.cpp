@@ -86,31 +86,8 @@ void FOBB::Update(const FMatrix& WorldMatrix)
 
 FAABB FOBB::ToWorldAABB() const
 {
-    FVector Corners[8];
-    Corners[0] = FVector(-Extents.X, -Extents.Y, -Extents.Z);
-    Corners[1] = FVector( Extents.X, -Extents.Y, -Extents.Z);
-    Corners[2] = FVector(-Extents.X,  Extents.Y, -Extents.Z);
-    Corners[3] = FVector( Extents.X,  Extents.Y, -Extents.Z);
-    Corners[4] = FVector(-Extents.X, -Extents.Y,  Extents.Z);
-    Corners[5] = FVector( Extents.X, -Extents.Y,  Extents.Z);
-    Corners[6] = FVector(-Extents.X,  Extents.Y,  Extents.Z);
-    Corners[7] = FVector( Extents.X,  Extents.Y,  Extents.Z);
-
     FMatrix ObbTransform = ScaleRotation * FMatrix::TranslationMatrix(Center);
 
-    FVector NewMin(FLT_MAX, FLT_MAX, FLT_MAX);
-    FVector NewMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-    for (int i = 0; i < 8; ++i)
-    {
-        FVector TransformedCorner = ObbTransform.TransformPosition(Corners[i]);
-        NewMin.X = std::min(NewMin.X, TransformedCorner.X);
-        NewMin.Y = std::min(NewMin.Y, TransformedCorner.Y);
-        NewMin.Z = std::min(NewMin.Z, TransformedCorner.Z);
-        NewMax.X = std::max(NewMax.X, TransformedCorner.X);
-        NewMax.Y = std::max(NewMax.Y, TransformedCorner.Y);
-        NewMax.Z = std::max(NewMax.Z, TransformedCorner.Z);
-    }
-
-    return FAABB(NewMin, NewMax);
+    // 원점 중심의 로컬 박스를 OBB 변환으로 옮긴 AABB
+    return FAABB(-Extents, Extents).TransformBy(ObbTransform);
 }
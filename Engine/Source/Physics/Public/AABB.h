@@ -2,6 +2,8 @@
 #include "Physics/Public/BoundingVolume.h"
 #include "Global/Vector.h"
 
+struct FMatrix;
+
 struct FAABB : public IBoundingVolume
 {
 	FVector Min;
@@ -11,6 +13,17 @@ struct FAABB : public IBoundingVolume
 	FAABB(const FVector& InMin, const FVector& InMax) : Min(InMin), Max(InMax) {}
 
 	FVector GetCenter() const { return (Min + Max) * 0.5f; }
+	FVector GetExtent() const { return (Max - Min) * 0.5f; }
+
+	/**
+	 * @brief 행렬로 변환한 박스를 감싸는 AABB (Arvo 방식)
+	 * 8개 코너를 각각 변환하는 대신 중심은 점으로 변환하고, 반경은 행렬 3x3 부분의 절댓값으로 변환합니다.
+	 * 아핀 행렬(마지막 열이 0, 0, 0, 1) 전용이며, 결과는 8개 코너 방식과 같습니다.
+	 */
+	FAABB TransformBy(const FMatrix& InMatrix) const;
+
+	/** @brief 같은 행렬로 여러 박스를 변환합니다. 행렬 행과 절댓값 행을 한 번만 준비합니다. */
+	static void TransformBy(const FMatrix& InMatrix, const FAABB* InBoxes, FAABB* OutBoxes, size_t InCount);
 
 	float GetCenterDistanceSquared(const FVector& Point) const;
 
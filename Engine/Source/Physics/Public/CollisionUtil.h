@@ -629,14 +629,14 @@ namespace CollisionUtil
         // BoxA FOBB 생성
         FVector CenterA = BoxA->GetWorldLocation();
         FVector ExtentA = BoxA->GetBoxExtent();
-        const FMatrix& TransformA = BoxA->GetWorldTransformMatrix();
+        const FMatrix TransformA = BoxA->GetWorldTransformMatrix();
 
         FOBB OBBA(CenterA, ExtentA, TransformA);
 
         // BoxB FOBB 생성
         FVector CenterB = BoxB->GetWorldLocation();
         FVector ExtentB = BoxB->GetBoxExtent();
-        const FMatrix& TransformB = BoxB->GetWorldTransformMatrix();
+        const FMatrix TransformB = BoxB->GetWorldTransformMatrix();
 
         FOBB OBBB(CenterB, ExtentB, TransformB);
 
@@ -685,7 +685,7 @@ namespace CollisionUtil
         );
 
         // Box의 월드 변환 행렬
-        const FMatrix& BoxTransform = Box->GetWorldTransformMatrix();
+        const FMatrix BoxTransform = Box->GetWorldTransformMatrix();
 
         // Box 로컬 축 추출 (행벡터 시스템: 각 ROW가 basis vector)
         FVector BoxAxisX = FVector(BoxTransform.Data[0][0], BoxTransform.Data[0][1], BoxTransform.Data[0][2]);
@@ -828,7 +828,7 @@ namespace CollisionUtil
         // Box를 OBB로 변환
         FVector BoxCenter = Box->GetWorldLocation();
         FVector BoxExtent = Box->GetBoxExtent();
-        const FMatrix& BoxTransform = Box->GetWorldTransformMatrix();
+        const FMatrix BoxTransform = Box->GetWorldTransformMatrix();
         FOBB OBB(BoxCenter, BoxExtent, BoxTransform);
 
         // 선분과 OBB 간의 최단 거리 계산
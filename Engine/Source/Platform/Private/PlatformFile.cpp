@@ -0,0 +1,113 @@
+#include "pch.h"
+#include "Platform/Public/PlatformFile.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+FPlatformFile::FHandle FPlatformFile::OpenWrite(const std::filesystem::path& InPath)
+{
+#ifdef _WIN32
+	const HANDLE FileHandle = CreateFileW(
+		InPath.c_str(),
+		GENERIC_WRITE,
+		FILE_SHARE_READ,
+		nullptr,
+		CREATE_ALWAYS,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+		nullptr
+	);
+	return FileHandle == INVALID_HANDLE_VALUE ? INVALID_HANDLE : reinterpret_cast<FHandle>(FileHandle);
+#else
+	const int FileDescriptor = open(InPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	return FileDescriptor < 0 ? INVALID_HANDLE : static_cast<FHandle>(FileDescriptor);
+#endif
+}
+
+bool FPlatformFile::Write(FHandle InHandle, const void* InData, size_t InSize)
+{
+	if (InHandle == INVALID_HANDLE)
+	{
+		return false;
+	}
+
+#ifdef _WIN32
+	DWORD BytesWritten = 0;
+	return WriteFile(reinterpret_cast<HANDLE>(InHandle), InData, static_cast<DWORD>(InSize), &BytesWritten, nullptr) && BytesWritten == InSize;
+#else
+	// write는 신호나 파이프 크기 때문에 일부만 쓸 수 있으므로 끝까지 반복
+	const char* Data = static_cast<const char*>(InData);
+	while (InSize > 0)
+	{
+		const ssize_t BytesWritten = write(static_cast<int>(InHandle), Data, InSize);
+		if (BytesWritten <= 0)
+		{
+			return false;
+		}
+		Data += BytesWritten;
+		InSize -= static_cast<size_t>(BytesWritten);
+	}
+	return true;
+#endif
+}
+
+void FPlatformFile::Flush(FHandle InHandle)
+{
+	if (InHandle == INVALID_HANDLE)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	FlushFileBuffers(reinterpret_cast<HANDLE>(InHandle));
+#else
+	fsync(static_cast<int>(InHandle));
+#endif
+}
+
+void FPlatformFile::Close(FHandle InHandle)
+{
+	if (InHandle == INVALID_HANDLE)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	CloseHandle(reinterpret_cast<HANDLE>(InHandle));
+#else
+	close(static_cast<int>(InHandle));
+#endif
+}
+
+bool FPlatformFile::ReadAllBytes(const std::filesystem::path& InPath, FString& OutData)
+{
+	std::ifstream File(InPath, std::ios::binary | std::ios::ate);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	const std::streamsize Size = File.tellg();
+	if (Size < 0)
+	{
+		return false;
+	}
+
+	OutData.resize(static_cast<size_t>(Size));
+	File.seekg(0, std::ios::beg);
+	return Size == 0 || static_cast<bool>(File.read(OutData.data(), Size));
+}
+
+std::filesystem::path FPlatformFile::GetExecutablePath()
+{
+#ifdef _WIN32
+	wchar_t ProgramPath[MAX_PATH];
+	GetModuleFileNameW(nullptr, ProgramPath, MAX_PATH);
+	return std::filesystem::path(ProgramPath);
+#else
+	std::error_code ErrorCode;
+	std::filesystem::path ProgramPath = std::filesystem::read_symlink("/proc/self/exe", ErrorCode);
+	return ErrorCode ? std::filesystem::current_path() / "FutureEngine" : ProgramPath;
+#endif
+}
@@ -0,0 +1,24 @@
+#include "pch.h"
+#include "Platform/Public/PlatformTime.h"
+
+#include <ctime>
+
+FPlatformDateTime FPlatformTime::GetLocalDateTime()
+{
+	const std::time_t Now = std::time(nullptr);
+	std::tm LocalTime = {};
+#ifdef _WIN32
+	localtime_s(&LocalTime, &Now);
+#else
+	localtime_r(&Now, &LocalTime);
+#endif
+
+	FPlatformDateTime DateTime;
+	DateTime.Year = LocalTime.tm_year + 1900;
+	DateTime.Month = LocalTime.tm_mon + 1;
+	DateTime.Day = LocalTime.tm_mday;
+	DateTime.Hour = LocalTime.tm_hour;
+	DateTime.Minute = LocalTime.tm_min;
+	DateTime.Second = LocalTime.tm_sec;
+	return DateTime;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+/**
+ * @brief 빌드 구성 스위치
+ * 에디터 실행 파일(Engine.vcxproj)은 모두 1이며, 헤드리스 코어 빌드(CMake FutureEngineCore)가 0으로 정의합니다.
+ *
+ * WITH_EDITOR	에디터 모듈(선택, 뷰포트, 에디터 프리미티브)을 사용하는 코드
+ * WITH_RENDERER	D3D11 렌더러. 0이면 Null 렌더러로, GPU 리소스(버퍼, 텍스처 SRV)를 만들지 않고 nullptr을 사용
+ * WITH_LUA		sol2 기반 Lua 스크립트. 0이면 스크립트 컴포넌트는 직렬화만 하고 실행하지 않음
+ */
+#ifndef WITH_EDITOR
+#define WITH_EDITOR 1
+#endif
+
+#ifndef WITH_RENDERER
+#define WITH_RENDERER 1
+#endif
+
+#ifndef WITH_LUA
+#define WITH_LUA 1
+#endif
+
+/**
+ * @brief Win32 기본 타입
+ * Windows 빌드는 pch.h의 windows.h가 정의하므로 아무것도 하지 않고,
+ * 그 외 플랫폼에서는 엔진 공용 헤더(CoreTypes.h 등)가 쓰는 타입만 같은 크기로 정의합니다.
+ */
+#ifndef _WIN32
+
+#include <cstdint>
+
+using INT = int;
+using UINT = unsigned int;
+using LONG = std::int32_t;
+using ULONG = std::uint32_t;
+using DWORD = std::uint32_t;
+using WORD = std::uint16_t;
+using BYTE = std::uint8_t;
+using BOOL = int;
+using FLOAT = float;
+using HRESULT = std::int32_t;
+using HWND = void*;
+using HINSTANCE = void*;
+
+#ifndef FORCEINLINE
+#define FORCEINLINE inline __attribute__((always_inline))
+#endif
+
+#ifndef MAX_PATH
+#define MAX_PATH 260
+#endif
+
+#ifndef S_OK
+#define S_OK static_cast<HRESULT>(0)
+#define E_FAIL static_cast<HRESULT>(0x80004005)
+#define SUCCEEDED(hr) (static_cast<HRESULT>(hr) >= 0)
+#define FAILED(hr) (static_cast<HRESULT>(hr) < 0)
+#endif
+
+#endif
@@ -0,0 +1,33 @@
+#pragma once
+#include "Global/Types.h"
+
+#include <cstdint>
+#include <filesystem>
+
+/**
+ * @brief 플랫폼 파일 입출력
+ * 순차 쓰기 파일 핸들은 Windows에서 Win32 파일 API(CreateFile/WriteFile), 그 외 플랫폼에서 POSIX(open/write)를 사용합니다.
+ * 전체 파일 읽기와 실행 파일 경로처럼 엔진 곳곳에서 쓰는 동작도 여기서 플랫폼 차이를 숨깁니다.
+ */
+class FPlatformFile
+{
+public:
+	using FHandle = intptr_t;
+	static constexpr FHandle INVALID_HANDLE = -1;
+
+	/**
+	 * @brief 순차 쓰기용으로 파일을 새로 만듭니다. (기존 파일은 비움, 다른 프로세스의 읽기는 허용)
+	 * @return 실패하면 INVALID_HANDLE
+	 */
+	static FHandle OpenWrite(const std::filesystem::path& InPath);
+	static bool Write(FHandle InHandle, const void* InData, size_t InSize);
+	/** @brief OS 캐시의 내용을 디스크에 동기화합니다. */
+	static void Flush(FHandle InHandle);
+	static void Close(FHandle InHandle);
+
+	/** @brief 파일 전체를 읽습니다. (텍스트 변환 없음) */
+	static bool ReadAllBytes(const std::filesystem::path& InPath, FString& OutData);
+
+	/** @brief 현재 실행 파일의 전체 경로 */
+	static std::filesystem::path GetExecutablePath();
+};
@@ -0,0 +1,48 @@
+#pragma once
+#include "Global/Types.h"
+
+#include <chrono>
+
+/**
+ * @brief 벽시계 기준 로컬 시각 (로그 파일명 등)
+ */
+struct FPlatformDateTime
+{
+	int32 Year = 0;
+	int32 Month = 0;
+	int32 Day = 0;
+	int32 Hour = 0;
+	int32 Minute = 0;
+	int32 Second = 0;
+};
+
+/**
+ * @brief 플랫폼 시간 소스
+ * 측정용 사이클은 std::chrono::steady_clock이므로 플랫폼 API 없이 동작하며, 틱 단위는 steady_clock의 period를 따릅니다.
+ * 로컬 시각 변환만 플랫폼별 함수(localtime_s / localtime_r)를 사용합니다.
+ */
+class FPlatformTime
+{
+public:
+	static constexpr double GetSecondsPerCycle()
+	{
+		return static_cast<double>(std::chrono::steady_clock::period::num) / static_cast<double>(std::chrono::steady_clock::period::den);
+	}
+
+	static double ToMilliseconds(uint64 InCycleDiff)
+	{
+		return static_cast<double>(InCycleDiff) * GetSecondsPerCycle() * 1000.0;
+	}
+
+	static uint64 Cycles64()
+	{
+		return static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+	}
+
+	static double Seconds()
+	{
+		return static_cast<double>(Cycles64()) * GetSecondsPerCycle();
+	}
+
+	static FPlatformDateTime GetLocalDateTime();
+};
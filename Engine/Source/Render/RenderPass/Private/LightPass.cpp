@@ -329,7 +329,11 @@ void FLightPass::Execute(FRenderingContext& Context)
 	uint64 ShadowMapMemory = 0;
 	uint64 RenderTargetMemory = 0;
 	uint32 UsedAtlasTiles = 0;
-	uint32 MaxAtlasTiles = 0;
+	float AtlasUsage = 0.0f;
+	uint32 DownscaledShadowRequests = 0;
+	uint32 DroppedShadowRequests = 0;
+	uint32 RenderedAtlasTiles = 0;
+	uint32 CachedAtlasTiles = 0;
 
 	URenderer& Renderer = URenderer::GetInstance();
 	FShadowMapPass* ShadowMapPass = Renderer.GetShadowMapPass();
@@ -337,7 +341,12 @@ void FLightPass::Execute(FRenderingContext& Context)
 	{
 		ShadowMapMemory = ShadowMapPass->GetTotalShadowMapMemory();
 		UsedAtlasTiles = ShadowMapPass->GetUsedAtlasTileCount();
-		MaxAtlasTiles = ShadowMapPass->GetMaxAtlasTileCount();
+		const FShadowAtlasPackStats& PackStats = ShadowMapPass->GetAtlasPackStats();
+		AtlasUsage = PackStats.GetAtlasUsage();
+		DownscaledShadowRequests = PackStats.DownscaledRequestCount;
+		DroppedShadowRequests = PackStats.DroppedRequestCount;
+		RenderedAtlasTiles = ShadowMapPass->GetRenderedAtlasTileCount();
+		CachedAtlasTiles = ShadowMapPass->GetCachedAtlasTileCount();
 	}
 
 	// 렌더 타겟 메모리 계산
@@ -347,7 +356,7 @@ void FLightPass::Execute(FRenderingContext& Context)
 		RenderTargetMemory = DeviceResources->GetTotalRenderTargetMemory();
 	}
 
-	UStatOverlay::GetInstance().RecordShadowStats(DirectionalCount, PointLightCount, SpotLightCount, AmbientCount, ShadowMapMemory, RenderTargetMemory, UsedAtlasTiles, MaxAtlasTiles);
+	UStatOverlay::GetInstance().RecordShadowStats(DirectionalCount, PointLightCount, SpotLightCount, AmbientCount, ShadowMapMemory, RenderTargetMemory, UsedAtlasTiles, AtlasUsage, DownscaledShadowRequests, DroppedShadowRequests, RenderedAtlasTiles, CachedAtlasTiles);
 }
 
 
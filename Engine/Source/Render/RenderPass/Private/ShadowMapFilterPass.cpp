@@ -22,67 +22,18 @@ FShadowMapFilterPass::~FShadowMapFilterPass()
 
 void FShadowMapFilterPass::Execute(FRenderingContext& Context)
 {
-	// --- 1. Directional Lights ---
-	for (uint32 i = 0; i < Context.DirectionalLights.size(); ++i)
+	// 이번 프레임에 다시 그려진 Atlas 타일만 필터링한다 (캐시된 타일은 이미 필터링되어 있다)
+	FShadowMapResource* ShadowMap = ShadowMapPass->GetShadowAtlas();
+	for (const FShadowAtlasUpdatedTile& Tile : ShadowMapPass->GetUpdatedAtlasTiles())
 	{
-		auto DirLight = Context.DirectionalLights[i];
-		if (DirLight->GetCastShadows() && DirLight->GetLightEnabled())
-		{
-			for (int32 j = 0; j < UCascadeManager::GetInstance().GetSplitNum(); ++j)
-			{
-				FShadowMapResource* ShadowMap = ShadowMapPass->GetShadowAtlas();
-				FShadowAtlasTilePos AtlasTilePos = ShadowMapPass->GetDirectionalAtlasTilePos(j);
-				FilterShadowAtlasMap(
-					DirLight,
-					ShadowMap,
-					AtlasTilePos.UV[0] * TEXTURE_WIDTH,
-					AtlasTilePos.UV[1] * TEXTURE_HEIGHT,
-					static_cast<uint32>(DirLight->GetShadowResolutionScale()),
-					static_cast<uint32>(DirLight->GetShadowResolutionScale())
-				);
-			}
-		}
-	}
-
-	// --- 2. SpotLights ---
-	for (uint32 i = 0; i < Context.SpotLights.size(); ++i)
-	{
-		auto SpotLight = Context.SpotLights[i];
-		if (SpotLight->GetCastShadows() && SpotLight->GetLightEnabled())
-		{
-			FShadowMapResource* ShadowMap = ShadowMapPass->GetShadowAtlas();
-			FShadowAtlasTilePos AtlasTilePos = ShadowMapPass->GetSpotAtlasTilePos(i);
-			FilterShadowAtlasMap(
-				SpotLight,
-				ShadowMap,
-				AtlasTilePos.UV[0] * TEXTURE_WIDTH,
-				AtlasTilePos.UV[1] * TEXTURE_HEIGHT,
-				static_cast<uint32>(SpotLight->GetShadowResolutionScale()),
-				static_cast<uint32>(SpotLight->GetShadowResolutionScale())
-			);
-		}
-	}
-
-	// --- 3. Point Lights ---
-	for (uint32 i = 0; i< Context.PointLights.size(); ++i)
-	{
-		auto PointLight = Context.PointLights[i];
-		if (PointLight->GetCastShadows() && PointLight->GetLightEnabled())
-		{
-			FShadowMapResource* ShadowMap = ShadowMapPass->GetShadowAtlas();
-			FShadowAtlasPointLightTilePos AtlasTilePos = ShadowMapPass->GetPointAtlasTilePos(i);
-			for (int j = 0; j < 6; ++j)
-			{
-				FilterShadowAtlasMap(
-					PointLight,
-					ShadowMap,
-					AtlasTilePos.UV[j][0] * TEXTURE_WIDTH,
-					AtlasTilePos.UV[j][1] * TEXTURE_HEIGHT,
-					TEXTURE_WIDTH,
-					TEXTURE_HEIGHT
-				);	
-			}
-		}
+		FilterShadowAtlasMap(
+			Tile.Light,
+			ShadowMap,
+			Tile.Rect.X,
+			Tile.Rect.Y,
+			Tile.Rect.Size,
+			Tile.Rect.Size
+		);
 	}
 }
 
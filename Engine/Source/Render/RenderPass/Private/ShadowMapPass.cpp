@@ -8,11 +8,11 @@
 #include "Component/Public/PointLightComponent.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Render/Shadow/Public/PSMCalculator.h"
+#include "Level/Public/Level.h"
+#include "Global/Octree.h"
 
-#define MAX_LIGHT_NUM 8
-#define X_OFFSET 1024.0f
-#define Y_OFFSET 1024.0f
-#define SHADOW_MAP_RESOLUTION 1024.0f
+#define SHADOW_ATLAS_RESOLUTION 8192
+#define MIN_SHADOW_TILE_RESOLUTION 64
 
 // Helper functions for matrix operations
 namespace ShadowMatrixHelper
@@ -86,6 +86,101 @@ namespace ShadowMatrixHelper
 	}
 }
 
+// Shadow cache helper functions
+namespace ShadowCacheHelper
+{
+	// Atlas에 할당된 타일 영역을 덮는 viewport
+	D3D11_VIEWPORT MakeAtlasTileViewport(const FShadowAtlasRect& InRect)
+	{
+		D3D11_VIEWPORT Viewport;
+		Viewport.Width = static_cast<float>(InRect.Size);
+		Viewport.Height = static_cast<float>(InRect.Size);
+		Viewport.MinDepth = 0.0f;
+		Viewport.MaxDepth = 1.0f;
+		Viewport.TopLeftX = static_cast<float>(InRect.X);
+		Viewport.TopLeftY = static_cast<float>(InRect.Y);
+		return Viewport;
+	}
+
+	/**
+	 * 라이트 영향 범위(구)가 화면 높이에서 차지하는 비율 (0 ~ 1)
+	 * 카메라가 영향 범위 안에 있으면 화면 전체를 덮는 것으로 본다
+	 */
+	float ComputeScreenCoverage(const FVector& InLightPosition, float InRadius, const UCamera* InCamera)
+	{
+		if (!InCamera)
+		{
+			return 1.0f;
+		}
+
+		const float Distance = (InLightPosition - InCamera->GetLocation()).Length();
+		if (Distance <= InRadius)
+		{
+			return 1.0f;
+		}
+
+		float HalfViewSize;
+		if (InCamera->GetCameraType() == ECameraType::ECT_Orthographic)
+		{
+			HalfViewSize = InCamera->GetOrthoWidth() * 0.5f;
+		}
+		else
+		{
+			HalfViewSize = Distance * std::tanf(FVector::GetDegreeToRadian(InCamera->GetFovY()) * 0.5f);
+		}
+
+		if (HalfViewSize <= 0.0f)
+		{
+			return 1.0f;
+		}
+
+		return std::clamp(InRadius / HalfViewSize, 0.0f, 1.0f);
+	}
+
+	// AABB의 8개 코너가 모두 clip space의 같은 평면 바깥에 있으면 frustum 밖
+	bool IsOutsideFrustum(const FAABB& InBounds, const FMatrix& InViewProj)
+	{
+		uint8 OutsideMask = 0x3F;
+		for (int i = 0; i < 8; i++)
+		{
+			const FVector4 Corner(
+				(i & 1) ? InBounds.Max.X : InBounds.Min.X,
+				(i & 2) ? InBounds.Max.Y : InBounds.Min.Y,
+				(i & 4) ? InBounds.Max.Z : InBounds.Min.Z,
+				1.0f);
+			const FVector4 Clip = Corner * InViewProj;
+
+			uint8 CornerMask = 0;
+			if (Clip.X < -Clip.W) CornerMask |= 0x01;
+			if (Clip.X > Clip.W)  CornerMask |= 0x02;
+			if (Clip.Y < -Clip.W) CornerMask |= 0x04;
+			if (Clip.Y > Clip.W)  CornerMask |= 0x08;
+			if (Clip.Z < 0.0f)    CornerMask |= 0x10;
+			if (Clip.Z > Clip.W)  CornerMask |= 0x20;
+
+			OutsideMask &= CornerMask;
+			if (OutsideMask == 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool IsSameLightState(const FShadowAtlasSlotCache& A, const FShadowAtlasSlotCache& B)
+	{
+		return A.Light == B.Light
+			&& memcmp(&A.ViewProjection, &B.ViewProjection, sizeof(FMatrix)) == 0
+			&& A.LightPosition == B.LightPosition
+			&& A.LightRange == B.LightRange
+			&& std::equal(std::begin(A.AtlasRects), std::end(A.AtlasRects), std::begin(B.AtlasRects))
+			&& A.ShadowBias == B.ShadowBias
+			&& A.ShadowSlopeBias == B.ShadowSlopeBias
+			&& A.ShadowSharpen == B.ShadowSharpen
+			&& A.ShadowModeIndex == B.ShadowModeIndex;
+	}
+}
+
 FShadowMapPass::FShadowMapPass(UPipeline* InPipeline,
 	ID3D11Buffer* InConstantBufferCamera,
 	ID3D11Buffer* InConstantBufferModel,
@@ -102,6 +197,7 @@ FShadowMapPass::FShadowMapPass(UPipeline* InPipeline,
 	, LinearDepthOnlyVS(InPointLightShadowVS)
 	, LinearDepthOnlyPS(InPointLightShadowPS)
 	, PointLightShadowInputLayout(InPointLightShadowInputLayout)
+	, AtlasAllocator(SHADOW_ATLAS_RESOLUTION, MIN_SHADOW_TILE_RESOLUTION)
 {
 	ID3D11Device* Device = URenderer::GetInstance().GetDevice();
 
@@ -145,7 +241,7 @@ FShadowMapPass::FShadowMapPass(UPipeline* InPipeline,
 
 	ConstantCascadeData = FRenderResourceFactory::CreateConstantBuffer<FCascadeShadowMapData>();
 	
-	ShadowAtlas.Initialize(Device, 8192);
+	ShadowAtlas.Initialize(Device, SHADOW_ATLAS_RESOLUTION);
 
 	D3D11_BUFFER_DESC BufferDesc = {};
 	
@@ -217,8 +313,26 @@ FShadowMapPass::FShadowMapPass(UPipeline* InPipeline,
 	assert(SUCCEEDED(hr));
 
 	ShadowAtlasDirectionalLightTilePosArray.resize(8);
-	ShadowAtlasPointLightTilePosArray.resize(8);
-	ShadowAtlasSpotLightTilePosArray.resize(8);
+	ShadowAtlasPointLightTilePosArray.resize(PointTilePosCapacity);
+	ShadowAtlasSpotLightTilePosArray.resize(SpotTilePosCapacity);
+
+	// 6. Atlas 타일 단위 초기화 리소스 (Shadow Cache)
+	// 캐시된 타일을 보존해야 하므로 전체 Clear 대신 타일마다 Depth/Moments를 덮어쓴다
+	D3D11_DEPTH_STENCIL_DESC TileClearDSDesc = {};
+	TileClearDSDesc.DepthEnable = TRUE;
+	TileClearDSDesc.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ALL;
+	TileClearDSDesc.DepthFunc = D3D11_COMPARISON_ALWAYS;
+	TileClearDSDesc.StencilEnable = FALSE;
+
+	hr = Device->CreateDepthStencilState(&TileClearDSDesc, &TileClearDepthStencilState);
+	if (FAILED(hr))
+	{
+		throw std::runtime_error("Failed to create shadow atlas tile clear depth stencil state");
+	}
+
+	TArray<D3D11_INPUT_ELEMENT_DESC> TileClearLayoutDesc = {};
+	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/ShadowAtlasTileClear.hlsl", TileClearLayoutDesc, &TileClearVS, nullptr);
+	FRenderResourceFactory::CreatePixelShader(L"Asset/Shader/ShadowAtlasTileClear.hlsl", &TileClearPS);
 }
 
 FShadowMapPass::~FShadowMapPass()
@@ -228,6 +342,8 @@ FShadowMapPass::~FShadowMapPass()
 
 void FShadowMapPass::Execute(FRenderingContext& Context)
 {
+	TIME_PROFILE(ShadowMapPass)
+
 	// IMPORTANT: Unbind shadow map SRVs before rendering to them as DSV
 	// This prevents D3D11 resource hazard warnings
 	const auto& Renderer = URenderer::GetInstance();
@@ -235,72 +351,469 @@ void FShadowMapPass::Execute(FRenderingContext& Context)
 	ID3D11ShaderResourceView* NullSRVs[4] = { nullptr, nullptr, nullptr, nullptr };
 	DeviceContext->PSSetShaderResources(10, 4, NullSRVs);  // Unbind t10-t14
 
-	
-	const float ClearColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-	DeviceContext->ClearRenderTargetView(ShadowAtlas.VarianceShadowRTV.Get(), ClearColor);
-	DeviceContext->ClearDepthStencilView(ShadowAtlas.ShadowDSV.Get(), D3D11_CLEAR_DEPTH, 1.0f, 0);
+	// Spot/Point 슬롯은 캐시되므로 Atlas 전체를 Clear하지 않고, 다시 그리는 타일만 초기화한다
+	GatherDirtyCasterBounds(Context);
+	CachedAtlasTileCount = 0;
+	RenderedAtlasTileCount = 0;
+	UpdatedAtlasTiles.clear();
+
+	// Phase 0: 그림자를 생성하는 모든 라이트의 타일을 Atlas에 배치
+	UDirectionalLightComponent* ShadowDirectionalLight = nullptr;
+	PackShadowAtlas(Context, ShadowDirectionalLight);
+
+	// Phase 1: Directional Light
+	// 카메라에 따라 매 프레임 달라지므로 캐시하지 않는다
+	FShadowAtlasRect AtlasRect;
+	if (ShadowDirectionalLight && GetLightAtlasRect(ShadowDirectionalLight, 0, AtlasRect))
+	{
+		const FShadowAtlasRequest& Allocation = AtlasRequests[LightAtlasRequestIndices[ShadowDirectionalLight]];
+		for (uint32 i = 0; i < Allocation.TileCount; i++)
+		{
+			ClearAtlasTile(Allocation.Rects[i]);
+			UpdatedAtlasTiles.push_back({ ShadowDirectionalLight, Allocation.Rects[i] });
+		}
+
+		RenderDirectionalShadowMap(ShadowDirectionalLight, Context.StaticMeshes, Context.CurrentCamera, Allocation);
+		RenderedAtlasTileCount += Allocation.TileCount;
+	}
+
+	// Phase 2: Spot Lights
+	// Tile 위치는 LightPass의 라이트 버퍼와 같은 인덱스(보이고 켜진 라이트 순서)로 기록한다
+	uint32 SpotLightIndex = 0;
+	for (USpotLightComponent* SpotLight : Context.SpotLights)
+	{
+		if (!SpotLight || !SpotLight->GetVisible() || !SpotLight->GetLightEnabled())
+			continue;
+
+		const uint32 LightIndex = SpotLightIndex++;
+		if (!GetLightAtlasRect(SpotLight, 0, AtlasRect))
+			continue;
+
+		ShadowAtlasSpotLightTilePosArray[LightIndex] = {{AtlasRect.X, AtlasRect.Y}, {}};
+
+		FMatrix LightView, LightProj;
+		CalculateSpotLightViewProj(SpotLight, Context.StaticMeshes, LightView, LightProj);
+
+		FShadowAtlasSlotCache LightState;
+		LightState.Light = SpotLight;
+		LightState.ViewProjection = LightView * LightProj;
+		LightState.LightPosition = SpotLight->GetWorldLocation();
+		LightState.LightRange = SpotLight->GetAttenuationRadius();
+		LightState.AtlasRects[0] = AtlasRect;
+		LightState.ShadowBias = SpotLight->GetShadowBias();
+		LightState.ShadowSlopeBias = SpotLight->GetShadowSlopeBias();
+		LightState.ShadowSharpen = SpotLight->GetShadowSharpen();
+		LightState.ShadowModeIndex = SpotLight->GetShadowModeIndex();
+
+		const bool bCasterDirty = HasDirtyCasterInLightVolume(LightState.LightPosition, LightState.LightRange, &LightState.ViewProjection);
+		if (UpdateAtlasSlotCache(LightState, bCasterDirty))
+		{
+			// 캐스터 목록은 이 라이트를 그리는 동안만 필요하므로 끝나면 Frame arena를 되돌린다
+			FFrameArenaMark ArenaMark;
+			TFrameArray<UStaticMeshComponent*> Casters;
+			GatherShadowCasters(Context.Level, LightState.LightPosition, LightState.LightRange, &LightState.ViewProjection, Casters);
+
+			ClearAtlasTile(AtlasRect);
+			RenderSpotShadowMap(SpotLight, AtlasRect, Casters);
+			UpdatedAtlasTiles.push_back({ SpotLight, AtlasRect });
+			++RenderedAtlasTileCount;
+		}
+		else
+		{
+			// 캐시된 타일을 그대로 사용하지만 Lighting에서 쓰는 정보는 갱신한다
+			SpotLight->SetShadowViewProjection(LightState.ViewProjection);
+			++CachedAtlasTileCount;
+		}
+	}
+
+	// Phase 3: Point Lights
+	uint32 PointLightIndex = 0;
+	for (UPointLightComponent* PointLight : Context.PointLights)
+	{
+		if (!PointLight || !PointLight->GetVisible() || !PointLight->GetLightEnabled())
+			continue;
 
-	// Phase 1: Directional Lights
-	ActiveDirectionalLightCount = 0;
-	ActiveDirectionalCascadeCount = 0;
+		const uint32 LightIndex = PointLightIndex++;
+		if (!GetLightAtlasRect(PointLight, 0, AtlasRect))
+			continue;
+
+		// Point Light의 6면 ViewProj는 위치와 반경으로 결정된다
+		FShadowAtlasSlotCache LightState;
+		LightState.Light = PointLight;
+		LightState.ViewProjection = FMatrix::Identity();
+		LightState.LightPosition = PointLight->GetWorldLocation();
+		LightState.LightRange = PointLight->GetAttenuationRadius();
+		LightState.ShadowBias = PointLight->GetShadowBias();
+		LightState.ShadowSlopeBias = PointLight->GetShadowSlopeBias();
+		LightState.ShadowSharpen = PointLight->GetShadowSharpen();
+		LightState.ShadowModeIndex = PointLight->GetShadowModeIndex();
+
+		for (uint32 Face = 0; Face < 6; Face++)
+		{
+			GetLightAtlasRect(PointLight, Face, LightState.AtlasRects[Face]);
+			ShadowAtlasPointLightTilePosArray[LightIndex].UV[Face][0] = LightState.AtlasRects[Face].X;
+			ShadowAtlasPointLightTilePosArray[LightIndex].UV[Face][1] = LightState.AtlasRects[Face].Y;
+		}
+
+		const bool bCasterDirty = HasDirtyCasterInLightVolume(LightState.LightPosition, LightState.LightRange, nullptr);
+		if (UpdateAtlasSlotCache(LightState, bCasterDirty))
+		{
+			FFrameArenaMark ArenaMark;
+			TFrameArray<UStaticMeshComponent*> Casters;
+			GatherShadowCasters(Context.Level, LightState.LightPosition, LightState.LightRange, nullptr, Casters);
+
+			for (uint32 Face = 0; Face < 6; Face++)
+			{
+				ClearAtlasTile(LightState.AtlasRects[Face]);
+				UpdatedAtlasTiles.push_back({ PointLight, LightState.AtlasRects[Face] });
+			}
+			RenderPointShadowMap(PointLight, LightState.AtlasRects, Casters);
+			RenderedAtlasTileCount += 6;
+		}
+		else
+		{
+			CachedAtlasTileCount += 6;
+		}
+	}
+
+	SetShadowAtlasTilePositionStructuredBuffer();
+}
+
+void FShadowMapPass::BeginFrame()
+{
+	PreviousAtlasAllocations.clear();
+	for (uint32 i = 0; i < AtlasRequests.size(); i++)
+	{
+		if (AtlasRequests[i].IsAllocated())
+		{
+			PreviousAtlasAllocations[AtlasRequestLights[i]] = AtlasRequests[i];
+		}
+	}
+
+	AtlasRequests.clear();
+	AtlasRequestLights.clear();
+	LightAtlasRequestIndices.clear();
+
+	// 직전 프레임에 어느 뷰포트에서도 사용되지 않은 라이트의 캐시는 제거한다
+	for (auto It = AtlasSlotCaches.begin(); It != AtlasSlotCaches.end();)
+	{
+		if (!It->second.bUsed)
+		{
+			It = AtlasSlotCaches.erase(It);
+		}
+		else
+		{
+			It->second.bUsed = false;
+			++It;
+		}
+	}
+}
+
+void FShadowMapPass::PackShadowAtlas(FRenderingContext& Context, UDirectionalLightComponent*& OutDirectionalLight)
+{
+	OutDirectionalLight = nullptr;
+	bool bNeedsPack = false;
+
+	// 앞선 뷰포트가 이미 요청한 라이트는 더 큰 해상도나 다른 타일 개수가 필요할 때만 요청을 바꾼다
+	auto AddRequest = [&](ULightComponent* InLight, uint32 InResolution, uint32 InTileCount, float InPriority)
+	{
+		if (auto It = LightAtlasRequestIndices.find(InLight); It != LightAtlasRequestIndices.end())
+		{
+			FShadowAtlasRequest& Request = AtlasRequests[It->second];
+			if (InResolution > Request.RequestedResolution || InTileCount != Request.TileCount)
+			{
+				Request.RequestedResolution = std::max(Request.RequestedResolution, InResolution);
+				Request.TileCount = InTileCount;
+				bNeedsPack = true;
+			}
+			Request.Priority = std::max(Request.Priority, InPriority);
+			return;
+		}
+
+		FShadowAtlasRequest Request;
+		Request.Owner = InLight;
+		Request.RequestedResolution = InResolution;
+		Request.TileCount = InTileCount;
+		Request.Priority = InPriority;
+		if (auto Previous = PreviousAtlasAllocations.find(InLight); Previous != PreviousAtlasAllocations.end())
+		{
+			Request.SetPreviousAllocation(Previous->second);
+		}
+
+		LightAtlasRequestIndices[InLight] = static_cast<uint32>(AtlasRequests.size());
+		AtlasRequests.push_back(Request);
+		AtlasRequestLights.push_back(InLight);
+		bNeedsPack = true;
+	};
+
+	// 1. Directional Light: 화면 전체를 덮으므로 가장 높은 우선순위로 요청 해상도 그대로 배치한다
 	for (auto DirLight : Context.DirectionalLights)
 	{
 		if (DirLight->GetCastShadows() && DirLight->GetLightEnabled())
 		{
 			// 유효한 첫번째 Dir Light만 사용
-			RenderDirectionalShadowMap(DirLight, Context.StaticMeshes, Context.CurrentCamera);
-			ActiveDirectionalLightCount = 1;
-			ActiveDirectionalCascadeCount = UCascadeManager::GetInstance().GetSplitNum();
+			AddRequest(DirLight,
+				static_cast<uint32>(DirLight->GetShadowResolutionScale()),
+				DirLight->GetShadowProjectionMode() == 4 ? UCascadeManager::GetInstance().GetSplitNum() : 1,
+				FShadowAtlasRequest::FIXED_RESOLUTION_PRIORITY);
+			OutDirectionalLight = DirLight;
 			break;
 		}
 	}
 
-	// Phase 2: Spot Lights
-	// 유효한 Spot Light를 수집한다. 8개가 상한이다.
-	TArray<USpotLightComponent*> ValidSpotLights;
+	// 2. Spot/Point Light: 화면에서 차지하는 비율만큼 해상도를 요청한다 (GetShadowResolutionScale()이 상한)
+	auto AddLocalLightRequest = [&](UPointLightComponent* InLight, uint32 InTileCount)
+	{
+		const float Coverage = ShadowCacheHelper::ComputeScreenCoverage(
+			InLight->GetWorldLocation(), InLight->GetAttenuationRadius(), Context.CurrentCamera);
+
+		AddRequest(InLight, static_cast<uint32>(InLight->GetShadowResolutionScale() * Coverage), InTileCount, Coverage);
+	};
+
+	uint32 VisibleSpotLightCount = 0;
 	for (USpotLightComponent* SpotLight : Context.SpotLights)
 	{
-		if (ValidSpotLights.size() >= MAX_LIGHT_NUM)
-			break;
-		
-		if (SpotLight->GetCastShadows() && SpotLight->GetLightEnabled())
+		if (!SpotLight || !SpotLight->GetVisible() || !SpotLight->GetLightEnabled())
+			continue;
+
+		++VisibleSpotLightCount;
+		if (SpotLight->GetCastShadows())
 		{
-			ValidSpotLights.push_back(SpotLight);
+			AddLocalLightRequest(SpotLight, 1);
 		}
 	}
 
-	ActiveSpotLightCount = static_cast<uint32>(ValidSpotLights.size());
-	for (int32 i = 0; i < ValidSpotLights.size(); i++)
+	uint32 VisiblePointLightCount = 0;
+	for (UPointLightComponent* PointLight : Context.PointLights)
 	{
-		RenderSpotShadowMap(ValidSpotLights[i], i, Context.StaticMeshes);
+		if (!PointLight || !PointLight->GetVisible() || !PointLight->GetLightEnabled())
+			continue;
+
+		++VisiblePointLightCount;
+		if (PointLight->GetCastShadows())
+		{
+			AddLocalLightRequest(PointLight, 6);
+		}
 	}
 
-	// Phase 3: Point Lights
-	TArray<UPointLightComponent*> ValidPointLights;
-	for (UPointLightComponent* PointLight : Context.PointLights)
+	EnsureTilePosBufferCapacity(VisibleSpotLightCount, VisiblePointLightCount);
+
+	if (!bNeedsPack)
 	{
-		if (ValidPointLights.size() >= MAX_LIGHT_NUM)
-			break;
-		
-		if (PointLight->GetCastShadows() && PointLight->GetLightEnabled())
+		return;
+	}
+
+	// 3. 이번 프레임에 이미 배치된 요청은 현재 영역을 유지하도록 넘긴다 (앞선 뷰포트가 그린 타일 보존)
+	for (FShadowAtlasRequest& Request : AtlasRequests)
+	{
+		if (Request.IsAllocated())
 		{
-			ValidPointLights.push_back(PointLight);
+			Request.SetPreviousAllocation(Request);
 		}
 	}
 
-	ActivePointLightCount = static_cast<uint32>(ValidPointLights.size());
-	for (int32 i = 0; i < ValidPointLights.size(); i++)
+	// 4. 배치 후 실제 할당된 해상도를 라이트에 기록 (0이면 Atlas 공간 부족으로 이번 프레임 그림자 없음)
+	AtlasPackStats = AtlasAllocator.Pack(AtlasRequests);
+
+	for (uint32 i = 0; i < AtlasRequests.size(); i++)
 	{
-		RenderPointShadowMap(ValidPointLights[i], i, Context.StaticMeshes);
+		AtlasRequestLights[i]->SetShadowAtlasResolution(static_cast<float>(AtlasRequests[i].AllocatedResolution));
 	}
+}
 
-	SetShadowAtlasTilePositionStructuredBuffer();
+void FShadowMapPass::EnsureTilePosBufferCapacity(uint32 InSpotLightCount, uint32 InPointLightCount)
+{
+	if (SpotTilePosCapacity < InSpotLightCount)
+	{
+		while (SpotTilePosCapacity < InSpotLightCount)
+		{
+			SpotTilePosCapacity = SpotTilePosCapacity << 1;
+		}
+		SafeRelease(ShadowAtlasSpotLightTilePosStructuredSRV);
+		SafeRelease(ShadowAtlasSpotLightTilePosStructuredBuffer);
+		ShadowAtlasSpotLightTilePosStructuredBuffer = FRenderResourceFactory::CreateStructuredBuffer<FShadowAtlasTilePos>(SpotTilePosCapacity);
+		FRenderResourceFactory::CreateStructuredShaderResourceView(ShadowAtlasSpotLightTilePosStructuredBuffer, &ShadowAtlasSpotLightTilePosStructuredSRV);
+	}
+
+	if (PointTilePosCapacity < InPointLightCount)
+	{
+		while (PointTilePosCapacity < InPointLightCount)
+		{
+			PointTilePosCapacity = PointTilePosCapacity << 1;
+		}
+		SafeRelease(ShadowAtlasPointLightTilePosStructuredSRV);
+		SafeRelease(ShadowAtlasPointLightTilePosStructuredBuffer);
+		ShadowAtlasPointLightTilePosStructuredBuffer = FRenderResourceFactory::CreateStructuredBuffer<FShadowAtlasPointLightTilePos>(PointTilePosCapacity);
+		FRenderResourceFactory::CreateStructuredShaderResourceView(ShadowAtlasPointLightTilePosStructuredBuffer, &ShadowAtlasPointLightTilePosStructuredSRV);
+	}
+
+	// 그림자가 없는 라이트의 항목은 셰이더에서 CastShadow로 걸러진다
+	ShadowAtlasSpotLightTilePosArray.assign(SpotTilePosCapacity, {});
+	ShadowAtlasPointLightTilePosArray.assign(PointTilePosCapacity, {});
+}
+
+void FShadowMapPass::GatherDirtyCasterBounds(FRenderingContext& Context)
+{
+	DirtyCasterBounds.clear();
+	MovingCasters.clear();
+	if (!Context.Level)
+	{
+		return;
+	}
+
+	// 등록/해제되었거나 정적 상태에서 움직이기 시작한 Primitive의 이전 영역
+	const TArray<FAABB>& LevelDirtyBounds = Context.Level->GetDirtyPrimitiveBounds();
+	DirtyCasterBounds.insert(DirtyCasterBounds.end(), LevelDirtyBounds.begin(), LevelDirtyBounds.end());
+
+	// 현재 움직이고 있는 메시의 영역
+	for (UPrimitiveComponent* Primitive : Context.Level->GetDynamicPrimitives())
+	{
+		if (Primitive->GetRenderProxyType() == ERenderProxyType::StaticMesh)
+		{
+			FVector WorldMin, WorldMax;
+			Primitive->GetWorldAABB(WorldMin, WorldMax);
+			DirtyCasterBounds.emplace_back(WorldMin, WorldMax);
+			MovingCasters.push_back(static_cast<UStaticMeshComponent*>(Primitive));
+		}
+	}
+}
+
+void FShadowMapPass::GatherShadowCasters(ULevel* InLevel, const FVector& InLightPosition, float InLightRange, const FMatrix* InViewProj,
+	TFrameArray<UStaticMeshComponent*>& OutCasters) const
+{
+	OutCasters.clear();
+	if (!InLevel)
+	{
+		return;
+	}
+
+	// 라이트 영향 구를 감싸는 AABB로 Octree를 조회하고, 움직이는 메시(Octree 밖)를 더한다
+	const FVector Extent(InLightRange, InLightRange, InLightRange);
+	const FAABB LightBounds(InLightPosition - Extent, InLightPosition + Extent);
+
+	TFrameArray<UPrimitiveComponent*> Candidates;
+	if (const FOctree* StaticOctree = InLevel->GetStaticOctree())
+	{
+		StaticOctree->QueryOverlap(LightBounds, Candidates);
+	}
+	Candidates.insert(Candidates.end(), MovingCasters.begin(), MovingCasters.end());
+
+	// 구 또는 Spot light frustum과 실제로 겹치는 보이는 메시만 남긴다
+	const float RangeSquared = InLightRange * InLightRange;
+	OutCasters.reserve(Candidates.size());
+	for (UPrimitiveComponent* Primitive : Candidates)
+	{
+		if (Primitive->GetRenderProxyType() != ERenderProxyType::StaticMesh || !Primitive->IsVisible())
+		{
+			continue;
+		}
+
+		FVector WorldMin, WorldMax;
+		Primitive->GetWorldAABB(WorldMin, WorldMax);
+		const FAABB Bounds(WorldMin, WorldMax);
+		if (Bounds.GetDistanceSquaredToPoint(InLightPosition) > RangeSquared)
+		{
+			continue;
+		}
+
+		if (InViewProj && ShadowCacheHelper::IsOutsideFrustum(Bounds, *InViewProj))
+		{
+			continue;
+		}
+
+		OutCasters.push_back(static_cast<UStaticMeshComponent*>(Primitive));
+	}
+}
+
+bool FShadowMapPass::HasDirtyCasterInLightVolume(const FVector& InLightPosition, float InLightRange, const FMatrix* InViewProj) const
+{
+	const float RangeSquared = InLightRange * InLightRange;
+	for (const FAABB& Bounds : DirtyCasterBounds)
+	{
+		if (Bounds.GetDistanceSquaredToPoint(InLightPosition) > RangeSquared)
+		{
+			continue;
+		}
+
+		if (InViewProj && ShadowCacheHelper::IsOutsideFrustum(Bounds, *InViewProj))
+		{
+			continue;
+		}
+
+		return true;
+	}
+	return false;
+}
+
+bool FShadowMapPass::UpdateAtlasSlotCache(const FShadowAtlasSlotCache& InLightState, bool bInCasterDirty)
+{
+	FShadowAtlasSlotCache& InOutSlot = AtlasSlotCaches[InLightState.Light];
+	const bool bSameState = InOutSlot.bValid && ShadowCacheHelper::IsSameLightState(InOutSlot, InLightState);
+
+	// 같은 프레임에 앞선 뷰포트가 같은 상태로 이미 처리했다면 타일은 최신이다
+	if (InOutSlot.bUsed && bSameState)
+	{
+		return false;
+	}
+
+	// 직전 프레임에 캐스터 변경으로 다시 그렸다면, 라이트 영역을 벗어난 캐스터를 지우기 위해 한 번 더 그린다
+	const bool bNeedsRender = !bSameState
+		|| InOutSlot.bCasterDirty
+		|| bInCasterDirty;
+
+	InOutSlot = InLightState;
+	InOutSlot.bValid = true;
+	InOutSlot.bCasterDirty = bInCasterDirty;
+	InOutSlot.bUsed = true;
+
+	return bNeedsRender;
+}
+
+void FShadowMapPass::ClearAtlasTile(const FShadowAtlasRect& InAtlasRect)
+{
+	const D3D11_VIEWPORT TileViewport = ShadowCacheHelper::MakeAtlasTileViewport(InAtlasRect);
+
+	ID3D11DeviceContext* DeviceContext = URenderer::GetInstance().GetDeviceContext();
+
+	// 현재 상태 저장 (복원용)
+	ID3D11RenderTargetView* OriginalRTV = nullptr;
+	ID3D11DepthStencilView* OriginalDSV = nullptr;
+	DeviceContext->OMGetRenderTargets(1, &OriginalRTV, &OriginalDSV);
+
+	D3D11_VIEWPORT OriginalViewport;
+	UINT NumViewports = 1;
+	DeviceContext->RSGetViewports(&NumViewports, &OriginalViewport);
+
+	Pipeline->SetRenderTargets(1, ShadowAtlas.VarianceShadowRTV.GetAddressOf(), ShadowAtlas.ShadowDSV.Get());
+	DeviceContext->RSSetViewports(1, &TileViewport);
+
+	FPipelineInfo TileClearPipelineInfo = {
+		nullptr,
+		TileClearVS,
+		FRenderResourceFactory::GetRasterizerState({ ECullMode::None, EFillMode::Solid }),
+		TileClearDepthStencilState,
+		TileClearPS,
+		nullptr,
+		D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST
+	};
+	Pipeline->UpdatePipeline(TileClearPipelineInfo);
+	Pipeline->Draw(3, 0);
+
+	// 상태 복원
+	Pipeline->SetRenderTargets(1, &OriginalRTV, OriginalDSV);
+	DeviceContext->RSSetViewports(1, &OriginalViewport);
+
+	if (OriginalRTV)
+		OriginalRTV->Release();
+	if (OriginalDSV)
+		OriginalDSV->Release();
 }
 
 void FShadowMapPass::RenderDirectionalShadowMap(
 	UDirectionalLightComponent* Light,
-	const TArray<UStaticMeshComponent*>& Meshes,
-	UCamera* InCamera
+	const TFrameArray<UStaticMeshComponent*>& Meshes,
+	UCamera* InCamera,
+	const FShadowAtlasRequest& InAllocation
 	)
 {
 	// FShadowMapResource* ShadowMap = GetOrCreateShadowMap(Light);
@@ -402,20 +915,15 @@ void FShadowMapPass::RenderDirectionalShadowMap(
 	FRenderResourceFactory::UpdateConstantBufferData(ConstantCascadeData, CascadeShadowMapData);
 	Pipeline->SetConstantBuffer(6, EShaderType::VS | EShaderType::PS, ConstantCascadeData);
 
+	NumCascades = std::min(NumCascades, static_cast<int>(InAllocation.TileCount));
 	for (int i = 0; i < NumCascades; i++)
 	{
-		D3D11_VIEWPORT ShadowViewport;
-
-		ShadowViewport.Width = Light->GetShadowResolutionScale();
-		ShadowViewport.Height = Light->GetShadowResolutionScale();
-		ShadowViewport.MinDepth = 0.0f;
-		ShadowViewport.MaxDepth = 1.0f;
-		ShadowViewport.TopLeftX = SHADOW_MAP_RESOLUTION * i;
-		ShadowViewport.TopLeftY = 0.0f;
+		const FShadowAtlasRect& AtlasRect = InAllocation.Rects[i];
+		D3D11_VIEWPORT ShadowViewport = ShadowCacheHelper::MakeAtlasTileViewport(AtlasRect);
 
 		DeviceContext->RSSetViewports(1, &ShadowViewport);
 
-		ShadowAtlasDirectionalLightTilePosArray[i] = {{static_cast<uint32>(i), 0}, {}};
+		ShadowAtlasDirectionalLightTilePosArray[i] = {{AtlasRect.X, AtlasRect.Y}, {}};
 
 		FMatrix LightView = CascadeShadowMapData.View;
 		FMatrix LightProj = CascadeShadowMapData.Proj[i];
@@ -452,8 +960,8 @@ void FShadowMapPass::RenderDirectionalShadowMap(
 
 void FShadowMapPass::RenderSpotShadowMap(
 	USpotLightComponent* Light,
-	uint32 AtlasIndex,
-	const TArray<UStaticMeshComponent*>& Meshes
+	const FShadowAtlasRect& InAtlasRect,
+	const TFrameArray<UStaticMeshComponent*>& Meshes
 	)
 {
 	// FShadowMapResource* ShadowMap = GetOrCreateShadowMap(Light);
@@ -479,19 +987,7 @@ void FShadowMapPass::RenderSpotShadowMap(
 		ShadowAtlas.ShadowDSV.Get()
 		);
 
-	D3D11_VIEWPORT ShadowViewport;
-
-	const static float Y_START = SHADOW_MAP_RESOLUTION;
-
-	ShadowViewport.Width = Light->GetShadowResolutionScale();
-	ShadowViewport.Height = Light->GetShadowResolutionScale();
-	ShadowViewport.MinDepth = 0.0f;
-	ShadowViewport.MaxDepth = 1.0f;
-	ShadowViewport.TopLeftX = X_OFFSET * AtlasIndex;
-	ShadowViewport.TopLeftY = Y_START;
-
-	ShadowAtlasSpotLightTilePosArray[AtlasIndex] = {{AtlasIndex, 1}};
-	
+	D3D11_VIEWPORT ShadowViewport = ShadowCacheHelper::MakeAtlasTileViewport(InAtlasRect);
 	DeviceContext->RSSetViewports(1, &ShadowViewport);
 	
 	// 2. Light별 캐싱된 rasterizer state 가져오기 (DepthBias 포함)
@@ -557,8 +1053,8 @@ void FShadowMapPass::RenderSpotShadowMap(
 
 void FShadowMapPass::RenderPointShadowMap(
 	UPointLightComponent* Light,
-	uint32 AtlasIndex,
-	const TArray<UStaticMeshComponent*>& Meshes
+	const FShadowAtlasRect* InAtlasRects,
+	const TFrameArray<UStaticMeshComponent*>& Meshes
 	)
 {
 	// FCubeShadowMapResource* ShadowMap = GetOrCreateCubeShadowMap(Light);
@@ -617,23 +1113,10 @@ void FShadowMapPass::RenderPointShadowMap(
 	// 4. 6개 면 렌더링 (+X, -X, +Y, -Y, +Z, -Z)
 	for (int Face = 0; Face < 6; Face++)
 	{
-		// // 4-1. DSV 설정 (각 면)
-		D3D11_VIEWPORT ShadowViewport;
-
-		static const float Y_START = SHADOW_MAP_RESOLUTION * 2.0f;
-
-		ShadowViewport.Width = Light->GetShadowResolutionScale();;
-		ShadowViewport.Height = Light->GetShadowResolutionScale();;
-		ShadowViewport.MinDepth = 0.0f;
-		ShadowViewport.MaxDepth = 1.0f;
-		ShadowViewport.TopLeftX = X_OFFSET * AtlasIndex;
-		ShadowViewport.TopLeftY = Y_START + Y_OFFSET * Face;
-
+		// 4-1. Viewport 설정 (각 면에 할당된 Atlas 영역)
+		D3D11_VIEWPORT ShadowViewport = ShadowCacheHelper::MakeAtlasTileViewport(InAtlasRects[Face]);
 		DeviceContext->RSSetViewports(1, &ShadowViewport);
 
-		ShadowAtlasPointLightTilePosArray[AtlasIndex].UV[Face][0] = AtlasIndex;
-		ShadowAtlasPointLightTilePosArray[AtlasIndex].UV[Face][1] = 2 + Face;
-
 		// 4-2. Constant buffer 업데이트 (각 면의 ViewProj)
 		FShadowViewProjConstant CBData;
 		CBData.ViewProjection = ViewProj[Face];
@@ -714,7 +1197,7 @@ void FShadowMapPass::SetShadowAtlasTilePositionStructuredBuffer()
 }
 
 void FShadowMapPass::CalculateDirectionalLightViewProj(UDirectionalLightComponent* Light,
-	const TArray<UStaticMeshComponent*>& Meshes, UCamera* InCamera, FMatrix& OutView, FMatrix& OutProj)
+	const TFrameArray<UStaticMeshComponent*>& Meshes, UCamera* InCamera, FMatrix& OutView, FMatrix& OutProj)
 {
 	// PSM (Perspective Shadow Map) 구현
 	if (!InCamera)
@@ -757,7 +1240,7 @@ void FShadowMapPass::CalculateDirectionalLightViewProj(UDirectionalLightComponen
 }
 
 void FShadowMapPass::CalculateUniformShadowMapViewProj(UDirectionalLightComponent* Light,
-	const TArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj)
+	const TFrameArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj)
 {
 	// Sample 버전의 Uniform Shadow Map 구현
 	// 1. 모든 메시의 AABB를 포함하는 bounding box 계산
@@ -814,34 +1297,10 @@ void FShadowMapPass::CalculateUniformShadowMapViewProj(UDirectionalLightComponen
 
 	OutView = FMatrix::CreateLookAtLH(LightPos, SceneCenter, Up);
 
-	// 3. AABB를 light view space로 변환하여 orthographic projection 범위 계산
-	FVector LightSpaceMin(FLT_MAX, FLT_MAX, FLT_MAX);
-	FVector LightSpaceMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-	// AABB의 8개 코너를 light view space로 변환
-	FVector Corners[8] = {
-		FVector(MinBounds.X, MinBounds.Y, MinBounds.Z),
-		FVector(MaxBounds.X, MinBounds.Y, MinBounds.Z),
-		FVector(MinBounds.X, MaxBounds.Y, MinBounds.Z),
-		FVector(MaxBounds.X, MaxBounds.Y, MinBounds.Z),
-		FVector(MinBounds.X, MinBounds.Y, MaxBounds.Z),
-		FVector(MaxBounds.X, MinBounds.Y, MaxBounds.Z),
-		FVector(MinBounds.X, MaxBounds.Y, MaxBounds.Z),
-		FVector(MaxBounds.X, MaxBounds.Y, MaxBounds.Z)
-	};
-
-	for (int i = 0; i < 8; i++)
-	{
-		FVector LightSpaceCorner = OutView.TransformPosition(Corners[i]);
-
-		LightSpaceMin.X = std::min(LightSpaceMin.X, LightSpaceCorner.X);
-		LightSpaceMin.Y = std::min(LightSpaceMin.Y, LightSpaceCorner.Y);
-		LightSpaceMin.Z = std::min(LightSpaceMin.Z, LightSpaceCorner.Z);
-
-		LightSpaceMax.X = std::max(LightSpaceMax.X, LightSpaceCorner.X);
-		LightSpaceMax.Y = std::max(LightSpaceMax.Y, LightSpaceCorner.Y);
-		LightSpaceMax.Z = std::max(LightSpaceMax.Z, LightSpaceCorner.Z);
-	}
+	// 3. AABB를 light view space로 변환하여 orthographic projection 범위 계산 (View 행렬은 아핀이므로 Arvo 방식 사용)
+	const FAABB LightSpaceBounds = FAABB(MinBounds, MaxBounds).TransformBy(OutView);
+	const FVector& LightSpaceMin = LightSpaceBounds.Min;
+	const FVector& LightSpaceMax = LightSpaceBounds.Max;
 
 	// 4. Orthographic projection 생성
 	// Scene 크기에 비례한 padding 사용 (씬이 크면 padding도 크게)
@@ -865,7 +1324,7 @@ void FShadowMapPass::CalculateUniformShadowMapViewProj(UDirectionalLightComponen
 }
 
 void FShadowMapPass::CalculateSpotLightViewProj(USpotLightComponent* Light,
-	const TArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj)
+	const TFrameArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj)
 {
 	// 1. Light의 위치와 방향 가져오기
 	FVector LightPos = Light->GetWorldLocation();
@@ -1036,19 +1495,22 @@ FShadowMapResource* FShadowMapPass::GetShadowAtlas()
 	return &ShadowAtlas;
 }
 
-FShadowAtlasTilePos FShadowMapPass::GetDirectionalAtlasTilePos(uint32 Index) const
+bool FShadowMapPass::GetLightAtlasRect(const ULightComponent* InLight, uint32 InTileIndex, FShadowAtlasRect& OutRect) const
 {
-	return ShadowAtlasDirectionalLightTilePosArray[Index];
-}
+	auto It = LightAtlasRequestIndices.find(InLight);
+	if (It == LightAtlasRequestIndices.end())
+	{
+		return false;
+	}
 
-FShadowAtlasTilePos FShadowMapPass::GetSpotAtlasTilePos(uint32 Index) const
-{
-	return ShadowAtlasSpotLightTilePosArray[Index];
-}
+	const FShadowAtlasRequest& Allocation = AtlasRequests[It->second];
+	if (!Allocation.IsAllocated() || InTileIndex >= Allocation.TileCount)
+	{
+		return false;
+	}
 
-FShadowAtlasPointLightTilePos FShadowMapPass::GetPointAtlasTilePos(uint32 Index) const
-{
-	return ShadowAtlasPointLightTilePosArray[Index];
+	OutRect = Allocation.Rects[InTileIndex];
+	return true;
 }
 
 /**
@@ -1104,24 +1566,11 @@ uint64 FShadowMapPass::GetTotalShadowMapMemory() const
 
 /**
  * @brief 사용 중인 아틀라스 타일 개수를 반환
- * @return 현재 사용 중인 타일 개수
+ * @return 이번 프레임에 Atlas에 배치된 타일 개수 (Directional Cascade + Spot + Point * 6)
  */
 uint32 FShadowMapPass::GetUsedAtlasTileCount() const
 {
-	// 실제 사용 중인 타일 개수 계산
-	// Directional CSM Count + Spot * 1 + Point * 6 (큐브맵 6면)
-	return ActiveDirectionalCascadeCount + ActiveSpotLightCount + (ActivePointLightCount * 6);
-}
-
-/**
- * @brief 아틀라스의 최대 타일 개수를 반환
- * @return 최대 타일 개수 (4x4 = 16)
- */
-uint32 FShadowMapPass::GetMaxAtlasTileCount()
-{
-	// 8x8 아틀라스 = 64 타일 (8192 / 1024 = 8)
-	// TODO(KHJ): 일단은 고정값, 필요 시 따로 값을 받아올 것
-	return 64;
+	return AtlasPackStats.AllocatedTileCount;
 }
 
 /**
@@ -1258,6 +1707,14 @@ void FShadowMapPass::Release()
 	SafeRelease(ShadowAtlasPointLightTilePosStructuredSRV);
 
 	SafeRelease(ConstantCascadeData);
+
+	SafeRelease(TileClearVS);
+	SafeRelease(TileClearPS);
+	SafeRelease(TileClearDepthStencilState);
+	AtlasSlotCaches.clear();
+	AtlasRequests.clear();
+	LightAtlasRequestIndices.clear();
+	UpdatedAtlasTiles.clear();
 	// Shader와 InputLayout은 Renderer가 소유하므로 여기서 해제하지 않음
 }
 
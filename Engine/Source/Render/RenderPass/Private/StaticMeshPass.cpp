@@ -10,12 +10,18 @@
 #include "Component/Public/PointLightComponent.h"
 #include "Texture/Public/ShadowMapResources.h"
 #include "Render/RenderPass/Public/ShadowData.h"
+#include "Render/UI/Overlay/Public/StatOverlay.h"
+#include "Editor/Public/Camera.h"
 
 FStaticMeshPass::FStaticMeshPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferCamera, ID3D11Buffer* InConstantBufferModel,
 	ID3D11VertexShader* InVS, ID3D11PixelShader* InPS, ID3D11InputLayout* InLayout, ID3D11DepthStencilState* InDS)
 	: FRenderPass(InPipeline, InConstantBufferCamera, InConstantBufferModel), VS(InVS), PS(InPS), InputLayout(InLayout), DS(InDS)
 {
 	ConstantBufferMaterial = FRenderResourceFactory::CreateConstantBuffer<FMaterialConstants>();
+	ConstantBufferInstanceOffset = FRenderResourceFactory::CreateConstantBuffer<FInstanceOffsetConstants>();
+
+	InstanceStructuredBuffer = FRenderResourceFactory::CreateStructuredBuffer<FMatrix>(InstanceBufferCount);
+	FRenderResourceFactory::CreateStructuredShaderResourceView(InstanceStructuredBuffer, &InstanceStructuredBufferSRV);
 }
 
 void FStaticMeshPass::Execute(FRenderingContext& Context)
@@ -30,6 +36,7 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 	else
 	{
 		VS = Renderer.GetVertexShader(Context.ViewMode);
+		InstancedVS = Renderer.GetInstancedVertexShader(Context.ViewMode);
 		PS = Renderer.GetPixelShader(Context.ViewMode);
 	}
 	
@@ -65,16 +72,21 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 	Pipeline->SetConstantBuffer(1, EShaderType::VS | EShaderType::PS, ConstantBufferCamera);
 
 	if (!(Context.ShowFlags & EEngineShowFlags::SF_StaticMesh)) { return; }
-	TArray<UStaticMeshComponent*>& MeshComponents = Context.StaticMeshes;
-	sort(MeshComponents.begin(), MeshComponents.end(),
-		[](UStaticMeshComponent* A, UStaticMeshComponent* B) {
-			int32 MeshA = A->GetStaticMesh() ? A->GetStaticMesh()->GetAssetPathFileName().GetComparisonIndex() : 0;
-			int32 MeshB = B->GetStaticMesh() ? B->GetStaticMesh()->GetAssetPathFileName().GetComparisonIndex() : 0;
-			return MeshA < MeshB;
-		});
 
-	FStaticMesh* CurrentMeshAsset = nullptr;
-	UMaterial* CurrentMaterial = nullptr;
+	// 1. 보이는 메시 섹션마다 Draw command를 만들고 64비트 키로 정렬 (키가 같으면 입력 순서 유지)
+	BuildDrawCommands(Context);
+	DrawSortKey::RadixSort(SortKeys, SortedOrder, SortScratch);
+
+	const FDrawStateChangeCount UnsortedChanges = DrawSortKey::CountStateChanges(SortKeys);
+	const FDrawStateChangeCount SortedChanges = DrawSortKey::CountStateChanges(SortKeys, &SortedOrder);
+	UStatOverlay::GetInstance().RecordDrawSortStats(static_cast<uint32>(DrawCommands.size()),
+		SortedChanges.GetTotal(), UnsortedChanges.GetTotal());
+
+	// 2. 같은 메시 섹션/머티리얼을 공유하는 command를 묶고, 2개 이상인 묶음의 World 행렬을 업로드
+	InstanceBatcher.Build(BatchKeys, SortedOrder);
+	UploadInstanceData();
+	UStatOverlay::GetInstance().RecordInstancingStats(static_cast<uint32>(InstanceBatcher.GetBatches().size()),
+		InstanceBatcher.GetInstancedBatchCount());
 
 	// --- RTVs Setup ---
 	
@@ -98,93 +110,78 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 
 	// --- RTVs Setup End ---
 
-	for (UStaticMeshComponent* MeshComp : MeshComponents) 
+	// 3. 정렬된 순서대로 제출하며, 실제로 바뀐 상태만 바인딩한다
+	const FStaticMesh* CurrentMeshAsset = nullptr;
+	const UStaticMeshComponent* CurrentComponent = nullptr;
+	const UMaterial* CurrentMaterial = nullptr;
+	bool bCurrentNormalMapEnabled = false;
+	bool bInstancedPipeline = false;
+
+	const TArray<uint32>& InstanceCommands = InstanceBatcher.GetInstanceCommands();
+	for (const FInstanceBatch& Batch : InstanceBatcher.GetBatches())
 	{
-		if (!MeshComp->IsVisible()) { continue; }
-		if (!MeshComp->GetStaticMesh()) { continue; }
-		FStaticMesh* MeshAsset = MeshComp->GetStaticMesh()->GetStaticMeshAsset();
-		if (!MeshAsset) { continue; }
+		const FMeshDrawCommand& Command = DrawCommands[InstanceCommands[Batch.FirstInstance]];
+		UStaticMeshComponent* MeshComp = Command.Component;
 
-		if (CurrentMeshAsset != MeshAsset)
+		if (CurrentMeshAsset != Command.MeshAsset)
 		{
 			Pipeline->SetVertexBuffer(MeshComp->GetVertexBuffer(), sizeof(FNormalVertex));
 			Pipeline->SetIndexBuffer(MeshComp->GetIndexBuffer(), 0);
-			CurrentMeshAsset = MeshAsset;
+			CurrentMeshAsset = Command.MeshAsset;
+		}
+
+		if (Command.Material &&
+			(CurrentMaterial != Command.Material || bCurrentNormalMapEnabled != MeshComp->IsNormalMapEnabled()))
+		{
+			BindMaterial(MeshComp, Command.Material);
+			CurrentMaterial = Command.Material;
+			bCurrentNormalMapEnabled = MeshComp->IsNormalMapEnabled();
 		}
-		
-		FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, MeshComp->GetWorldTransformMatrix());
-		Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferModel);
 
-		if (MeshAsset->MaterialInfo.empty() || MeshComp->GetStaticMesh()->GetNumMaterials() == 0) 
+		if (Batch.IsInstanced())
 		{
-			Pipeline->DrawIndexed(static_cast<uint32>(MeshAsset->Indices.size()), 0, 0);
+			if (!bInstancedPipeline)
+			{
+				PipelineInfo.VertexShader = InstancedVS;
+				Pipeline->UpdatePipeline(PipelineInfo);
+				Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferInstanceOffset);
+				bInstancedPipeline = true;
+			}
+
+			FInstanceOffsetConstants InstanceOffset;
+			InstanceOffset.InstanceBaseIndex = Batch.InstanceBufferOffset;
+			FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferInstanceOffset, InstanceOffset);
+
+			Pipeline->DrawIndexedInstanced(Command.IndexCount, Batch.InstanceCount, Command.StartIndex, 0, 0);
 			continue;
 		}
 
-		if (MeshComp->IsScrollEnabled()) 
+		if (bInstancedPipeline)
 		{
-			MeshComp->SetElapsedTime(MeshComp->GetElapsedTime() + UTimeManager::GetInstance().GetDeltaTime());
+			// Model 상수 버퍼의 내용은 그대로이므로 다시 바인딩만 한다
+			PipelineInfo.VertexShader = VS;
+			Pipeline->UpdatePipeline(PipelineInfo);
+			Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferModel);
+			bInstancedPipeline = false;
 		}
 
-		for (const FMeshSection& Section : MeshAsset->Sections)
+		if (CurrentComponent != MeshComp)
 		{
-			UMaterial* Material = MeshComp->GetMaterial(Section.MaterialSlot);
-			if (CurrentMaterial != Material) {
-				FMaterialConstants MaterialConstants = {};
-				FVector AmbientColor = Material->GetAmbientColor(); MaterialConstants.Ka = FVector4(AmbientColor.X, AmbientColor.Y, AmbientColor.Z, 1.0f);
-				FVector DiffuseColor = Material->GetDiffuseColor(); MaterialConstants.Kd = FVector4(DiffuseColor.X, DiffuseColor.Y, DiffuseColor.Z, 1.0f);
-				FVector SpecularColor = Material->GetSpecularColor(); MaterialConstants.Ks = FVector4(SpecularColor.X, SpecularColor.Y, SpecularColor.Z, 1.0f);
-				MaterialConstants.Ns = Material->GetSpecularExponent();
-				MaterialConstants.Ni = Material->GetRefractionIndex();
-				MaterialConstants.D = Material->GetDissolveFactor();
-				MaterialConstants.MaterialFlags = 0;
-				if (Material->GetDiffuseTexture())  { MaterialConstants.MaterialFlags |= HAS_DIFFUSE_MAP; }
-				if (Material->GetAmbientTexture())  { MaterialConstants.MaterialFlags |= HAS_AMBIENT_MAP; }
-				if (Material->GetSpecularTexture()) { MaterialConstants.MaterialFlags |= HAS_SPECULAR_MAP; }
-				if (Material->GetNormalTexture())   { MaterialConstants.MaterialFlags |= HAS_NORMAL_MAP; }
-				if (!MeshComp->IsNormalMapEnabled())
-				{
-					MaterialConstants.MaterialFlags &= ~HAS_NORMAL_MAP;
-				}
-				if (Material->GetAlphaTexture())    { MaterialConstants.MaterialFlags |= HAS_ALPHA_MAP; }
-				if (Material->GetBumpTexture())     { MaterialConstants.MaterialFlags |= HAS_BUMP_MAP; }
-				MaterialConstants.Time = MeshComp->GetElapsedTime();
-
-				FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferMaterial, MaterialConstants);
-				Pipeline->SetConstantBuffer(2, EShaderType::VS | EShaderType::PS, ConstantBufferMaterial);
-
-				if (UTexture* DiffuseTexture = Material->GetDiffuseTexture())
-				{
-					Pipeline->SetShaderResourceView(0, EShaderType::PS, DiffuseTexture->GetTextureSRV());
-					Pipeline->SetSamplerState(0, EShaderType::PS, DiffuseTexture->GetTextureSampler());
-				}
-				if (UTexture* AmbientTexture = Material->GetAmbientTexture())
-				{
-					Pipeline->SetShaderResourceView(1, EShaderType::PS, AmbientTexture->GetTextureSRV());
-				}
-				if (UTexture* SpecularTexture = Material->GetSpecularTexture())
-				{
-					Pipeline->SetShaderResourceView(2, EShaderType::PS, SpecularTexture->GetTextureSRV());
-				}
-				if (Material->GetNormalTexture() && MeshComp->IsNormalMapEnabled())
-				{
-					Pipeline->SetShaderResourceView(3, EShaderType::PS, Material->GetNormalTexture()->GetTextureSRV());
-				}
-				if (UTexture* AlphaTexture = Material->GetAlphaTexture())
-				{
-					Pipeline->SetShaderResourceView(4, EShaderType::PS, AlphaTexture->GetTextureSRV());
-				}
-				if (UTexture* BumpTexture = Material->GetBumpTexture()) 
-				{ // 범프 텍스처 추가 그러나 범프 텍스처 사용하지 않아서 없을 것임. 무시 ㄱㄱ
-					Pipeline->SetShaderResourceView(5, EShaderType::PS, BumpTexture->GetTextureSRV());
-					// 필요한 경우 샘플러 지정
-					// Pipeline->SetSamplerState(5, false, BumpTexture->GetTextureSampler());
-				}
-				CurrentMaterial = Material;
-			}
-				Pipeline->DrawIndexed(Section.IndexCount, Section.StartIndex, 0);
+			FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, MeshComp->GetWorldTransformMatrix());
+			Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferModel);
+			CurrentComponent = MeshComp;
 		}
+
+		Pipeline->DrawIndexed(Command.IndexCount, Command.StartIndex, 0);
+	}
+
+	if (bInstancedPipeline)
+	{
+		PipelineInfo.VertexShader = VS;
+		Pipeline->UpdatePipeline(PipelineInfo);
+		Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferModel);
 	}
+	Pipeline->SetShaderResourceView(15, EShaderType::VS, nullptr);  // Instance World Matrices
 	Pipeline->SetConstantBuffer(2, EShaderType::PS, nullptr);
 
 	// Unbind shadow maps to prevent resource hazards
@@ -205,7 +202,182 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 	// --- RTVs Reset End ---
 }
 
+void FStaticMeshPass::BuildDrawCommands(FRenderingContext& Context)
+{
+	DrawCommands.clear();
+	SortKeys.clear();
+	BatchKeys.clear();
+	TextureSetIds.Reset();
+	MaterialIds.Reset();
+	MeshIds.Reset();
+
+	// 이 패스는 뷰 모드별 셰이더 하나만 사용하므로 Pass/Shader 필드는 고정
+	constexpr uint32 PassId = 0;
+	const uint32 ShaderId = static_cast<uint32>(Context.ViewMode);
+
+	const FVector CameraLocation = Context.CurrentCamera ? Context.CurrentCamera->GetLocation() : FVector::ZeroVector();
+	const float MaxDistance = Context.CurrentCamera ? Context.CurrentCamera->GetFarZ() : 0.0f;
+
+	// 인스턴싱 셰이더가 없거나 UV 스크롤처럼 컴포넌트별 상태가 있는 command는 묶지 않는다
+	const auto MakeBatchKey = [this](uint64 InSortKey, uint32 InSectionIndex, bool bInInstanceable)
+	{
+		if (!InstancedVS || !bInInstanceable)
+		{
+			return FMeshInstanceBatcher::NO_BATCH;
+		}
+		return FMeshInstanceBatcher::MakeBatchKey(InSortKey, InSectionIndex);
+	};
+
+	for (UStaticMeshComponent* MeshComp : Context.StaticMeshes)
+	{
+		if (!MeshComp->IsVisible()) { continue; }
+		if (!MeshComp->GetStaticMesh()) { continue; }
+		FStaticMesh* MeshAsset = MeshComp->GetStaticMesh()->GetStaticMeshAsset();
+		if (!MeshAsset) { continue; }
+
+		if (MeshComp->IsScrollEnabled())
+		{
+			MeshComp->SetElapsedTime(MeshComp->GetElapsedTime() + UTimeManager::GetInstance().GetDeltaTime());
+		}
+
+		// 스크롤 시간은 컴포넌트마다 달라 머티리얼 상수 버퍼를 공유할 수 없으므로 인스턴싱하지 않는다
+		const bool bInstanceable = !MeshComp->IsScrollEnabled();
+
+		const uint32 MeshId = MeshIds.GetId(reinterpret_cast<uint64>(MeshAsset));
+		const uint32 DepthBucket = DrawSortKey::QuantizeDepth((MeshComp->GetWorldLocation() - CameraLocation).Length(), MaxDistance);
+
+		if (MeshAsset->MaterialInfo.empty() || MeshComp->GetStaticMesh()->GetNumMaterials() == 0)
+		{
+			FMeshDrawCommand Command;
+			Command.Component = MeshComp;
+			Command.MeshAsset = MeshAsset;
+			Command.IndexCount = static_cast<uint32>(MeshAsset->Indices.size());
+			Command.SortKey = DrawSortKey::Make(PassId, ShaderId, 0, 0, MeshId, DepthBucket);
+
+			DrawCommands.push_back(Command);
+			SortKeys.push_back(Command.SortKey);
+			BatchKeys.push_back(MakeBatchKey(Command.SortKey, 0, bInstanceable));
+			continue;
+		}
+
+		const bool bNormalMapEnabled = MeshComp->IsNormalMapEnabled();
+		for (uint32 SectionIndex = 0; SectionIndex < MeshAsset->Sections.size(); ++SectionIndex)
+		{
+			const FMeshSection& Section = MeshAsset->Sections[SectionIndex];
+			UMaterial* Material = MeshComp->GetMaterial(Section.MaterialSlot);
+
+			// 바인딩되는 텍스처 조합 (Normal map은 컴포넌트 설정에 따라 바인딩 여부가 달라짐)
+			uint64 TextureSetHash = 0;
+			for (const UTexture* Texture : { Material->GetDiffuseTexture(), Material->GetAmbientTexture(), Material->GetSpecularTexture(),
+				bNormalMapEnabled ? Material->GetNormalTexture() : nullptr, Material->GetAlphaTexture(), Material->GetBumpTexture() })
+			{
+				TextureSetHash = (TextureSetHash ^ reinterpret_cast<uint64>(Texture)) * 1099511628211ull;
+			}
+
+			// 머티리얼 상수 버퍼도 Normal map 설정에 따라 달라지므로 함께 구분한다 (포인터 하위 비트는 항상 0)
+			const uint64 MaterialStateKey = reinterpret_cast<uint64>(Material) | (bNormalMapEnabled ? 1ull : 0ull);
+
+			FMeshDrawCommand Command;
+			Command.Component = MeshComp;
+			Command.MeshAsset = MeshAsset;
+			Command.Material = Material;
+			Command.StartIndex = Section.StartIndex;
+			Command.IndexCount = Section.IndexCount;
+			Command.SortKey = DrawSortKey::Make(PassId, ShaderId,
+				TextureSetIds.GetId(TextureSetHash), MaterialIds.GetId(MaterialStateKey), MeshId, DepthBucket);
+
+			DrawCommands.push_back(Command);
+			SortKeys.push_back(Command.SortKey);
+			BatchKeys.push_back(MakeBatchKey(Command.SortKey, SectionIndex, bInstanceable));
+		}
+	}
+}
+
+void FStaticMeshPass::UploadInstanceData()
+{
+	InstanceBatcher.PackInstanceBuffer(InstanceWorlds, [this](uint32 InCommandIndex)
+	{
+		return DrawCommands[InCommandIndex].Component->GetWorldTransformMatrix();
+	});
+
+	if (InstanceWorlds.empty()) { return; }
+
+	// 최대갯수 재할당
+	const uint32 InstanceCount = static_cast<uint32>(InstanceWorlds.size());
+	if (InstanceBufferCount < InstanceCount)
+	{
+		while (InstanceBufferCount < InstanceCount)
+		{
+			InstanceBufferCount = InstanceBufferCount << 1;
+		}
+		SafeRelease(InstanceStructuredBuffer);
+		InstanceStructuredBuffer = FRenderResourceFactory::CreateStructuredBuffer<FMatrix>(InstanceBufferCount);
+		SafeRelease(InstanceStructuredBufferSRV);
+		FRenderResourceFactory::CreateStructuredShaderResourceView(InstanceStructuredBuffer, &InstanceStructuredBufferSRV);
+	}
+
+	FRenderResourceFactory::UpdateStructuredBuffer(InstanceStructuredBuffer, InstanceWorlds);
+	Pipeline->SetShaderResourceView(15, EShaderType::VS, InstanceStructuredBufferSRV);
+}
+
+void FStaticMeshPass::BindMaterial(const UStaticMeshComponent* InMeshComp, UMaterial* InMaterial)
+{
+	FMaterialConstants MaterialConstants = {};
+	FVector AmbientColor = InMaterial->GetAmbientColor(); MaterialConstants.Ka = FVector4(AmbientColor.X, AmbientColor.Y, AmbientColor.Z, 1.0f);
+	FVector DiffuseColor = InMaterial->GetDiffuseColor(); MaterialConstants.Kd = FVector4(DiffuseColor.X, DiffuseColor.Y, DiffuseColor.Z, 1.0f);
+	FVector SpecularColor = InMaterial->GetSpecularColor(); MaterialConstants.Ks = FVector4(SpecularColor.X, SpecularColor.Y, SpecularColor.Z, 1.0f);
+	MaterialConstants.Ns = InMaterial->GetSpecularExponent();
+	MaterialConstants.Ni = InMaterial->GetRefractionIndex();
+	MaterialConstants.D = InMaterial->GetDissolveFactor();
+	MaterialConstants.MaterialFlags = 0;
+	if (InMaterial->GetDiffuseTexture())  { MaterialConstants.MaterialFlags |= HAS_DIFFUSE_MAP; }
+	if (InMaterial->GetAmbientTexture())  { MaterialConstants.MaterialFlags |= HAS_AMBIENT_MAP; }
+	if (InMaterial->GetSpecularTexture()) { MaterialConstants.MaterialFlags |= HAS_SPECULAR_MAP; }
+	if (InMaterial->GetNormalTexture())   { MaterialConstants.MaterialFlags |= HAS_NORMAL_MAP; }
+	if (!InMeshComp->IsNormalMapEnabled())
+	{
+		MaterialConstants.MaterialFlags &= ~HAS_NORMAL_MAP;
+	}
+	if (InMaterial->GetAlphaTexture())    { MaterialConstants.MaterialFlags |= HAS_ALPHA_MAP; }
+	if (InMaterial->GetBumpTexture())     { MaterialConstants.MaterialFlags |= HAS_BUMP_MAP; }
+	MaterialConstants.Time = InMeshComp->GetElapsedTime();
+
+	FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferMaterial, MaterialConstants);
+	Pipeline->SetConstantBuffer(2, EShaderType::VS | EShaderType::PS, ConstantBufferMaterial);
+
+	if (UTexture* DiffuseTexture = InMaterial->GetDiffuseTexture())
+	{
+		Pipeline->SetShaderResourceView(0, EShaderType::PS, DiffuseTexture->GetTextureSRV());
+		Pipeline->SetSamplerState(0, EShaderType::PS, DiffuseTexture->GetTextureSampler());
+	}
+	if (UTexture* AmbientTexture = InMaterial->GetAmbientTexture())
+	{
+		Pipeline->SetShaderResourceView(1, EShaderType::PS, AmbientTexture->GetTextureSRV());
+	}
+	if (UTexture* SpecularTexture = InMaterial->GetSpecularTexture())
+	{
+		Pipeline->SetShaderResourceView(2, EShaderType::PS, SpecularTexture->GetTextureSRV());
+	}
+	if (InMaterial->GetNormalTexture() && InMeshComp->IsNormalMapEnabled())
+	{
+		Pipeline->SetShaderResourceView(3, EShaderType::PS, InMaterial->GetNormalTexture()->GetTextureSRV());
+	}
+	if (UTexture* AlphaTexture = InMaterial->GetAlphaTexture())
+	{
+		Pipeline->SetShaderResourceView(4, EShaderType::PS, AlphaTexture->GetTextureSRV());
+	}
+	if (UTexture* BumpTexture = InMaterial->GetBumpTexture()) 
+	{ // 범프 텍스처 추가 그러나 범프 텍스처 사용하지 않아서 없을 것임. 무시 ㄱㄱ
+		Pipeline->SetShaderResourceView(5, EShaderType::PS, BumpTexture->GetTextureSRV());
+		// 필요한 경우 샘플러 지정
+		// Pipeline->SetSamplerState(5, false, BumpTexture->GetTextureSampler());
+	}
+}
+
 void FStaticMeshPass::Release()
 {
 	SafeRelease(ConstantBufferMaterial);
+	SafeRelease(ConstantBufferInstanceOffset);
+	SafeRelease(InstanceStructuredBufferSRV);
+	SafeRelease(InstanceStructuredBuffer);
 }
@@ -13,18 +13,20 @@ struct FRenderingContext
     uint64 ShowFlags;
     D3D11_VIEWPORT Viewport;
     FVector2 RenderTargetSize;
+    class ULevel* Level = nullptr;
 
-    TArray<class UPrimitiveComponent*> AllPrimitives;
+    // 프레임마다 새로 채워지므로 FFrameArena에 할당 (프레임 끝에 무효화됨)
+    TFrameArray<class UPrimitiveComponent*> AllPrimitives;
     // Components By Render Pass
-    TArray<class UStaticMeshComponent*> StaticMeshes;
-    TArray<class UBillBoardComponent*> BillBoards;
-    TArray<class UEditorIconComponent*> EditorIcons;
-    TArray<class UTextComponent*> Texts;
-    TArray<class UUUIDTextComponent*> UUIDs;
-    TArray<class UDecalComponent*> Decals;
-    TArray<class UPointLightComponent*> PointLights;
-    TArray<class USpotLightComponent*> SpotLights;
-    TArray<class UDirectionalLightComponent*> DirectionalLights;
-    TArray<class UAmbientLightComponent*> AmbientLights;
-    TArray<class UHeightFogComponent*> Fogs;
+    TFrameArray<class UStaticMeshComponent*> StaticMeshes;
+    TFrameArray<class UBillBoardComponent*> BillBoards;
+    TFrameArray<class UEditorIconComponent*> EditorIcons;
+    TFrameArray<class UTextComponent*> Texts;
+    TFrameArray<class UUUIDTextComponent*> UUIDs;
+    TFrameArray<class UDecalComponent*> Decals;
+    TFrameArray<class UPointLightComponent*> PointLights;
+    TFrameArray<class USpotLightComponent*> SpotLights;
+    TFrameArray<class UDirectionalLightComponent*> DirectionalLights;
+    TFrameArray<class UAmbientLightComponent*> AmbientLights;
+    TFrameArray<class UHeightFogComponent*> Fogs;
 };
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "Render/Shadow/Public/ShadowAtlasAllocator.h"
+
 struct FShadowViewProjConstant
 {
     FMatrix ViewProjection;
@@ -12,6 +14,7 @@ struct FPointLightShadowParams
     float LightRange;
 };
 
+// Atlas 타일의 좌상단 위치 (texel 단위, 셰이더의 ATLASGRIDSIZE = 1 / ATLASSIZE)
 struct FShadowAtlasTilePos
 {
     uint32 UV[2];
@@ -23,6 +26,42 @@ struct FShadowAtlasPointLightTilePos
     uint32 UV[6][2];
 };
 
+/**
+ * @brief 이번 프레임에 다시 렌더링된 Atlas 타일 (ShadowMapFilterPass의 필터링 대상)
+ */
+struct FShadowAtlasUpdatedTile
+{
+    const class ULightComponent* Light = nullptr;
+    FShadowAtlasRect Rect;
+};
+
+/**
+ * @brief Shadow atlas 슬롯 캐시 정보 (Spot/Point Light)
+ *
+ * 슬롯을 마지막으로 렌더링한 라이트와 당시의 라이트 상태를 보관합니다.
+ * 라이트 상태가 같고 라이트 영역 안의 캐스터가 변하지 않았다면 슬롯을 다시 그리지 않습니다.
+ */
+struct FShadowAtlasSlotCache
+{
+    const class ULightComponent* Light = nullptr;
+
+    // 라이트 상태 (변경 시 재렌더링)
+    FMatrix ViewProjection;
+    FVector LightPosition;
+    float LightRange = 0.0f;
+    FShadowAtlasRect AtlasRects[6];     // Atlas Packer가 할당한 영역 (Spot: 1개, Point: 6개)
+    float ShadowBias = 0.0f;
+    float ShadowSlopeBias = 0.0f;
+    float ShadowSharpen = 0.0f;
+    EShadowModeIndex ShadowModeIndex = EShadowModeIndex::SMI_UnFiltered;
+
+    bool bValid = false;
+    // 직전 렌더링이 캐스터 변경 때문이었는지 (라이트 영역을 벗어난 캐스터를 지우기 위해 한 번 더 그림)
+    bool bCasterDirty = false;
+    // 이번 프레임에 사용되었는지 (사용되지 않은 라이트의 캐시는 제거)
+    bool bUsed = false;
+};
+
 enum class EPlaneVertexPos
 {
     TOP_LEFT = 0,
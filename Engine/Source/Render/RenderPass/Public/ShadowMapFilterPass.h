@@ -47,10 +47,6 @@ private:
      */
     void FilterShadowAtlasMap(const ULightComponent* LightComponent, const FShadowMapResource* ShadowMap, uint32 RegionStartX, uint32 RegionStartY, uint32 RegionWidth, uint32 RegionHeight);
 
-    // @todo: 쉐도우 맵 크기 동적조정 기능 추가전까지 사용
-    static constexpr uint32 TEXTURE_WIDTH = 1024;
-    
-    static constexpr uint32 TEXTURE_HEIGHT = 1024;
     
     // 컴퓨트 셰이더의 스레드 그룹 차원(X) 크기.
     // @note HLSL의 [numthreads(X, Y, Z)] 지시자에서 X 값과 반드시 일치해야 한다.
@@ -4,12 +4,15 @@
 #include "Global/Types.h"
 #include "Render/RenderPass/Public/ShadowData.h"
 #include "Manager/Render/Public/CascadeManager.h"
+#include "Physics/Public/AABB.h"
+#include "Render/Shadow/Public/ShadowAtlasAllocator.h"
 
 class ULightComponent;
 class UDirectionalLightComponent;
 class USpotLightComponent;
 class UPointLightComponent;
 class UStaticMeshComponent;
+class ULevel;
 
 /**
  * @brief Shadow map 렌더링 전용 pass
@@ -19,6 +22,10 @@ class UStaticMeshComponent;
  * - Spot Light: 단일 shadow map (perspective projection)
  * - Point Light: Cube shadow map (6면, omnidirectional)
  *
+ * 모든 타일은 하나의 Shadow Atlas에 FShadowAtlasAllocator로 배치됩니다.
+ * 배치는 프레임 단위로 여러 뷰포트가 공유하며, 직전 프레임의 영역을 유지하므로 캐시된 타일이 카메라 이동으로 무효화되지 않습니다.
+ * Spot/Point Light의 해상도는 화면에서 차지하는 크기(뷰포트 중 최대)에 비례하며 GetShadowResolutionScale()이 상한입니다.
+ *
  * StaticMeshPass 이전에 실행되어 depth map을 준비합니다.
  */
 class FShadowMapPass : public FRenderPass
@@ -39,6 +46,12 @@ public:
 	void Execute(FRenderingContext& Context) override;
 	void Release() override;
 
+	/**
+	 * @brief 프레임의 첫 뷰포트를 렌더링하기 전에 호출합니다.
+	 * 직전 프레임의 Atlas 배치를 다음 배치의 기준으로 보관하고, 어느 뷰포트에서도 쓰이지 않은 라이트의 슬롯 캐시를 제거합니다.
+	 */
+	void BeginFrame();
+
 	// --- Public Getters ---
 	/**
 	 * @brief Directional light의 shadow map 리소스를 가져옵니다.
@@ -64,33 +77,29 @@ public:
 	FShadowMapResource* GetShadowAtlas();
 
 	/**
-	 * @brief Directional Light의 Atlas Tile 위치를 가져옵니다.
-	 * @param Index Directional Light의 인덱스
-	 * @return Directional Light의 Atlas Tile 위치
-	 * @todo ShadowMapPass에 저장되어있는 인덱스와 외부에서 활용되는 인덱스 일치여부 확인
+	 * @brief 라이트에 이번 프레임 할당된 Atlas 영역을 가져옵니다.
+	 * @param InLight 라이트 컴포넌트
+	 * @param InTileIndex 타일 인덱스 (Point Light: 면 인덱스, Directional Light: Cascade 인덱스)
+	 * @param OutRect 할당된 영역 (texel 단위)
+	 * @return 할당되지 않았으면 false
 	 */
-	FShadowAtlasTilePos GetDirectionalAtlasTilePos(uint32 Index) const;
+	bool GetLightAtlasRect(const ULightComponent* InLight, uint32 InTileIndex, FShadowAtlasRect& OutRect) const;
 
 	/**
-	 * @brief Spotlight의 Atlas Tile 위치를 가져옵니다.
-	 * @param Index Spotlight의 인덱스
-	 * @return Spotlight의 Atlas Tile 위치
-	 * @todo ShadowMapPass에 저장되어있는 인덱스와 외부에서 활용되는 인덱스 일치여부 확인
+	 * @brief 이번 프레임에 다시 렌더링된 Atlas 타일 목록을 가져옵니다.
+	 * 캐시된 타일은 이미 필터링되어 있으므로 포함되지 않습니다.
 	 */
-	FShadowAtlasTilePos GetSpotAtlasTilePos(uint32 Index) const;
+	const TArray<FShadowAtlasUpdatedTile>& GetUpdatedAtlasTiles() const { return UpdatedAtlasTiles; }
+
+	/** @brief Atlas 전체 해상도 (texel 단위 타일 좌표를 UV로 변환할 때 사용) */
+	uint32 GetAtlasResolution() const { return AtlasAllocator.GetAtlasResolution(); }
 
 	// Shadow stat information
 	uint64 GetTotalShadowMapMemory() const;
 	uint32 GetUsedAtlasTileCount() const;
-	static uint32 GetMaxAtlasTileCount();
-
-	/**
-	 * @brief Point Light의 Atlas Tile 위치를 가져옵니다.
-	 * @param Index Point Light의 인덱스
-	 * @return Point Light의 Atlas Tile 위치
-	 * @todo ShadowMapPass에 저장되어있는 인덱스와 외부에서 활용되는 인덱스 일치여부 확인
-	 */
-	FShadowAtlasPointLightTilePos GetPointAtlasTilePos(uint32 Index) const;
+	const FShadowAtlasPackStats& GetAtlasPackStats() const { return AtlasPackStats; }
+	uint32 GetCachedAtlasTileCount() const { return CachedAtlasTileCount; }
+	uint32 GetRenderedAtlasTileCount() const { return RenderedAtlasTileCount; }
 
 private:
 	// --- Directional Light Shadow Rendering ---
@@ -101,36 +110,98 @@ private:
 	 */
 	void RenderDirectionalShadowMap(
 		UDirectionalLightComponent* Light,
-		const TArray<UStaticMeshComponent*>& Meshes,
-		UCamera* InCamera
+		const TFrameArray<UStaticMeshComponent*>& Meshes,
+		UCamera* InCamera,
+		const FShadowAtlasRequest& InAllocation
 		);
 
 	// --- Spot Light Shadow Rendering ---
 	/**
 	 * @brief Spot light의 shadow map을 렌더링합니다.
 	 * @param Light Spot light component
-	 * @param Meshes 렌더링할 static mesh 목록
+	 * @param InAtlasRect Atlas에 할당된 영역
+	 * @param Meshes 렌더링할 static mesh 목록 (GatherShadowCasters로 수집한 라이트 영역 안의 캐스터)
 	 */
 	void RenderSpotShadowMap(
 		USpotLightComponent* Light,
-		uint32 AtlasIndex,
-		const TArray<UStaticMeshComponent*>& Meshes
+		const FShadowAtlasRect& InAtlasRect,
+		const TFrameArray<UStaticMeshComponent*>& Meshes
 		);
 
 	// --- Point Light Shadow Rendering (6 faces) ---
 	/**
 	 * @brief Point light의 cube shadow map을 렌더링합니다 (6면).
 	 * @param Light Point light component
-	 * @param Meshes 렌더링할 static mesh 목록
+	 * @param InAtlasRects Atlas에 할당된 영역 (6면)
+	 * @param Meshes 렌더링할 static mesh 목록 (GatherShadowCasters로 수집한 라이트 영역 안의 캐스터)
 	 */
 	void RenderPointShadowMap(
 		UPointLightComponent* Light,
-		uint32 AtlasIndex,
-		const TArray<UStaticMeshComponent*>& Meshes
+		const FShadowAtlasRect* InAtlasRects,
+		const TFrameArray<UStaticMeshComponent*>& Meshes
 		);
 
 	void SetShadowAtlasTilePositionStructuredBuffer();
 
+	// --- Shadow Atlas Packing ---
+	/**
+	 * @brief 그림자를 생성하는 라이트의 Atlas 요청을 이번 프레임 요청에 합치고, 바뀐 것이 있으면 다시 배치합니다.
+	 * 같은 프레임에 앞선 뷰포트가 배치한 영역과 직전 프레임의 영역은 가능한 한 그대로 유지됩니다.
+	 * @param Context 렌더링 컨텍스트
+	 * @param OutDirectionalLight 그림자를 생성하는 Directional Light (없으면 nullptr)
+	 */
+	void PackShadowAtlas(FRenderingContext& Context, UDirectionalLightComponent*& OutDirectionalLight);
+
+	/**
+	 * @brief Tile 위치 structured buffer가 라이트 개수를 수용하도록 확장합니다.
+	 * LightPass의 라이트 버퍼 인덱스로 접근하므로 보이는 라이트 개수만큼 필요합니다.
+	 */
+	void EnsureTilePosBufferCapacity(uint32 InSpotLightCount, uint32 InPointLightCount);
+
+	// --- Shadow Cache ---
+	/**
+	 * @brief 이번 프레임에 변경된 캐스터 영역을 수집합니다.
+	 * Level의 변경 영역(등록/해제/정적 상태에서 이동)과 현재 움직이고 있는 메시의 영역을 합칩니다.
+	 * 움직이는 메시는 Octree에 없으므로 GatherShadowCasters에서 쓰도록 MovingCasters에도 보관합니다.
+	 * @param Context 렌더링 컨텍스트
+	 */
+	void GatherDirtyCasterBounds(FRenderingContext& Context);
+
+	/**
+	 * @brief 라이트 영향 범위 안의 그림자 캐스터를 수집합니다.
+	 * 카메라 컬링 결과(Context.StaticMeshes)는 화면 밖의 캐스터를 빠뜨리므로 Level의 Octree와 움직이는 메시에서 직접 찾습니다.
+	 * @param InLevel 캐스터를 찾을 레벨
+	 * @param InLightPosition 라이트 위치
+	 * @param InLightRange 라이트 영향 반경
+	 * @param InViewProj Spot light의 view-projection (nullptr이면 구 영역만 검사)
+	 * @param OutCasters 수집된 캐스터 목록
+	 */
+	void GatherShadowCasters(ULevel* InLevel, const FVector& InLightPosition, float InLightRange, const FMatrix* InViewProj,
+		TFrameArray<UStaticMeshComponent*>& OutCasters) const;
+
+	/**
+	 * @brief 변경된 캐스터가 라이트 영역 안에 있는지 확인합니다.
+	 * @param InLightPosition 라이트 위치
+	 * @param InLightRange 라이트 영향 반경
+	 * @param InViewProj Spot light의 view-projection (nullptr이면 구 영역만 검사)
+	 */
+	bool HasDirtyCasterInLightVolume(const FVector& InLightPosition, float InLightRange, const FMatrix* InViewProj) const;
+
+	/**
+	 * @brief 라이트의 슬롯 캐시와 현재 라이트 상태를 비교하여 재렌더링 여부를 결정하고 캐시를 갱신합니다.
+	 * @param InLightState 현재 라이트 상태 (Atlas 영역 포함)
+	 * @param bInCasterDirty 라이트 영역 안의 캐스터 변경 여부
+	 * @return 슬롯을 다시 렌더링해야 하면 true
+	 */
+	bool UpdateAtlasSlotCache(const FShadowAtlasSlotCache& InLightState, bool bInCasterDirty);
+
+	/**
+	 * @brief Atlas의 특정 타일만 초기화합니다. (Depth = 1, Moments = 1)
+	 * 전체 Clear를 하면 캐시된 타일이 지워지므로 타일 단위로 덮어씁니다.
+	 * @param InAtlasRect 초기화할 타일 영역
+	 */
+	void ClearAtlasTile(const FShadowAtlasRect& InAtlasRect);
+
 	// --- Helper Functions ---
 	/**
 	 * @brief Directional light의 view-projection 행렬을 계산합니다.
@@ -141,7 +212,7 @@ private:
 	 * @param OutProj 출력 projection matrix
 	 */
 	void CalculateDirectionalLightViewProj(UDirectionalLightComponent* Light,
-		const TArray<UStaticMeshComponent*>& Meshes, UCamera* InCamera, FMatrix& OutView, FMatrix& OutProj);
+		const TFrameArray<UStaticMeshComponent*>& Meshes, UCamera* InCamera, FMatrix& OutView, FMatrix& OutProj);
 
 	/**
 	 * @brief Uniform Shadow Map의 view-projection 행렬을 계산합니다 (Sample 버전).
@@ -151,7 +222,7 @@ private:
 	 * @param OutProj 출력 projection matrix
 	 */
 	void CalculateUniformShadowMapViewProj(UDirectionalLightComponent* Light,
-		const TArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj);
+		const TFrameArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj);
 
 	/**
 	 * @brief Spot light의 view-projection 행렬을 계산합니다.
@@ -161,7 +232,7 @@ private:
 	 * @param OutProj 출력 projection matrix
 	 */
 	void CalculateSpotLightViewProj(USpotLightComponent* Light,
-		const TArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj);
+		const TFrameArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj);
 
 	/**
 	 * @brief Point light의 6면에 대한 view-projection 행렬을 계산합니다.
@@ -261,11 +332,9 @@ private:
 	TArray<FShadowAtlasTilePos> ShadowAtlasSpotLightTilePosArray;
 	TArray<FShadowAtlasPointLightTilePos> ShadowAtlasPointLightTilePosArray;
 
-	// 실제 렌더링된 라이트 개수 및 타일 개수
-	uint32 ActiveDirectionalLightCount = 0; // Directional Light 개수 (0 또는 1)
-	uint32 ActiveDirectionalCascadeCount = 0; // CSM Cascade Count (1 ~ 8)
-	uint32 ActiveSpotLightCount = 0;
-	uint32 ActivePointLightCount = 0;
+	// Tile 위치 structured buffer 용량 (라이트 개수에 맞춰 2배씩 확장)
+	uint32 SpotTilePosCapacity = 8;
+	uint32 PointTilePosCapacity = 8;
 
 	ID3D11Buffer* ShadowAtlasDirectionalLightTilePosStructuredBuffer = nullptr;
 	ID3D11ShaderResourceView* ShadowAtlasDirectionalLightTilePosStructuredSRV = nullptr;
@@ -278,6 +347,32 @@ private:
 
 	FShadowMapResource ShadowAtlas{};
 
+	// Atlas 타일 단위 초기화 (Shadow Cache)
+	ID3D11VertexShader* TileClearVS = nullptr;
+	ID3D11PixelShader* TileClearPS = nullptr;
+	ID3D11DepthStencilState* TileClearDepthStencilState = nullptr;
+
+	// Atlas 배치 (프레임 단위, 모든 뷰포트의 요청을 합쳐 배치)
+	FShadowAtlasAllocator AtlasAllocator;
+	FShadowAtlasPackStats AtlasPackStats;
+	TArray<FShadowAtlasRequest> AtlasRequests;
+	TArray<ULightComponent*> AtlasRequestLights;
+	TMap<const ULightComponent*, uint32> LightAtlasRequestIndices;
+	// 직전 프레임의 배치 결과 (라이트가 같은 영역을 유지하도록 다음 배치에 넘김)
+	TMap<const ULightComponent*, FShadowAtlasRequest> PreviousAtlasAllocations;
+	TArray<FShadowAtlasUpdatedTile> UpdatedAtlasTiles;
+
+	// 라이트별 슬롯 캐시 (Spot: 1타일, Point: 6타일)
+	TMap<const ULightComponent*, FShadowAtlasSlotCache> AtlasSlotCaches;
+
+	// 이번 프레임에 변경된 캐스터 영역
+	TArray<FAABB> DirtyCasterBounds;
+	// 현재 움직이고 있어 Octree에 없는 캐스터
+	TArray<UStaticMeshComponent*> MovingCasters;
+
+	uint32 CachedAtlasTileCount = 0;
+	uint32 RenderedAtlasTileCount = 0;
+
 	// Handle Cascade Data
 	ID3D11Buffer* ConstantCascadeData = nullptr;
 };
@@ -1,5 +1,32 @@
 ﻿#pragma once
 #include "Render/RenderPass/Public/RenderPass.h"
+#include "Optimization/Public/DrawSortKey.h"
+#include "Optimization/Public/MeshInstancing.h"
+
+class UStaticMeshComponent;
+class UMaterial;
+struct FStaticMesh;
+
+/**
+ * @brief Static mesh 섹션 하나를 그리기 위한 정보
+ * SortKey 순서대로 제출하여 셰이더/텍스처/머티리얼/버텍스 버퍼 변경을 최소화합니다.
+ */
+struct FMeshDrawCommand
+{
+    uint64 SortKey = 0;
+    UStaticMeshComponent* Component = nullptr;
+    FStaticMesh* MeshAsset = nullptr;
+    UMaterial* Material = nullptr;      // nullptr이면 머티리얼 없이 메시 전체를 그림
+    uint32 StartIndex = 0;
+    uint32 IndexCount = 0;
+};
+
+// 인스턴싱 Draw가 읽을 World 행렬 시작 위치 (UberLit.hlsl INSTANCED의 b0)
+struct FInstanceOffsetConstants
+{
+    uint32 InstanceBaseIndex = 0;
+    uint32 Padding[3] = {};
+};
 
 class FStaticMeshPass : public FRenderPass
 {
@@ -11,14 +38,43 @@ public:
 
     // hot reload용 setter methods
 	void SetVertexShader(ID3D11VertexShader* InVS) { VS = InVS; } 
+	void SetInstancedVertexShader(ID3D11VertexShader* InVS) { InstancedVS = InVS; }
 	void SetPixelShader(ID3D11PixelShader* InPS) { PS = InPS; }
 	void SetInputLayout(ID3D11InputLayout* InLayout) { InputLayout = InLayout; }
 
 private:
+    /** @brief 보이는 메시 섹션마다 Draw command와 정렬 키를 생성합니다. */
+    void BuildDrawCommands(FRenderingContext& Context);
+    void BindMaterial(const UStaticMeshComponent* InMeshComp, UMaterial* InMaterial);
+    /** @brief 인스턴싱 묶음의 World 행렬을 모아 StructuredBuffer에 올립니다. (필요하면 버퍼를 2배씩 늘림) */
+    void UploadInstanceData();
+
     ID3D11VertexShader* VS = nullptr;
+    ID3D11VertexShader* InstancedVS = nullptr;     // nullptr이면 인스턴싱하지 않음
     ID3D11PixelShader* PS = nullptr;
     ID3D11InputLayout* InputLayout = nullptr;
     ID3D11DepthStencilState* DS = nullptr;
     
     ID3D11Buffer* ConstantBufferMaterial = nullptr;
+    ID3D11Buffer* ConstantBufferInstanceOffset = nullptr;
+
+    // 인스턴싱 World 행렬 버퍼 (VS t15)
+    ID3D11Buffer* InstanceStructuredBuffer = nullptr;
+    ID3D11ShaderResourceView* InstanceStructuredBufferSRV = nullptr;
+    uint32 InstanceBufferCount = 256;
+    TArray<FMatrix> InstanceWorlds;
+
+    // 프레임마다 재사용하는 Draw 정렬 버퍼
+    TArray<FMeshDrawCommand> DrawCommands;
+    TArray<uint64> SortKeys;
+    TArray<uint32> SortedOrder;
+    TArray<uint32> SortScratch;
+
+    // 키가 같은 command는 한 번의 인스턴싱 Draw로 묶는다 (FMeshInstanceBatcher::NO_BATCH는 단독으로 그림)
+    TArray<uint64> BatchKeys;
+    FMeshInstanceBatcher InstanceBatcher;
+
+    FSortKeyIdTable TextureSetIds = FSortKeyIdTable(DrawSortKey::TEXTURE_SET_BITS);
+    FSortKeyIdTable MaterialIds = FSortKeyIdTable(DrawSortKey::MATERIAL_BITS);
+    FSortKeyIdTable MeshIds = FSortKeyIdTable(DrawSortKey::MESH_BITS);
 };
@@ -149,6 +149,11 @@ void UPipeline::DrawIndexed(uint32 IndexCount, uint32 StartIndexLocation, int32
 	DeviceContext->DrawIndexed(IndexCount, StartIndexLocation, BaseVertexLocation);
 }
 
+void UPipeline::DrawIndexedInstanced(uint32 IndexCountPerInstance, uint32 InstanceCount, uint32 StartIndexLocation, int32 BaseVertexLocation, uint32 StartInstanceLocation)
+{
+	DeviceContext->DrawIndexedInstanced(IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation, StartInstanceLocation);
+}
+
 void UPipeline::DispatchCS(ID3D11ComputeShader* CS, uint32 x, uint32 y, uint32 z)
 {
 	DeviceContext->CSSetShader(CS, nullptr, 0);
@@ -429,6 +429,24 @@ void URenderer::CreateStaticMeshShader()
 	};
 	FRenderResourceFactory::CreatePixelShader(ShaderFilePathString, &UberLitPixelShaderWorldNormal, "Uber_PS", WorldNormalViewMacros.data());
 
+	// Compile instanced vertex shader variants (World 행렬을 StructuredBuffer에서 읽음, 입력 레이아웃은 동일)
+	TArray<D3D_SHADER_MACRO> LambertInstancedMacros = {
+		{ "LIGHTING_MODEL_LAMBERT", "1" },
+		{ "INSTANCED", "1" },
+		{ nullptr, nullptr }
+	};
+	ID3D11InputLayout* InstancedInputLayout = nullptr;
+	FRenderResourceFactory::CreateVertexShaderAndInputLayout(ShaderFilePathString, ShaderMeshLayout, &UberLitVertexShaderInstanced, &InstancedInputLayout, "Uber_VS", LambertInstancedMacros.data());
+	SafeRelease(InstancedInputLayout);
+
+	TArray<D3D_SHADER_MACRO> GouraudInstancedMacros = {
+		{ "LIGHTING_MODEL_GOURAUD", "1" },
+		{ "INSTANCED", "1" },
+		{ nullptr, nullptr }
+	};
+	FRenderResourceFactory::CreateVertexShaderAndInputLayout(ShaderFilePathString, ShaderMeshLayout, &UberLitVertexShaderGouraudInstanced, &InstancedInputLayout, "Uber_VS", GouraudInstancedMacros.data());
+	SafeRelease(InstancedInputLayout);
+
 	RegisterShaderReloadCache(ShaderPath, ShaderUsage::STATICMESH);
 }
 
@@ -692,6 +710,8 @@ void URenderer::HotReloadShaders()
 			SafeRelease(UberLitInputLayout);
 			SafeRelease(UberLitVertexShader);
 			SafeRelease(UberLitVertexShaderGouraud);
+			SafeRelease(UberLitVertexShaderInstanced);
+			SafeRelease(UberLitVertexShaderGouraudInstanced);
 			SafeRelease(UberLitPixelShader);
 			SafeRelease(UberLitPixelShaderGouraud);
 			SafeRelease(UberLitPixelShaderBlinnPhong);
@@ -703,6 +723,7 @@ void URenderer::HotReloadShaders()
 				{
 					StaticMeshPass->SetInputLayout(UberLitInputLayout);
 					StaticMeshPass->SetVertexShader(UberLitVertexShader);
+					StaticMeshPass->SetInstancedVertexShader(UberLitVertexShaderInstanced);
 					StaticMeshPass->SetPixelShader(UberLitPixelShader);
 					break;
 				}
@@ -759,6 +780,8 @@ void URenderer::ReleaseDefaultShader()
 	SafeRelease(UberLitPixelShaderWorldNormal);
 	SafeRelease(UberLitVertexShader);
 	SafeRelease(UberLitVertexShaderGouraud);
+	SafeRelease(UberLitVertexShaderInstanced);
+	SafeRelease(UberLitVertexShaderGouraudInstanced);
 	
 	SafeRelease(DefaultInputLayout);
 	SafeRelease(DefaultPixelShader);
@@ -849,6 +872,9 @@ void URenderer::Update()
     int32 StartIndex = (CurrentLayout == EViewportLayout::Single) ? ViewportMgr.GetActiveIndex() : 0;
     int32 EndIndex = (CurrentLayout == EViewportLayout::Single) ? (StartIndex + 1) : static_cast<int32>(Viewports.size());
 
+    // Shadow atlas 배치와 슬롯 캐시는 이번 프레임의 모든 뷰포트가 공유한다
+    ShadowMapPass->BeginFrame();
+
     for (int32 ViewportIndex = StartIndex; ViewportIndex < EndIndex; ++ViewportIndex)
     {
         FViewport* Viewport = Viewports[ViewportIndex];
@@ -931,6 +957,28 @@ void URenderer::Update()
         UUIManager::GetInstance().Render();
     }
 
+    // 렌더 목록은 FFrameArena 메모리를 가리키므로 프레임 끝(Reset) 전에 비워둔다
+    RenderingContext = FRenderingContext();
+
+    // 이번 프레임에 렌더링한 레벨의 변경 영역은 그림자 패스가 모두 소비했으므로 여기서 비운다
+    // (렌더링되지 않은 레벨은 다음에 렌더링될 때까지 누적)
+    for (int32 ViewportIndex = StartIndex; ViewportIndex < EndIndex; ++ViewportIndex)
+    {
+        const FViewport* Viewport = Viewports[ViewportIndex];
+        if (!Viewport || Viewport->GetRect().Width < 50 || Viewport->GetRect().Height < 50)
+        {
+            continue;
+        }
+
+        if (UWorld* RenderedWorld = GEditor->GetWorldForViewport(ViewportIndex))
+        {
+            if (ULevel* RenderedLevel = RenderedWorld->GetLevel())
+            {
+                RenderedLevel->ClearDirtyPrimitiveBounds();
+            }
+        }
+    }
+
     RenderEnd();
 }
 
@@ -982,36 +1030,6 @@ void URenderer::RenderLevel(FViewport* InViewport, int32 ViewportIndex)
 
 	const FCameraConstants& ViewProj = InViewport->GetViewportClient()->GetCamera()->GetFViewProjConstants();
 	static bool bCullingEnabled = false; // 임시 토글(초기값: 컬링 비활성)
-	TArray<UPrimitiveComponent*> FinalVisiblePrims;
-	if (!bCullingEnabled)
-	{
-		// 1) 옥트리(정적 프리미티브) 전부 수집
-		if (FOctree* StaticOctree = WorldToRender->GetLevel()->GetStaticOctree())
-		{
-			TArray<UPrimitiveComponent*> AllStatics;
-			StaticOctree->GetAllPrimitives(AllStatics);
-			for (UPrimitiveComponent* Primitive : AllStatics)
-			{
-				if (Primitive && Primitive->IsVisible())
-				{
-					FinalVisiblePrims.push_back(Primitive);
-				}
-			}
-		}
-		// 2) 동적 프리미티브 전부 수집
-		TArray<UPrimitiveComponent*>& DynamicPrimitives = WorldToRender->GetLevel()->GetDynamicPrimitives();
-		for (UPrimitiveComponent* Primitive : DynamicPrimitives)
-		{
-			if (Primitive && Primitive->IsVisible())
-			{
-				FinalVisiblePrims.push_back(Primitive);
-			}
-		}
-	}
-	else
-	{
-		FinalVisiblePrims = InViewport->GetViewportClient()->GetCamera()->GetViewVolumeCuller().GetRenderableObjects();
-	}
 
 	RenderingContext = FRenderingContext(
 
@@ -1023,97 +1041,141 @@ void URenderer::RenderLevel(FViewport* InViewport, int32 ViewportIndex)
 		{DeviceResources->GetViewportInfo().Width, DeviceResources->GetViewportInfo().Height}
 		);
 
+	RenderingContext.Level = WorldToRender->GetLevel();
+
+	// Pilot Mode: 현재 조종 중인 Actor의 아이콘은 렌더링 스킵
+	UEditor* Editor = GEditor ? GEditor->GetEditorModule() : nullptr;
+	const AActor* PilotedActor = (Editor && Editor->IsPilotMode()) ? Editor->GetPilotedActor() : nullptr;
+	auto ShouldSkipEditorIcon = [PilotedActor](UEditorIconComponent* InEditorIcon)
+	{
+		return PilotedActor && InEditorIcon->GetTypedOuter<AActor>() == PilotedActor;
+	};
+
+	// 렌더 목록은 Frame arena에 할당되며, Arena는 배열이 늘어날 때 이전 버퍼를 회수하지 않으므로
+	// Level의 타입별 목록 크기(상한)만큼 미리 잡아 배열마다 한 번만 할당한다
+	RenderingContext.StaticMeshes.reserve(CurrentLevel->GetStaticMeshComponents().size());
+	RenderingContext.BillBoards.reserve(CurrentLevel->GetBillBoardComponents().size());
+	RenderingContext.Texts.reserve(CurrentLevel->GetTextComponents().size());
+	RenderingContext.UUIDs.reserve(CurrentLevel->GetUUIDTextComponents().size());
+	RenderingContext.Decals.reserve(CurrentLevel->GetDecalComponents().size());
+	RenderingContext.EditorIcons.reserve(CurrentLevel->GetEditorIconComponents().size());
+	RenderingContext.AllPrimitives.reserve(
+		RenderingContext.StaticMeshes.capacity() + RenderingContext.BillBoards.capacity() + RenderingContext.Texts.capacity() +
+		RenderingContext.UUIDs.capacity() + RenderingContext.Decals.capacity() + RenderingContext.EditorIcons.capacity());
+	RenderingContext.SpotLights.reserve(CurrentLevel->GetSpotLightComponents().size());
+	RenderingContext.PointLights.reserve(CurrentLevel->GetPointLightComponents().size());
+	// Directional, Ambient Light는 첫 번째 유효한 라이트 하나만 담는다
+	RenderingContext.DirectionalLights.reserve(std::min<size_t>(CurrentLevel->GetDirectionalLightComponents().size(), 1));
+	RenderingContext.AmbientLights.reserve(std::min<size_t>(CurrentLevel->GetAmbientLightComponents().size(), 1));
+	RenderingContext.Fogs.reserve(CurrentLevel->GetHeightFogComponents().size());
+
 	// 1. Sort visible primitive components
-	RenderingContext.AllPrimitives = FinalVisiblePrims;
-	for (auto& Prim : FinalVisiblePrims)
+	// 컴포넌트 타입은 ULevel::RegisterComponent에서 이미 분류되어 있으므로 여기서는 캐스팅하지 않는다
+	if (!bCullingEnabled)
 	{
-		if (auto StaticMesh = Cast<UStaticMeshComponent>(Prim))
-		{
-			RenderingContext.StaticMeshes.push_back(StaticMesh);
-		}
-		else if (auto BillBoard = Cast<UBillBoardComponent>(Prim))
+		// 컬링하지 않으면 Level의 타입별 렌더 목록을 가시성으로만 걸러낸다 (Octree, Actor 순회 없음)
+		auto GatherVisible = [this](const auto& InComponents, auto& OutComponents)
 		{
-			RenderingContext.BillBoards.push_back(BillBoard);
-		}
-		else if (auto EditorIcon = Cast<UEditorIconComponent>(Prim))
-		{
-			// Pilot Mode: 현재 조종 중인 Actor의 아이콘은 렌더링 스킵
-			UEditor* Editor = GEditor ? GEditor->GetEditorModule() : nullptr;
-			bool bShouldSkip = false;
-
-			if (Editor && Editor->IsPilotMode() && Editor->GetPilotedActor())
+			for (auto* Component : InComponents)
 			{
-				AActor* OwnerActor = EditorIcon->GetTypedOuter<AActor>();
-				bShouldSkip = (OwnerActor == Editor->GetPilotedActor());
+				if (Component && Component->IsVisible())
+				{
+					OutComponents.push_back(Component);
+					RenderingContext.AllPrimitives.push_back(Component);
+				}
 			}
+		};
+
+		GatherVisible(CurrentLevel->GetStaticMeshComponents(), RenderingContext.StaticMeshes);
+		GatherVisible(CurrentLevel->GetBillBoardComponents(), RenderingContext.BillBoards);
+		GatherVisible(CurrentLevel->GetTextComponents(), RenderingContext.Texts);
+		GatherVisible(CurrentLevel->GetUUIDTextComponents(), RenderingContext.UUIDs);
+		GatherVisible(CurrentLevel->GetDecalComponents(), RenderingContext.Decals);
 
-			if (!bShouldSkip)
+		for (UEditorIconComponent* EditorIcon : CurrentLevel->GetEditorIconComponents())
+		{
+			if (EditorIcon && EditorIcon->IsVisible() && !ShouldSkipEditorIcon(EditorIcon))
 			{
 				RenderingContext.EditorIcons.push_back(EditorIcon);
+				RenderingContext.AllPrimitives.push_back(EditorIcon);
 			}
 		}
-		else if (auto Text = Cast<UTextComponent>(Prim))
-		{
-			if (!Text->IsExactly(UUUIDTextComponent::StaticClass())) { RenderingContext.Texts.push_back(Text); }
-			else { RenderingContext.UUIDs.push_back(Cast<UUUIDTextComponent>(Text)); }
-		}
-		else if (auto Decal = Cast<UDecalComponent>(Prim))
-		{
-			RenderingContext.Decals.push_back(Decal);
-		}
 	}
-	
-	for (const auto& LightComponent : CurrentLevel->GetLightComponents())
+	else
 	{
-		if (auto PointLightComponent = Cast<UPointLightComponent>(LightComponent))
+		const TArray<UPrimitiveComponent*>& RenderableObjects = InViewport->GetViewportClient()->GetCamera()->GetViewVolumeCuller().GetRenderableObjects();
+		RenderingContext.AllPrimitives.assign(RenderableObjects.begin(), RenderableObjects.end());
+		for (UPrimitiveComponent* Prim : RenderingContext.AllPrimitives)
 		{
-			auto SpotLightComponent = Cast<USpotLightComponent>(LightComponent);
-			
-			if (SpotLightComponent &&
-				SpotLightComponent->GetVisible() &&
-				SpotLightComponent->GetLightEnabled())
+			switch (Prim->GetRenderProxyType())
 			{
-				RenderingContext.SpotLights.push_back(SpotLightComponent);
-			}
-			else if (PointLightComponent &&
-				PointLightComponent->GetVisible() &&
-				PointLightComponent->GetLightEnabled())
-			{
-				RenderingContext.PointLights.push_back(PointLightComponent);
+			case ERenderProxyType::StaticMesh:
+				RenderingContext.StaticMeshes.push_back(static_cast<UStaticMeshComponent*>(Prim));
+				break;
+			case ERenderProxyType::BillBoard:
+				RenderingContext.BillBoards.push_back(static_cast<UBillBoardComponent*>(Prim));
+				break;
+			case ERenderProxyType::EditorIcon:
+				if (!ShouldSkipEditorIcon(static_cast<UEditorIconComponent*>(Prim)))
+				{
+					RenderingContext.EditorIcons.push_back(static_cast<UEditorIconComponent*>(Prim));
+				}
+				break;
+			case ERenderProxyType::Text:
+				RenderingContext.Texts.push_back(static_cast<UTextComponent*>(Prim));
+				break;
+			case ERenderProxyType::UUIDText:
+				RenderingContext.UUIDs.push_back(static_cast<UUUIDTextComponent*>(Prim));
+				break;
+			case ERenderProxyType::Decal:
+				RenderingContext.Decals.push_back(static_cast<UDecalComponent*>(Prim));
+				break;
+			default:
+				break;
 			}
 		}
+	}
 
-		auto DirectionalLightComponent = Cast<UDirectionalLightComponent>(LightComponent);
-		if (DirectionalLightComponent &&
-			DirectionalLightComponent->GetVisible() &&
-			DirectionalLightComponent->GetLightEnabled() &&
-			RenderingContext.DirectionalLights.empty())
+	// 2. Collect lights (Level이 타입별로 보관하는 목록 사용)
+	for (USpotLightComponent* SpotLightComponent : CurrentLevel->GetSpotLightComponents())
+	{
+		if (SpotLightComponent->GetVisible() && SpotLightComponent->GetLightEnabled())
 		{
-			RenderingContext.DirectionalLights.push_back(DirectionalLightComponent);
+			RenderingContext.SpotLights.push_back(SpotLightComponent);
 		}
+	}
 
-		auto AmbientLightComponent = Cast<UAmbientLightComponent>(LightComponent);
-		if (AmbientLightComponent &&
-			AmbientLightComponent->GetVisible() &&
-			AmbientLightComponent->GetLightEnabled() &&
-			RenderingContext.AmbientLights.empty())
+	for (UPointLightComponent* PointLightComponent : CurrentLevel->GetPointLightComponents())
+	{
+		if (PointLightComponent->GetVisible() && PointLightComponent->GetLightEnabled())
 		{
-			RenderingContext.AmbientLights.push_back(AmbientLightComponent);
+			RenderingContext.PointLights.push_back(PointLightComponent);
 		}
 	}
 
-	// 2. Collect HeightFogComponents from all actors in the level
-	for (const auto& Actor : CurrentLevel->GetLevelActors())
+	// Directional, Ambient Light는 유효한 첫 번째 라이트만 사용
+	for (UDirectionalLightComponent* DirectionalLightComponent : CurrentLevel->GetDirectionalLightComponents())
 	{
-		for (const auto& Component : Actor->GetOwnedComponents())
+		if (DirectionalLightComponent->GetVisible() && DirectionalLightComponent->GetLightEnabled())
 		{
-			if (auto Fog = Cast<UHeightFogComponent>(Component))
-			{
-				RenderingContext.Fogs.push_back(Fog);
-			}
+			RenderingContext.DirectionalLights.push_back(DirectionalLightComponent);
+			break;
 		}
 	}
 
+	for (UAmbientLightComponent* AmbientLightComponent : CurrentLevel->GetAmbientLightComponents())
+	{
+		if (AmbientLightComponent->GetVisible() && AmbientLightComponent->GetLightEnabled())
+		{
+			RenderingContext.AmbientLights.push_back(AmbientLightComponent);
+			break;
+		}
+	}
+
+	// 3. HeightFogComponents (Level에 등록된 목록 사용)
+	const TArray<UHeightFogComponent*>& HeightFogs = CurrentLevel->GetHeightFogComponents();
+	RenderingContext.Fogs.assign(HeightFogs.begin(), HeightFogs.end());
+
 	for (auto RenderPass: RenderPasses)
 	{
 		RenderPass->Execute(RenderingContext);
@@ -1219,6 +1281,23 @@ ID3D11VertexShader* URenderer::GetVertexShader(EViewModeIndex ViewModeIndex) con
 	return nullptr;
 }
 
+ID3D11VertexShader* URenderer::GetInstancedVertexShader(EViewModeIndex ViewModeIndex) const
+{
+	if (ViewModeIndex == EViewModeIndex::VMI_Gouraud)
+	{
+		return UberLitVertexShaderGouraudInstanced;
+	}
+	else if (ViewModeIndex == EViewModeIndex::VMI_Lambert
+		|| ViewModeIndex == EViewModeIndex::VMI_BlinnPhong
+		|| ViewModeIndex == EViewModeIndex::VMI_WorldNormal)
+	{
+		return UberLitVertexShaderInstanced;
+	}
+
+	// Unlit/SceneDepth는 TextureShader를 사용하므로 인스턴싱하지 않음
+	return nullptr;
+}
+
 ID3D11PixelShader* URenderer::GetPixelShader(EViewModeIndex ViewModeIndex) const
 {
 	if (ViewModeIndex == EViewModeIndex::VMI_Gouraud)
@@ -1292,63 +1371,39 @@ void URenderer::RenderHitProxyPass(UCamera* InCamera, const D3D11_VIEWPORT& InVi
 	Context.Viewport = InViewport;
 	Context.RenderTargetSize = FVector2(InViewport.Width, InViewport.Height);
 
-	// 모든 Primitive 컴포넌트 수집
-	TArray<UPrimitiveComponent*> AllVisiblePrims;
-
-	// Static Octree에서 정적 프리미티브 수집
-	if (FOctree* StaticOctree = CurrentLevel->GetStaticOctree())
+	// 타입별로 분류된 Level의 렌더 목록에서 보이는 컴포넌트만 수집 (Frame arena 재할당을 피하도록 상한만큼 예약)
+	Context.StaticMeshes.reserve(CurrentLevel->GetStaticMeshComponents().size());
+	Context.EditorIcons.reserve(CurrentLevel->GetEditorIconComponents().size());
+	Context.BillBoards.reserve(CurrentLevel->GetBillBoardComponents().size());
+	for (UStaticMeshComponent* StaticMesh : CurrentLevel->GetStaticMeshComponents())
 	{
-		TArray<UPrimitiveComponent*> AllStatics;
-		StaticOctree->GetAllPrimitives(AllStatics);
-		for (UPrimitiveComponent* Primitive : AllStatics)
+		if (StaticMesh && StaticMesh->IsVisible())
 		{
-			if (Primitive && Primitive->IsVisible())
-			{
-				AllVisiblePrims.push_back(Primitive);
-			}
+			Context.StaticMeshes.push_back(StaticMesh);
 		}
 	}
 
-	// 동적 프리미티브 수집
-	TArray<UPrimitiveComponent*>& DynamicPrimitives = CurrentLevel->GetDynamicPrimitives();
-	for (UPrimitiveComponent* Primitive : DynamicPrimitives)
+	// Pilot Mode: 현재 조종 중인 Actor의 아이콘은 렌더링 스킵
+	// Outer 체인을 타고 올라가며 AActor 찾기
+	UEditor* PilotEditor = GEditor ? GEditor->GetEditorModule() : nullptr;
+	const AActor* PilotedActor = (PilotEditor && PilotEditor->IsPilotMode()) ? PilotEditor->GetPilotedActor() : nullptr;
+	for (UEditorIconComponent* EditorIcon : CurrentLevel->GetEditorIconComponents())
 	{
-		if (Primitive && Primitive->IsVisible())
+		if (EditorIcon && EditorIcon->IsVisible() &&
+			!(PilotedActor && EditorIcon->GetTypedOuter<AActor>() == PilotedActor))
 		{
-			AllVisiblePrims.push_back(Primitive);
+			Context.EditorIcons.push_back(EditorIcon);
 		}
 	}
 
-	// Primitive 타입별로 분류
-	for (auto& Prim : AllVisiblePrims)
+	for (UBillBoardComponent* BillBoard : CurrentLevel->GetBillBoardComponents())
 	{
-		if (auto StaticMesh = Cast<UStaticMeshComponent>(Prim))
-		{
-			Context.StaticMeshes.push_back(StaticMesh);
-		}
-		else if (auto EditorIcon = Cast<UEditorIconComponent>(Prim))
-		{
-			// Pilot Mode: 현재 조종 중인 Actor의 아이콘은 렌더링 스킵
-			// Outer 체인을 타고 올라가며 AActor 찾기
-			UEditor* Editor = GEditor ? GEditor->GetEditorModule() : nullptr;
-			bool bShouldSkip = false;
-			if (Editor && Editor->IsPilotMode() && Editor->GetPilotedActor())
-			{
-				AActor* OwnerActor = EditorIcon->GetTypedOuter<AActor>();
-				bShouldSkip = (OwnerActor == Editor->GetPilotedActor());
-			}
-
-			if (!bShouldSkip)
-			{
-				Context.EditorIcons.push_back(EditorIcon);
-			}
-		}
-		else if (auto BillBoard = Cast<UBillBoardComponent>(Prim))
+		if (BillBoard && BillBoard->IsVisible())
 		{
 			Context.BillBoards.push_back(BillBoard);
 		}
-		// 필요하면 다른 타입도 추가 가능
 	}
+	// 필요하면 다른 타입도 추가 가능
 
 	// HitProxyPass 실행
 	HitProxyPass->Execute(Context);
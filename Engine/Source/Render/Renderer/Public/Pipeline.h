@@ -54,6 +54,8 @@ public:
 
 	void DrawIndexed(uint32 IndexCount, uint32 StartIndexLocation, int32 BaseVertexLocation);
 
+	void DrawIndexedInstanced(uint32 IndexCountPerInstance, uint32 InstanceCount, uint32 StartIndexLocation, int32 BaseVertexLocation, uint32 StartInstanceLocation);
+
 	void DispatchCS(ID3D11ComputeShader* CS, uint32 x, uint32 y = 1, uint32 z = 1);
 
 private:
@@ -118,6 +118,8 @@ public:
 
 	ID3D11VertexShader* GetVertexShader(EViewModeIndex ViewModeIndex) const;
 	ID3D11PixelShader* GetPixelShader(EViewModeIndex ViewModeIndex) const;
+	/** @brief 인스턴싱 버전의 Vertex Shader (지원하지 않는 뷰 모드는 nullptr) */
+	ID3D11VertexShader* GetInstancedVertexShader(EViewModeIndex ViewModeIndex) const;
 
 	FLightPass* GetLightPass() { return LightPass; }
 	FClusteredRenderingGridPass* GetClusteredRenderingGridPass() { return ClusteredRenderingGridPass; }
@@ -163,6 +165,8 @@ private:
 	// StaticMesh Shaders
 	ID3D11VertexShader* UberLitVertexShader = nullptr;
 	ID3D11VertexShader* UberLitVertexShaderGouraud = nullptr;
+	ID3D11VertexShader* UberLitVertexShaderInstanced = nullptr;
+	ID3D11VertexShader* UberLitVertexShaderGouraudInstanced = nullptr;
 	ID3D11PixelShader* UberLitPixelShader = nullptr;
 	ID3D11PixelShader* UberLitPixelShaderGouraud = nullptr;
 	ID3D11PixelShader* UberLitPixelShaderBlinnPhong = nullptr;
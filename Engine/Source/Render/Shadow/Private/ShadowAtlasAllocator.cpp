@@ -0,0 +1,372 @@
+#include "pch.h"
+#include "Render/Shadow/Public/ShadowAtlasAllocator.h"
+
+FShadowAtlasAllocator::FShadowAtlasAllocator(uint32 InAtlasResolution, uint32 InMinTileResolution)
+	: AtlasResolution(InAtlasResolution)
+	, MinTileResolution(std::min(InMinTileResolution, InAtlasResolution))
+	, LevelCount(1)
+{
+	// 최소 해상도에 도달할 때까지의 레벨 개수
+	for (uint32 Resolution = AtlasResolution; Resolution > MinTileResolution; Resolution >>= 1)
+	{
+		++LevelCount;
+	}
+
+	FreeNodes.resize(LevelCount);
+	Reset();
+}
+
+void FShadowAtlasAllocator::Reset()
+{
+	for (TArray<FShadowAtlasRect>& Nodes : FreeNodes)
+	{
+		Nodes.clear();
+	}
+	FreeNodes[0].push_back({ 0, 0, AtlasResolution });
+}
+
+uint32 FShadowAtlasAllocator::ClampResolution(uint32 InResolution) const
+{
+	uint32 Resolution = MinTileResolution;
+	while (Resolution < InResolution && Resolution < AtlasResolution)
+	{
+		Resolution <<= 1;
+	}
+	return Resolution;
+}
+
+uint32 FShadowAtlasAllocator::GetLevel(uint32 InResolution) const
+{
+	uint32 Level = 0;
+	while (Level + 1 < LevelCount && GetLevelResolution(Level) > InResolution)
+	{
+		++Level;
+	}
+	return Level;
+}
+
+bool FShadowAtlasAllocator::CanAllocate(uint32 InResolution, uint32 InCount) const
+{
+	const uint32 TargetLevel = GetLevel(ClampResolution(InResolution));
+
+	// 상위 레벨의 노드 하나는 TargetLevel 노드 4^(TargetLevel - Level)개로 분할할 수 있다
+	uint64 Available = 0;
+	for (uint32 Level = 0; Level <= TargetLevel; ++Level)
+	{
+		Available += static_cast<uint64>(FreeNodes[Level].size()) << (2 * (TargetLevel - Level));
+		if (Available >= InCount)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FShadowAtlasAllocator::Allocate(uint32 InResolution, FShadowAtlasRect& OutRect)
+{
+	const uint32 TargetLevel = GetLevel(ClampResolution(InResolution));
+
+	// 1. 요청 레벨부터 위로 올라가며 비어있는 가장 작은 노드를 찾는다
+	int32 Level = static_cast<int32>(TargetLevel);
+	while (Level >= 0 && FreeNodes[Level].empty())
+	{
+		--Level;
+	}
+
+	if (Level < 0)
+	{
+		return false;
+	}
+
+	FShadowAtlasRect Node = FreeNodes[Level].back();
+	FreeNodes[Level].pop_back();
+
+	// 2. 요청 레벨에 도달할 때까지 4분할 (좌상단 노드를 계속 분할하고 나머지는 free list에 보관)
+	while (static_cast<uint32>(Level) < TargetLevel)
+	{
+		const uint32 Half = Node.Size >> 1;
+		++Level;
+
+		// back()이 좌상단이 되도록 역순으로 넣는다
+		FreeNodes[Level].push_back({ Node.X + Half, Node.Y + Half, Half });
+		FreeNodes[Level].push_back({ Node.X, Node.Y + Half, Half });
+		FreeNodes[Level].push_back({ Node.X + Half, Node.Y, Half });
+
+		Node.Size = Half;
+	}
+
+	OutRect = Node;
+	return true;
+}
+
+bool FShadowAtlasAllocator::FindFreeNodeContaining(const FShadowAtlasRect& InRect, uint32& OutLevel, uint32& OutIndex) const
+{
+	if (!InRect.IsValid() || InRect.X % InRect.Size != 0 || InRect.Y % InRect.Size != 0 ||
+		InRect.X + InRect.Size > AtlasResolution || InRect.Y + InRect.Size > AtlasResolution)
+	{
+		return false;
+	}
+
+	const uint32 TargetLevel = GetLevel(InRect.Size);
+	if (GetLevelResolution(TargetLevel) != InRect.Size)
+	{
+		return false;
+	}
+
+	// 요청 레벨부터 위로 올라가며 InRect를 포함하는 노드가 비어있는지 확인
+	for (int32 Level = static_cast<int32>(TargetLevel); Level >= 0; --Level)
+	{
+		const uint32 NodeSize = GetLevelResolution(Level);
+		const uint32 NodeX = InRect.X - InRect.X % NodeSize;
+		const uint32 NodeY = InRect.Y - InRect.Y % NodeSize;
+
+		const TArray<FShadowAtlasRect>& Nodes = FreeNodes[Level];
+		for (uint32 Index = 0; Index < Nodes.size(); ++Index)
+		{
+			if (Nodes[Index].X == NodeX && Nodes[Index].Y == NodeY)
+			{
+				OutLevel = static_cast<uint32>(Level);
+				OutIndex = Index;
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool FShadowAtlasAllocator::AllocateAt(const FShadowAtlasRect& InRect)
+{
+	uint32 Level;
+	uint32 Index;
+	if (!FindFreeNodeContaining(InRect, Level, Index))
+	{
+		return false;
+	}
+
+	FShadowAtlasRect Node = FreeNodes[Level][Index];
+	FreeNodes[Level][Index] = FreeNodes[Level].back();
+	FreeNodes[Level].pop_back();
+
+	// InRect에 도달할 때까지 4분할 (InRect를 포함하는 자식을 계속 분할하고 나머지는 free list에 보관)
+	while (Node.Size > InRect.Size)
+	{
+		const uint32 Half = Node.Size >> 1;
+		++Level;
+
+		const FShadowAtlasRect Children[4] = {
+			{ Node.X, Node.Y, Half },
+			{ Node.X + Half, Node.Y, Half },
+			{ Node.X, Node.Y + Half, Half },
+			{ Node.X + Half, Node.Y + Half, Half },
+		};
+
+		for (const FShadowAtlasRect& Child : Children)
+		{
+			if (InRect.X >= Child.X && InRect.X < Child.X + Half && InRect.Y >= Child.Y && InRect.Y < Child.Y + Half)
+			{
+				Node = Child;
+			}
+			else
+			{
+				FreeNodes[Level].push_back(Child);
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FShadowAtlasAllocator::PlaceRequests(TArray<FShadowAtlasRequest>& InOutRequests, const TArray<uint32>& InOrder,
+	const TArray<uint32>& InResolutions, bool bInKeepPreviousRects)
+{
+	for (uint32 Index : InOrder)
+	{
+		FShadowAtlasRequest& Request = InOutRequests[Index];
+		Request.AllocatedResolution = 0;
+		for (FShadowAtlasRect& Rect : Request.Rects)
+		{
+			Rect = {};
+		}
+	}
+
+	// 1. 해상도가 직전과 같은 요청은 직전 영역을 그대로 사용 (타일 중 하나라도 쓸 수 없으면 새로 배치)
+	if (bInKeepPreviousRects)
+	{
+		for (uint32 Index : InOrder)
+		{
+			FShadowAtlasRequest& Request = InOutRequests[Index];
+			const uint32 Resolution = InResolutions[Index];
+			if (Request.PreviousResolution != Resolution)
+			{
+				continue;
+			}
+
+			// 한 요청의 직전 영역은 서로 겹치지 않으므로 각각 비어있으면 모두 할당할 수 있다
+			bool bCanKeep = true;
+			for (uint32 Tile = 0; Tile < Request.TileCount && bCanKeep; ++Tile)
+			{
+				uint32 Level;
+				uint32 NodeIndex;
+				bCanKeep = Request.PreviousRects[Tile].Size == Resolution &&
+					FindFreeNodeContaining(Request.PreviousRects[Tile], Level, NodeIndex);
+			}
+
+			if (!bCanKeep)
+			{
+				continue;
+			}
+
+			for (uint32 Tile = 0; Tile < Request.TileCount; ++Tile)
+			{
+				AllocateAt(Request.PreviousRects[Tile]);
+				Request.Rects[Tile] = Request.PreviousRects[Tile];
+			}
+			Request.AllocatedResolution = Resolution;
+		}
+	}
+
+	// 2. 나머지를 큰 타일부터 배치
+	bool bAllPlaced = true;
+	for (uint32 Index : InOrder)
+	{
+		FShadowAtlasRequest& Request = InOutRequests[Index];
+		if (Request.IsAllocated())
+		{
+			continue;
+		}
+
+		const uint32 Resolution = InResolutions[Index];
+		if (!CanAllocate(Resolution, Request.TileCount))
+		{
+			bAllPlaced = false;
+			continue;
+		}
+
+		for (uint32 Tile = 0; Tile < Request.TileCount; ++Tile)
+		{
+			Allocate(Resolution, Request.Rects[Tile]);
+		}
+		Request.AllocatedResolution = Resolution;
+	}
+
+	return bAllPlaced;
+}
+
+FShadowAtlasPackStats FShadowAtlasAllocator::Pack(TArray<FShadowAtlasRequest>& InOutRequests)
+{
+	Reset();
+
+	FShadowAtlasPackStats Stats;
+	Stats.AtlasTexels = static_cast<uint64>(AtlasResolution) * AtlasResolution;
+
+	// 1. 유효한 요청을 우선순위 순으로 정렬 (원래 순서는 유지)
+	TArray<uint32> Order;
+	Order.reserve(InOutRequests.size());
+	TArray<uint32> Resolutions(InOutRequests.size(), 0);
+	TArray<uint32> TargetResolutions(InOutRequests.size(), 0);
+
+	uint64 TotalTexels = 0;
+	for (uint32 i = 0; i < InOutRequests.size(); ++i)
+	{
+		FShadowAtlasRequest& Request = InOutRequests[i];
+		Request.AllocatedResolution = 0;
+		for (FShadowAtlasRect& Rect : Request.Rects)
+		{
+			Rect = {};
+		}
+
+		if (Request.RequestedResolution == 0 || Request.TileCount == 0)
+		{
+			continue;
+		}
+
+		Request.TileCount = std::min(Request.TileCount, FShadowAtlasRequest::MAX_TILES_PER_REQUEST);
+		Resolutions[i] = ClampResolution(Request.RequestedResolution);
+
+		// 요청이 직전 해상도의 여유 범위 안이면 직전 해상도를 유지 (경계 근처에서 타일이 매 프레임 바뀌지 않도록)
+		if (Request.PreviousResolution > 0)
+		{
+			const float Previous = static_cast<float>(ClampResolution(Request.PreviousResolution));
+			const float Requested = static_cast<float>(Request.RequestedResolution);
+			if (Requested > Previous * 0.5f * (1.0f - FShadowAtlasRequest::RESIZE_HYSTERESIS) &&
+				Requested <= Previous * (1.0f + FShadowAtlasRequest::RESIZE_HYSTERESIS))
+			{
+				Resolutions[i] = static_cast<uint32>(Previous);
+			}
+		}
+		TargetResolutions[i] = Resolutions[i];
+
+		const uint64 RequestTexels = static_cast<uint64>(Resolutions[i]) * Resolutions[i] * Request.TileCount;
+		Stats.RequestedTexels += RequestTexels;
+		TotalTexels += RequestTexels;
+
+		Order.push_back(i);
+		++Stats.RequestCount;
+	}
+
+	std::stable_sort(Order.begin(), Order.end(), [&InOutRequests](uint32 A, uint32 B)
+	{
+		return InOutRequests[A].Priority > InOutRequests[B].Priority;
+	});
+
+	// 2. 면적이 넘치면 우선순위가 가장 낮은 요청을 최소 해상도까지 낮춘 뒤 다음 요청으로 넘어간다
+	for (auto It = Order.rbegin(); It != Order.rend() && TotalTexels > Stats.AtlasTexels; ++It)
+	{
+		const FShadowAtlasRequest& Request = InOutRequests[*It];
+		if (Request.Priority >= FShadowAtlasRequest::FIXED_RESOLUTION_PRIORITY)
+		{
+			continue;
+		}
+
+		uint32& Resolution = Resolutions[*It];
+		while (Resolution > MinTileResolution && TotalTexels > Stats.AtlasTexels)
+		{
+			TotalTexels -= static_cast<uint64>(Resolution) * Resolution * Request.TileCount;
+			Resolution >>= 1;
+			TotalTexels += static_cast<uint64>(Resolution) * Resolution * Request.TileCount;
+		}
+	}
+
+	// 3. 최소 해상도로도 넘치면 우선순위가 낮은 요청부터 제외한다
+	while (TotalTexels > Stats.AtlasTexels && !Order.empty())
+	{
+		const uint32 Dropped = Order.back();
+		Order.pop_back();
+		TotalTexels -= static_cast<uint64>(Resolutions[Dropped]) * Resolutions[Dropped] * InOutRequests[Dropped].TileCount;
+		++Stats.DroppedRequestCount;
+	}
+
+	// 4. 큰 타일부터 배치 (2의 거듭제곱 정사각형을 내림차순으로 넣으면 면적이 맞는 한 항상 들어간다)
+	//    직전 영역을 먼저 유지하면 단편화로 들어가지 않는 요청이 생길 수 있으므로, 그때는 직전 영역 없이 다시 배치한다
+	std::stable_sort(Order.begin(), Order.end(), [&Resolutions](uint32 A, uint32 B)
+	{
+		return Resolutions[A] > Resolutions[B];
+	});
+
+	if (!PlaceRequests(InOutRequests, Order, Resolutions, true))
+	{
+		Reset();
+		PlaceRequests(InOutRequests, Order, Resolutions, false);
+	}
+
+	for (uint32 Index : Order)
+	{
+		const FShadowAtlasRequest& Request = InOutRequests[Index];
+		if (!Request.IsAllocated())
+		{
+			++Stats.DroppedRequestCount;
+			continue;
+		}
+
+		const uint32 Resolution = Request.AllocatedResolution;
+		Stats.AllocatedTileCount += Request.TileCount;
+		Stats.AllocatedTexels += static_cast<uint64>(Resolution) * Resolution * Request.TileCount;
+
+		if (Resolution < TargetResolutions[Index])
+		{
+			++Stats.DownscaledRequestCount;
+		}
+	}
+
+	return Stats;
+}
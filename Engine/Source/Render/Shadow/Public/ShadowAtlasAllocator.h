@@ -0,0 +1,167 @@
+#pragma once
+
+#include "Global/Types.h"
+
+/**
+ * @brief Shadow atlas 안의 정사각형 타일 영역 (texel 단위)
+ */
+struct FShadowAtlasRect
+{
+	uint32 X = 0;
+	uint32 Y = 0;
+	uint32 Size = 0;
+
+	bool IsValid() const { return Size > 0; }
+
+	bool operator==(const FShadowAtlasRect& InOther) const
+	{
+		return X == InOther.X && Y == InOther.Y && Size == InOther.Size;
+	}
+
+	bool operator!=(const FShadowAtlasRect& InOther) const { return !(*this == InOther); }
+};
+
+/**
+ * @brief Atlas 할당 요청
+ *
+ * 하나의 요청은 같은 해상도의 타일 여러 개로 구성됩니다.
+ * (Spot Light: 1개, Point Light: 6개, Directional Light: Cascade 개수)
+ */
+struct FShadowAtlasRequest
+{
+	static constexpr uint32 MAX_TILES_PER_REQUEST = 8;
+	/** @brief 이 우선순위의 요청은 공간이 부족해도 해상도를 낮추지 않음 (Directional Light) */
+	static constexpr float FIXED_RESOLUTION_PRIORITY = FLT_MAX;
+	/**
+	 * @brief 직전 해상도를 유지하는 요청 해상도의 여유 비율
+	 * 직전 해상도 P에 대해 요청이 (P / 2 * (1 - 비율), P * (1 + 비율)] 안이면 P를 유지하므로
+	 * 카메라가 2의 거듭제곱 경계 근처에서 움직여도 타일 크기와 위치가 흔들리지 않습니다.
+	 */
+	static constexpr float RESIZE_HYSTERESIS = 0.25f;
+
+	// 입력
+	const void* Owner = nullptr;      // 요청한 라이트 (Allocator는 참조하지 않음)
+	uint32 RequestedResolution = 0;   // 원하는 타일 해상도 (2의 거듭제곱으로 올림 처리)
+	uint32 TileCount = 1;             // 필요한 타일 개수 (1 ~ MAX_TILES_PER_REQUEST)
+	float Priority = 0.0f;            // 클수록 먼저, 높은 해상도로 배치
+	uint32 PreviousResolution = 0;    // 직전 배치 해상도 (0이면 없음)
+	FShadowAtlasRect PreviousRects[MAX_TILES_PER_REQUEST];  // 직전 배치 영역 (비어 있으면 같은 자리에 다시 배치)
+
+	// 출력
+	uint32 AllocatedResolution = 0;   // 실제 할당된 해상도 (0이면 공간이 없어 할당 실패)
+	FShadowAtlasRect Rects[MAX_TILES_PER_REQUEST];
+
+	bool IsAllocated() const { return AllocatedResolution > 0; }
+
+	/** @brief InPrevious의 배치 결과를 다음 Pack에서 유지할 직전 영역으로 지정합니다. (자기 자신도 가능) */
+	void SetPreviousAllocation(const FShadowAtlasRequest& InPrevious)
+	{
+		PreviousResolution = InPrevious.AllocatedResolution;
+		std::copy(std::begin(InPrevious.Rects), std::end(InPrevious.Rects), std::begin(PreviousRects));
+	}
+};
+
+/**
+ * @brief Shadow atlas 패킹 통계
+ */
+struct FShadowAtlasPackStats
+{
+	uint32 RequestCount = 0;
+	uint32 AllocatedTileCount = 0;
+	uint32 DownscaledRequestCount = 0;  // 공간 부족으로 해상도가 낮아진 요청 수
+	uint32 DroppedRequestCount = 0;     // 최소 해상도로도 공간이 없어 할당되지 못한 요청 수
+	uint64 RequestedTexels = 0;         // 요청 해상도 기준 총 texel 수
+	uint64 AllocatedTexels = 0;         // 실제 할당된 총 texel 수
+	uint64 AtlasTexels = 0;             // Atlas 전체 texel 수
+
+	/** @brief Atlas 중 실제로 사용된 비율 (0 ~ 1) */
+	float GetAtlasUsage() const
+	{
+		return AtlasTexels > 0 ? static_cast<float>(static_cast<double>(AllocatedTexels) / static_cast<double>(AtlasTexels)) : 0.0f;
+	}
+
+	/** @brief 요청한 texel 대비 실제 할당된 texel 비율 (0 ~ 1) */
+	float GetFulfillment() const
+	{
+		return RequestedTexels > 0 ? static_cast<float>(static_cast<double>(AllocatedTexels) / static_cast<double>(RequestedTexels)) : 1.0f;
+	}
+};
+
+/**
+ * @brief Shadow atlas 타일 할당기 (Quadtree)
+ *
+ * Atlas를 4분할 quadtree로 관리하며 2의 거듭제곱 크기의 정사각형 타일을 할당합니다.
+ * 레벨별 free list만 유지하므로 GPU 리소스나 렌더러 없이 단독으로 사용할 수 있습니다.
+ *
+ * 매 프레임 Pack()으로 모든 요청을 다시 배치합니다.
+ * - 직전 배치(PreviousResolution, PreviousRects)가 있고 요청 해상도가 RESIZE_HYSTERESIS 범위 안이면 직전 해상도를 유지합니다.
+ * - 우선순위가 가장 낮은 요청을 최소 해상도까지 절반씩 낮춘 뒤 다음 요청으로 넘어가며 전체 면적을 Atlas 안에 맞춥니다.
+ *   FIXED_RESOLUTION_PRIORITY 요청은 낮추지 않습니다.
+ * - 해상도가 직전과 같은 요청은 직전 영역에 먼저 배치하여 캐시된 타일을 그대로 쓸 수 있게 합니다.
+ * - 나머지는 큰 타일부터 배치하므로 면적이 맞으면 quadtree 특성상 단편화 없이 모두 배치됩니다.
+ *   유지한 영역 때문에 단편화되어 들어가지 않는 요청이 생기면 직전 영역을 무시하고 전부 다시 배치합니다.
+ * - 그래도 공간이 없으면 우선순위가 낮은 요청부터 할당하지 않습니다.
+ */
+class FShadowAtlasAllocator
+{
+public:
+	FShadowAtlasAllocator(uint32 InAtlasResolution = 8192, uint32 InMinTileResolution = 64);
+
+	/** @brief 모든 할당을 해제합니다. */
+	void Reset();
+
+	/**
+	 * @brief 타일 하나를 할당합니다.
+	 * @param InResolution 원하는 해상도 (2의 거듭제곱으로 올림, 최소/최대 해상도로 clamp)
+	 * @param OutRect 할당된 영역
+	 * @return 공간이 없으면 false
+	 */
+	bool Allocate(uint32 InResolution, FShadowAtlasRect& OutRect);
+
+	/**
+	 * @brief 지정한 영역을 그대로 할당합니다.
+	 * @param InRect 할당할 영역 (2의 거듭제곱 크기, 크기의 배수 위치)
+	 * @return 영역이 quadtree 노드와 맞지 않거나 이미 사용 중이면 false
+	 */
+	bool AllocateAt(const FShadowAtlasRect& InRect);
+
+	/**
+	 * @brief 지정 해상도의 타일 InCount개를 할당할 공간이 남아있는지 확인합니다.
+	 */
+	bool CanAllocate(uint32 InResolution, uint32 InCount) const;
+
+	/**
+	 * @brief 요청 목록을 Atlas에 배치합니다. 기존 할당은 모두 해제됩니다.
+	 * @param InOutRequests 요청 목록 (AllocatedResolution, Rects가 채워짐, 순서는 유지)
+	 * @return 패킹 통계
+	 */
+	FShadowAtlasPackStats Pack(TArray<FShadowAtlasRequest>& InOutRequests);
+
+	uint32 GetAtlasResolution() const { return AtlasResolution; }
+	uint32 GetMinTileResolution() const { return MinTileResolution; }
+
+	/** @brief 해상도를 [MinTileResolution, AtlasResolution] 범위의 2의 거듭제곱으로 올림합니다. */
+	uint32 ClampResolution(uint32 InResolution) const;
+
+private:
+	uint32 GetLevel(uint32 InResolution) const;
+
+	/** @brief InRect를 포함하는 비어있는 노드를 찾습니다. (InRect가 quadtree 노드와 맞지 않으면 false) */
+	bool FindFreeNodeContaining(const FShadowAtlasRect& InRect, uint32& OutLevel, uint32& OutIndex) const;
+
+	/**
+	 * @brief Order 순서대로 요청을 배치합니다.
+	 * @param bInKeepPreviousRects 해상도가 직전과 같은 요청을 직전 영역에 먼저 배치할지 여부
+	 * @return 모든 요청이 배치되었으면 true
+	 */
+	bool PlaceRequests(TArray<FShadowAtlasRequest>& InOutRequests, const TArray<uint32>& InOrder,
+		const TArray<uint32>& InResolutions, bool bInKeepPreviousRects);
+	uint32 GetLevelResolution(uint32 InLevel) const { return AtlasResolution >> InLevel; }
+
+	uint32 AtlasResolution;
+	uint32 MinTileResolution;
+	uint32 LevelCount;
+
+	// 레벨별 비어있는 노드 (Level 0 = Atlas 전체)
+	TArray<TArray<FShadowAtlasRect>> FreeNodes;
+};
@@ -4,6 +4,7 @@
 #include "Render/Renderer/Public/Renderer.h"
 #include "Render/UI/Overlay/Public/D2DOverlayManager.h"
 #include "Manager/Render/Public/CascadeManager.h"
+#include "Utility/Public/HitchDetector.h"
 
 IMPLEMENT_SINGLETON_CLASS(UStatOverlay, UObject)
 
@@ -46,6 +47,10 @@ void UStatOverlay::Render()
     {
         RenderShadowInfo();
     }
+    if (IsStatEnabled(EStatType::Draw))
+    {
+        RenderDrawInfo();
+    }
 }
 
 void UStatOverlay::RenderFPS()
@@ -54,8 +59,14 @@ void UStatOverlay::RenderFPS()
     CurrentFPS = timeManager.GetFPS();
     FrameTime = timeManager.GetDeltaTime() * 1000;
 
-    char buf[64];
-    (void)sprintf_s(buf, sizeof(buf), "FPS: %.1f (%.2f ms)", CurrentFPS, FrameTime);
+    // 순간 값만으로는 드문 히치가 보이지 않으므로 최근 프레임 시간 분포를 함께 표시
+    const FHitchDetector& HitchDetector = FHitchDetector::GetInstance();
+    const FFrameTimeHistogram& Histogram = HitchDetector.GetHistogram();
+
+    char buf[192];
+    (void)sprintf_s(buf, sizeof(buf), "FPS: %.1f (%.2f ms) | p50 %.2f p95 %.2f p99 %.2f p99.9 %.2f ms | hitches %llu",
+        CurrentFPS, FrameTime, Histogram.GetPercentile(50.0), Histogram.GetPercentile(95.0), Histogram.GetPercentile(99.0),
+        Histogram.GetPercentile(99.9), HitchDetector.GetHitchCount());
     FString text = buf;
 
     float r = 0.5f, g = 1.0f, b = 0.5f;
@@ -67,15 +78,31 @@ void UStatOverlay::RenderFPS()
 
 void UStatOverlay::RenderMemory()
 {
-    float MemoryMB = static_cast<float>(TotalAllocationBytes) / (1024.0f * 1024.0f);
+    constexpr float MB = 1024.0f * 1024.0f;
+    const FMemoryTagStats& Total = FMemoryTracker::GetTotalStats();
 
-    char Buf[64];
-    (void)sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%u objects)", MemoryMB, TotalAllocationCount);
+    char Buf[128];
+    (void)sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%llu objects, sampled peak %.1f MB, %.0f allocs/s)",
+        static_cast<float>(Total.LiveBytes) / MB, Total.LiveCount, static_cast<float>(Total.SampledPeakBytes) / MB, Total.AllocationsPerSecond);
     FString text = Buf;
 
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
     RenderText(text, OverlayX, OverlayY + OffsetY, 1.0f, 1.0f, 0.0f);
+
+    // 태그별 Live / 프레임 단위로 샘플링한 Peak / 할당 빈도
+    for (uint8 i = 0; i < static_cast<uint8>(EMemoryTag::Count); ++i)
+    {
+        const EMemoryTag Tag = static_cast<EMemoryTag>(i);
+        const FMemoryTagStats& Stats = FMemoryTracker::GetTagStats(Tag);
+
+        (void)sprintf_s(Buf, sizeof(Buf), "  %-8s %8.2f MB (sampled peak %.2f MB, %.0f allocs/s)",
+            GetMemoryTagName(Tag), static_cast<float>(Stats.LiveBytes) / MB, static_cast<float>(Stats.SampledPeakBytes) / MB, Stats.AllocationsPerSecond);
+        text = Buf;
+
+        OffsetY += 20.0f;
+        RenderText(text, OverlayX, OverlayY + OffsetY, 1.0f, 1.0f, 0.6f);
+    }
 }
 
 void UStatOverlay::RenderPicking()
@@ -89,7 +116,7 @@ void UStatOverlay::RenderPicking()
 
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
-    if (IsStatEnabled(EStatType::Memory)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += MEMORY_STAT_HEIGHT;
 
     float r = 0.0f, g = 1.0f, b = 0.8f;
     if (LastPickingTimeMs > 5.0f) { r = 1.0f; g = 0.0f; b = 0.0f; }
@@ -107,7 +134,7 @@ void UStatOverlay::RenderDecalInfo()
 
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))      OffsetY += 20.0f;
-    if (IsStatEnabled(EStatType::Memory))   OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory))   OffsetY += MEMORY_STAT_HEIGHT;
     if (IsStatEnabled(EStatType::Picking))  OffsetY += 20.0f;
 
     float r = 0.5f, g = 1.0f, b = 0.5f;
@@ -125,11 +152,12 @@ void UStatOverlay::RenderDecalInfo()
 
 void UStatOverlay::RenderTimeInfo()
 {
-    const TArray<FString> ProfileKeys = FScopeCycleCounter::GetTimeProfileKeys();
+    FProfiler& Profiler = FProfiler::GetInstance();
+    Profiler.GetCallTree(ProfileNodes);
 
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
-    if (IsStatEnabled(EStatType::Memory)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += MEMORY_STAT_HEIGHT;
     if (IsStatEnabled(EStatType::Picking)) OffsetY += 20.0f;
     if (IsStatEnabled(EStatType::Decal))  OffsetY += 20.0f;
     if (IsStatEnabled(EStatType::Shadow))
@@ -142,22 +170,38 @@ void UStatOverlay::RenderTimeInfo()
             OffsetY += 60.0f;
         }
     }
+    if (IsStatEnabled(EStatType::Draw)) OffsetY += 40.0f;
 
     float CurrentY = OverlayY + OffsetY;
     const float LineHeight = 20.0f;
 
-    for (const FString& Key : ProfileKeys)
+    char Buf[192];
+    (void)sprintf_s(Buf, sizeof(Buf), "CPU Profile ms (last | min/avg/max/p99 of %u frames)", FProfiler::HISTORY_FRAME_COUNT);
+    RenderText(Buf, OverlayX, CurrentY, 0.0f, 1.0f, 1.0f);
+    CurrentY += LineHeight;
+
+    // 호출 트리를 깊이만큼 들여써서 표시 (스레드가 여럿이면 스레드마다 제목 줄)
+    uint32 CurrentThread = 0xFFFFFFFFu;
+    for (const FProfileNodeStats& Node : ProfileNodes)
     {
-        const FTimeProfile& Profile = FScopeCycleCounter::GetTimeProfile(Key);
+        if (Node.ThreadIndex != CurrentThread && Node.ThreadIndex > 0)
+        {
+            (void)sprintf_s(Buf, sizeof(Buf), "[%s]", Profiler.GetThreadName(Node.ThreadIndex));
+            RenderText(Buf, OverlayX, CurrentY, 0.0f, 1.0f, 1.0f);
+            CurrentY += LineHeight;
+        }
+        CurrentThread = Node.ThreadIndex;
 
-        char buf[128];
-        (void)sprintf_s(buf, sizeof(buf), "%s: %.2f ms", Key.c_str(), Profile.Milliseconds);
-        FString text = buf;
+        const int32 Indent = static_cast<int32>(std::min(Node.Depth, 8u) * 2);
+        (void)sprintf_s(Buf, sizeof(Buf), "%*s%-*s %6.2f | %5.2f/%5.2f/%5.2f/%5.2f x%u",
+            Indent, "", 22 - Indent, Node.Name, Node.LastMilliseconds,
+            Node.MinMilliseconds, Node.AvgMilliseconds, Node.MaxMilliseconds, Node.P99Milliseconds, Node.LastCallCount);
 
         float r = 0.8f, g = 0.8f, b = 0.8f;
-        if (Profile.Milliseconds > 1.0f) { r = 1.0f; g = 1.0f; b = 0.0f; }
+        if (Node.LastCallCount == 0) { r = 0.5f; g = 0.5f; b = 0.5f; }
+        else if (Node.LastMilliseconds > 1.0) { r = 1.0f; g = 1.0f; b = 0.0f; }
 
-        RenderText(text, OverlayX, CurrentY, r, g, b);
+        RenderText(Buf, OverlayX, CurrentY, r, g, b);
         CurrentY += LineHeight;
     }
 }
@@ -166,7 +210,7 @@ void UStatOverlay::RenderShadowInfo()
 {
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
-    if (IsStatEnabled(EStatType::Memory)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += MEMORY_STAT_HEIGHT;
     if (IsStatEnabled(EStatType::Picking)) OffsetY += 20.0f;
     if (IsStatEnabled(EStatType::Decal))  OffsetY += 40.0f;
 
@@ -256,30 +300,36 @@ void UStatOverlay::RenderShadowInfo()
         CurrentY += LineHeight;
     }
 
-    // Shadow Atlas 사용 현황
+    // Shadow Atlas 사용 현황 (Atlas 면적 대비 사용률, 공간 부족으로 해상도가 낮아지거나 제외된 라이트 수)
     {
         char Buf[128];
-        (void)sprintf_s(Buf, sizeof(Buf), "Atlas Tiles: %u / %u", UsedAtlasTiles, MaxAtlasTiles);
+        (void)sprintf_s(Buf, sizeof(Buf), "Atlas Tiles: %u (%.1f%% packed, %u downscaled, %u dropped)",
+            UsedAtlasTiles, AtlasUsage * 100.0f, DownscaledShadowRequests, DroppedShadowRequests);
         FString Text = Buf;
 
         float r = 0.5f, g = 1.0f, b = 0.5f;
-        if (MaxAtlasTiles > 0)
+        if (DroppedShadowRequests > 0 || AtlasUsage > 0.9f)
         {
-            float UsageRatio = static_cast<float>(UsedAtlasTiles) / static_cast<float>(MaxAtlasTiles);
-            if (UsageRatio > 0.9f)
-            {
-                r = 1.0f; g = 0.0f; b = 0.0f;
-            }
-            else if (UsageRatio > 0.7f)
-            {
-                r = 1.0f; g = 1.0f; b = 0.0f;
-            }
+            r = 1.0f; g = 0.0f; b = 0.0f;
+        }
+        else if (DownscaledShadowRequests > 0 || AtlasUsage > 0.7f)
+        {
+            r = 1.0f; g = 1.0f; b = 0.0f;
         }
 
         RenderText(Text, OverlayX, CurrentY, r, g, b);
         CurrentY += LineHeight;
     }
 
+    // Shadow Cache 현황 (Spot/Point 타일 중 이번 프레임에 다시 그린 개수 / 캐시를 재사용한 개수)
+    {
+        char Buf[128];
+        (void)sprintf_s(Buf, sizeof(Buf), "Shadow Cache: Rendered %u, Cached %u", RenderedAtlasTiles, CachedAtlasTiles);
+        FString Text = Buf;
+        RenderText(Text, OverlayX, CurrentY, 0.5f, 1.0f, 0.5f);
+        CurrentY += LineHeight;
+    }
+
     // CSM (Cascade Shadow Map) 정보
     if (DirectionalLightCount > 0)
     {
@@ -372,13 +422,60 @@ void UStatOverlay::RecordPickingStats(float elapsedMs)
     AccumulatedPickingTimeMs += elapsedMs;
 }
 
+void UStatOverlay::RenderDrawInfo()
+{
+    float OffsetY = 0.0f;
+    if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += MEMORY_STAT_HEIGHT;
+    if (IsStatEnabled(EStatType::Picking)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Decal))  OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Shadow))
+    {
+        OffsetY += 140.0f;
+        if (DirectionalLightCount > 0)
+        {
+            OffsetY += 60.0f;
+        }
+    }
+
+    // 정렬하지 않고 제출했을 때 대비 줄어든 상태 변경 (셰이더, 텍스처, 머티리얼, 버텍스 버퍼)
+    const uint32 AvoidedStateChanges = UnsortedDrawStateChanges > DrawStateChanges ? UnsortedDrawStateChanges - DrawStateChanges : 0;
+
+    char Buf[128];
+    (void)sprintf_s(Buf, sizeof(Buf), "Mesh Draws: %u, State Changes: %u (avoided %u)",
+        DrawCommandCount, DrawStateChanges, AvoidedStateChanges);
+    FString Text = Buf;
+
+    RenderText(Text, OverlayX, OverlayY + OffsetY, 0.5f, 1.0f, 0.5f);
+
+    // 인스턴싱 전후의 Draw call 수 (인스턴싱 전 = 메시 섹션 수)
+    (void)sprintf_s(Buf, sizeof(Buf), "Draw Calls: %u -> %u (%u instanced batches)",
+        DrawCommandCount, DrawCallCount, InstancedBatchCount);
+    Text = Buf;
+
+    RenderText(Text, OverlayX, OverlayY + OffsetY + 20.0f, 0.5f, 1.0f, 0.5f);
+}
+
+void UStatOverlay::RecordDrawSortStats(uint32 InDrawCommandCount, uint32 InStateChanges, uint32 InUnsortedStateChanges)
+{
+    DrawCommandCount = InDrawCommandCount;
+    DrawStateChanges = InStateChanges;
+    UnsortedDrawStateChanges = InUnsortedStateChanges;
+}
+
+void UStatOverlay::RecordInstancingStats(uint32 InDrawCallCount, uint32 InInstancedBatchCount)
+{
+    DrawCallCount = InDrawCallCount;
+    InstancedBatchCount = InInstancedBatchCount;
+}
+
 void UStatOverlay::RecordDecalStats(uint32 InRenderedDecal, uint32 InCollidedCompCount)
 {
     RenderedDecal = InRenderedDecal;
     CollidedCompCount = InCollidedCompCount;
 }
 
-void UStatOverlay::RecordShadowStats(uint32 InDirectionalLightCount, uint32 InPointLightCount, uint32 InSpotLightCount, uint32 InAmbientLightCount, uint64 InShadowMapMemoryBytes, uint64 InRenderTargetMemoryBytes, uint32 InUsedAtlasTiles, uint32 InMaxAtlasTiles)
+void UStatOverlay::RecordShadowStats(uint32 InDirectionalLightCount, uint32 InPointLightCount, uint32 InSpotLightCount, uint32 InAmbientLightCount, uint64 InShadowMapMemoryBytes, uint64 InRenderTargetMemoryBytes, uint32 InUsedAtlasTiles, float InAtlasUsage, uint32 InDownscaledShadowRequests, uint32 InDroppedShadowRequests, uint32 InRenderedAtlasTiles, uint32 InCachedAtlasTiles)
 {
     DirectionalLightCount = InDirectionalLightCount;
     PointLightCount = InPointLightCount;
@@ -387,5 +484,9 @@ void UStatOverlay::RecordShadowStats(uint32 InDirectionalLightCount, uint32 InPo
     ShadowMapMemoryBytes = InShadowMapMemoryBytes;
     RenderTargetMemoryBytes = InRenderTargetMemoryBytes;
     UsedAtlasTiles = InUsedAtlasTiles;
-    MaxAtlasTiles = InMaxAtlasTiles;
+    AtlasUsage = InAtlasUsage;
+    DownscaledShadowRequests = InDownscaledShadowRequests;
+    DroppedShadowRequests = InDroppedShadowRequests;
+    RenderedAtlasTiles = InRenderedAtlasTiles;
+    CachedAtlasTiles = InCachedAtlasTiles;
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Public/Object.h"
+#include "Utility/Public/Profiler.h"
 
 enum class EStatType : uint8
 {
@@ -10,7 +11,8 @@ enum class EStatType : uint8
 	Decal =		1 << 3,  // 8
 	Time =		1 << 4,	 // 16
 	Shadow =	1 << 5,  // 32
-	All = FPS | Memory | Picking | Time | Decal | Shadow
+	Draw =		1 << 6,  // 64
+	All = FPS | Memory | Picking | Time | Decal | Shadow | Draw
 };
 
 UCLASS()
@@ -31,6 +33,7 @@ public:
 	void ToggleTime() { IsStatEnabled(EStatType::Time) ? DisableStat(EStatType::Time) : EnableStat(EStatType::Time); }
 	void ToggleDecal() { IsStatEnabled(EStatType::Decal) ? DisableStat(EStatType::Decal) : EnableStat(EStatType::Decal); }
 	void ToggleShadow() { IsStatEnabled(EStatType::Shadow) ? DisableStat(EStatType::Shadow) : EnableStat(EStatType::Shadow); }
+	void ToggleDraw() { IsStatEnabled(EStatType::Draw) ? DisableStat(EStatType::Draw) : EnableStat(EStatType::Draw); }
 	void ToggleAll() { IsStatEnabled(EStatType::All) ? DisableStat(EStatType::All) : EnableStat(EStatType::All); }
 
 	// Stat control methods (명시적 켜기/끄기)
@@ -40,13 +43,16 @@ public:
 	void ShowTime() { EnableStat(EStatType::Time); }
 	void ShowDecal() { EnableStat(EStatType::Decal); }
 	void ShowShadow() { EnableStat(EStatType::Shadow); }
+	void ShowDraw() { EnableStat(EStatType::Draw); }
 	void ShowAll() { EnableStat(EStatType::All); }
 	void HideAll() { SetStatType(EStatType::None); }
 
 	// API to update stats
 	void RecordPickingStats(float ElapsedMS);
 	void RecordDecalStats(uint32 InRenderedDecal, uint32 InCollidedCompCount);
-	void RecordShadowStats(uint32 InDirectionalLightCount, uint32 InPointLightCount, uint32 InSpotLightCount, uint32 InAmbientLightCount, uint64 InShadowMapMemoryBytes, uint64 InRenderTargetMemoryBytes, uint32 InUsedAtlasTiles, uint32 InMaxAtlasTiles);
+	void RecordDrawSortStats(uint32 InDrawCommandCount, uint32 InStateChanges, uint32 InUnsortedStateChanges);
+	void RecordInstancingStats(uint32 InDrawCallCount, uint32 InInstancedBatchCount);
+	void RecordShadowStats(uint32 InDirectionalLightCount, uint32 InPointLightCount, uint32 InSpotLightCount, uint32 InAmbientLightCount, uint64 InShadowMapMemoryBytes, uint64 InRenderTargetMemoryBytes, uint32 InUsedAtlasTiles, float InAtlasUsage, uint32 InDownscaledShadowRequests, uint32 InDroppedShadowRequests, uint32 InRenderedAtlasTiles, uint32 InCachedAtlasTiles);
 
 private:
 	void RenderFPS();
@@ -55,12 +61,19 @@ private:
 	void RenderDecalInfo();
 	void RenderTimeInfo();
 	void RenderShadowInfo();
+	void RenderDrawInfo();
 	void RenderText(const FString& Text, float X, float Y, float R, float G, float B);
 
+	// Memory Stat: 전체 1줄 + 태그별 1줄
+	static constexpr float MEMORY_STAT_HEIGHT = 20.0f * (1 + static_cast<uint32>(EMemoryTag::Count));
+
 	// FPS Stats
 	float CurrentFPS = 0.0f;
 	float FrameTime = 0.0f;
 
+	// Time Stats (매 프레임 재사용하는 호출 트리 버퍼)
+	TArray<FProfileNodeStats> ProfileNodes;
+
 	// Picking Stats
 	uint32 PickAttempts = 0;
 	float LastPickingTimeMs = 0.0f;
@@ -70,6 +83,13 @@ private:
 	uint32 RenderedDecal = 0;
 	uint32 CollidedCompCount = 0;
 
+	// Draw Stats (StaticMeshPass 정렬 결과)
+	uint32 DrawCommandCount = 0;
+	uint32 DrawStateChanges = 0;
+	uint32 UnsortedDrawStateChanges = 0;
+	uint32 DrawCallCount = 0;
+	uint32 InstancedBatchCount = 0;
+
 	// Shadow Stats
 	uint32 DirectionalLightCount = 0;
 	uint32 PointLightCount = 0;
@@ -78,7 +98,11 @@ private:
 	uint64 ShadowMapMemoryBytes = 0;
 	uint64 RenderTargetMemoryBytes = 0;
 	uint32 UsedAtlasTiles = 0;
-	uint32 MaxAtlasTiles = 0;
+	float AtlasUsage = 0.0f;
+	uint32 DownscaledShadowRequests = 0;
+	uint32 DroppedShadowRequests = 0;
+	uint32 RenderedAtlasTiles = 0;
+	uint32 CachedAtlasTiles = 0;
 
 	// Rendering position
 	float OverlayX = 18.0f;
@@ -865,13 +865,13 @@ void UActorDetailWidget::AddComponentByName(AActor* InSelectedActor, const FStri
 			// 3. 선택된 컴포넌트(부모)에 새로 만든 컴포넌트(자식)를 붙임
 			//    (SetupAttachment는 UCLASS 내에서 호출하는 것을 가정)
 			NewSceneComponent->AttachToComponent(ParentSceneComponent);
-			UE_LOG_SUCCESS("'%s'를 '%s'의 자식으로 추가했습니다.", NewComponent->GetName().ToString().data(), ParentSceneComponent->GetName().ToString().data());
+			UE_LOG_SUCCESS("'%s'를 '%s'의 자식으로 추가했습니다.", NewComponent->GetName().ToStringView().data(), ParentSceneComponent->GetName().ToStringView().data());
 		}
 		else
 		{
 			// 4. 선택된 컴포넌트가 없으면 액터의 루트 컴포넌트에 붙임
 			NewSceneComponent->AttachToComponent(InSelectedActor->GetRootComponent());
-			UE_LOG_SUCCESS("'%s'를 액터의 루트에 추가했습니다.", NewComponent->GetName().ToString().data());
+			UE_LOG_SUCCESS("'%s'를 액터의 루트에 추가했습니다.", NewComponent->GetName().ToStringView().data());
 		}
 
 		NewSceneComponent->SetRelativeLocation(FVector::Zero());
@@ -880,7 +880,7 @@ void UActorDetailWidget::AddComponentByName(AActor* InSelectedActor, const FStri
 	}
 	else
 	{
-		UE_LOG_SUCCESS("Non-Scene Component '%s'를 액터에 추가했습니다.", NewComponent->GetName().ToString().data());
+		UE_LOG_SUCCESS("Non-Scene Component '%s'를 액터에 추가했습니다.", NewComponent->GetName().ToStringView().data());
 	}
 
 	// 새로 추가된 컴포넌트를 자동으로 선택
@@ -910,7 +910,7 @@ void UActorDetailWidget::FinishRenamingActor(AActor* InActor)
 	}
 
 	FString NewName = ActorNameBuffer;
-	if (!NewName.empty() && NewName != InActor->GetName().ToString())
+	if (!NewName.empty() && NewName != InActor->GetName().ToStringView())
 	{
 		// Actor 이름 변경
 		InActor->SetName(NewName);
@@ -62,7 +62,7 @@ void UActorTerminationWidget::DeleteSelectedActor(AActor* InSelectedActor)
 	}
 
 	UE_LOG_INFO("ActorTerminationWidget: 선택된 Actor를 삭제를 위해 마킹 처리: %s",
-	       InSelectedActor->GetName() == FName::GetNone() ? "UnNamed" : InSelectedActor->GetName().ToString().data());
+	       InSelectedActor->GetName() == FName::GetNone() ? "UnNamed" : InSelectedActor->GetName().ToStringView().data());
 
 	// 지연 삭제를 사용하여 안전하게 다음 틱에서 삭제
 	GWorld->DestroyActor(InSelectedActor);
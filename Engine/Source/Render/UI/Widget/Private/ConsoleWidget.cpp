@@ -8,6 +8,14 @@
 #include "Utility/Public/UELogParser.h"
 #include "Utility/Public/ScopeCycleCounter.h"
 #include "Utility/Public/LogFileWriter.h"
+#include "Utility/Public/MathBenchmark.h"
+#include "Utility/Public/LogBenchmark.h"
+#include "Utility/Public/CastBenchmark.h"
+#include "Utility/Public/SpawnBenchmark.h"
+#include "Utility/Public/DelegateBenchmark.h"
+#include "Utility/Public/HitchDetector.h"
+#include "Manager/Time/Public/TimeManager.h"
+#include "Component/Public/SceneTransformStore.h"
 
 // #define IMGUI_DEFINE_MATH_OPERATORS
 // #include "ImGui/imgui_internal.h"
@@ -30,6 +38,8 @@ UConsoleWidget::~UConsoleWidget()
 		delete LogFileWriter;
 		LogFileWriter = nullptr;
 	}
+
+	FStructuredLog::GetInstance().Shutdown();
 }
 
 void UConsoleWidget::Initialize()
@@ -62,16 +72,20 @@ void UConsoleWidget::Initialize()
 		// 초기화 성공 시 임시 버퍼의 로그들을 파일에 기록
 		for (const auto& PendingLog : PendingLogs)
 		{
-			FString FileLog = GetLogTypePrefix(PendingLog.Type);
-			FileLog += " ";
-			FileLog += PendingLog.Message;
-			LogFileWriter->AddLog(FileLog);
+			LogFileWriter->AddLog(GetLogTypePrefix(PendingLog.Type), PendingLog.Message.c_str());
 		}
 
 		// 임시 버퍼 비우기
 		PendingLogs.clear();
 
 		AddLog(ELogType::Success, "LogFileWriter: Initialized: %s", LogFileWriter->GetCurrentLogFileName().data());
+
+		// 구조화 로그는 같은 이름의 .ulog에 기록
+		FString StructuredLogPath = "Log/" + std::filesystem::path(LogFileWriter->GetCurrentLogFileName()).stem().string() + ".ulog";
+		if (!FStructuredLog::GetInstance().Initialize(StructuredLogPath))
+		{
+			AddLog(ELogType::Error, "StructuredLog: Failed to open %s", StructuredLogPath.data());
+		}
 	}
 	else
 	{
@@ -519,30 +533,39 @@ void UConsoleWidget::AddLogInternal(ELogType InType, const char* fmt, va_list In
 	int LogLength = vsnprintf(nullptr, 0, fmt, ArgumentsCopy);
 	va_end(ArgumentsCopy);
 
-	// 필요한 크기만큼 동적 할당
+	// 대부분의 로그는 스택 버퍼로 충분하므로, 넘칠 때만 필요한 크기만큼 동적 할당
 	// malloc 대신 overloading 함수의 영향을 받을 수 있도록 new 할당 사용
-	char* Buffer = new char[LogLength + 1];
+	char StackBuffer[512];
+	char* Buffer = LogLength < static_cast<int>(sizeof(StackBuffer)) ? StackBuffer : new char[LogLength + 1];
 
 	// Make full string
 	va_copy(ArgumentsCopy, InArguments);
 	(void)vsnprintf(Buffer, LogLength + 1, fmt, ArgumentsCopy);
 	va_end(ArgumentsCopy);
 
-	// 기본 Info 타입으로 log 추가
+	AddFormattedLog(InType, Buffer);
+
+	if (Buffer != StackBuffer)
+	{
+		delete[] Buffer;
+	}
+}
+
+/**
+ * @brief 포맷이 끝난 메시지를 로그 목록과 파일에 추가하는 함수
+ * UE_LOG 매크로는 호출 지점에서 한 번만 포맷한 뒤 이 함수로 바로 전달한다
+ */
+void UConsoleWidget::AddFormattedLog(ELogType InType, const char* InMessage)
+{
 	FLogEntry LogEntry;
 	LogEntry.Type = InType;
-
-	// Log buffer 복사 후 제거
-	LogEntry.Message = FString(Buffer);
+	LogEntry.Message = FString(InMessage);
 
 	// 파일에 로그 작성 또는 임시 버퍼에 저장
 	if (LogFileWriter && LogFileWriter->IsInitialized())
 	{
 		// LogFileWriter가 초기화되었으면 파일에 작성
-		FString FileLog = GetLogTypePrefix(InType);
-		FileLog += " ";
-		FileLog += Buffer;
-		LogFileWriter->AddLog(FileLog);
+		LogFileWriter->AddLog(GetLogTypePrefix(InType), InMessage);
 	}
 	else
 	{
@@ -550,8 +573,6 @@ void UConsoleWidget::AddLogInternal(ELogType InType, const char* fmt, va_list In
 		PendingLogs.push_back(LogEntry);
 	}
 
-	delete[] Buffer;
-
 	// 200개 초과 시 가장 오래된 로그 제거
 	if (LogItems.size() >= 200)
 	{
@@ -599,10 +620,7 @@ void UConsoleWidget::AddSystemLog(const char* InText, bool bInIsError)
 	if (LogFileWriter && LogFileWriter->IsInitialized())
 	{
 		// LogFileWriter가 초기화되었으면 파일에 작성
-		FString FileLog = GetLogTypePrefix(LogEntry.Type);
-		FileLog += " ";
-		FileLog += LogEntry.Message;
-		LogFileWriter->AddLog(FileLog);
+		LogFileWriter->AddLog(GetLogTypePrefix(LogEntry.Type), LogEntry.Message.c_str());
 	}
 	else
 	{
@@ -799,6 +817,258 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		HandleStatCommand(StatCommand);
 	}
 
+	// 프레임 트레이스 캡처 (Chrome Trace Event JSON)
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "trace" || CommandLower.rfind("trace ", 0) == 0)
+	{
+		uint32 FrameCount = 300;
+		bool bIsValidCount = true;
+		if (CommandLower.length() > 6)
+		{
+			try
+			{
+				FrameCount = static_cast<uint32>(std::stoul(CommandLower.substr(6)));
+			}
+			catch (...)
+			{
+				bIsValidCount = false;
+			}
+		}
+
+		FProfiler& Profiler = FProfiler::GetInstance();
+		char FilePath[64];
+		(void)snprintf(FilePath, sizeof(FilePath), "Trace/FrameTrace_%llu.json", static_cast<unsigned long long>(Profiler.GetFrameNumber()));
+		if (!bIsValidCount)
+		{
+			AddLog(ELogType::Error, "Invalid frame count: %s", CommandLower.substr(6).data());
+		}
+		else if (Profiler.BeginTraceCapture(FrameCount, FilePath))
+		{
+			AddLog(ELogType::Success, "Capturing %u frames to %s", FrameCount, FilePath);
+		}
+		else
+		{
+			AddLog(ELogType::Error, "Trace capture is already running or frame count is 0");
+		}
+	}
+
+	// 히치 임계값 설정 및 프레임 시간 분포 출력
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "hitch" || CommandLower.rfind("hitch ", 0) == 0)
+	{
+		FHitchDetector& HitchDetector = FHitchDetector::GetInstance();
+		if (CommandLower.length() > 6)
+		{
+			try
+			{
+				HitchDetector.SetThresholdMilliseconds(std::stod(CommandLower.substr(6)));
+				AddLog(ELogType::Success, "Hitch threshold set to %.2f ms", HitchDetector.GetThresholdMilliseconds());
+			}
+			catch (...)
+			{
+				AddLog(ELogType::Error, "Invalid threshold: %s", CommandLower.substr(6).data());
+			}
+		}
+
+		const FFrameTimeHistogram& Histogram = HitchDetector.GetHistogram();
+		AddLog(ELogType::Info, "Frame time (last %u frames): p50 %.2f / p95 %.2f / p99 %.2f / p99.9 %.2f / max %.2f ms",
+			Histogram.GetSampleCount(), Histogram.GetPercentile(50.0), Histogram.GetPercentile(95.0),
+			Histogram.GetPercentile(99.0), Histogram.GetPercentile(99.9), Histogram.GetPercentile(100.0));
+		AddLog(ELogType::Info, "Hitches: %llu (threshold %.2f ms)", HitchDetector.GetHitchCount(), HitchDetector.GetThresholdMilliseconds());
+		for (const FHitchScope& Scope : HitchDetector.GetLastHitchScopes())
+		{
+			AddLog(ELogType::Debug, "  [%s] %s: self %.2f ms, total %.2f ms", Scope.ThreadName, Scope.Name,
+				Scope.SelfMilliseconds, Scope.InclusiveMilliseconds);
+		}
+	}
+
+	// 고정 스텝 시뮬레이션 설정 및 상태 출력
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "fixedstep" || CommandLower.rfind("fixedstep ", 0) == 0)
+	{
+		UTimeManager& TimeManager = UTimeManager::GetInstance();
+		FFixedStepClock& FixedStepClock = TimeManager.GetFixedStepClock();
+		const FString Argument = CommandLower.length() > 10 ? CommandLower.substr(10) : "";
+
+		if (Argument == "off")
+		{
+			TimeManager.SetFixedTimestepEnabled(false);
+			AddLog(ELogType::Success, "Fixed timestep disabled");
+		}
+		else if (Argument == "interp on" || Argument == "interp off")
+		{
+			TimeManager.SetInterpolationEnabled(Argument == "interp on");
+			AddLog(ELogType::Success, "Render interpolation %s", TimeManager.IsInterpolationEnabled() ? "enabled" : "disabled");
+		}
+		else if (!Argument.empty())
+		{
+			const bool bIsSubsteps = Argument.rfind("substeps ", 0) == 0;
+			try
+			{
+				const int Value = std::stoi(bIsSubsteps ? Argument.substr(9) : Argument);
+				if (Value <= 0)
+				{
+					throw std::out_of_range("fixedstep");
+				}
+
+				if (bIsSubsteps)
+				{
+					FixedStepClock.SetMaxSubsteps(static_cast<uint32>(Value));
+				}
+				else
+				{
+					FixedStepClock.SetStepsPerSecond(static_cast<uint32>(Value));
+					TimeManager.SetFixedTimestepEnabled(true);
+				}
+				AddLog(ELogType::Success, "Fixed timestep: %u Hz, max %u substeps", FixedStepClock.GetStepsPerSecond(), FixedStepClock.GetMaxSubsteps());
+			}
+			catch (...)
+			{
+				AddLog(ELogType::Error, "Usage: fixedstep [<hz> | off | substeps <n> | interp on|off]");
+			}
+		}
+
+		AddLog(ELogType::Info, "Fixed timestep %s: %u Hz (%.3f ms), max %u substeps, interpolation %s",
+			TimeManager.IsFixedTimestepEnabled() ? "ON" : "OFF", FixedStepClock.GetStepsPerSecond(),
+			FixedStepClock.GetStepSeconds() * 1000.0f, FixedStepClock.GetMaxSubsteps(),
+			TimeManager.IsInterpolationEnabled() ? "on" : "off");
+		AddLog(ELogType::Info, "Steps: %llu (last frame %u, dropped %llu), alpha %.2f, interpolated nodes %u",
+			FixedStepClock.GetStepCount(), FixedStepClock.GetSubstepCount(), FixedStepClock.GetDroppedStepCount(),
+			FixedStepClock.GetAlpha(), FSceneTransformStore::GetInstance().GetLastInterpolatedCount());
+	}
+
+	// 지연 포맷 구조화 로그 조회 (이때 처음 포맷됨)
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "log recent" || CommandLower.rfind("log recent ", 0) == 0)
+	{
+		uint32 LineCount = 20;
+		if (CommandLower.length() > 11)
+		{
+			LineCount = static_cast<uint32>(std::strtoul(CommandLower.c_str() + 11, nullptr, 10));
+		}
+
+		FStructuredLog& StructuredLog = FStructuredLog::GetInstance();
+		TArray<FStructuredLogLine> Lines;
+		StructuredLog.GetRecentLines(LineCount, Lines);
+
+		AddLog(ELogType::System, "Deferred log: %llu recorded, %llu dropped (%s)",
+			StructuredLog.GetRecordCount(), StructuredLog.GetDroppedCount(), StructuredLog.GetFilePath().data());
+		for (const FStructuredLogLine& Line : Lines)
+		{
+			AddLog(static_cast<ELogType>(Line.LogType), "[%.3f] %s", Line.Seconds, Line.Message.data());
+		}
+	}
+
+	// .ulog 파일을 같은 이름의 .txt로 디코딩
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.rfind("log decode ", 0) == 0)
+	{
+		// 경로는 대소문자를 유지
+		const FString InputPath = Input.substr(11);
+		FStructuredLogDecoder Decoder;
+		TArray<FStructuredLogLine> Lines;
+		if (!Decoder.DecodeFile(InputPath, Lines))
+		{
+			AddLog(ELogType::Error, "Failed to decode %s", InputPath.data());
+		}
+		else
+		{
+			const FString OutputPath = std::filesystem::path(InputPath).replace_extension(".txt").string();
+			std::ofstream Ofs(OutputPath, std::ios::out | std::ios::trunc);
+			for (const FStructuredLogLine& Line : Lines)
+			{
+				Ofs << FStructuredLogDecoder::ToText(Line) << '\n';
+			}
+			AddLog(ELogType::Success, "Decoded %zu lines to %s", Lines.size(), OutputPath.data());
+		}
+	}
+
+	// 수학 라이브러리 마이크로 벤치마크
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "bench math")
+	{
+		TArray<FMathBenchmarkResult> Results;
+		FMathBenchmark::Run(Results);
+
+		AddLog(ELogType::System, "Math Benchmark (%u elements x %u repeats):",
+			FMathBenchmark::DEFAULT_ELEMENT_COUNT, FMathBenchmark::DEFAULT_REPEAT_COUNT);
+		for (const FMathBenchmarkResult& Result : Results)
+		{
+			AddLog(ELogType::Info, "  %-36s %8.2f ns/op", Result.Name, Result.NanosecondsPerOp);
+		}
+	}
+
+	// 로그 큐 처리량 벤치마크
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "bench log")
+	{
+		TArray<FLogBenchmarkResult> Results;
+		FLogBenchmark::Run(Results);
+
+		AddLog(ELogType::System, "Log Queue Benchmark (%u messages per producer):", FLogBenchmark::DEFAULT_MESSAGES_PER_PRODUCER);
+		for (const FLogBenchmarkResult& Result : Results)
+		{
+			AddLog(ELogType::Info, "  %-24s %u thread(s) %8.2f M delivered/s %8.2f M pushed/s (dropped %llu)", Result.Name, Result.ProducerCount,
+				Result.MessagesPerSecond / 1000000.0, Result.PushesPerSecond / 1000000.0, Result.DroppedCount);
+		}
+	}
+
+	// UClass::IsChildOf / Cast 처리량 벤치마크
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "bench cast")
+	{
+		TArray<FCastBenchmarkResult> Results;
+		FCastBenchmark::Run(Results);
+
+		AddLog(ELogType::System, "Cast Benchmark (%u class pairs x %u repeats):",
+			FCastBenchmark::DEFAULT_PAIR_COUNT, FCastBenchmark::DEFAULT_REPEAT_COUNT);
+		for (const FCastBenchmarkResult& Result : Results)
+		{
+			AddLog(ELogType::Info, "  %-36s %8.2f M casts/s", Result.Name, Result.CastsPerSecond / 1000000.0);
+		}
+	}
+
+	// UObject 생성/소멸 처리량 벤치마크
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "bench spawn")
+	{
+		TArray<FSpawnBenchmarkResult> Results;
+		FSpawnBenchmark::Run(Results);
+
+		AddLog(ELogType::System, "Spawn Benchmark (%u objects x %u rounds, scattered destroy order):",
+			FSpawnBenchmark::DEFAULT_OBJECT_COUNT, FSpawnBenchmark::DEFAULT_ROUND_COUNT);
+		for (const FSpawnBenchmarkResult& Result : Results)
+		{
+			AddLog(ELogType::Info, "  %-36s %8.2f M spawn+destroy/s", Result.Name, Result.SpawnsPerSecond / 1000000.0);
+		}
+	}
+
+	// TDelegate BroadCast / 핸들러 등록 할당 벤치마크
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "bench delegate")
+	{
+		TArray<FDelegateBenchmarkResult> Results;
+		FDelegateBenchmark::Run(Results);
+
+		AddLog(ELogType::System, "Delegate Benchmark (%u AddDynamic + 1 lambda handlers, %u broadcasts):",
+			FDelegateBenchmark::DEFAULT_MEMBER_HANDLER_COUNT, FDelegateBenchmark::DEFAULT_BROADCAST_COUNT);
+		for (const FDelegateBenchmarkResult& Result : Results)
+		{
+			AddLog(ELogType::Info, "  %-36s %8.2f ns/broadcast (%llu heap allocs to bind)", Result.Name,
+				Result.NanosecondsPerBroadcast, Result.BindAllocationCount);
+		}
+	}
+
 	// shadow_filter 명령어 처리
 	else if (FString CommandLower = InCommand;
 		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
@@ -984,6 +1254,16 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  STAT PICK - Show picking performance overlay");
 		AddLog(ELogType::Info, "  STAT SHADOW - Show light and shadow map stats");
 		AddLog(ELogType::Info, "  STAT NONE - Hide all overlays");
+		AddLog(ELogType::Info, "  TRACE [frames] - Capture frame timings to Trace/*.json (open in ui.perfetto.dev)");
+		AddLog(ELogType::Info, "  HITCH [ms] - Show frame time percentiles / set hitch threshold (dumps Trace/Hitch_*.json)");
+		AddLog(ELogType::Info, "  FIXEDSTEP [hz | off | substeps <n> | interp on|off] - Fixed-step simulation with render interpolation");
+		AddLog(ELogType::Info, "  LOG RECENT [n] - Format and show the last n deferred (UE_LOG_DEFERRED) logs");
+		AddLog(ELogType::Info, "  LOG DECODE <file.ulog> - Decode a binary log to text (.txt)");
+		AddLog(ELogType::Info, "  BENCH MATH - Run vector/matrix math microbenchmarks");
+		AddLog(ELogType::Info, "  BENCH LOG - Measure log queue throughput with 1 and 8 producer threads");
+		AddLog(ELogType::Info, "  BENCH CAST - Measure UClass::IsChildOf / Cast throughput against the old SuperClass walk");
+		AddLog(ELogType::Info, "  BENCH SPAWN - Measure UObject spawn/destroy throughput (FUObjectPool vs global heap)");
+		AddLog(ELogType::Info, "  BENCH DELEGATE - Measure TDelegate broadcast cost and bind allocations against TArray<std::function>");
 		AddLog(ELogType::Info, "  SHADOW_FILTER <filter> - Apply shadow filter to all lights");
 		AddLog(ELogType::Debug, "    Available filters: VSM, PCF, UnFiltered, VSM_BOX, VSM_GAUSSIAN, SAVSM");
 		AddLog(ELogType::Debug, "    Example: shadow_filter VSM");
@@ -1049,6 +1329,11 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 		StatOverlay.ShowShadow();
 		AddLog(ELogType::Success, "Shadow overlay enabled");
 	}
+	else if (StatCommand == "draw")
+	{
+		StatOverlay.ShowDraw();
+		AddLog(ELogType::Success, "Draw overlay enabled");
+	}
 	else if (StatCommand == "all")
 	{
 		StatOverlay.ShowAll();
@@ -1062,7 +1347,7 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 	else
 	{
 		AddLog(ELogType::Error, "Unknown stat command: %s", StatCommand.data());
-		AddLog(ELogType::Info, "Available: fps, memory, pick, time, decal, shadow, all, none");
+		AddLog(ELogType::Info, "Available: fps, memory, pick, time, decal, shadow, draw, all, none");
 	}
 }
 
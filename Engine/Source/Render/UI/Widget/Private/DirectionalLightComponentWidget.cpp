@@ -346,16 +346,23 @@ void UDirectionalLightComponentWidget::RenderWidget()
         ImGui::Text("Cascade SubFrustum Number");
         ImGui::SliderInt("##CascadeSlider", &currentCascade, 0, splitNum - 1);
 
-        ImVec2 imageSize(256, 256);
-        ImVec2 startPos(0.125f * currentCascade, 0.0f);
-        ImVec2 endPos = startPos + ImVec2(
-            1.0f / (8192.0f / DirectionalLightComponent->GetShadowResolutionScale()),
-            1.0f / (8192.0f / DirectionalLightComponent->GetShadowResolutionScale())
-            );
-
-        ImGui::Image(TextureID, imageSize, startPos, endPos);
-        if (ImGui::IsItemHovered())
-            ImGui::SetTooltip("광원의 Shadow Map 출력");
+        // Atlas Packer가 이번 프레임에 할당한 Cascade 영역을 출력 (할당되지 않았으면 출력하지 않음)
+        const FShadowMapPass* ShadowMapPass = URenderer::GetInstance().GetShadowMapPass();
+        const float AtlasResolution = static_cast<float>(ShadowMapPass->GetAtlasResolution());
+        FShadowAtlasRect AtlasRect;
+        if (ShadowMapPass->GetLightAtlasRect(DirectionalLightComponent, static_cast<uint32>(currentCascade), AtlasRect))
+        {
+            ImVec2 imageSize(256, 256);
+            ImVec2 startPos(static_cast<float>(AtlasRect.X) / AtlasResolution, static_cast<float>(AtlasRect.Y) / AtlasResolution);
+            ImVec2 endPos = startPos + ImVec2(
+                static_cast<float>(AtlasRect.Size) / AtlasResolution,
+                static_cast<float>(AtlasRect.Size) / AtlasResolution
+                );
+
+            ImGui::Image(TextureID, imageSize, startPos, endPos);
+            if (ImGui::IsItemHovered())
+                ImGui::SetTooltip("광원의 Shadow Map 출력");
+        }
     }
     
     ImGui::PopStyleColor(3);
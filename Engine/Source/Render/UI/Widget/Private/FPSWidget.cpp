@@ -72,9 +72,33 @@ void UFPSWidget::RenderWidget()
 	// Details
 	if (bShowGraph)
 	{
+		const FMemoryTagStats& TotalMemory = FMemoryTracker::GetTotalStats();
 		ImGui::Text("동적 할당된 메모리 정보");
-		ImGui::Text("Overall Object Count: %u", TotalAllocationCount);
-		ImGui::Text("Overall Memory: %.3f KB", static_cast<float>(TotalAllocationBytes) / KILO);
+		ImGui::Text("Overall Object Count: %llu", TotalMemory.LiveCount);
+		ImGui::Text("Overall Memory: %.3f KB (Sampled Peak %.3f KB)", static_cast<float>(TotalMemory.LiveBytes) / KILO, static_cast<float>(TotalMemory.SampledPeakBytes) / KILO);
+		ImGui::Text("Allocation Rate: %.0f /s", TotalMemory.AllocationsPerSecond);
+
+		if (ImGui::BeginTable("MemoryTags", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+		{
+			ImGui::TableSetupColumn("Tag");
+			ImGui::TableSetupColumn("Live (KB)");
+			ImGui::TableSetupColumn("Sampled Peak (KB)");
+			ImGui::TableSetupColumn("Allocs/s");
+			ImGui::TableHeadersRow();
+
+			for (uint8 i = 0; i < static_cast<uint8>(EMemoryTag::Count); ++i)
+			{
+				const EMemoryTag Tag = static_cast<EMemoryTag>(i);
+				const FMemoryTagStats& Stats = FMemoryTracker::GetTagStats(Tag);
+
+				ImGui::TableNextRow();
+				ImGui::TableSetColumnIndex(0); ImGui::TextUnformatted(GetMemoryTagName(Tag));
+				ImGui::TableSetColumnIndex(1); ImGui::Text("%.1f", static_cast<float>(Stats.LiveBytes) / KILO);
+				ImGui::TableSetColumnIndex(2); ImGui::Text("%.1f", static_cast<float>(Stats.SampledPeakBytes) / KILO);
+				ImGui::TableSetColumnIndex(3); ImGui::Text("%.0f", Stats.AllocationsPerSecond);
+			}
+			ImGui::EndTable();
+		}
 		ImGui::Separator();
 
 		ImGui::Text("Frame Time History:");
@@ -289,23 +289,17 @@ void UPointLightComponentWidget::RenderWidget()
     ImTextureID TextureID = (ImTextureID)ShadowSRV;
     if (ShadowSRV)
     {
-        FRenderingContext RenderingContext = URenderer::GetInstance().GetRenderingContext();
-        int32 PointLightIdx = 0;
-        for (UPointLightComponent* PointLight : RenderingContext.PointLights)
-        {
-            if (PointLightComponent == PointLight)
-                break;
-            PointLightIdx++;
-        }
+        const FShadowMapPass* ShadowMapPass = URenderer::GetInstance().GetShadowMapPass();
+        const float AtlasResolution = static_cast<float>(ShadowMapPass->GetAtlasResolution());
 
-        const static int32 IDX_MAX = 8;
-        
-        if (PointLightIdx < IDX_MAX)
+        // Atlas Packer가 이번 프레임에 할당한 영역을 출력 (할당되지 않았으면 출력하지 않음)
+        FShadowAtlasRect AtlasRect;
+        if (ShadowMapPass->GetLightAtlasRect(PointLightComponent, 0, AtlasRect))
         {
             ImVec2 imageSize(256, 256);
             
             const char* faceNames[6] = { "X+", "X-", "Y+", "Y-", "Z+", "Z-" };
-            // 각 면의 UV 범위 계산 (위→아래 방향으로 6분할)
+            // 각 면은 Atlas Packer가 할당한 별도의 타일에 있다
 
             // 탭 바 시작
             if (ImGui::BeginTabBar("CubeShadowMapTabs"))
@@ -315,10 +309,11 @@ void UPointLightComponentWidget::RenderWidget()
                     if (ImGui::BeginTabItem(faceNames[faceIdx]))
                     {
                         // UV 계산 (Y축이 아래로 갈수록 증가)
-                        float uStart = 0.125f * static_cast<float>(PointLightIdx);
-                        float vStart = 0.125f * static_cast<float>(faceIdx + 2);
-                        float uEnd   = uStart + (1.0f / (8192.0f / PointLightComponent->GetShadowResolutionScale()));
-                        float vEnd   = vStart + (1.0f / (8192.0f / PointLightComponent->GetShadowResolutionScale()));
+                        ShadowMapPass->GetLightAtlasRect(PointLightComponent, faceIdx, AtlasRect);
+                        float uStart = static_cast<float>(AtlasRect.X) / AtlasResolution;
+                        float vStart = static_cast<float>(AtlasRect.Y) / AtlasResolution;
+                        float uEnd   = uStart + static_cast<float>(AtlasRect.Size) / AtlasResolution;
+                        float vEnd   = vStart + static_cast<float>(AtlasRect.Size) / AtlasResolution;
 
                         ImGui::Image(TextureID,
                                      imageSize,
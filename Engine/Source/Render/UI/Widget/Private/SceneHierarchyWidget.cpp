@@ -52,7 +52,7 @@ void USceneHierarchyWidget::RenderWidget()
 	}
 
 	// 헤더 정보
-	ImGui::Text("Level: %s", CurrentLevel->GetName().ToString().c_str());
+	ImGui::Text("Level: %s", CurrentLevel->GetName().ToStringView().data());
 	ImGui::Separator();
 
 	// 검색창 렌더링
@@ -230,7 +230,7 @@ void USceneHierarchyWidget::RenderActorInfo(AActor* InActor, int32 InIndex)
 				}
 			}
 			UE_LOG_INFO("SceneHierarchy: %s의 가시성이 %s로 변경되었습니다",
-			            ActorName.ToString().data(),
+			            ActorName.ToStringView().data(),
 			            bNewVisibility ? "Visible" : "Hidden");
 		}
 	}
@@ -344,13 +344,13 @@ void USceneHierarchyWidget::SelectActor(AActor* InActor, bool bInFocusCamera)
 {
 	UEditor* Editor = GEditor->GetEditorModule();
 	Editor->SelectActor(InActor);
-	UE_LOG("SceneHierarchy: %s를 선택했습니다", InActor->GetName().ToString().data());
+	UE_LOG("SceneHierarchy: %s를 선택했습니다", InActor->GetName().ToStringView().data());
 
 	// 카메라 포커싱은 더블 클릭에서만 수행
 	if (InActor && bInFocusCamera)
 	{
 		GEditor->GetEditorModule()->FocusOnSelectedActor();
-		UE_LOG_SUCCESS("SceneHierarchy: %s에 카메라 포커싱 완료", InActor->GetName().ToString().data());
+		UE_LOG_SUCCESS("SceneHierarchy: %s에 카메라 포커싱 완료", InActor->GetName().ToStringView().data());
 	}
 }
 
@@ -489,7 +489,7 @@ void USceneHierarchyWidget::FinishRenaming(bool bInConfirm)
 	{
 		FString NewName = FString(RenameBuffer);
 		// 빈 이름 방지 및 이름 변경 여부 확인
-		if (!NewName.empty() && NewName != RenamingActor->GetName().ToString())
+		if (!NewName.empty() && NewName != RenamingActor->GetName().ToStringView())
 		{
 			// Detail 패널과 동일한 방식 사용
 			RenamingActor->SetName(NewName);
@@ -312,26 +312,20 @@ void USpotLightComponentWidget::RenderWidget()
     ImTextureID TextureID = (ImTextureID)ShadowSRV;
     if (ShadowSRV)
     {
-        FRenderingContext RenderingContext = URenderer::GetInstance().GetRenderingContext();
-        int32 SpotLightIdx = 0;
-        for (USpotLightComponent* SpotLight : RenderingContext.SpotLights)
-        {
-            if (SpotLightComponent == SpotLight)
-                break;
-            SpotLightIdx++;
-        }
-
-        const static int32 IDX_MAX = 8;
+        const FShadowMapPass* ShadowMapPass = URenderer::GetInstance().GetShadowMapPass();
+        const float AtlasResolution = static_cast<float>(ShadowMapPass->GetAtlasResolution());
 
-        if (SpotLightIdx < IDX_MAX)
+        // Atlas Packer가 이번 프레임에 할당한 영역을 출력 (할당되지 않았으면 출력하지 않음)
+        FShadowAtlasRect AtlasRect;
+        if (ShadowMapPass->GetLightAtlasRect(SpotLightComponent, 0, AtlasRect))
         {
             // 원하는 출력 크기 설정
             ImVec2 ImageSize(256, 256); 
 
-            ImVec2 startPos(0.125f * static_cast<float>(SpotLightIdx), 0.125f);
+            ImVec2 startPos(static_cast<float>(AtlasRect.X) / AtlasResolution, static_cast<float>(AtlasRect.Y) / AtlasResolution);
             ImVec2 endPos = startPos + ImVec2(
-            1.0f / (8192.0f / SpotLightComponent->GetShadowResolutionScale()),
-            1.0f / (8192.0f / SpotLightComponent->GetShadowResolutionScale())
+            static_cast<float>(AtlasRect.Size) / AtlasResolution,
+            static_cast<float>(AtlasRect.Size) / AtlasResolution
             );
             
             // ImGui::Image(텍스처 ID, 크기, UV 시작점, UV 끝점, Tint Color, Border Color)
@@ -55,6 +55,7 @@ public:
 	// Log functions
 	void AddLog(const char* fmt, ...);
 	void AddLog(ELogType InType, const char* fmt, ...);
+	void AddFormattedLog(ELogType InType, const char* InMessage);
 	void AddSystemLog(const char* InText, bool bInIsError = false);
 	void ClearLog();
 
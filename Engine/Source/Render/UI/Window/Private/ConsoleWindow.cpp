@@ -235,6 +235,35 @@ void UConsoleWindow::AddLog(ELogType InType, const char* fmt, ...) const
 	}
 }
 
+/**
+ * @brief 이미 포맷된 메시지를 그대로 추가하는 함수 (UE_LOG 매크로가 사용)
+ * 메시지를 다시 포맷하지 않으므로 '%'가 들어 있어도 안전하고 길이 제한도 없음
+ */
+void UConsoleWindow::AddFormattedLog(ELogType InType, const char* InMessage) const
+{
+	if (ConsoleWidget)
+	{
+		ConsoleWidget->AddFormattedLog(InType, InMessage);
+	}
+}
+
+/**
+ * @brief UE_LOG 매크로의 출력 함수
+ * 호출 지점마다 인라인되던 printf와 예외 처리를 한 곳으로 모아 호출 지점의 코드 크기를 줄임
+ */
+void UConsoleWindow::WriteLog(ELogType InType, const char* InStdoutPrefix, const char* InMessage)
+{
+	printf("%s%s\n", InStdoutPrefix, InMessage);
+	try
+	{
+		GetInstance().AddFormattedLog(InType, InMessage);
+	}
+	catch (...)
+	{
+		// 콘솔 윈도우를 만들 수 없는 시점이어도 stdout 출력은 유지
+	}
+}
+
 void UConsoleWindow::AddSystemLog(const char* InText, bool bInIsError) const
 {
 	if (ConsoleWidget)
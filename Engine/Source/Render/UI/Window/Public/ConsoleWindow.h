@@ -21,6 +21,8 @@ public:
 
 	void AddLog(const char* fmt, ...) const;
 	void AddLog(ELogType InType, const char* fmt, ...) const;
+	void AddFormattedLog(ELogType InType, const char* InMessage) const;
+	static void WriteLog(ELogType InType, const char* InStdoutPrefix, const char* InMessage);
 	void AddSystemLog(const char* InText, bool bInIsError = false) const;
 
 	void Initialize() override;
@@ -0,0 +1,103 @@
+#include "pch.h"
+#include "Utility/Public/CastBenchmark.h"
+#include "Component/Public/SceneComponent.h"
+
+#include <chrono>
+
+namespace
+{
+	// 판정 결과가 최적화로 제거되지 않도록 누적
+	volatile uint64 GBenchmarkSink = 0;
+
+	template<typename TFunction>
+	double MeasureCastsPerSecond(uint64 InCastCount, TFunction&& InFunction)
+	{
+		const auto StartTime = std::chrono::steady_clock::now();
+		InFunction();
+		const auto EndTime = std::chrono::steady_clock::now();
+		return static_cast<double>(InCastCount) / std::chrono::duration<double>(EndTime - StartTime).count();
+	}
+
+	// 비교 기준: 상수 시간 조상 배열 이전의 UClass::IsChildOf
+	bool IsChildOfBySuperClassWalk(const UClass* InClass, const UClass* InTarget)
+	{
+		if (!InTarget)
+		{
+			return false;
+		}
+
+		if (InClass == InTarget)
+		{
+			return true;
+		}
+
+		for (const UClass* Current = InClass; Current; Current = Current->GetSuperClass())
+		{
+			if (Current->GetName() == InTarget->GetName())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+void FCastBenchmark::Run(TArray<FCastBenchmarkResult>& OutResults, uint32 InPairCount, uint32 InRepeatCount)
+{
+	OutResults.clear();
+
+	const TArray<UClass*> Classes = UClass::FindClasses(UObject::StaticClass());
+	if (InPairCount == 0 || InRepeatCount == 0 || Classes.empty())
+	{
+		return;
+	}
+
+	TArray<const UClass*> Sources(InPairCount);
+	TArray<const UClass*> Targets(InPairCount);
+	for (uint32 Index = 0; Index < InPairCount; ++Index)
+	{
+		Sources[Index] = Classes[rand() % Classes.size()];
+		Targets[Index] = Classes[rand() % Classes.size()];
+	}
+	const uint64 CastCount = static_cast<uint64>(InPairCount) * InRepeatCount;
+
+	OutResults.push_back({ "IsChildOf (SuperClass walk, FName)", MeasureCastsPerSecond(CastCount, [&]()
+	{
+		uint64 ChildCount = 0;
+		for (uint32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			for (uint32 Index = 0; Index < InPairCount; ++Index)
+			{
+				ChildCount += IsChildOfBySuperClassWalk(Sources[Index], Targets[Index]) ? 1 : 0;
+			}
+		}
+		GBenchmarkSink = GBenchmarkSink + ChildCount;
+	}) });
+
+	OutResults.push_back({ "IsChildOf (ancestor chain)", MeasureCastsPerSecond(CastCount, [&]()
+	{
+		uint64 ChildCount = 0;
+		for (uint32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			for (uint32 Index = 0; Index < InPairCount; ++Index)
+			{
+				ChildCount += Sources[Index]->IsChildOf(Targets[Index]) ? 1 : 0;
+			}
+		}
+		GBenchmarkSink = GBenchmarkSink + ChildCount;
+	}) });
+
+	// Cast<T>와 같은 경로: 매번 T::StaticClass()(SignUpClass 포함)를 얻은 뒤 IsChildOf
+	OutResults.push_back({ "Cast<USceneComponent> path", MeasureCastsPerSecond(CastCount, [&]()
+	{
+		uint64 ChildCount = 0;
+		for (uint32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			for (uint32 Index = 0; Index < InPairCount; ++Index)
+			{
+				ChildCount += Sources[Index]->IsChildOf(USceneComponent::StaticClass()) ? 1 : 0;
+			}
+		}
+		GBenchmarkSink = GBenchmarkSink + ChildCount;
+	}) });
+}
@@ -0,0 +1,142 @@
+#include "pch.h"
+#include "Utility/Public/DelegateBenchmark.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Global/Memory.h"
+
+#include <chrono>
+
+namespace
+{
+	using FHitResult = UPrimitiveComponent::FHitResult;
+
+	// 호출 결과가 최적화로 제거되지 않도록 누적
+	volatile uint64 GBenchmarkSink = 0;
+
+	/**
+	 * @brief AddDynamic으로 등록되는 오버랩 핸들러
+	 * TWeakObjectPtr는 UObject 배열 인덱스만 사용하므로 UClass 등록 없이 UObject를 상속한다
+	 */
+	class FOverlapListener : public UObject
+	{
+	public:
+		void OnBeginOverlap(UPrimitiveComponent*, AActor*, UPrimitiveComponent*, int32 InBodyIndex, bool, const FHitResult&)
+		{
+			CallCount += static_cast<uint64>(InBodyIndex) + 1;
+		}
+
+		uint64 CallCount = 0;
+	};
+
+	/**
+	 * @brief 비교 기준: Small buffer 최적화 이전의 TDelegate (TArray<std::function>, BroadCast 인자 값 전달)
+	 */
+	template<typename... Args>
+	class TStdFunctionDelegate
+	{
+	public:
+		using HandlerType = std::function<void(Args...)>;
+
+		void Add(const HandlerType& Handler)
+		{
+			Handlers.emplace_back(Handler);
+		}
+
+		template<typename T>
+		void AddDynamic(T* Instance, void(T::*Func)(Args...))
+		{
+			TWeakObjectPtr<T> WeakInstance(Instance);
+			HandlerType BoundHandler = [WeakInstance, Func](Args... InArgs)
+			{
+				if (WeakInstance.IsValid())
+				{
+					(WeakInstance.Get()->*Func)(InArgs...);
+				}
+			};
+			Handlers.emplace_back(std::move(BoundHandler));
+		}
+
+		void BroadCast(Args... InArgs)
+		{
+			for (const auto& Handler : Handlers)
+			{
+				if (Handler)
+				{
+					Handler(InArgs...);
+				}
+			}
+		}
+
+	private:
+		TArray<HandlerType> Handlers;
+	};
+
+	// 멤버 함수 핸들러와 람다 하나를 등록하는 동안의 전역 operator new 호출 횟수
+	template<typename TDelegateType>
+	uint64 BindHandlers(TDelegateType& InDelegate, const TArray<FOverlapListener*>& InListeners, uint64& InLambdaCallCount)
+	{
+		FMemoryTracker::Update(0.0f);
+		const uint64 AllocationsBefore = FMemoryTracker::GetTotalStats().TotalAllocations;
+
+		for (FOverlapListener* Listener : InListeners)
+		{
+			InDelegate.AddDynamic(Listener, &FOverlapListener::OnBeginOverlap);
+		}
+		InDelegate.Add([&InLambdaCallCount](UPrimitiveComponent*, AActor*, UPrimitiveComponent*, int32, bool, const FHitResult&)
+		{
+			++InLambdaCallCount;
+		});
+
+		FMemoryTracker::Update(0.0f);
+		return FMemoryTracker::GetTotalStats().TotalAllocations - AllocationsBefore;
+	}
+
+	template<typename TDelegateType>
+	FDelegateBenchmarkResult Measure(const char* InName, const TArray<FOverlapListener*>& InListeners, uint32 InBroadcastCount)
+	{
+		FDelegateBenchmarkResult Result;
+		Result.Name = InName;
+
+		uint64 LambdaCallCount = 0;
+		TDelegateType Delegate;
+		Result.BindAllocationCount = BindHandlers(Delegate, InListeners, LambdaCallCount);
+
+		const FHitResult SweepResult;
+		const auto StartTime = std::chrono::steady_clock::now();
+		for (uint32 Index = 0; Index < InBroadcastCount; ++Index)
+		{
+			Delegate.BroadCast(nullptr, nullptr, nullptr, static_cast<int32>(Index & 1), false, SweepResult);
+		}
+		const auto EndTime = std::chrono::steady_clock::now();
+
+		Result.NanosecondsPerBroadcast = std::chrono::duration<double, std::nano>(EndTime - StartTime).count() / InBroadcastCount;
+		GBenchmarkSink = GBenchmarkSink + LambdaCallCount;
+		return Result;
+	}
+}
+
+void FDelegateBenchmark::Run(TArray<FDelegateBenchmarkResult>& OutResults, uint32 InMemberHandlerCount, uint32 InBroadcastCount)
+{
+	OutResults.clear();
+	if (InBroadcastCount == 0)
+	{
+		return;
+	}
+
+	TArray<FOverlapListener*> Listeners;
+	for (uint32 Index = 0; Index < InMemberHandlerCount; ++Index)
+	{
+		Listeners.push_back(new FOverlapListener());
+	}
+
+	using FOverlapDelegate = decltype(UPrimitiveComponent::OnComponentBeginOverlap);
+	using FStdFunctionOverlapDelegate = TStdFunctionDelegate<UPrimitiveComponent*, AActor*, UPrimitiveComponent*, int32, bool, const FHitResult&>;
+
+	OutResults.push_back(Measure<FStdFunctionOverlapDelegate>("TArray<std::function>", Listeners, InBroadcastCount));
+	OutResults.push_back(Measure<FOverlapDelegate>("TDelegate (small buffer)", Listeners, InBroadcastCount));
+
+	for (FOverlapListener* Listener : Listeners)
+	{
+		GBenchmarkSink = GBenchmarkSink + Listener->CallCount;
+		delete Listener;
+	}
+}
@@ -0,0 +1,87 @@
+#include "pch.h"
+#include "Utility/Public/FrameTimeHistogram.h"
+
+void FFrameTimeHistogram::AddSample(double InMilliseconds)
+{
+	const double Microseconds = std::max(InMilliseconds, 0.0) * 1000.0 + 0.5;
+	const uint32 BucketIndex = GetBucketIndex(static_cast<uint64>(std::min(Microseconds, 1.0e12)));
+
+	if (SampleCount == WINDOW_FRAME_COUNT)
+	{
+		--BucketCounts[WindowBuckets[NextWindowIndex]];
+	}
+	else
+	{
+		++SampleCount;
+	}
+
+	++BucketCounts[BucketIndex];
+	WindowBuckets[NextWindowIndex] = static_cast<uint16>(BucketIndex);
+	NextWindowIndex = (NextWindowIndex + 1) % WINDOW_FRAME_COUNT;
+}
+
+void FFrameTimeHistogram::Reset()
+{
+	std::fill(std::begin(BucketCounts), std::end(BucketCounts), 0u);
+	NextWindowIndex = 0;
+	SampleCount = 0;
+}
+
+double FFrameTimeHistogram::GetPercentile(double InPercentile) const
+{
+	if (SampleCount == 0)
+	{
+		return 0.0;
+	}
+
+	// 올림 순위: 최소 한 개의 샘플은 포함
+	const double Clamped = std::clamp(InPercentile, 0.0, 100.0);
+	const uint32 Rank = std::max(1u, static_cast<uint32>(std::ceil(Clamped / 100.0 * SampleCount)));
+
+	uint32 Accumulated = 0;
+	for (uint32 BucketIndex = 0; BucketIndex < BUCKET_COUNT; ++BucketIndex)
+	{
+		Accumulated += BucketCounts[BucketIndex];
+		if (Accumulated >= Rank)
+		{
+			return static_cast<double>(GetBucketUpperBound(BucketIndex)) / 1000.0;
+		}
+	}
+
+	return static_cast<double>(GetBucketUpperBound(BUCKET_COUNT - 1)) / 1000.0;
+}
+
+uint32 FFrameTimeHistogram::GetBucketIndex(uint64 InMicroseconds)
+{
+	if (InMicroseconds < LINEAR_BUCKET_COUNT)
+	{
+		return static_cast<uint32>(InMicroseconds);
+	}
+
+	if (InMicroseconds >> MAX_VALUE_BITS)
+	{
+		return BUCKET_COUNT - 1;
+	}
+
+	// 최상위 비트 아래 6비트로 구간 안의 위치를 정함
+	uint32 HighestBit = 7;
+	while (InMicroseconds >> (HighestBit + 1))
+	{
+		++HighestBit;
+	}
+	const uint32 SubBucket = static_cast<uint32>(InMicroseconds >> (HighestBit - 6)) - SUB_BUCKET_COUNT;
+	return LINEAR_BUCKET_COUNT + (HighestBit - 7) * SUB_BUCKET_COUNT + SubBucket;
+}
+
+uint64 FFrameTimeHistogram::GetBucketUpperBound(uint32 InBucketIndex)
+{
+	if (InBucketIndex < LINEAR_BUCKET_COUNT)
+	{
+		return InBucketIndex;
+	}
+
+	const uint32 Offset = InBucketIndex - LINEAR_BUCKET_COUNT;
+	const uint32 HighestBit = 7 + Offset / SUB_BUCKET_COUNT;
+	const uint64 Top = SUB_BUCKET_COUNT + Offset % SUB_BUCKET_COUNT;
+	return ((Top + 1) << (HighestBit - 6)) - 1;
+}
@@ -0,0 +1,109 @@
+#include "pch.h"
+#include "Utility/Public/HitchDetector.h"
+#include "Utility/Public/Profiler.h"
+
+bool FHitchDetector::AddFrame(double InFrameMilliseconds)
+{
+	if (FrameCount < WARMUP_FRAME_COUNT)
+	{
+		++FrameCount;
+		return false;
+	}
+
+	Histogram.AddSample(InFrameMilliseconds);
+	SecondsSinceDump += InFrameMilliseconds / 1000.0;
+
+	if (ThresholdMilliseconds <= 0.0 || InFrameMilliseconds < ThresholdMilliseconds)
+	{
+		return false;
+	}
+
+	++HitchCount;
+	CollectWorstScopes();
+	if (bDumpEnabled)
+	{
+		ReportHitch(InFrameMilliseconds);
+	}
+	return true;
+}
+
+void FHitchDetector::Reset()
+{
+	Histogram.Reset();
+	LastHitchScopes.clear();
+	FrameCount = 0;
+	HitchCount = 0;
+	SecondsSinceDump = 1.0e9;
+}
+
+void FHitchDetector::CollectWorstScopes()
+{
+	TArray<FProfileNodeStats> Nodes;
+	FProfiler& Profiler = FProfiler::GetInstance();
+	Profiler.GetCallTree(Nodes);
+
+	// 호출 트리는 깊이 우선 순서이므로, 스택의 맨 위가 항상 현재 노드의 부모
+	TArray<double> SelfMilliseconds(Nodes.size());
+	TArray<size_t> Parents;
+	for (size_t Index = 0; Index < Nodes.size(); ++Index)
+	{
+		const FProfileNodeStats& Node = Nodes[Index];
+		while (!Parents.empty() && (Nodes[Parents.back()].Depth >= Node.Depth || Nodes[Parents.back()].ThreadIndex != Node.ThreadIndex))
+		{
+			Parents.pop_back();
+		}
+
+		SelfMilliseconds[Index] = Node.LastMilliseconds;
+		if (!Parents.empty())
+		{
+			SelfMilliseconds[Parents.back()] -= Node.LastMilliseconds;
+		}
+		Parents.push_back(Index);
+	}
+
+	LastHitchScopes.clear();
+	for (size_t Index = 0; Index < Nodes.size(); ++Index)
+	{
+		if (Nodes[Index].LastCallCount > 0)
+		{
+			LastHitchScopes.push_back({ Nodes[Index].Name, Profiler.GetThreadName(Nodes[Index].ThreadIndex),
+				std::max(SelfMilliseconds[Index], 0.0), Nodes[Index].LastMilliseconds });
+		}
+	}
+
+	const size_t ReportCount = std::min<size_t>(LastHitchScopes.size(), MAX_REPORTED_SCOPES);
+	std::partial_sort(LastHitchScopes.begin(), LastHitchScopes.begin() + ReportCount, LastHitchScopes.end(),
+		[](const FHitchScope& A, const FHitchScope& B) { return A.SelfMilliseconds > B.SelfMilliseconds; });
+	LastHitchScopes.resize(ReportCount);
+}
+
+void FHitchDetector::ReportHitch(double InFrameMilliseconds)
+{
+	FProfiler& Profiler = FProfiler::GetInstance();
+	UE_LOG_WARNING("Hitch: frame %llu took %.2f ms (threshold %.2f ms, p99 %.2f ms)",
+		static_cast<unsigned long long>(Profiler.GetFrameNumber()), InFrameMilliseconds, ThresholdMilliseconds,
+		Histogram.GetPercentile(99.0));
+
+	for (const FHitchScope& Scope : LastHitchScopes)
+	{
+		UE_LOG_WARNING("  [%s] %s: self %.2f ms, total %.2f ms", Scope.ThreadName, Scope.Name,
+			Scope.SelfMilliseconds, Scope.InclusiveMilliseconds);
+	}
+
+	if (SecondsSinceDump < CooldownSeconds)
+	{
+		return;
+	}
+	SecondsSinceDump = 0.0;
+
+	char FilePath[64];
+	(void)snprintf(FilePath, sizeof(FilePath), "Trace/Hitch_%llu.json", static_cast<unsigned long long>(Profiler.GetFrameNumber()));
+	if (Profiler.WriteRecentTrace(DumpSeconds, FilePath))
+	{
+		UE_LOG_SUCCESS("Hitch: last %.1f s of profiler data saved to %s", DumpSeconds, FilePath);
+	}
+	else
+	{
+		UE_LOG_ERROR("Hitch: failed to write %s", FilePath);
+	}
+}
@@ -0,0 +1,157 @@
+#include "pch.h"
+#include "Utility/Public/LogBenchmark.h"
+#include "Utility/Public/LogQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace
+{
+	constexpr const char* BENCHMARK_PREFIX = "[INFO]";
+
+	// 생산자 스레드를 동시에 출발시키고, 전부 끝날 때까지의 시간(초)을 반환
+	template<typename TProduceFunction>
+	double RunProducers(uint32 InProducerCount, TProduceFunction&& InProduce)
+	{
+		std::atomic<bool> bStart{ false };
+		TArray<std::thread> Producers;
+		for (uint32 ProducerIndex = 0; ProducerIndex < InProducerCount; ++ProducerIndex)
+		{
+			Producers.emplace_back([&bStart, &InProduce, ProducerIndex]
+			{
+				while (!bStart.load(std::memory_order_acquire))
+				{
+					std::this_thread::yield();
+				}
+				InProduce(ProducerIndex);
+			});
+		}
+
+		const auto StartTime = std::chrono::steady_clock::now();
+		bStart.store(true, std::memory_order_release);
+		for (std::thread& Producer : Producers)
+		{
+			Producer.join();
+		}
+		const auto EndTime = std::chrono::steady_clock::now();
+		return std::chrono::duration<double>(EndTime - StartTime).count();
+	}
+
+	FLogBenchmarkResult MeasureLogQueue(uint32 InProducerCount, uint32 InMessagesPerProducer, ELogQueueFullPolicy InFullPolicy)
+	{
+		FLogQueue Queue(FLogQueue::DEFAULT_CAPACITY, InFullPolicy);
+		std::atomic<bool> bStop{ false };
+		std::thread Consumer([&Queue, &bStop]
+		{
+			FString Batch;
+			Batch.reserve(128 * 1024);
+			while (true)
+			{
+				const bool bStopRequested = bStop.load(std::memory_order_acquire);
+				if (Queue.Drain(Batch, 64 * 1024) == 0 && bStopRequested)
+				{
+					break;
+				}
+				Batch.clear();
+			}
+		});
+
+		const double Seconds = RunProducers(InProducerCount, [&Queue, InMessagesPerProducer](uint32 InProducerIndex)
+		{
+			char Message[128];
+			for (uint32 Index = 0; Index < InMessagesPerProducer; ++Index)
+			{
+				(void)snprintf(Message, sizeof(Message), "Producer %u: overlap event %u between actors", InProducerIndex, Index);
+				Queue.Push(BENCHMARK_PREFIX, Message);
+			}
+		});
+
+		bStop.store(true, std::memory_order_release);
+		Consumer.join();
+
+		const uint64 PushedCount = static_cast<uint64>(InProducerCount) * InMessagesPerProducer;
+		FLogBenchmarkResult Result;
+		Result.Name = InFullPolicy == ELogQueueFullPolicy::Drop ? "FLogQueue (drop)" : "FLogQueue (block)";
+		Result.ProducerCount = InProducerCount;
+		Result.DroppedCount = Queue.GetDroppedCount();
+		Result.MessagesPerSecond = static_cast<double>(PushedCount - Result.DroppedCount) / Seconds;
+		Result.PushesPerSecond = static_cast<double>(PushedCount) / Seconds;
+		return Result;
+	}
+
+	// 비교 기준: 기존 FLogFileWriter 방식
+	FLogBenchmarkResult MeasureMutexQueue(uint32 InProducerCount, uint32 InMessagesPerProducer)
+	{
+		std::mutex QueueMutex;
+		std::condition_variable QueueCondition;
+		std::queue<FString> Queue;
+		bool bStop = false;
+
+		std::thread Consumer([&]
+		{
+			while (true)
+			{
+				std::unique_lock<std::mutex> Lock(QueueMutex);
+				QueueCondition.wait(Lock, [&] { return !Queue.empty() || bStop; });
+				if (Queue.empty() && bStop)
+				{
+					break;
+				}
+				while (!Queue.empty())
+				{
+					Queue.pop();
+				}
+			}
+		});
+
+		const double Seconds = RunProducers(InProducerCount, [&](uint32 InProducerIndex)
+		{
+			char Message[128];
+			for (uint32 Index = 0; Index < InMessagesPerProducer; ++Index)
+			{
+				(void)snprintf(Message, sizeof(Message), "Producer %u: overlap event %u between actors", InProducerIndex, Index);
+				FString FileLog = BENCHMARK_PREFIX;
+				FileLog += " ";
+				FileLog += Message;
+				{
+					std::lock_guard<std::mutex> Lock(QueueMutex);
+					Queue.push(FileLog);
+				}
+				QueueCondition.notify_one();
+			}
+		});
+
+		{
+			std::lock_guard<std::mutex> Lock(QueueMutex);
+			bStop = true;
+		}
+		QueueCondition.notify_one();
+		Consumer.join();
+
+		FLogBenchmarkResult Result;
+		Result.Name = "std::mutex + std::queue";
+		Result.ProducerCount = InProducerCount;
+		Result.MessagesPerSecond = static_cast<double>(InProducerCount) * InMessagesPerProducer / Seconds;
+		Result.PushesPerSecond = Result.MessagesPerSecond;
+		return Result;
+	}
+}
+
+void FLogBenchmark::Run(TArray<FLogBenchmarkResult>& OutResults, uint32 InMessagesPerProducer)
+{
+	OutResults.clear();
+	if (InMessagesPerProducer == 0)
+	{
+		return;
+	}
+
+	for (uint32 ProducerCount : { 1u, 8u })
+	{
+		OutResults.push_back(MeasureMutexQueue(ProducerCount, InMessagesPerProducer));
+		OutResults.push_back(MeasureLogQueue(ProducerCount, InMessagesPerProducer, ELogQueueFullPolicy::Block));
+		OutResults.push_back(MeasureLogQueue(ProducerCount, InMessagesPerProducer, ELogQueueFullPolicy::Drop));
+	}
+}
@@ -1,10 +1,11 @@
 #include "pch.h"
 #include "Utility/Public/LogFileWriter.h"
+#include "Platform/Public/PlatformTime.h"
 
 FLogFileWriter::FLogFileWriter()
 	: bShouldStop(false)
 	, bIsInitialized(false)
-	, FileHandle(INVALID_HANDLE_VALUE)
+	, FileHandle(FPlatformFile::INVALID_HANDLE)
 {
 }
 
@@ -28,18 +29,9 @@ void FLogFileWriter::Initialize()
 	// 전체 경로 생성 (Log/ + 파일명)
 	FString FullPath = "Log/" + CurrentLogFileName;
 
-	// CreateFile with async write optimization
-	FileHandle = CreateFileA(
-		FullPath.data(),
-		GENERIC_WRITE,
-		FILE_SHARE_READ,
-		nullptr,
-		CREATE_ALWAYS,
-		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
-		nullptr
-	);
-
-	if (FileHandle == INVALID_HANDLE_VALUE)
+	FileHandle = FPlatformFile::OpenWrite(FullPath);
+
+	if (FileHandle == FPlatformFile::INVALID_HANDLE)
 	{
 		return;
 	}
@@ -59,32 +51,19 @@ void FLogFileWriter::Shutdown()
 
 	// 종료 신호 전송
 	bShouldStop.store(true);
-	QueueCondition.notify_all();
 
-	// 워커 스레드가 모든 로그를 처리할 때까지 대기
+	// 워커 스레드가 모든 로그를 처리할 때까지 대기 (워커는 큐가 빌 때까지 쓰고 종료)
 	if (WorkerThread.joinable())
 	{
 		WorkerThread.join();
 	}
 
-	// 남은 로그가 있다면 마지막으로 직접 쓰기
-	if (!LogQueue.empty() && FileHandle != INVALID_HANDLE_VALUE)
-	{
-		TArray<FString> RemainingLogs;
-		while (!LogQueue.empty())
-		{
-			RemainingLogs.push_back(LogQueue.front());
-			LogQueue.pop();
-		}
-		WriteBatchToFile(RemainingLogs);
-	}
-
 	// 파일 핸들 닫기
-	if (FileHandle != INVALID_HANDLE_VALUE)
+	if (FileHandle != FPlatformFile::INVALID_HANDLE)
 	{
-		FlushFileBuffers(FileHandle);
-		CloseHandle(FileHandle);
-		FileHandle = INVALID_HANDLE_VALUE;
+		FPlatformFile::Flush(FileHandle);
+		FPlatformFile::Close(FileHandle);
+		FileHandle = FPlatformFile::INVALID_HANDLE;
 	}
 
 	bIsInitialized.store(false);
@@ -97,136 +76,107 @@ void FLogFileWriter::AddLog(const FString& InLog)
 		return;
 	}
 
+	LogQueue.Push("", InLog.c_str());
+}
+
+void FLogFileWriter::AddLog(const char* InPrefix, const char* InMessage)
+{
+	if (!bIsInitialized.load(std::memory_order_relaxed))
 	{
-		std::lock_guard<std::mutex> Lock(QueueMutex);
-		LogQueue.push(InLog);
+		return;
 	}
 
-	QueueCondition.notify_one();
+	LogQueue.Push(InPrefix, InMessage);
 }
 
 void FLogFileWriter::WorkerThreadFunc()
 {
-	TArray<FString> Batch;
-	Batch.reserve(BatchSize);
+	MEMORY_TAG_SCOPE(Log)
+	FString Batch;
+	Batch.reserve(BatchBytes + FLogQueue::MAX_MESSAGE_LENGTH * 2);
+	uint64 ReportedDroppedCount = 0;
 
-	while (!bShouldStop.load() || !LogQueue.empty())
+	while (true)
 	{
-		{
-			std::unique_lock<std::mutex> Lock(QueueMutex);
-			QueueCondition.wait(Lock, [this]
-			{
-				return !LogQueue.empty() || bShouldStop.load();
-			});
+		// 종료 신호를 먼저 읽어야, 신호 이후 비어 있음을 확인한 뒤에만 종료함
+		const bool bStopRequested = bShouldStop.load();
+		const uint32 RecordCount = LogQueue.Drain(Batch, BatchBytes);
 
-			while (!LogQueue.empty() && Batch.size() < BatchSize)
-			{
-				Batch.push_back(std::move(LogQueue.front()));
-				LogQueue.pop();
-			}
+		const uint64 DroppedCount = LogQueue.GetDroppedCount();
+		if (DroppedCount != ReportedDroppedCount)
+		{
+			char Notice[96];
+			(void)snprintf(Notice, sizeof(Notice), "[LogFileWriter] %llu messages dropped (queue full)\r\n",
+				static_cast<unsigned long long>(DroppedCount - ReportedDroppedCount));
+			Batch += Notice;
+			ReportedDroppedCount = DroppedCount;
 		}
 
-		if (!Batch.empty())
+		// 버퍼가 찼거나 큐가 비었을 때 한 번에 쓰기
+		if (!Batch.empty() && (Batch.size() >= BatchBytes || RecordCount == 0))
 		{
 			WriteBatchToFile(Batch);
 			Batch.clear();
 		}
-	}
-}
 
-void FLogFileWriter::CreateLogDirectory()
-{
-	DWORD Attributes = GetFileAttributesA("Log");
-
-	// 폴더가 존재하지 않거나 파일인 경우
-	if (Attributes == INVALID_FILE_ATTRIBUTES)
-	{
-		// 폴더 생성
-		if (!CreateDirectoryA("Log", nullptr))
+		if (RecordCount == 0)
 		{
-			DWORD Error = GetLastError();
-			if (Error != ERROR_ALREADY_EXISTS)
+			if (bStopRequested)
 			{
-				return;
+				break;
 			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(IdleSleepMilliseconds));
 		}
 	}
-	else if (!(Attributes & FILE_ATTRIBUTE_DIRECTORY))
-	{
-		return;
-	}
 }
 
-void FLogFileWriter::CleanupOldLogFiles()
+void FLogFileWriter::CreateLogDirectory()
 {
-	WIN32_FIND_DATAA FindData;
-	HANDLE hFind = FindFirstFileA("Log\\*.log", &FindData);
-
-	if (hFind == INVALID_HANDLE_VALUE)
-	{
-		return;
-	}
-
-	TArray<FString> LogFiles;
+	// 이미 있으면 아무것도 하지 않으며, 같은 이름의 파일이 있으면 실패한 채로 둠 (이후 OpenWrite가 실패)
+	std::error_code ErrorCode;
+	std::filesystem::create_directory("Log", ErrorCode);
+}
 
-	do
+void FLogFileWriter::CleanupOldLogFiles()
+{
+	std::error_code ErrorCode;
+	TArray<std::filesystem::path> LogFiles;
+	for (const auto& Entry : std::filesystem::directory_iterator("Log", ErrorCode))
 	{
-		if (!(FindData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+		if (Entry.is_regular_file() && Entry.path().extension() == ".log")
 		{
-			LogFiles.emplace_back(FindData.cFileName);
+			LogFiles.push_back(Entry.path());
 		}
 	}
-	while (FindNextFileA(hFind, &FindData));
-
-	FindClose(hFind);
 
+	// 파일명이 시각 순이므로 이름순 정렬 후 오래된 것부터 삭제 (새로 만들 파일 자리를 남김)
 	std::sort(LogFiles.begin(), LogFiles.end());
-
-	while (LogFiles.size() >= MaxLogFiles)
+	for (size_t Index = 0; Index + MaxLogFiles <= LogFiles.size(); ++Index)
 	{
-		FString FileToDelete = "Log\\" + LogFiles.front();
-		DeleteFileA(FileToDelete.c_str());
-		LogFiles.erase(LogFiles.begin());
+		std::filesystem::remove(LogFiles[Index], ErrorCode);
 	}
 }
 
 FString FLogFileWriter::GenerateLogFileName()
 {
-	SYSTEMTIME LocalTime;
-	GetLocalTime(&LocalTime);
+	const FPlatformDateTime LocalTime = FPlatformTime::GetLocalDateTime();
 
 	char FileName[256];
-	(void)sprintf_s(FileName, sizeof(FileName), "%04d-%02d-%02d_%02d-%02d-%02d.log",
-		LocalTime.wYear, LocalTime.wMonth, LocalTime.wDay,
-		LocalTime.wHour, LocalTime.wMinute, LocalTime.wSecond);
+	(void)snprintf(FileName, sizeof(FileName), "%04d-%02d-%02d_%02d-%02d-%02d.log",
+		LocalTime.Year, LocalTime.Month, LocalTime.Day,
+		LocalTime.Hour, LocalTime.Minute, LocalTime.Second);
 
 	return FString(FileName);
 }
 
-void FLogFileWriter::WriteBatchToFile(const TArray<FString>& InBatch) const
+void FLogFileWriter::WriteBatchToFile(const FString& InBatch) const
 {
-	if (FileHandle == INVALID_HANDLE_VALUE || InBatch.empty())
+	if (FileHandle == FPlatformFile::INVALID_HANDLE || InBatch.empty())
 	{
 		return;
 	}
 
-	FString CombinedLog;
-	CombinedLog.reserve(InBatch.size() * 128);
-
-	for (const auto& Log : InBatch)
-	{
-		CombinedLog += Log;
-		CombinedLog += "\r\n";
-	}
-
-	DWORD BytesWritten = 0;
-	WriteFile(
-		FileHandle,
-		CombinedLog.c_str(),
-		static_cast<DWORD>(CombinedLog.size()),
-		&BytesWritten,
-		nullptr
-	);
-
-	FlushFileBuffers(FileHandle);
+	// 레코드는 이미 "\r\n"으로 끝나므로 그대로 씀
+	// Write 이후 데이터는 OS 캐시에 있어 프로세스가 비정상 종료돼도 남으므로, 디스크 동기화(Flush)는 Shutdown에서만 수행
+	FPlatformFile::Write(FileHandle, InBatch.data(), InBatch.size());
 }
@@ -0,0 +1,156 @@
+#include "pch.h"
+#include "Utility/Public/LogFormat.h"
+
+namespace LogFormat
+{
+	FMessageBuffer::~FMessageBuffer()
+	{
+		if (Data != InlineData)
+		{
+			delete[] Data;
+		}
+	}
+
+	void FMessageBuffer::Append(const char* InData, size_t InLength)
+	{
+		if (Length + InLength >= Capacity)
+		{
+			Reserve(Length + InLength + 1);
+		}
+		memcpy(Data + Length, InData, InLength);
+		Length += InLength;
+		Data[Length] = '\0';
+	}
+
+	void FMessageBuffer::Reserve(size_t InCapacity)
+	{
+		if (InCapacity <= Capacity)
+		{
+			return;
+		}
+
+		// malloc 대신 overloading 함수의 영향을 받을 수 있도록 new 할당 사용
+		const size_t NewCapacity = std::max(InCapacity, Capacity * 2);
+		char* NewData = new char[NewCapacity];
+		memcpy(NewData, Data, Length + 1);
+		if (Data != InlineData)
+		{
+			delete[] Data;
+		}
+		Data = NewData;
+		Capacity = NewCapacity;
+	}
+
+	void AppendInteger(FMessageBuffer& OutBuffer, const FSegment& InSegment, long long InSigned, unsigned long long InUnsigned)
+	{
+		if (InSegment.Conversion == 'c')
+		{
+			if (InSegment.bIsPlain && InSegment.Spec[1] == 'c')
+			{
+				OutBuffer.Append(static_cast<char>(InSigned));
+			}
+			else
+			{
+				OutBuffer.AppendPrintf(InSegment.Spec, static_cast<int>(InSigned));
+			}
+			return;
+		}
+
+		const bool bIsSigned = InSegment.Conversion == 'd' || InSegment.Conversion == 'i';
+
+		// 정밀도가 있는 정수(%.3d)는 0 채우기 규칙이 있으므로 snprintf 사용
+		if (!InSegment.bIsPlain || InSegment.Precision >= 0)
+		{
+			if (bIsSigned)
+			{
+				OutBuffer.AppendPrintf(InSegment.Spec, InSigned);
+			}
+			else
+			{
+				OutBuffer.AppendPrintf(InSegment.Spec, InUnsigned);
+			}
+			return;
+		}
+
+		char Digits[24];
+		std::to_chars_result Result;
+		switch (InSegment.Conversion)
+		{
+		case 'x':
+		case 'X':
+			Result = std::to_chars(Digits, Digits + sizeof(Digits), InUnsigned, 16);
+			break;
+		case 'o':
+			Result = std::to_chars(Digits, Digits + sizeof(Digits), InUnsigned, 8);
+			break;
+		case 'u':
+			Result = std::to_chars(Digits, Digits + sizeof(Digits), InUnsigned);
+			break;
+		default:
+			Result = std::to_chars(Digits, Digits + sizeof(Digits), InSigned);
+			break;
+		}
+
+		if (InSegment.Conversion == 'X')
+		{
+			for (char* Character = Digits; Character != Result.ptr; ++Character)
+			{
+				if (*Character >= 'a' && *Character <= 'f')
+				{
+					*Character = static_cast<char>(*Character - 'a' + 'A');
+				}
+			}
+		}
+
+		OutBuffer.Append(Digits, static_cast<size_t>(Result.ptr - Digits));
+	}
+
+	void AppendFloat(FMessageBuffer& OutBuffer, const FSegment& InSegment, double InValue)
+	{
+		// %f, %.Nf만 빠른 경로 (printf의 기본 정밀도 6과 같은 결과)
+		if (InSegment.bIsPlain && InSegment.Conversion == 'f' && InSegment.Precision <= 17 && std::isfinite(InValue))
+		{
+			char Digits[64];
+			const int Precision = InSegment.Precision >= 0 ? InSegment.Precision : 6;
+			const std::to_chars_result Result = std::to_chars(Digits, Digits + sizeof(Digits), InValue, std::chars_format::fixed, Precision);
+			if (Result.ec == std::errc())
+			{
+				OutBuffer.Append(Digits, static_cast<size_t>(Result.ptr - Digits));
+				return;
+			}
+		}
+
+		OutBuffer.AppendPrintf(InSegment.Spec, InValue);
+	}
+
+	void AppendString(FMessageBuffer& OutBuffer, const FSegment& InSegment, const char* InString, size_t InLength)
+	{
+		if (InSegment.Conversion == 'p')
+		{
+			OutBuffer.AppendPrintf(InSegment.Spec, static_cast<const void*>(InString));
+			return;
+		}
+
+		// 정밀도(%.Ns)는 최대 길이
+		if (InSegment.Precision >= 0)
+		{
+			InLength = strnlen(InString, std::min<size_t>(InLength, static_cast<size_t>(InSegment.Precision)));
+		}
+
+		if (InSegment.bIsPlain)
+		{
+			OutBuffer.Append(InString, InLength);
+			return;
+		}
+
+		// 폭 지정(%-20s)은 snprintf로 처리하되, FString은 널 종료가 아닐 수 있으므로 길이를 정밀도로 넘김 ("%-20.*s")
+		char Spec[MAX_SPEC_LENGTH];
+		size_t SpecLength = 0;
+		for (const char* Character = InSegment.Spec; *Character != '.' && *Character != 's'; ++Character)
+		{
+			Spec[SpecLength++] = *Character;
+		}
+		memcpy(Spec + SpecLength, ".*s", 4);
+		OutBuffer.AppendPrintf(Spec, static_cast<int>(InLength), InString);
+	}
+}
@@ -0,0 +1,159 @@
+#include "pch.h"
+#include "Utility/Public/LogQueue.h"
+
+#include <thread>
+
+FLogQueue::FLogQueue(uint32 InCapacity, ELogQueueFullPolicy InFullPolicy)
+	: Capacity(InCapacity)
+	, FullPolicy(InFullPolicy)
+{
+	assert(InCapacity >= MAX_MESSAGE_LENGTH * 4 && (InCapacity & (InCapacity - 1)) == 0 && "Capacity must be a power of two");
+
+	// 헤더가 0이면 미공개 레코드로 보므로 아레나 전체를 0으로 시작
+	Arena = reinterpret_cast<uint8*>(new uint64[Capacity / sizeof(uint64)]());
+}
+
+FLogQueue::~FLogQueue()
+{
+	delete[] reinterpret_cast<uint64*>(Arena);
+}
+
+bool FLogQueue::Push(const char* InPrefix, const char* InMessage)
+{
+	const uint32 PrefixLength = static_cast<uint32>(strlen(InPrefix));
+	const uint32 MessageLength = static_cast<uint32>(std::min<size_t>(strlen(InMessage), MAX_MESSAGE_LENGTH));
+	const uint32 SeparatorLength = PrefixLength > 0 ? 1 : 0;
+	const uint32 Length = PrefixLength + SeparatorLength + MessageLength + 2;
+
+	uint32 RecordSize = 0;
+	FRecordHeader* Header = Reserve(Length, RecordSize);
+	if (!Header)
+	{
+		return false;
+	}
+
+	// "Prefix Message\r\n"(Prefix가 비었으면 "Message\r\n")을 헤더 바로 뒤에 복사
+	char* Text = reinterpret_cast<char*>(Header + 1);
+	memcpy(Text, InPrefix, PrefixLength);
+	if (SeparatorLength > 0)
+	{
+		Text[PrefixLength] = ' ';
+	}
+	memcpy(Text + PrefixLength + SeparatorLength, InMessage, MessageLength);
+	Text[Length - 2] = '\r';
+	Text[Length - 1] = '\n';
+
+	Publish(Header, Length, RecordSize);
+	return true;
+}
+
+bool FLogQueue::PushBytes(const void* InData, uint32 InSize)
+{
+	if (InSize == 0 || InSize > MAX_MESSAGE_LENGTH)
+	{
+		return false;
+	}
+
+	uint32 RecordSize = 0;
+	FRecordHeader* Header = Reserve(InSize, RecordSize);
+	if (!Header)
+	{
+		return false;
+	}
+
+	memcpy(static_cast<void*>(Header + 1), InData, InSize);
+	Publish(Header, InSize, RecordSize);
+	return true;
+}
+
+uint32 FLogQueue::Drain(FString& OutBuffer, size_t InMaxBytes)
+{
+	const uint64 Start = ReadCursor.load(std::memory_order_relaxed);
+	uint64 Read = Start;
+	uint32 RecordCount = 0;
+
+	while (OutBuffer.size() < InMaxBytes)
+	{
+		FRecordHeader* Header = GetHeader(Read);
+		const uint32 Size = Header->Size.load(std::memory_order_acquire);
+		if (Size == 0)
+		{
+			break;
+		}
+
+		const uint32 RecordSize = Size & ~PADDING_FLAG;
+		if (!(Size & PADDING_FLAG))
+		{
+			OutBuffer.append(reinterpret_cast<const char*>(Header + 1), Header->Length);
+			++RecordCount;
+		}
+
+		// 다음 바퀴에서 레코드 경계가 달라지므로 헤더뿐 아니라 레코드 전체를 비움
+		memset(static_cast<void*>(Header), 0, RecordSize);
+		Read += RecordSize;
+	}
+
+	if (Read != Start)
+	{
+		ReadCursor.store(Read, std::memory_order_release);
+	}
+	return RecordCount;
+}
+
+FLogQueue::FRecordHeader* FLogQueue::Reserve(uint32 InLength, uint32& OutRecordSize)
+{
+	const uint32 RecordSize = (sizeof(FRecordHeader) + InLength + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+
+	// 공간 예약: 아레나 끝을 넘으면 끝까지를 패딩으로 함께 예약
+	uint64 Write = WriteCursor.load(std::memory_order_relaxed);
+	uint32 PaddingSize = 0;
+	bool bHasBlocked = false;
+	while (true)
+	{
+		const uint32 Offset = static_cast<uint32>(Write & (Capacity - 1));
+		PaddingSize = Offset + RecordSize > Capacity ? Capacity - Offset : 0;
+
+		if (Write + PaddingSize + RecordSize - ReadCursor.load(std::memory_order_acquire) > Capacity)
+		{
+			if (FullPolicy.load(std::memory_order_relaxed) == ELogQueueFullPolicy::Drop)
+			{
+				DroppedCount.fetch_add(1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			if (!bHasBlocked)
+			{
+				BlockedCount.fetch_add(1, std::memory_order_relaxed);
+				bHasBlocked = true;
+			}
+			std::this_thread::yield();
+			Write = WriteCursor.load(std::memory_order_relaxed);
+			continue;
+		}
+
+		if (WriteCursor.compare_exchange_weak(Write, Write + PaddingSize + RecordSize, std::memory_order_relaxed))
+		{
+			break;
+		}
+	}
+
+	if (PaddingSize > 0)
+	{
+		GetHeader(Write)->Size.store(PaddingSize | PADDING_FLAG, std::memory_order_release);
+		Write += PaddingSize;
+	}
+
+	OutRecordSize = RecordSize;
+	return GetHeader(Write);
+}
+
+void FLogQueue::Publish(FRecordHeader* InHeader, uint32 InLength, uint32 InRecordSize)
+{
+	InHeader->Length = InLength;
+	InHeader->Size.store(InRecordSize, std::memory_order_release);
+}
+
+FLogQueue::FRecordHeader* FLogQueue::GetHeader(uint64 InCursor) const
+{
+	return reinterpret_cast<FRecordHeader*>(Arena + (InCursor & (Capacity - 1)));
+}
@@ -0,0 +1,195 @@
+#include "pch.h"
+#include "Utility/Public/MathBenchmark.h"
+#include "Physics/Public/AABB.h"
+
+#include <chrono>
+
+namespace
+{
+	// 결과를 사용하지 않는 연산이 최적화로 제거되지 않도록 누적
+	volatile float GBenchmarkSink = 0.0f;
+
+	template<typename TFunction>
+	double MeasureNanosecondsPerOp(uint64 InOpCount, TFunction&& InFunction)
+	{
+		const auto StartTime = std::chrono::steady_clock::now();
+		InFunction();
+		const auto EndTime = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(EndTime - StartTime).count() / static_cast<double>(InOpCount);
+	}
+
+	float RandomFloat(float InMin, float InMax)
+	{
+		return InMin + (InMax - InMin) * (static_cast<float>(rand()) / static_cast<float>(RAND_MAX));
+	}
+
+	// 비교 기준: 8개 코너를 각각 변환한 뒤 최소/최대를 구하는 방식
+	FAABB TransformAABBByCorners(const FAABB& InBox, const FMatrix& InMatrix)
+	{
+		FVector WorldMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+		FVector WorldMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const FVector LocalCorner((Corner & 1) ? InBox.Max.X : InBox.Min.X,
+				(Corner & 2) ? InBox.Max.Y : InBox.Min.Y,
+				(Corner & 4) ? InBox.Max.Z : InBox.Min.Z);
+			const FVector WorldCorner = InMatrix.TransformPosition(LocalCorner);
+			WorldMin = FVector(std::min(WorldMin.X, WorldCorner.X), std::min(WorldMin.Y, WorldCorner.Y), std::min(WorldMin.Z, WorldCorner.Z));
+			WorldMax = FVector(std::max(WorldMax.X, WorldCorner.X), std::max(WorldMax.Y, WorldCorner.Y), std::max(WorldMax.Z, WorldCorner.Z));
+		}
+		return FAABB(WorldMin, WorldMax);
+	}
+}
+
+void FMathBenchmark::Run(TArray<FMathBenchmarkResult>& OutResults, uint32 InElementCount, uint32 InRepeatCount)
+{
+	OutResults.clear();
+	if (InElementCount == 0 || InRepeatCount == 0)
+	{
+		return;
+	}
+
+	TArray<FVector> Positions(InElementCount);
+	TArray<FVector> Transformed(InElementCount);
+	TArray<FVector4> Vectors4(InElementCount);
+	TArray<FMatrix> Matrices(InElementCount);
+	TArray<FAABB> Boxes(InElementCount);
+	TArray<FAABB> TransformedBoxes(InElementCount);
+	for (uint32 Index = 0; Index < InElementCount; ++Index)
+	{
+		Positions[Index] = FVector(RandomFloat(-100.0f, 100.0f), RandomFloat(-100.0f, 100.0f), RandomFloat(-100.0f, 100.0f));
+		Vectors4[Index] = FVector4(Positions[Index], 1.0f);
+		Matrices[Index] = FMatrix::GetModelMatrix(Positions[Index],
+			FVector(RandomFloat(-180.0f, 180.0f), RandomFloat(-90.0f, 90.0f), RandomFloat(-180.0f, 180.0f)),
+			FVector(RandomFloat(0.5f, 2.0f), RandomFloat(0.5f, 2.0f), RandomFloat(0.5f, 2.0f)));
+		Boxes[Index] = FAABB(Positions[Index], Positions[Index] + FVector(RandomFloat(0.1f, 10.0f), RandomFloat(0.1f, 10.0f), RandomFloat(0.1f, 10.0f)));
+	}
+	const FMatrix Transform = Matrices[0];
+	const uint64 OpCount = static_cast<uint64>(InElementCount) * InRepeatCount;
+
+	OutResults.push_back({ "FVector Add/Sub/Scale", MeasureNanosecondsPerOp(OpCount, [&]()
+	{
+		FVector Sum;
+		for (uint32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			for (const FVector& Position : Positions)
+			{
+				Sum += (Position - Sum) * 0.5f;
+			}
+		}
+		GBenchmarkSink = GBenchmarkSink + Sum.X;
+	}) });
+
+	OutResults.push_back({ "FVector Dot/Cross", MeasureNanosecondsPerOp(OpCount, [&]()
+	{
+		FVector Axis(0.0f, 0.0f, 1.0f);
+		float Sum = 0.0f;
+		for (uint32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			for (const FVector& Position : Positions)
+			{
+				Sum += Position.Dot(Axis);
+				Axis = Position.Cross(Axis) * 0.001f + Axis;
+			}
+		}
+		GBenchmarkSink = GBenchmarkSink + Sum + Axis.X;
+	}) });
+
+	OutResults.push_back({ "FVector4 * FMatrix", MeasureNanosecondsPerOp(OpCount, [&]()
+	{
+		FVector4 Sum;
+		for (uint32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			for (const FVector4& Vector : Vectors4)
+			{
+				Sum += Vector * Transform;
+			}
+		}
+		GBenchmarkSink = GBenchmarkSink + Sum.X;
+	}) });
+
+	OutResults.push_back({ "FMatrix::TransformPosition", MeasureNanosecondsPerOp(OpCount, [&]()
+	{
+		for (uint32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			for (uint32 Index = 0; Index < InElementCount; ++Index)
+			{
+				Transformed[Index] = Transform.TransformPosition(Positions[Index]);
+			}
+		}
+		GBenchmarkSink = GBenchmarkSink + Transformed[InElementCount - 1].X;
+	}) });
+
+	OutResults.push_back({ "FMatrix::TransformPositions (batch)", MeasureNanosecondsPerOp(OpCount, [&]()
+	{
+		for (uint32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			Transform.TransformPositions(Positions.data(), Transformed.data(), InElementCount);
+		}
+		GBenchmarkSink = GBenchmarkSink + Transformed[InElementCount - 1].X;
+	}) });
+
+	OutResults.push_back({ "FAABB Transform (8 corners)", MeasureNanosecondsPerOp(OpCount, [&]()
+	{
+		for (uint32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			for (uint32 Index = 0; Index < InElementCount; ++Index)
+			{
+				TransformedBoxes[Index] = TransformAABBByCorners(Boxes[Index], Matrices[Index]);
+			}
+		}
+		GBenchmarkSink = GBenchmarkSink + TransformedBoxes[InElementCount - 1].Max.X;
+	}) });
+
+	OutResults.push_back({ "FAABB::TransformBy", MeasureNanosecondsPerOp(OpCount, [&]()
+	{
+		for (uint32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			for (uint32 Index = 0; Index < InElementCount; ++Index)
+			{
+				TransformedBoxes[Index] = Boxes[Index].TransformBy(Matrices[Index]);
+			}
+		}
+		GBenchmarkSink = GBenchmarkSink + TransformedBoxes[InElementCount - 1].Max.X;
+	}) });
+
+	OutResults.push_back({ "FAABB::TransformBy (batch)", MeasureNanosecondsPerOp(OpCount, [&]()
+	{
+		for (uint32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			FAABB::TransformBy(Transform, Boxes.data(), TransformedBoxes.data(), InElementCount);
+		}
+		GBenchmarkSink = GBenchmarkSink + TransformedBoxes[InElementCount - 1].Max.X;
+	}) });
+
+	// 행렬 연산은 원소당 비용이 크므로 반복 횟수를 줄여 측정
+	const uint32 MatrixRepeatCount = InRepeatCount / 16 > 0 ? InRepeatCount / 16 : 1;
+	const uint64 MatrixOpCount = static_cast<uint64>(InElementCount) * MatrixRepeatCount;
+
+	OutResults.push_back({ "FMatrix * FMatrix", MeasureNanosecondsPerOp(MatrixOpCount, [&]()
+	{
+		FMatrix Product = FMatrix::Identity();
+		for (uint32 Repeat = 0; Repeat < MatrixRepeatCount; ++Repeat)
+		{
+			for (const FMatrix& Matrix : Matrices)
+			{
+				Product = Matrix * Product;
+				Product.Data[3][3] = 1.0f;
+			}
+		}
+		GBenchmarkSink = GBenchmarkSink + Product.Data[0][0];
+	}) });
+
+	OutResults.push_back({ "FMatrix::Inverse", MeasureNanosecondsPerOp(MatrixOpCount, [&]()
+	{
+		float Sum = 0.0f;
+		for (uint32 Repeat = 0; Repeat < MatrixRepeatCount; ++Repeat)
+		{
+			for (const FMatrix& Matrix : Matrices)
+			{
+				Sum += Matrix.Inverse().Data[3][0];
+			}
+		}
+		GBenchmarkSink = GBenchmarkSink + Sum;
+	}) });
+}
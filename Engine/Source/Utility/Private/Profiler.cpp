@@ -0,0 +1,373 @@
+#include "pch.h"
+#include "Utility/Public/Profiler.h"
+
+namespace
+{
+	constexpr uint32 ROOT_NODE = 0;
+	constexpr uint32 INVALID_NODE = 0xFFFFFFFFu;
+}
+
+thread_local FProfiler::FThreadState* FProfiler::CurrentThreadState = nullptr;
+
+TStatId::TStatId(const char* InName)
+	: Index(FProfiler::GetInstance().RegisterStat(InName))
+{
+}
+
+uint32 FProfiler::RegisterStat(const char* InName)
+{
+	std::lock_guard<std::mutex> Lock(RegisterMutex);
+
+	const uint32 Count = StatCount.load(std::memory_order_relaxed);
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		if (strcmp(StatNames[Index], InName) == 0)
+		{
+			return Index;
+		}
+	}
+
+	if (Count >= MAX_STATS)
+	{
+		return TStatId::INVALID_INDEX;
+	}
+
+	StatNames[Count] = InName;
+	StatCount.store(Count + 1, std::memory_order_release);
+	return Count;
+}
+
+const char* FProfiler::GetStatName(uint32 InStatIndex) const
+{
+	return InStatIndex < StatCount.load(std::memory_order_acquire) ? StatNames[InStatIndex] : "Unknown";
+}
+
+void FProfiler::SetCurrentThreadName(const char* InName)
+{
+	GetCurrentThreadState().Name = InName;
+}
+
+const char* FProfiler::GetThreadName(uint32 InThreadIndex) const
+{
+	return InThreadIndex < ThreadCount.load(std::memory_order_acquire) ? Threads[InThreadIndex]->Name : "Unknown";
+}
+
+uint32 FProfiler::BeginScope(TStatId InStatId)
+{
+	if (!InStatId.IsValid())
+	{
+		return INVALID_NODE;
+	}
+
+	FThreadState& State = GetCurrentThreadState();
+	const uint32 NodeIndex = FindOrAddChild(State, State.CurrentNode, InStatId.Index);
+	if (NodeIndex != INVALID_NODE)
+	{
+		State.CurrentNode = NodeIndex;
+	}
+	return NodeIndex;
+}
+
+void FProfiler::EndScope(uint32 InNodeIndex, uint64 InStartCycles, uint64 InEndCycles)
+{
+	if (InNodeIndex == INVALID_NODE)
+	{
+		return;
+	}
+
+	FThreadState& State = GetCurrentThreadState();
+	State.CurrentNode = State.Nodes[InNodeIndex].Parent;
+
+	const uint64 WriteIndex = State.WriteIndex.load(std::memory_order_relaxed);
+	if (WriteIndex - State.ReadIndex.load(std::memory_order_acquire) >= EVENT_BUFFER_SIZE)
+	{
+		State.DroppedEvents.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	FScopeEvent& Event = State.Events[WriteIndex & (EVENT_BUFFER_SIZE - 1)];
+	Event.StartCycles = InStartCycles;
+	Event.EndCycles = InEndCycles;
+	Event.NodeIndex = InNodeIndex;
+	State.WriteIndex.store(WriteIndex + 1, std::memory_order_release);
+}
+
+void FProfiler::EndFrame()
+{
+	const bool bRecordTrace = TraceFramesRemaining > 0;
+	if (RecentEvents.empty())
+	{
+		RecentEvents.resize(RECENT_EVENT_BUFFER_SIZE);
+	}
+
+	const uint32 NumThreads = ThreadCount.load(std::memory_order_acquire);
+	for (uint32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		FThreadState& State = *Threads[ThreadIndex];
+
+		// 이벤트보다 노드가 먼저 공개되므로, 이벤트를 읽기 전에 노드 수를 맞춰둔다
+		const uint64 WriteIndex = State.WriteIndex.load(std::memory_order_acquire);
+		State.Histories.resize(State.NodeCount.load(std::memory_order_acquire));
+
+		for (uint64 ReadIndex = State.ReadIndex.load(std::memory_order_relaxed); ReadIndex < WriteIndex; ++ReadIndex)
+		{
+			const FScopeEvent& Event = State.Events[ReadIndex & (EVENT_BUFFER_SIZE - 1)];
+			FNodeHistory& History = State.Histories[Event.NodeIndex];
+			History.FrameCycles += Event.EndCycles - Event.StartCycles;
+			++History.FrameCallCount;
+
+			const FTraceEvent TraceEvent = { Event.StartCycles, Event.EndCycles, State.Nodes[Event.NodeIndex].StatIndex, ThreadIndex };
+			RecentEvents[RecentWriteIndex++ & (RECENT_EVENT_BUFFER_SIZE - 1)] = TraceEvent;
+			if (bRecordTrace)
+			{
+				TraceEvents.push_back(TraceEvent);
+			}
+		}
+		State.ReadIndex.store(WriteIndex, std::memory_order_release);
+
+		// 이번 프레임에 호출된 노드만 기록에 추가
+		for (FNodeHistory& History : State.Histories)
+		{
+			History.LastMilliseconds = FPlatformTime::ToMilliseconds(History.FrameCycles);
+			History.LastCallCount = History.FrameCallCount;
+			if (History.FrameCallCount > 0)
+			{
+				History.Samples[History.NextSample] = static_cast<float>(History.LastMilliseconds);
+				History.NextSample = (History.NextSample + 1) % HISTORY_FRAME_COUNT;
+				History.SampleCount = std::min(History.SampleCount + 1, HISTORY_FRAME_COUNT);
+			}
+			History.FrameCycles = 0;
+			History.FrameCallCount = 0;
+		}
+	}
+
+	++FrameNumber;
+
+	if (bRecordTrace && --TraceFramesRemaining == 0)
+	{
+		if (WriteTraceFile(TraceFilePath, TraceEvents, TraceStartCycles))
+		{
+			UE_LOG_SUCCESS("Profiler: %u frames, %zu events saved to %s", TraceFrameCount, TraceEvents.size(), TraceFilePath.c_str());
+		}
+		else
+		{
+			UE_LOG_ERROR("Profiler: failed to write trace file %s", TraceFilePath.c_str());
+		}
+		TArray<FTraceEvent>().swap(TraceEvents);
+	}
+
+	// 캡처는 요청 직후의 프레임 경계에서 시작해, 요청 전에 열린 구간이 섞이지 않도록 함
+	if (bTraceCapturePending)
+	{
+		bTraceCapturePending = false;
+		TraceFramesRemaining = TraceFrameCount;
+		TraceStartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+bool FProfiler::BeginTraceCapture(uint32 InFrameCount, const FString& InFilePath)
+{
+	if (InFrameCount == 0 || IsCapturingTrace())
+	{
+		return false;
+	}
+
+	TraceFrameCount = InFrameCount;
+	TraceFilePath = InFilePath;
+	bTraceCapturePending = true;
+	return true;
+}
+
+void FProfiler::GetCallTree(TArray<FProfileNodeStats>& OutNodes) const
+{
+	OutNodes.clear();
+
+	const uint32 NumThreads = ThreadCount.load(std::memory_order_acquire);
+	for (uint32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		const FThreadState& State = *Threads[ThreadIndex];
+		const uint32 NumNodes = static_cast<uint32>(State.Histories.size());
+
+		// 자식 목록은 소유 스레드가 계속 바꾸므로, 바뀌지 않는 Parent로 다시 구성
+		TArray<TArray<uint32>> Children(NumNodes);
+		for (uint32 NodeIndex = ROOT_NODE + 1; NodeIndex < NumNodes; ++NodeIndex)
+		{
+			Children[State.Nodes[NodeIndex].Parent].push_back(NodeIndex);
+		}
+
+		for (uint32 Child : Children[ROOT_NODE])
+		{
+			AppendSubtree(State, ThreadIndex, Child, Children, OutNodes);
+		}
+	}
+}
+
+bool FProfiler::WriteRecentTrace(double InSeconds, const FString& InFilePath) const
+{
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	const uint64 WindowCycles = static_cast<uint64>(InSeconds / FPlatformTime::GetSecondsPerCycle());
+	const uint64 CutoffCycles = NowCycles > WindowCycles ? NowCycles - WindowCycles : 0;
+
+	// 링 버퍼는 닫힌 순서로 쌓이므로 오래된 쪽부터 훑으며 창 안의 구간만 모음
+	TArray<FTraceEvent> Events;
+	uint64 StartCycles = NowCycles;
+	const uint64 FirstIndex = RecentWriteIndex > RECENT_EVENT_BUFFER_SIZE ? RecentWriteIndex - RECENT_EVENT_BUFFER_SIZE : 0;
+	for (uint64 Index = FirstIndex; Index < RecentWriteIndex; ++Index)
+	{
+		const FTraceEvent& Event = RecentEvents[Index & (RECENT_EVENT_BUFFER_SIZE - 1)];
+		if (Event.EndCycles >= CutoffCycles)
+		{
+			Events.push_back(Event);
+			StartCycles = std::min(StartCycles, Event.StartCycles);
+		}
+	}
+
+	return WriteTraceFile(InFilePath, Events, StartCycles);
+}
+
+bool FProfiler::WriteTraceFile(const FString& InFilePath, const TArray<FTraceEvent>& InEvents, uint64 InStartCycles) const
+{
+	const std::filesystem::path FilePath(InFilePath);
+	if (FilePath.has_parent_path())
+	{
+		std::error_code ErrorCode;
+		std::filesystem::create_directories(FilePath.parent_path(), ErrorCode);
+	}
+
+	std::ofstream Ofs(FilePath, std::ios::out | std::ios::trunc);
+	if (!Ofs.is_open())
+	{
+		return false;
+	}
+
+	// Trace Event Format: 시간 단위는 마이크로초, "X"는 시작 시각과 길이를 가진 완료 구간
+	char Line[256];
+	const char* Separator = "";
+	Ofs << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+	const uint32 NumThreads = ThreadCount.load(std::memory_order_acquire);
+	for (uint32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		(void)snprintf(Line, sizeof(Line), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+			ThreadIndex, GetThreadName(ThreadIndex));
+		Ofs << Separator << Line;
+		Separator = ",\n";
+	}
+
+	const double MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000000.0;
+	for (const FTraceEvent& Event : InEvents)
+	{
+		const double Timestamp = static_cast<double>(static_cast<int64>(Event.StartCycles - InStartCycles)) * MicrosecondsPerCycle;
+		const double Duration = static_cast<double>(Event.EndCycles - Event.StartCycles) * MicrosecondsPerCycle;
+		(void)snprintf(Line, sizeof(Line), "{\"name\":\"%s\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+			GetStatName(Event.StatIndex), Event.ThreadIndex, Timestamp, Duration);
+		Ofs << Separator << Line;
+		Separator = ",\n";
+	}
+
+	Ofs << "\n]}\n";
+	return Ofs.good();
+}
+
+uint64 FProfiler::GetDroppedEventCount() const
+{
+	uint64 DroppedEvents = 0;
+	const uint32 NumThreads = ThreadCount.load(std::memory_order_acquire);
+	for (uint32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		DroppedEvents += Threads[ThreadIndex]->DroppedEvents.load(std::memory_order_relaxed);
+	}
+	return DroppedEvents;
+}
+
+FProfiler::FThreadState& FProfiler::GetCurrentThreadState()
+{
+	if (CurrentThreadState)
+	{
+		return *CurrentThreadState;
+	}
+
+	// 스레드가 끝나도 기록을 볼 수 있도록 해제하지 않음
+	FThreadState* State = new FThreadState();
+	FCallNode& Root = State->Nodes[ROOT_NODE];
+	Root = { INVALID_NODE, TStatId::INVALID_INDEX, 0, INVALID_NODE, INVALID_NODE };
+	State->NodeCount.store(1, std::memory_order_release);
+
+	{
+		std::lock_guard<std::mutex> Lock(RegisterMutex);
+		const uint32 Count = ThreadCount.load(std::memory_order_relaxed);
+		if (Count < MAX_THREADS)
+		{
+			Threads[Count] = State;
+			ThreadCount.store(Count + 1, std::memory_order_release);
+		}
+	}
+
+	CurrentThreadState = State;
+	return *State;
+}
+
+uint32 FProfiler::FindOrAddChild(FThreadState& InState, uint32 InParentNode, uint32 InStatIndex)
+{
+	FCallNode& Parent = InState.Nodes[InParentNode];
+	for (uint32 Child = Parent.FirstChild; Child != INVALID_NODE; Child = InState.Nodes[Child].NextSibling)
+	{
+		if (InState.Nodes[Child].StatIndex == InStatIndex)
+		{
+			return Child;
+		}
+	}
+
+	const uint32 Depth = InParentNode == ROOT_NODE ? 0 : Parent.Depth + 1;
+	const uint32 NodeIndex = InState.NodeCount.load(std::memory_order_relaxed);
+	if (NodeIndex >= MAX_NODES_PER_THREAD || Depth >= MAX_SCOPE_DEPTH)
+	{
+		return INVALID_NODE;
+	}
+
+	InState.Nodes[NodeIndex] = { InParentNode, InStatIndex, Depth, INVALID_NODE, Parent.FirstChild };
+	Parent.FirstChild = NodeIndex;
+	InState.NodeCount.store(NodeIndex + 1, std::memory_order_release);
+	return NodeIndex;
+}
+
+void FProfiler::AppendSubtree(const FThreadState& InState, uint32 InThreadIndex, uint32 InNodeIndex,
+	const TArray<TArray<uint32>>& InChildren, TArray<FProfileNodeStats>& OutNodes)
+{
+	const FCallNode& Node = InState.Nodes[InNodeIndex];
+	const FNodeHistory& History = InState.Histories[InNodeIndex];
+
+	FProfileNodeStats Stats;
+	Stats.Name = GetInstance().GetStatName(Node.StatIndex);
+	Stats.ThreadIndex = InThreadIndex;
+	Stats.Depth = Node.Depth;
+	Stats.LastMilliseconds = History.LastMilliseconds;
+	Stats.LastCallCount = History.LastCallCount;
+	Stats.SampleCount = History.SampleCount;
+
+	if (History.SampleCount > 0)
+	{
+		float Sorted[HISTORY_FRAME_COUNT];
+		double Sum = 0.0;
+		for (uint32 Index = 0; Index < History.SampleCount; ++Index)
+		{
+			Sorted[Index] = History.Samples[Index];
+			Sum += History.Samples[Index];
+		}
+		std::sort(Sorted, Sorted + History.SampleCount);
+
+		// p99: 기록의 99%가 이 값 이하 (올림 순위)
+		const uint32 P99Rank = (History.SampleCount * 99 + 99) / 100;
+		Stats.MinMilliseconds = Sorted[0];
+		Stats.MaxMilliseconds = Sorted[History.SampleCount - 1];
+		Stats.AvgMilliseconds = Sum / History.SampleCount;
+		Stats.P99Milliseconds = Sorted[P99Rank - 1];
+	}
+
+	OutNodes.push_back(Stats);
+
+	for (uint32 Child : InChildren[InNodeIndex])
+	{
+		AppendSubtree(InState, InThreadIndex, Child, InChildren, OutNodes);
+	}
+}
@@ -0,0 +1,84 @@
+#include "pch.h"
+#include "Utility/Public/SpawnBenchmark.h"
+#include "Core/Public/ObjectPool.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+
+#include <chrono>
+
+namespace
+{
+	template<typename TFunction>
+	double MeasureSpawnsPerSecond(uint64 InSpawnCount, TFunction&& InFunction)
+	{
+		const auto StartTime = std::chrono::steady_clock::now();
+		InFunction();
+		const auto EndTime = std::chrono::steady_clock::now();
+		return static_cast<double>(InSpawnCount) / std::chrono::duration<double>(EndTime - StartTime).count();
+	}
+
+	// 라운드마다 InObjectCount개를 만들고 InFreeOrder 순서로 소멸 (실제 게임처럼 생성 순서와 소멸 순서가 다름)
+	template<typename TCreate, typename TDestroy>
+	void RunRounds(const TArray<uint32>& InFreeOrder, uint32 InRoundCount, TCreate&& InCreate, TDestroy&& InDestroy)
+	{
+		using TObjectPointer = decltype(InCreate());
+		TArray<TObjectPointer> Objects(InFreeOrder.size());
+		for (uint32 Round = 0; Round < InRoundCount; ++Round)
+		{
+			for (TObjectPointer& Object : Objects)
+			{
+				Object = InCreate();
+			}
+			for (uint32 Index : InFreeOrder)
+			{
+				InDestroy(Objects[Index]);
+			}
+		}
+	}
+}
+
+void FSpawnBenchmark::Run(TArray<FSpawnBenchmarkResult>& OutResults, uint32 InObjectCount, uint32 InRoundCount)
+{
+	OutResults.clear();
+	if (InObjectCount == 0 || InRoundCount == 0)
+	{
+		return;
+	}
+
+	TArray<uint32> FreeOrder(InObjectCount);
+	for (uint32 Index = 0; Index < InObjectCount; ++Index)
+	{
+		FreeOrder[Index] = Index;
+	}
+	for (uint32 Index = InObjectCount - 1; Index > 0; --Index)
+	{
+		std::swap(FreeOrder[Index], FreeOrder[rand() % (Index + 1)]);
+	}
+
+	// 자주 생성/소멸되는 컴포넌트 크기로 할당자만 비교
+	constexpr size_t BlockSize = sizeof(UStaticMeshComponent);
+	const uint64 SpawnCount = static_cast<uint64>(InObjectCount) * InRoundCount;
+
+	OutResults.push_back({ "operator new/delete (global heap)", MeasureSpawnsPerSecond(SpawnCount, [&]()
+	{
+		RunRounds(FreeOrder, InRoundCount,
+			[] { return ::operator new(BlockSize); },
+			[](void* InMemory) { ::operator delete(InMemory); });
+	}) });
+
+	OutResults.push_back({ "FUObjectPool Allocate/Free", MeasureSpawnsPerSecond(SpawnCount, [&]()
+	{
+		FUObjectPool& Pool = FUObjectPool::GetInstance();
+		RunRounds(FreeOrder, InRoundCount,
+			[&Pool] { return Pool.Allocate(BlockSize); },
+			[&Pool](void* InMemory) { Pool.Free(InMemory, BlockSize); });
+	}) });
+
+	// NewObject는 객체마다 고유 이름을 이름 테이블에 남기므로 생성자 경로(new)만 사용
+	// (UStaticMeshComponent는 생성자에서 기본 메시를 불러오므로 Transform 저장소 등록까지 하는 USceneComponent로 측정)
+	OutResults.push_back({ "new/delete USceneComponent", MeasureSpawnsPerSecond(SpawnCount, [&]()
+	{
+		RunRounds(FreeOrder, InRoundCount,
+			[] { return new USceneComponent(); },
+			[](USceneComponent* InComponent) { delete InComponent; });
+	}) });
+}
@@ -0,0 +1,247 @@
+#include "pch.h"
+#include "Utility/Public/StructuredLog.h"
+
+using namespace StructuredLogFormat;
+
+namespace
+{
+	// 워커가 한 번에 꺼내 쓰는 최대 크기와, 큐가 비었을 때 다시 확인하기까지의 대기 시간
+	constexpr size_t BATCH_BYTES = 64 * 1024;
+	constexpr uint32 IDLE_SLEEP_MILLISECONDS = 2;
+}
+
+bool FStructuredLog::Initialize(const FString& InFilePath)
+{
+	std::lock_guard<std::mutex> Lock(FormatMutex);
+	if (bIsInitialized)
+	{
+		return true;
+	}
+
+	const std::filesystem::path Path(InFilePath);
+	if (Path.has_parent_path())
+	{
+		std::error_code ErrorCode;
+		std::filesystem::create_directories(Path.parent_path(), ErrorCode);
+	}
+
+	FileStream.open(Path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!FileStream.is_open())
+	{
+		return false;
+	}
+
+	FilePath = InFilePath;
+	RemoveOldLogFiles();
+
+	const FFileHeader Header = { FILE_MAGIC, FILE_VERSION, FPlatformTime::GetSecondsPerCycle(), FPlatformTime::Cycles64() };
+	FileStream.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+	RecentDecoder.SetTimeBase(Header.SecondsPerCycle, Header.StartCycles);
+
+	// 초기화 전에 등록된 호출 지점의 포맷을 먼저 기록
+	for (uint32 FormatId = 0; FormatId < FormatDefinitions.size(); ++FormatId)
+	{
+		SubmitFormat(FormatId, FormatDefinitions[FormatId]);
+	}
+
+	bShouldStop.store(false);
+	WorkerThread = std::thread(&FStructuredLog::WorkerThreadFunc, this);
+
+	bIsInitialized = true;
+	bIsRecording.store(bIsEnabled, std::memory_order_relaxed);
+	return true;
+}
+
+void FStructuredLog::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(FormatMutex);
+		if (!bIsInitialized)
+		{
+			return;
+		}
+		bIsInitialized = false;
+		bIsRecording.store(false, std::memory_order_relaxed);
+	}
+
+	// 워커는 큐가 빌 때까지 쓰고 종료
+	bShouldStop.store(true);
+	if (WorkerThread.joinable())
+	{
+		WorkerThread.join();
+	}
+
+	FileStream.close();
+}
+
+void FStructuredLog::SetEnabled(bool bInEnabled)
+{
+	std::lock_guard<std::mutex> Lock(FormatMutex);
+	bIsEnabled = bInEnabled;
+	bIsRecording.store(bIsInitialized && bIsEnabled, std::memory_order_relaxed);
+}
+
+uint32 FStructuredLog::RegisterFormat(ELogType InType, const char* InFormat, const char* InFile, uint32 InLine)
+{
+	std::lock_guard<std::mutex> Lock(FormatMutex);
+
+	const uint32 FormatId = static_cast<uint32>(FormatDefinitions.size());
+	FormatDefinitions.push_back({ InType, InFormat, InFile, InLine });
+
+	// 이 호출 지점의 Message보다 먼저 큐에 들어가야 디코더가 포맷을 알 수 있음
+	if (bIsInitialized)
+	{
+		SubmitFormat(FormatId, FormatDefinitions.back());
+	}
+	return FormatId;
+}
+
+void FStructuredLog::GetRecentLines(uint32 InCount, TArray<FStructuredLogLine>& OutLines)
+{
+	OutLines.clear();
+
+	std::lock_guard<std::mutex> Lock(RecentMutex);
+	const size_t First = RecentMessages.size() > InCount ? RecentMessages.size() - InCount : 0;
+	for (size_t Index = First; Index < RecentMessages.size(); ++Index)
+	{
+		const FString& Message = RecentMessages[Index];
+		RecentDecoder.Decode(reinterpret_cast<const uint8*>(Message.data()), Message.size(), &OutLines);
+	}
+}
+
+void FStructuredLog::EncodeString(FRecordWriter& InWriter, const char* InString, size_t InLength)
+{
+	const uint32 Length = static_cast<uint32>(std::min<size_t>(InLength, MAX_STRING_LENGTH));
+	InWriter.Write(EArgumentTag::String);
+	InWriter.Write(Length);
+	InWriter.WriteBytes(InString, Length);
+}
+
+void FStructuredLog::EncodeWideString(FRecordWriter& InWriter, const wchar_t* InString)
+{
+	// 파일 형식은 플랫폼과 무관하게 UTF-16 (wchar_t가 4바이트인 플랫폼은 서로게이트 쌍으로 변환)
+	uint16 Units[MAX_STRING_LENGTH];
+	uint32 Length = 0;
+	for (const wchar_t* Character = InString; *Character && Length + 2 <= MAX_STRING_LENGTH; ++Character)
+	{
+		const uint32 CodePoint = static_cast<uint32>(*Character);
+		if (CodePoint >= 0x10000)
+		{
+			Units[Length++] = static_cast<uint16>(0xD800 + ((CodePoint - 0x10000) >> 10));
+			Units[Length++] = static_cast<uint16>(0xDC00 + ((CodePoint - 0x10000) & 0x3FF));
+		}
+		else
+		{
+			Units[Length++] = static_cast<uint16>(CodePoint);
+		}
+	}
+
+	InWriter.Write(EArgumentTag::WideString);
+	InWriter.Write(Length);
+	InWriter.WriteBytes(Units, Length * sizeof(uint16));
+}
+
+void FStructuredLog::Submit(FRecordWriter& InWriter)
+{
+	if (InWriter.bOverflow)
+	{
+		return;
+	}
+
+	InWriter.FinalizeSize();
+	if (Queue.PushBytes(InWriter.Data, InWriter.Size))
+	{
+		RecordCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void FStructuredLog::SubmitFormat(uint32 InFormatId, const FFormatDefinition& InDefinition)
+{
+	FRecordWriter Writer;
+	Writer.WritePrefix(ERecordKind::Format);
+	Writer.Write(InFormatId);
+	Writer.Write(static_cast<uint8>(InDefinition.Type));
+	Writer.Write(InDefinition.Line);
+	Writer.WriteBytes(InDefinition.File, static_cast<uint32>(strlen(InDefinition.File) + 1));
+	Writer.WriteBytes(InDefinition.Format, static_cast<uint32>(strlen(InDefinition.Format) + 1));
+	Submit(Writer);
+}
+
+void FStructuredLog::WorkerThreadFunc()
+{
+	MEMORY_TAG_SCOPE(Log)
+	FString Batch;
+	Batch.reserve(BATCH_BYTES + MAX_RECORD_SIZE);
+	bool bHasUnflushedData = false;
+
+	while (true)
+	{
+		const bool bStopRequested = bShouldStop.load();
+		Batch.clear();
+		const uint32 DrainedCount = Queue.Drain(Batch, BATCH_BYTES);
+
+		if (!Batch.empty())
+		{
+			FileStream.write(Batch.data(), static_cast<std::streamsize>(Batch.size()));
+			bHasUnflushedData = true;
+
+			// 포맷 레코드는 디코더에 등록하고, 메시지 레코드는 포맷하지 않은 채 최근 목록에 보관
+			std::lock_guard<std::mutex> Lock(RecentMutex);
+			const uint8* Data = reinterpret_cast<const uint8*>(Batch.data());
+			for (size_t Offset = 0; Offset + RECORD_PREFIX_SIZE <= Batch.size();)
+			{
+				uint32 Size = 0;
+				memcpy(&Size, Data + Offset, sizeof(Size));
+				if (static_cast<ERecordKind>(Data[Offset + 4]) == ERecordKind::Format)
+				{
+					RecentDecoder.Decode(Data + Offset, Size, nullptr);
+				}
+				else
+				{
+					RecentMessages.emplace_back(Batch.data() + Offset, Size);
+					if (RecentMessages.size() > RECENT_MESSAGE_COUNT)
+					{
+						RecentMessages.pop_front();
+					}
+				}
+				Offset += Size;
+			}
+		}
+
+		if (DrainedCount == 0)
+		{
+			if (bHasUnflushedData)
+			{
+				FileStream.flush();
+				bHasUnflushedData = false;
+			}
+			if (bStopRequested)
+			{
+				break;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_SLEEP_MILLISECONDS));
+		}
+	}
+}
+
+void FStructuredLog::RemoveOldLogFiles() const
+{
+	const std::filesystem::path Directory = std::filesystem::path(FilePath).parent_path();
+
+	std::error_code ErrorCode;
+	TArray<std::filesystem::path> LogFiles;
+	for (const auto& Entry : std::filesystem::directory_iterator(Directory.empty() ? "." : Directory, ErrorCode))
+	{
+		if (Entry.is_regular_file() && Entry.path().extension() == ".ulog")
+		{
+			LogFiles.push_back(Entry.path());
+		}
+	}
+
+	// 파일명이 시각 순이므로 이름순 정렬 후 오래된 것부터 삭제 (방금 만든 파일 포함 MAX_LOG_FILES개 유지)
+	std::sort(LogFiles.begin(), LogFiles.end());
+	for (size_t Index = 0; Index + MAX_LOG_FILES < LogFiles.size(); ++Index)
+	{
+		std::filesystem::remove(LogFiles[Index], ErrorCode);
+	}
+}
@@ -0,0 +1,450 @@
+#include "pch.h"
+#include "Utility/Public/StructuredLogDecoder.h"
+
+using namespace StructuredLogFormat;
+
+namespace
+{
+	/**
+	 * @brief 레코드에서 읽어 둔 인자 하나
+	 */
+	struct FDecodedArgument
+	{
+		EArgumentTag Tag = EArgumentTag::Int64;
+		int64 IntValue = 0;
+		uint64 UIntValue = 0;
+		double DoubleValue = 0.0;
+		FString StringValue;
+	};
+
+	template<typename T>
+	bool ReadValue(const uint8*& InOutCursor, const uint8* InEnd, T& OutValue)
+	{
+		if (InEnd - InOutCursor < static_cast<ptrdiff_t>(sizeof(T)))
+		{
+			return false;
+		}
+		memcpy(&OutValue, InOutCursor, sizeof(T));
+		InOutCursor += sizeof(T);
+		return true;
+	}
+
+	bool ReadCString(const uint8*& InOutCursor, const uint8* InEnd, FString& OutString)
+	{
+		const uint8* Terminator = static_cast<const uint8*>(memchr(InOutCursor, 0, InEnd - InOutCursor));
+		if (!Terminator)
+		{
+			return false;
+		}
+		OutString.assign(reinterpret_cast<const char*>(InOutCursor), Terminator - InOutCursor);
+		InOutCursor = Terminator + 1;
+		return true;
+	}
+
+	void AppendUTF8(FString& OutString, uint32 InCodePoint)
+	{
+		if (InCodePoint < 0x80)
+		{
+			OutString += static_cast<char>(InCodePoint);
+		}
+		else if (InCodePoint < 0x800)
+		{
+			OutString += static_cast<char>(0xC0 | (InCodePoint >> 6));
+			OutString += static_cast<char>(0x80 | (InCodePoint & 0x3F));
+		}
+		else if (InCodePoint < 0x10000)
+		{
+			OutString += static_cast<char>(0xE0 | (InCodePoint >> 12));
+			OutString += static_cast<char>(0x80 | ((InCodePoint >> 6) & 0x3F));
+			OutString += static_cast<char>(0x80 | (InCodePoint & 0x3F));
+		}
+		else
+		{
+			OutString += static_cast<char>(0xF0 | (InCodePoint >> 18));
+			OutString += static_cast<char>(0x80 | ((InCodePoint >> 12) & 0x3F));
+			OutString += static_cast<char>(0x80 | ((InCodePoint >> 6) & 0x3F));
+			OutString += static_cast<char>(0x80 | (InCodePoint & 0x3F));
+		}
+	}
+
+	bool ReadArgument(const uint8*& InOutCursor, const uint8* InEnd, FDecodedArgument& OutArgument)
+	{
+		uint8 Tag = 0;
+		if (!ReadValue(InOutCursor, InEnd, Tag))
+		{
+			return false;
+		}
+		OutArgument.Tag = static_cast<EArgumentTag>(Tag);
+
+		switch (OutArgument.Tag)
+		{
+		case EArgumentTag::Int64:
+			return ReadValue(InOutCursor, InEnd, OutArgument.IntValue);
+		case EArgumentTag::UInt64:
+		case EArgumentTag::Pointer:
+			return ReadValue(InOutCursor, InEnd, OutArgument.UIntValue);
+		case EArgumentTag::Double:
+			return ReadValue(InOutCursor, InEnd, OutArgument.DoubleValue);
+		case EArgumentTag::String:
+			{
+				uint32 Length = 0;
+				if (!ReadValue(InOutCursor, InEnd, Length) || InEnd - InOutCursor < static_cast<ptrdiff_t>(Length))
+				{
+					return false;
+				}
+				OutArgument.StringValue.assign(reinterpret_cast<const char*>(InOutCursor), Length);
+				InOutCursor += Length;
+				return true;
+			}
+		case EArgumentTag::WideString:
+			{
+				// UTF-16 -> UTF-8 (서로게이트 쌍 처리)
+				uint32 Length = 0;
+				if (!ReadValue(InOutCursor, InEnd, Length) || InEnd - InOutCursor < static_cast<ptrdiff_t>(Length * sizeof(uint16)))
+				{
+					return false;
+				}
+				for (uint32 Index = 0; Index < Length; ++Index)
+				{
+					uint16 Unit = 0;
+					ReadValue(InOutCursor, InEnd, Unit);
+					uint32 CodePoint = Unit;
+					if (Unit >= 0xD800 && Unit < 0xDC00 && Index + 1 < Length)
+					{
+						uint16 Low = 0;
+						memcpy(&Low, InOutCursor, sizeof(Low));
+						if (Low >= 0xDC00 && Low < 0xE000)
+						{
+							CodePoint = 0x10000 + ((Unit - 0xD800) << 10) + (Low - 0xDC00);
+							InOutCursor += sizeof(Low);
+							++Index;
+						}
+					}
+					AppendUTF8(OutArgument.StringValue, CodePoint);
+				}
+				return true;
+			}
+		default:
+			return false;
+		}
+	}
+
+	int64 ToInt64(const FDecodedArgument& InArgument)
+	{
+		switch (InArgument.Tag)
+		{
+		case EArgumentTag::Int64: return InArgument.IntValue;
+		case EArgumentTag::UInt64:
+		case EArgumentTag::Pointer: return static_cast<int64>(InArgument.UIntValue);
+		case EArgumentTag::Double: return static_cast<int64>(InArgument.DoubleValue);
+		default: return strtoll(InArgument.StringValue.c_str(), nullptr, 10);
+		}
+	}
+
+	double ToDouble(const FDecodedArgument& InArgument)
+	{
+		switch (InArgument.Tag)
+		{
+		case EArgumentTag::Int64: return static_cast<double>(InArgument.IntValue);
+		case EArgumentTag::UInt64:
+		case EArgumentTag::Pointer: return static_cast<double>(InArgument.UIntValue);
+		case EArgumentTag::Double: return InArgument.DoubleValue;
+		default: return strtod(InArgument.StringValue.c_str(), nullptr);
+		}
+	}
+
+	FString ToString(const FDecodedArgument& InArgument)
+	{
+		switch (InArgument.Tag)
+		{
+		case EArgumentTag::Int64: return std::to_string(InArgument.IntValue);
+		case EArgumentTag::UInt64:
+		case EArgumentTag::Pointer: return std::to_string(InArgument.UIntValue);
+		case EArgumentTag::Double: return std::to_string(InArgument.DoubleValue);
+		default: return InArgument.StringValue;
+		}
+	}
+
+	template<typename T>
+	void AppendFormatted(FString& OutResult, const FString& InSpec, T InValue)
+	{
+		char Buffer[256];
+		const int Length = snprintf(Buffer, sizeof(Buffer), InSpec.c_str(), InValue);
+		if (Length < 0)
+		{
+			return;
+		}
+
+		if (Length < static_cast<int>(sizeof(Buffer)))
+		{
+			OutResult.append(Buffer, Length);
+			return;
+		}
+
+		const size_t Offset = OutResult.size();
+		OutResult.resize(Offset + Length + 1);
+		(void)snprintf(&OutResult[Offset], Length + 1, InSpec.c_str(), InValue);
+		OutResult.resize(Offset + Length);
+	}
+
+	bool IsDigit(char InCharacter)
+	{
+		return InCharacter >= '0' && InCharacter <= '9';
+	}
+}
+
+void FStructuredLogDecoder::SetTimeBase(double InSecondsPerCycle, uint64 InStartCycles)
+{
+	SecondsPerCycle = InSecondsPerCycle;
+	StartCycles = InStartCycles;
+}
+
+size_t FStructuredLogDecoder::Decode(const uint8* InData, size_t InSize, TArray<FStructuredLogLine>* OutLines)
+{
+	size_t Offset = 0;
+	while (Offset + RECORD_PREFIX_SIZE <= InSize)
+	{
+		uint32 Size = 0;
+		memcpy(&Size, InData + Offset, sizeof(Size));
+		if (Size < RECORD_PREFIX_SIZE || Offset + Size > InSize)
+		{
+			break;
+		}
+
+		const uint8* Cursor = InData + Offset + RECORD_PREFIX_SIZE;
+		const uint8* End = InData + Offset + Size;
+		const ERecordKind Kind = static_cast<ERecordKind>(InData[Offset + 4]);
+		Offset += Size;
+
+		uint32 FormatId = 0;
+		if (!ReadValue(Cursor, End, FormatId))
+		{
+			continue;
+		}
+
+		if (Kind == ERecordKind::Format)
+		{
+			FFormatEntry Entry;
+			if (ReadValue(Cursor, End, Entry.LogType) && ReadValue(Cursor, End, Entry.Line) &&
+				ReadCString(Cursor, End, Entry.File) && ReadCString(Cursor, End, Entry.Format))
+			{
+				if (FormatId >= Formats.size())
+				{
+					Formats.resize(FormatId + 1);
+				}
+				Formats[FormatId] = std::move(Entry);
+			}
+		}
+		else if (Kind == ERecordKind::Message && OutLines)
+		{
+			uint64 Cycles = 0;
+			uint8 ArgumentCount = 0;
+			if (!ReadValue(Cursor, End, Cycles) || !ReadValue(Cursor, End, ArgumentCount))
+			{
+				continue;
+			}
+
+			FStructuredLogLine Line;
+			Line.Seconds = static_cast<double>(static_cast<int64>(Cycles - StartCycles)) * SecondsPerCycle;
+			if (FormatId < Formats.size() && !Formats[FormatId].Format.empty())
+			{
+				const FFormatEntry& Entry = Formats[FormatId];
+				Line.LogType = Entry.LogType;
+				Line.File = Entry.File.c_str();
+				Line.Line = Entry.Line;
+				Line.Message = FormatMessage(Entry.Format, Cursor, End, ArgumentCount);
+			}
+			else
+			{
+				Line.Message = "<unknown format id " + std::to_string(FormatId) + ">";
+			}
+			OutLines->push_back(std::move(Line));
+		}
+	}
+
+	return Offset;
+}
+
+bool FStructuredLogDecoder::DecodeFile(const FString& InFilePath, TArray<FStructuredLogLine>& OutLines)
+{
+	std::ifstream Ifs(InFilePath, std::ios::binary);
+	if (!Ifs.is_open())
+	{
+		return false;
+	}
+
+	const FString Data((std::istreambuf_iterator<char>(Ifs)), std::istreambuf_iterator<char>());
+
+	FFileHeader Header = {};
+	if (Data.size() < sizeof(Header))
+	{
+		return false;
+	}
+	memcpy(&Header, Data.data(), sizeof(Header));
+	if (Header.Magic != FILE_MAGIC || Header.Version != FILE_VERSION)
+	{
+		return false;
+	}
+
+	SetTimeBase(Header.SecondsPerCycle, Header.StartCycles);
+	Decode(reinterpret_cast<const uint8*>(Data.data()) + sizeof(Header), Data.size() - sizeof(Header), &OutLines);
+	return true;
+}
+
+FString FStructuredLogDecoder::ToText(const FStructuredLogLine& InLine)
+{
+	char Prefix[64];
+	(void)snprintf(Prefix, sizeof(Prefix), "[%10.3f] %s ", InLine.Seconds, GetLogTypePrefix(InLine.LogType));
+	return Prefix + InLine.Message;
+}
+
+const char* FStructuredLogDecoder::GetLogTypePrefix(uint8 InLogType)
+{
+	// ELogType 순서와 같음
+	static const char* const Prefixes[] =
+	{
+		"[INFO]", "[WARN]", "[ERRO]", "[SUCC]", "[SYST]", "[DBUG]", "[ULOG]", "[TERM]", "[TERR]", "[COMM]",
+	};
+	return InLogType < std::size(Prefixes) ? Prefixes[InLogType] : "[INFO]";
+}
+
+FString FStructuredLogDecoder::FormatMessage(const FString& InFormat, const uint8* InArguments, const uint8* InEnd, uint32 InArgumentCount)
+{
+	TArray<FDecodedArgument> Arguments(InArgumentCount);
+	for (uint32 Index = 0; Index < InArgumentCount; ++Index)
+	{
+		if (!ReadArgument(InArguments, InEnd, Arguments[Index]))
+		{
+			Arguments.resize(Index);
+			break;
+		}
+	}
+
+	FString Result;
+	Result.reserve(InFormat.size() + 32);
+	size_t NextArgument = 0;
+	const size_t FormatLength = InFormat.size();
+
+	for (size_t Position = 0; Position < FormatLength;)
+	{
+		if (InFormat[Position] != '%')
+		{
+			Result += InFormat[Position++];
+			continue;
+		}
+
+		if (Position + 1 < FormatLength && InFormat[Position + 1] == '%')
+		{
+			Result += '%';
+			Position += 2;
+			continue;
+		}
+
+		// %[flags][width][.precision][length]conversion: 길이 지정자는 기록된 인자 타입에 맞게 다시 붙임
+		FString Spec = "%";
+		size_t Cursor = Position + 1;
+		while (Cursor < FormatLength && strchr("-+ #0", InFormat[Cursor]))
+		{
+			Spec += InFormat[Cursor++];
+		}
+
+		auto AppendNumber = [&]()
+		{
+			if (Cursor < FormatLength && InFormat[Cursor] == '*')
+			{
+				Spec += NextArgument < Arguments.size() ? std::to_string(ToInt64(Arguments[NextArgument++])) : "";
+				++Cursor;
+				return;
+			}
+			while (Cursor < FormatLength && IsDigit(InFormat[Cursor]))
+			{
+				Spec += InFormat[Cursor++];
+			}
+		};
+
+		AppendNumber();
+		if (Cursor < FormatLength && InFormat[Cursor] == '.')
+		{
+			Spec += InFormat[Cursor++];
+			AppendNumber();
+		}
+
+		while (Cursor < FormatLength && strchr("hlLzjtIq", InFormat[Cursor]))
+		{
+			// MSVC의 I64 / I32
+			if (InFormat[Cursor] == 'I' && Cursor + 2 < FormatLength && IsDigit(InFormat[Cursor + 1]))
+			{
+				Cursor += 2;
+			}
+			++Cursor;
+		}
+
+		if (Cursor >= FormatLength)
+		{
+			Result += InFormat.substr(Position);
+			break;
+		}
+
+		const char Conversion = InFormat[Cursor];
+		Position = Cursor + 1;
+
+		if (NextArgument >= Arguments.size())
+		{
+			Result += "<missing>";
+			continue;
+		}
+		const FDecodedArgument& Argument = Arguments[NextArgument++];
+
+		switch (Conversion)
+		{
+		case 'd':
+		case 'i':
+			AppendFormatted(Result, Spec + "lld", static_cast<long long>(ToInt64(Argument)));
+			break;
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X':
+			AppendFormatted(Result, Spec + "ll" + Conversion, static_cast<unsigned long long>(ToInt64(Argument)));
+			break;
+		case 'f':
+		case 'F':
+		case 'e':
+		case 'E':
+		case 'g':
+		case 'G':
+		case 'a':
+		case 'A':
+			AppendFormatted(Result, Spec + Conversion, ToDouble(Argument));
+			break;
+		case 'c':
+			if (Argument.Tag == EArgumentTag::String || Argument.Tag == EArgumentTag::WideString)
+			{
+				Result += Argument.StringValue.substr(0, 1);
+			}
+			else
+			{
+				AppendUTF8(Result, static_cast<uint32>(ToInt64(Argument)));
+			}
+			break;
+		case 's':
+			if (Spec.size() == 1)
+			{
+				Result += ToString(Argument);
+			}
+			else
+			{
+				AppendFormatted(Result, Spec + "s", ToString(Argument).c_str());
+			}
+			break;
+		case 'p':
+			AppendFormatted(Result, Spec + "p", reinterpret_cast<void*>(static_cast<uintptr_t>(ToInt64(Argument))));
+			break;
+		default:
+			Result += Spec + Conversion;
+			break;
+		}
+	}
+
+	return Result;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 캐스트 벤치마크 항목 하나의 결과
+ */
+struct FCastBenchmarkResult
+{
+	const char* Name = nullptr;
+	double CastsPerSecond = 0.0;
+};
+
+/**
+ * @brief UClass::IsChildOf / Cast<T>의 처리량(초당 캐스트 수) 벤치마크
+ * 콘솔의 "bench cast" 명령으로 실행하며, 등록된 모든 클래스에서 무작위로 뽑은 (클래스, 대상 클래스) 쌍을
+ * 조상 배열 방식과 기존 방식(SuperClass를 따라 올라가며 FName 비교)으로 판정하는 시간을 측정합니다.
+ */
+class FCastBenchmark
+{
+public:
+	static constexpr uint32 DEFAULT_PAIR_COUNT = 4096;
+	static constexpr uint32 DEFAULT_REPEAT_COUNT = 1024;
+
+	static void Run(TArray<FCastBenchmarkResult>& OutResults,
+		uint32 InPairCount = DEFAULT_PAIR_COUNT, uint32 InRepeatCount = DEFAULT_REPEAT_COUNT);
+};
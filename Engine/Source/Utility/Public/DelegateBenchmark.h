@@ -0,0 +1,27 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 델리게이트 벤치마크 항목 하나의 결과
+ */
+struct FDelegateBenchmarkResult
+{
+	const char* Name = nullptr;
+	double NanosecondsPerBroadcast = 0.0;
+	uint64 BindAllocationCount = 0;		// 빈 델리게이트에 핸들러를 모두 등록하는 동안의 힙 할당 횟수 (FMemoryTracker 기준)
+};
+
+/**
+ * @brief TDelegate::BroadCast 비용과 핸들러 등록 시 힙 할당 횟수 벤치마크
+ * 콘솔의 "bench delegate" 명령으로 실행하며, OnComponentBeginOverlap과 같은 시그니처에 멤버 함수 핸들러(AddDynamic) 4개와
+ * 람다 1개를 등록한 델리게이트를 TDelegate와 기존 방식(TArray<std::function>, 인자 값 복사)에 대해 측정합니다.
+ */
+class FDelegateBenchmark
+{
+public:
+	static constexpr uint32 DEFAULT_MEMBER_HANDLER_COUNT = 4;
+	static constexpr uint32 DEFAULT_BROADCAST_COUNT = 1000000;
+
+	static void Run(TArray<FDelegateBenchmarkResult>& OutResults,
+		uint32 InMemberHandlerCount = DEFAULT_MEMBER_HANDLER_COUNT, uint32 InBroadcastCount = DEFAULT_BROADCAST_COUNT);
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 최근 프레임 시간의 분포를 고정 메모리로 유지하는 HDR 방식 히스토그램
+ *
+ * 마이크로초 값을 로그-선형 버킷에 담습니다. 0~127us는 1us 단위이고, 그 위로는 2의 거듭제곱 구간마다
+ * 64개 버킷으로 나누므로 어느 구간에서든 상대 오차가 1/64(약 1.6%) 이하입니다.
+ * 최근 WINDOW_FRAME_COUNT 프레임만 반영하도록, 오래된 프레임은 버킷에서 빼고 새 프레임을 더합니다.
+ */
+class FFrameTimeHistogram
+{
+public:
+	static constexpr uint32 WINDOW_FRAME_COUNT = 4096;
+
+	// 2^26us(약 67초) 이상은 마지막 버킷으로 모음
+	static constexpr uint32 LINEAR_BUCKET_COUNT = 128;
+	static constexpr uint32 SUB_BUCKET_COUNT = 64;
+	static constexpr uint32 MAX_VALUE_BITS = 26;
+	static constexpr uint32 BUCKET_COUNT = LINEAR_BUCKET_COUNT + (MAX_VALUE_BITS - 7) * SUB_BUCKET_COUNT;
+
+	void AddSample(double InMilliseconds);
+	void Reset();
+
+	/**
+	 * @brief 최근 프레임 중 InPercentile(0~100)%가 이 값 이하인 프레임 시간(ms)
+	 * 버킷의 상한을 돌려주므로 실제 값보다 작게 보고되지 않습니다.
+	 */
+	double GetPercentile(double InPercentile) const;
+
+	uint32 GetSampleCount() const { return SampleCount; }
+
+	static uint32 GetBucketIndex(uint64 InMicroseconds);
+	static uint64 GetBucketUpperBound(uint32 InBucketIndex);
+
+private:
+	uint32 BucketCounts[BUCKET_COUNT] = {};
+
+	// 창에서 빠질 때 어느 버킷에서 뺄지 알기 위해 프레임별 버킷 인덱스를 보관
+	uint16 WindowBuckets[WINDOW_FRAME_COUNT] = {};
+	uint32 NextWindowIndex = 0;
+	uint32 SampleCount = 0;
+};
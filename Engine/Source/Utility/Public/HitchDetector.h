@@ -0,0 +1,75 @@
+#pragma once
+#include "Utility/Public/FrameTimeHistogram.h"
+
+/**
+ * @brief 히치 하나에 대해 가장 오래 걸린 측정 지점 (하위 구간을 뺀 자체 시간 기준)
+ */
+struct FHitchScope
+{
+	const char* Name = nullptr;
+	const char* ThreadName = nullptr;
+	double SelfMilliseconds = 0.0;
+	double InclusiveMilliseconds = 0.0;
+};
+
+/**
+ * @brief 프레임 시간 분포를 기록하고, 임계값을 넘는 프레임(히치)을 감지하는 클래스
+ *
+ * 메인 루프가 FProfiler::EndFrame 다음에 AddFrame을 호출합니다. 히치가 감지되면
+ * 그 프레임의 자체 시간이 큰 측정 지점을 로그로 남기고, 직전 DumpSeconds초의 프로파일러 구간을
+ * Trace/Hitch_<frame>.json에 저장합니다. (연속 히치로 파일이 쌓이지 않도록 CooldownSeconds 동안은 저장하지 않음)
+ *
+ * 시작 직후의 로딩 프레임은 분포와 감지에서 제외합니다. (WARMUP_FRAME_COUNT)
+ * SetDumpEnabled(false)로 두면 파일/로그 없이 분포와 감지만 동작하므로 합성 프레임 시간으로 검증할 수 있습니다.
+ */
+class FHitchDetector
+{
+public:
+	static constexpr uint32 WARMUP_FRAME_COUNT = 60;
+	static constexpr uint32 MAX_REPORTED_SCOPES = 5;
+
+	// 종료 시점까지 메인 루프가 사용하므로 해제하지 않음
+	static FHitchDetector& GetInstance()
+	{
+		static FHitchDetector* Instance = new FHitchDetector();
+		return *Instance;
+	}
+
+	/** @brief 프레임 하나를 기록합니다. @return 이 프레임이 히치로 판정되면 true */
+	bool AddFrame(double InFrameMilliseconds);
+	void Reset();
+
+	/** @brief 마지막 히치 프레임의 상위 측정 지점 (자체 시간 내림차순) */
+	const TArray<FHitchScope>& GetLastHitchScopes() const { return LastHitchScopes; }
+	const FFrameTimeHistogram& GetHistogram() const { return Histogram; }
+	uint64 GetHitchCount() const { return HitchCount; }
+
+	double GetThresholdMilliseconds() const { return ThresholdMilliseconds; }
+	void SetThresholdMilliseconds(double InMilliseconds) { ThresholdMilliseconds = InMilliseconds; }
+	void SetDumpSeconds(double InSeconds) { DumpSeconds = InSeconds; }
+	void SetCooldownSeconds(double InSeconds) { CooldownSeconds = InSeconds; }
+	void SetDumpEnabled(bool bInEnabled) { bDumpEnabled = bInEnabled; }
+
+	FHitchDetector(const FHitchDetector&) = delete;
+	FHitchDetector& operator=(const FHitchDetector&) = delete;
+
+private:
+	FHitchDetector() = default;
+	~FHitchDetector() = default;
+
+	void CollectWorstScopes();
+	void ReportHitch(double InFrameMilliseconds);
+
+	FFrameTimeHistogram Histogram;
+	TArray<FHitchScope> LastHitchScopes;
+
+	double ThresholdMilliseconds = 50.0;
+	double DumpSeconds = 3.0;
+	double CooldownSeconds = 10.0;
+	bool bDumpEnabled = true;
+
+	uint32 FrameCount = 0;
+	uint64 HitchCount = 0;
+	// 마지막 저장 이후 흐른 시간 (처음 히치는 바로 저장)
+	double SecondsSinceDump = 1.0e9;
+};
@@ -0,0 +1,27 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 로그 큐 벤치마크 항목 하나의 결과
+ */
+struct FLogBenchmarkResult
+{
+	const char* Name = nullptr;
+	uint32 ProducerCount = 0;
+	double MessagesPerSecond = 0.0;		// 큐에 실제로 들어간(소비자에게 전달된) 메시지 기준, Drop 정책에서 버려진 메시지는 제외
+	double PushesPerSecond = 0.0;		// 생산자가 Push를 호출한 횟수 기준 (버려진 메시지 포함)
+	uint64 DroppedCount = 0;
+};
+
+/**
+ * @brief 로그 큐의 처리량(초당 메시지 수) 벤치마크
+ * 콘솔의 "bench log" 명령으로 실행하며, 생산자 1개/8개가 동시에 로그를 넣고 소비자 스레드 하나가
+ * 꺼내 버리는(파일 쓰기 제외) 동안 전달된 메시지 수를 FLogQueue와 기존 방식(std::mutex + std::queue<FString>)에 대해 측정합니다.
+ */
+class FLogBenchmark
+{
+public:
+	static constexpr uint32 DEFAULT_MESSAGES_PER_PRODUCER = 100000;
+
+	static void Run(TArray<FLogBenchmarkResult>& OutResults, uint32 InMessagesPerProducer = DEFAULT_MESSAGES_PER_PRODUCER);
+};
@@ -1,14 +1,17 @@
 #pragma once
+#include "Utility/Public/LogQueue.h"
+#include "Platform/Public/PlatformFile.h"
+
 #include <thread>
-#include <queue>
-#include <mutex>
-#include <condition_variable>
 #include <atomic>
 #include <string>
 
 /**
  * @brief 비동기 로그 파일 작성기
  * 워커 스레드를 사용하여 메인 스레드 성능 영향 최소화
+ *
+ * 로그는 잠금 없는 FLogQueue에 포맷된 상태로 들어가고, 워커 스레드가 모아서 한 번의 FPlatformFile::Write로 씁니다.
+ * 큐가 가득 차면 기본적으로 버리며(Drop), 버려진 수는 다음 쓰기 때 파일에 함께 기록합니다.
  */
 class FLogFileWriter
 {
@@ -20,8 +23,13 @@ public:
 	void Initialize();
 	void Shutdown();
 
-	// 로그 추가
+	// 로그 추가 (모든 스레드)
 	void AddLog(const FString& InLog);
+	void AddLog(const char* InPrefix, const char* InMessage);
+
+	void SetFullPolicy(ELogQueueFullPolicy InFullPolicy) { LogQueue.SetFullPolicy(InFullPolicy); }
+	uint64 GetDroppedCount() const { return LogQueue.GetDroppedCount(); }
+	uint64 GetBlockedCount() const { return LogQueue.GetBlockedCount(); }
 
 	bool IsInitialized() const
 	{
@@ -43,18 +51,19 @@ private:
 	static FString GenerateLogFileName();
 
 	// 파일 쓰기
-	void WriteBatchToFile(const std::vector<FString>& InBatch) const;
+	void WriteBatchToFile(const FString& InBatch) const;
 
 	std::thread WorkerThread;
-	std::queue<FString> LogQueue;
-	std::mutex QueueMutex;
-	std::condition_variable QueueCondition;
+	FLogQueue LogQueue;
 	std::atomic<bool> bShouldStop;
 	std::atomic<bool> bIsInitialized;
 
-	HANDLE FileHandle;
+	FPlatformFile::FHandle FileHandle;
 	FString CurrentLogFileName;
 
 	static constexpr uint32 MaxLogFiles = 20;
-	static constexpr uint32 BatchSize = 100;
+	// 한 번의 Write로 쓰는 최대 크기
+	static constexpr uint32 BatchBytes = 64 * 1024;
+	// 큐가 비었을 때 워커가 다시 확인하기까지의 대기 시간
+	static constexpr uint32 IdleSleepMilliseconds = 2;
 };
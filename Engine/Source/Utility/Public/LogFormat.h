@@ -0,0 +1,454 @@
+#pragma once
+#include "Global/Types.h"
+
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @brief 컴파일 타임에 검사하고 분해하는 UE_LOG 포맷 문자열
+ *
+ * UE_LOG 계열 매크로는 포맷 리터럴을 constexpr로 해석해 지정자 개수와 인자 타입의 호환 여부를 static_assert로 검사하고,
+ * 포맷을 "리터럴 + 지정자" 세그먼트 표(TParsedFormat)로 나눠 호출 지점마다 상수로 둡니다.
+ * 런타임에는 FormatTo가 세그먼트의 리터럴과 인자를 차례로 이어 붙이기만 하며,
+ * 플래그와 폭이 없는 지정자(%d %u %zu %x %s %.2f 등)는 printf 해석 없이 바로 변환합니다.
+ *
+ * 인자는 가변 인자로 넘기지 않으므로 길이 수정자(l, ll, z, I64)와 실제 정수 크기가 달라도 값이 깨지지 않고,
+ * FString도 %s에 그대로 넘길 수 있습니다. '*' 폭/정밀도와 %n은 지원하지 않습니다.
+ */
+namespace LogFormat
+{
+	constexpr uint32 MAX_SPEC_LENGTH = 16;
+
+	/**
+	 * @brief 지정자가 받는 인자 종류
+	 * None은 지정자 없이 리터럴만 있는 세그먼트(포맷 끝, %% 앞)입니다.
+	 */
+	enum class EArgumentKind : uint8
+	{
+		None,
+		Integer,
+		Float,
+		String,
+		WideString,
+		Pointer,
+		Unsupported,
+	};
+
+	/**
+	 * @brief 지정자 하나와 그 앞의 리터럴
+	 * Spec은 snprintf에 바로 넘길 수 있도록 정규화한 지정자입니다. (정수는 "ll"로 통일, 예: "%08lX" -> "%08llX")
+	 */
+	struct FSegment
+	{
+		uint16 LiteralOffset = 0;
+		uint16 LiteralLength = 0;
+		EArgumentKind Kind = EArgumentKind::None;
+		char Conversion = 0;
+		int8 Precision = -1;
+		bool bIsPlain = true;	// 플래그와 폭이 없으면 snprintf를 거치지 않음
+		char Spec[MAX_SPEC_LENGTH] = {};
+	};
+	static_assert(sizeof(FSegment) == 24, "FSegment is stored per UE_LOG call site");
+
+	template<uint32 InSegmentCount>
+	struct TParsedFormat
+	{
+		static constexpr uint32 SEGMENT_COUNT = InSegmentCount;
+		FSegment Segments[InSegmentCount] = {};
+	};
+
+	template<typename... TArgs>
+	struct TArgumentList
+	{
+		static constexpr uint32 COUNT = sizeof...(TArgs);
+	};
+
+	/** @brief 인자 식의 타입만 얻기 위한 선언 (decltype 안에서만 사용, 정의 없음) */
+	template<typename... TArgs>
+	TArgumentList<std::decay_t<TArgs>...> MakeArgumentList(const TArgs&...);
+
+	template<typename T>
+	constexpr EArgumentKind GetArgumentKind()
+	{
+		using TPointee = std::remove_cv_t<std::remove_pointer_t<T>>;
+
+		if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+		{
+			return EArgumentKind::Integer;
+		}
+		else if constexpr (std::is_floating_point_v<T>)
+		{
+			return EArgumentKind::Float;
+		}
+		else if constexpr (std::is_same_v<T, FString> || (std::is_pointer_v<T> && std::is_same_v<TPointee, char>))
+		{
+			return EArgumentKind::String;
+		}
+		else if constexpr (std::is_pointer_v<T> && std::is_same_v<TPointee, wchar_t>)
+		{
+			return EArgumentKind::WideString;
+		}
+		else if constexpr (std::is_pointer_v<T> || std::is_null_pointer_v<T>)
+		{
+			return EArgumentKind::Pointer;
+		}
+		else
+		{
+			return EArgumentKind::Unsupported;
+		}
+	}
+
+	/**
+	 * @brief InFormat[InIndex]부터 다음 지정자까지 읽어 세그먼트 하나를 채웁니다.
+	 * @return 다음 세그먼트의 시작 위치. 잘못된 지정자면 0
+	 */
+	constexpr uint32 ParseSegment(const char* InFormat, uint32 InIndex, FSegment& OutSegment)
+	{
+		OutSegment.LiteralOffset = static_cast<uint16>(InIndex);
+		while (InFormat[InIndex] != '\0' && InFormat[InIndex] != '%')
+		{
+			++InIndex;
+		}
+		OutSegment.LiteralLength = static_cast<uint16>(InIndex - OutSegment.LiteralOffset);
+
+		if (InFormat[InIndex] == '\0')
+		{
+			return InIndex;
+		}
+
+		// "%%"는 '%' 하나를 리터럴에 포함시키고 세그먼트를 끝냄
+		if (InFormat[InIndex + 1] == '%')
+		{
+			++OutSegment.LiteralLength;
+			return InIndex + 2;
+		}
+
+		uint32 SpecLength = 0;
+		OutSegment.Spec[SpecLength++] = '%';
+		++InIndex;
+
+		// 플래그와 폭
+		while (InFormat[InIndex] == '-' || InFormat[InIndex] == '+' || InFormat[InIndex] == ' ' ||
+			InFormat[InIndex] == '#' || InFormat[InIndex] == '0' ||
+			(InFormat[InIndex] >= '1' && InFormat[InIndex] <= '9'))
+		{
+			OutSegment.bIsPlain = false;
+			if (SpecLength + 6 >= MAX_SPEC_LENGTH)
+			{
+				return 0;
+			}
+			OutSegment.Spec[SpecLength++] = InFormat[InIndex++];
+		}
+
+		// 정밀도
+		if (InFormat[InIndex] == '.')
+		{
+			OutSegment.Spec[SpecLength++] = InFormat[InIndex++];
+			OutSegment.Precision = 0;
+			while (InFormat[InIndex] >= '0' && InFormat[InIndex] <= '9')
+			{
+				if (SpecLength + 6 >= MAX_SPEC_LENGTH || OutSegment.Precision > 9)
+				{
+					return 0;
+				}
+				OutSegment.Precision = static_cast<int8>(OutSegment.Precision * 10 + (InFormat[InIndex] - '0'));
+				OutSegment.Spec[SpecLength++] = InFormat[InIndex++];
+			}
+		}
+
+		// 길이 수정자는 인자를 직접 변환하므로 건너뛰고, 와이드 문자열 여부만 기억
+		bool bIsWide = false;
+		while (true)
+		{
+			const char Modifier = InFormat[InIndex];
+			if (Modifier == 'l' || Modifier == 'w')
+			{
+				bIsWide = true;
+				++InIndex;
+			}
+			else if (Modifier == 'h' || Modifier == 'z' || Modifier == 'j' || Modifier == 't' || Modifier == 'L' || Modifier == 'q')
+			{
+				++InIndex;
+			}
+			else if (Modifier == 'I')
+			{
+				++InIndex;
+				if ((InFormat[InIndex] == '6' && InFormat[InIndex + 1] == '4') || (InFormat[InIndex] == '3' && InFormat[InIndex + 1] == '2'))
+				{
+					InIndex += 2;
+				}
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		const char Conversion = InFormat[InIndex];
+		switch (Conversion)
+		{
+		case 'd': case 'i': case 'u': case 'x': case 'X': case 'o':
+			OutSegment.Kind = EArgumentKind::Integer;
+			OutSegment.Spec[SpecLength++] = 'l';
+			OutSegment.Spec[SpecLength++] = 'l';
+			break;
+		case 'c':
+			OutSegment.Kind = EArgumentKind::Integer;
+			if (bIsWide)
+			{
+				OutSegment.Spec[SpecLength++] = 'l';
+			}
+			break;
+		case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+			OutSegment.Kind = EArgumentKind::Float;
+			break;
+		case 's':
+			OutSegment.Kind = bIsWide ? EArgumentKind::WideString : EArgumentKind::String;
+			if (bIsWide)
+			{
+				OutSegment.Spec[SpecLength++] = 'l';
+			}
+			break;
+		case 'p':
+			OutSegment.Kind = EArgumentKind::Pointer;
+			break;
+		default:
+			// '*', %n, 알 수 없는 변환, 포맷 끝의 '%'
+			return 0;
+		}
+
+		OutSegment.Conversion = Conversion;
+		OutSegment.Spec[SpecLength++] = Conversion;
+		OutSegment.Spec[SpecLength] = '\0';
+		return InIndex + 1;
+	}
+
+	/** @brief 포맷의 모든 지정자가 지원되는 형태인지 확인합니다. */
+	constexpr bool IsValidFormat(const char* InFormat)
+	{
+		for (uint32 Index = 0; InFormat[Index] != '\0';)
+		{
+			FSegment Segment;
+			Index = ParseSegment(InFormat, Index, Segment);
+			if (Index == 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** @brief 세그먼트 수 (마지막 리터럴 세그먼트 포함) */
+	constexpr uint32 CountSegments(const char* InFormat)
+	{
+		uint32 Count = 1;
+		for (uint32 Index = 0; InFormat[Index] != '\0'; ++Count)
+		{
+			FSegment Segment;
+			Index = ParseSegment(InFormat, Index, Segment);
+			if (Index == 0)
+			{
+				break;
+			}
+		}
+		return Count;
+	}
+
+	/** @brief 인자를 받는 지정자 수 */
+	constexpr uint32 CountSpecifiers(const char* InFormat)
+	{
+		uint32 Count = 0;
+		for (uint32 Index = 0; InFormat[Index] != '\0';)
+		{
+			FSegment Segment;
+			Index = ParseSegment(InFormat, Index, Segment);
+			if (Index == 0)
+			{
+				break;
+			}
+			Count += Segment.Kind != EArgumentKind::None ? 1 : 0;
+		}
+		return Count;
+	}
+
+	constexpr bool IsCompatible(EArgumentKind InSpecifierKind, EArgumentKind InArgumentKind)
+	{
+		if (InSpecifierKind == EArgumentKind::Pointer)
+		{
+			return InArgumentKind == EArgumentKind::Pointer || InArgumentKind == EArgumentKind::String || InArgumentKind == EArgumentKind::WideString;
+		}
+		return InSpecifierKind == InArgumentKind;
+	}
+
+	/** @brief 지정자와 인자 타입을 앞에서부터 짝지어 모두 호환되는지 확인합니다. (개수 검사는 CountSpecifiers로 따로 함) */
+	template<typename... TArgs>
+	constexpr bool AreArgumentsCompatible(const char* InFormat, TArgumentList<TArgs...>)
+	{
+		constexpr EArgumentKind ArgumentKinds[] = { GetArgumentKind<TArgs>()..., EArgumentKind::None };
+
+		uint32 ArgumentIndex = 0;
+		for (uint32 Index = 0; InFormat[Index] != '\0';)
+		{
+			FSegment Segment;
+			Index = ParseSegment(InFormat, Index, Segment);
+			if (Index == 0)
+			{
+				return false;
+			}
+			if (Segment.Kind == EArgumentKind::None)
+			{
+				continue;
+			}
+			if (ArgumentIndex >= sizeof...(TArgs) || !IsCompatible(Segment.Kind, ArgumentKinds[ArgumentIndex]))
+			{
+				return false;
+			}
+			++ArgumentIndex;
+		}
+		return true;
+	}
+
+	template<uint32 SegmentCount>
+	constexpr TParsedFormat<SegmentCount> ParseFormat(const char* InFormat)
+	{
+		TParsedFormat<SegmentCount> Result;
+		uint32 Index = 0;
+		for (uint32 SegmentIndex = 0; SegmentIndex < SegmentCount; ++SegmentIndex)
+		{
+			Index = ParseSegment(InFormat, Index, Result.Segments[SegmentIndex]);
+		}
+		return Result;
+	}
+
+	/**
+	 * @brief 로그 한 줄을 만드는 버퍼
+	 * 대부분의 로그는 스택의 INLINE_CAPACITY 안에 들어가며, 넘칠 때만 new로 늘립니다. 항상 널 종료 상태를 유지합니다.
+	 */
+	class FMessageBuffer
+	{
+	public:
+		static constexpr size_t INLINE_CAPACITY = 512;
+
+		FMessageBuffer() { InlineData[0] = '\0'; }
+		~FMessageBuffer();
+
+		void Append(const char* InData, size_t InLength);
+		void Append(char InCharacter) { Append(&InCharacter, 1); }
+
+		/** @brief 지정자 하나를 snprintf로 포맷해 붙입니다. (플래그/폭이 있거나 빠른 경로가 없는 경우) */
+		template<typename... TArgs>
+		void AppendPrintf(const char* InSpec, TArgs... InArgs)
+		{
+			const size_t Remaining = Capacity - Length;
+			const int Written = snprintf(Data + Length, Remaining, InSpec, InArgs...);
+			if (Written < 0)
+			{
+				Data[Length] = '\0';
+				return;
+			}
+			if (static_cast<size_t>(Written) >= Remaining)
+			{
+				Reserve(Length + Written + 1);
+				(void)snprintf(Data + Length, Capacity - Length, InSpec, InArgs...);
+			}
+			Length += Written;
+		}
+
+		const char* GetData() const { return Data; }
+		size_t GetLength() const { return Length; }
+
+		FMessageBuffer(const FMessageBuffer&) = delete;
+		FMessageBuffer& operator=(const FMessageBuffer&) = delete;
+
+	private:
+		void Reserve(size_t InCapacity);
+
+		char InlineData[INLINE_CAPACITY];
+		char* Data = InlineData;
+		size_t Length = 0;
+		size_t Capacity = INLINE_CAPACITY;
+	};
+
+	void AppendInteger(FMessageBuffer& OutBuffer, const FSegment& InSegment, long long InSigned, unsigned long long InUnsigned);
+	void AppendFloat(FMessageBuffer& OutBuffer, const FSegment& InSegment, double InValue);
+	void AppendString(FMessageBuffer& OutBuffer, const FSegment& InSegment, const char* InString, size_t InLength);
+
+	template<typename T>
+	void AppendArgument(FMessageBuffer& OutBuffer, const FSegment& InSegment, const T& InValue)
+	{
+		if constexpr (std::is_array_v<T>)
+		{
+			AppendArgument(OutBuffer, InSegment, static_cast<const std::remove_extent_t<T>*>(InValue));
+		}
+		else if constexpr (std::is_same_v<T, bool>)
+		{
+			AppendInteger(OutBuffer, InSegment, InValue ? 1 : 0, InValue ? 1u : 0u);
+		}
+		else if constexpr (std::is_enum_v<T>)
+		{
+			AppendArgument(OutBuffer, InSegment, static_cast<std::underlying_type_t<T>>(InValue));
+		}
+		else if constexpr (std::is_integral_v<T>)
+		{
+			// %x에 음수를 넘기면 printf처럼 인자 크기의 2의 보수로 출력
+			AppendInteger(OutBuffer, InSegment, static_cast<long long>(InValue), static_cast<std::make_unsigned_t<T>>(InValue));
+		}
+		else if constexpr (std::is_floating_point_v<T>)
+		{
+			AppendFloat(OutBuffer, InSegment, static_cast<double>(InValue));
+		}
+		else if constexpr (std::is_same_v<T, FString>)
+		{
+			AppendString(OutBuffer, InSegment, InValue.data(), InValue.size());
+		}
+		else if constexpr (GetArgumentKind<T>() == EArgumentKind::String)
+		{
+			AppendString(OutBuffer, InSegment, InValue ? InValue : "(null)", InValue ? strlen(InValue) : 6);
+		}
+		else if constexpr (GetArgumentKind<T>() == EArgumentKind::WideString)
+		{
+			OutBuffer.AppendPrintf(InSegment.Spec, InValue ? InValue : L"(null)");
+		}
+		else
+		{
+			static_assert(GetArgumentKind<T>() == EArgumentKind::Pointer, "UE_LOG: unsupported argument type");
+			OutBuffer.AppendPrintf(InSegment.Spec, static_cast<const void*>(InValue));
+		}
+	}
+
+	/** @brief 지정자를 만날 때까지의 리터럴 세그먼트를 붙이고, 지정자 세그먼트의 인자를 포맷합니다. */
+	template<typename T>
+	void AppendNextArgument(FMessageBuffer& OutBuffer, const FSegment*& InOutSegment, const char* InFormat, const T& InValue)
+	{
+		while (true)
+		{
+			const FSegment& Segment = *InOutSegment++;
+			OutBuffer.Append(InFormat + Segment.LiteralOffset, Segment.LiteralLength);
+			if (Segment.Kind != EArgumentKind::None)
+			{
+				AppendArgument(OutBuffer, Segment, InValue);
+				return;
+			}
+		}
+	}
+
+	/**
+	 * @brief 미리 분해한 세그먼트로 로그 메시지를 만듭니다.
+	 * 지정자와 인자의 짝은 매크로의 static_assert가 이미 보장합니다.
+	 * 세그먼트 수를 템플릿 인자로 받지 않으므로 인자 타입 조합이 같은 호출 지점끼리 같은 인스턴스를 공유합니다.
+	 */
+	template<typename... TArgs>
+	void FormatTo(FMessageBuffer& OutBuffer, const FSegment* InSegments, uint32 InSegmentCount, const char* InFormatText, const TArgs&... InArgs)
+	{
+		const FSegment* Segment = InSegments;
+		(AppendNextArgument(OutBuffer, Segment, InFormatText, InArgs), ...);
+
+		const FSegment* const End = InSegments + InSegmentCount;
+		for (; Segment != End; ++Segment)
+		{
+			OutBuffer.Append(InFormatText + Segment->LiteralOffset, Segment->LiteralLength);
+		}
+	}
+}
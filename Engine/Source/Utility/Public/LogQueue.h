@@ -0,0 +1,96 @@
+#pragma once
+#include "Global/Types.h"
+
+#include <atomic>
+
+/**
+ * @brief 큐가 가득 찼을 때 생산자의 동작
+ */
+enum class ELogQueueFullPolicy : uint8
+{
+	Drop,	// 로그를 버리고 DroppedCount 증가 (게임 스레드가 멈추지 않음)
+	Block,	// 소비자가 공간을 비울 때까지 대기 (BlockedCount 증가, 소비자가 돌고 있어야 함)
+};
+
+/**
+ * @brief 여러 스레드가 쓰고 한 스레드가 읽는 잠금 없는 로그 큐 (MPSC)
+ *
+ * 고정 크기 바이트 아레나를 링 버퍼로 사용합니다. 생산자는 WriteCursor를 CAS로 전진시켜
+ * 레코드 공간을 예약한 뒤, 이미 포맷된 텍스트를 복사하고 헤더의 크기를 기록(release)해 공개합니다.
+ * 소비자는 예약 순서대로 공개된 레코드만 읽고, 읽은 영역을 0으로 되돌린 뒤 ReadCursor를 전진시킵니다.
+ * 레코드가 아레나 끝을 넘으면 남은 공간을 패딩 레코드로 채우고 처음부터 씁니다.
+ *
+ * 레코드 텍스트는 "Prefix Message\r\n" 형태로 저장되어 소비자는 그대로 이어 붙여 파일에 쓰면 됩니다.
+ * PushBytes로 넣은 바이너리 레코드도 같은 방식으로 이어 붙으므로, 레코드가 스스로 길이를 담고 있어야 합니다.
+ */
+class FLogQueue
+{
+public:
+	static constexpr uint32 DEFAULT_CAPACITY = 1 << 20;
+	static constexpr uint32 MAX_MESSAGE_LENGTH = 4096;
+
+	explicit FLogQueue(uint32 InCapacity = DEFAULT_CAPACITY, ELogQueueFullPolicy InFullPolicy = ELogQueueFullPolicy::Drop);
+	~FLogQueue();
+
+	/**
+	 * @brief 로그 한 줄을 추가합니다. (모든 스레드)
+	 * MAX_MESSAGE_LENGTH를 넘는 메시지는 잘립니다.
+	 * @return Drop 정책에서 공간이 없으면 false
+	 */
+	bool Push(const char* InPrefix, const char* InMessage);
+
+	/**
+	 * @brief 바이너리 레코드 하나를 그대로 추가합니다. (모든 스레드)
+	 * @return 크기가 MAX_MESSAGE_LENGTH를 넘거나, Drop 정책에서 공간이 없으면 false
+	 */
+	bool PushBytes(const void* InData, uint32 InSize);
+
+	/**
+	 * @brief 공개된 레코드를 OutBuffer 뒤에 이어 붙입니다. (소비자 스레드 전용)
+	 * @param InMaxBytes OutBuffer가 이 크기 이상이 되면 중단
+	 * @return 꺼낸 레코드 수
+	 */
+	uint32 Drain(FString& OutBuffer, size_t InMaxBytes);
+
+	void SetFullPolicy(ELogQueueFullPolicy InFullPolicy) { FullPolicy.store(InFullPolicy, std::memory_order_relaxed); }
+	ELogQueueFullPolicy GetFullPolicy() const { return FullPolicy.load(std::memory_order_relaxed); }
+
+	/** @brief 공간이 없어 버려진 로그 수 (누적) */
+	uint64 GetDroppedCount() const { return DroppedCount.load(std::memory_order_relaxed); }
+	/** @brief 공간이 없어 대기한 Push 수 (누적) */
+	uint64 GetBlockedCount() const { return BlockedCount.load(std::memory_order_relaxed); }
+
+	FLogQueue(const FLogQueue&) = delete;
+	FLogQueue& operator=(const FLogQueue&) = delete;
+
+private:
+	/**
+	 * @brief 레코드 헤더 (8바이트 정렬)
+	 * Size가 0이면 아직 공개되지 않은 레코드이며, PADDING_FLAG가 있으면 아레나 끝을 채우는 빈 레코드입니다.
+	 */
+	struct FRecordHeader
+	{
+		std::atomic<uint32> Size;
+		uint32 Length;
+	};
+
+	static constexpr uint32 RECORD_ALIGNMENT = 8;
+	static constexpr uint32 PADDING_FLAG = 0x80000000u;
+
+	/** @brief InLength 바이트 레코드 공간을 예약합니다. 채운 뒤 Publish로 공개해야 하며, 공간이 없으면 nullptr */
+	FRecordHeader* Reserve(uint32 InLength, uint32& OutRecordSize);
+	static void Publish(FRecordHeader* InHeader, uint32 InLength, uint32 InRecordSize);
+	FRecordHeader* GetHeader(uint64 InCursor) const;
+
+	uint8* Arena;
+	uint32 Capacity;
+
+	std::atomic<ELogQueueFullPolicy> FullPolicy;
+
+	// 생산자와 소비자가 서로 다른 캐시 라인의 커서를 갱신하도록 분리
+	alignas(64) std::atomic<uint64> WriteCursor{ 0 };
+	alignas(64) std::atomic<uint64> ReadCursor{ 0 };
+
+	alignas(64) std::atomic<uint64> DroppedCount{ 0 };
+	std::atomic<uint64> BlockedCount{ 0 };
+};
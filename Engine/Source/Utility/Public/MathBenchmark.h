@@ -0,0 +1,25 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 벤치마크 항목 하나의 결과
+ */
+struct FMathBenchmarkResult
+{
+	const char* Name = nullptr;
+	double NanosecondsPerOp = 0.0;
+};
+
+/**
+ * @brief FVector / FVector4 / FMatrix 핵심 연산의 마이크로 벤치마크
+ * 콘솔의 "bench math" 명령으로 실행하며, 항목마다 같은 입력을 반복 처리한 평균 시간을 측정합니다.
+ */
+class FMathBenchmark
+{
+public:
+	static constexpr uint32 DEFAULT_ELEMENT_COUNT = 4096;
+	static constexpr uint32 DEFAULT_REPEAT_COUNT = 256;
+
+	static void Run(TArray<FMathBenchmarkResult>& OutResults,
+		uint32 InElementCount = DEFAULT_ELEMENT_COUNT, uint32 InRepeatCount = DEFAULT_REPEAT_COUNT);
+};
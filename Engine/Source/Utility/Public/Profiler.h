@@ -0,0 +1,221 @@
+#pragma once
+#include "Global/Types.h"
+#include "Platform/Public/PlatformTime.h"
+
+#include <atomic>
+#include <mutex>
+
+/**
+ * @brief 이름을 한 번만 등록해 얻는 측정 지점 ID
+ * 측정 지점마다 정적 변수로 두면 (TIME_PROFILE) 런타임에는 문자열 비교나 해시 없이 인덱스만 사용합니다.
+ */
+struct TStatId
+{
+	static constexpr uint32 INVALID_INDEX = 0xFFFFFFFFu;
+
+	uint32 Index = INVALID_INDEX;
+
+	TStatId() = default;
+	explicit TStatId(const char* InName);
+
+	bool IsValid() const { return Index != INVALID_INDEX; }
+};
+
+/**
+ * @brief 호출 트리의 노드 하나에 대한 프레임 통계 (GetCallTree 결과)
+ */
+struct FProfileNodeStats
+{
+	const char* Name = nullptr;
+	uint32 ThreadIndex = 0;
+	uint32 Depth = 0;
+
+	// 마지막 프레임 값 (호출되지 않았으면 0)
+	double LastMilliseconds = 0.0;
+	uint32 LastCallCount = 0;
+
+	// 호출된 프레임들의 기록 기준 (최근 HISTORY_FRAME_COUNT 프레임)
+	double MinMilliseconds = 0.0;
+	double AvgMilliseconds = 0.0;
+	double MaxMilliseconds = 0.0;
+	double P99Milliseconds = 0.0;
+	uint32 SampleCount = 0;
+};
+
+/**
+ * @brief 스레드별, 계층형 CPU 프로파일러
+ *
+ * 각 스레드는 자신의 호출 트리(측정 지점이 열린 순서대로 만든 부모-자식 노드)와
+ * 완료된 구간을 담는 링 버퍼를 가집니다. 구간 기록은 해당 스레드만 쓰므로 잠금이 없고,
+ * 메인 스레드가 프레임 끝(EndFrame)에 모든 스레드의 링 버퍼를 비우며 노드별 프레임 시간을 누적합니다.
+ * 노드마다 최근 HISTORY_FRAME_COUNT 프레임의 기록을 두어 최소/평균/최대/p99를 계산합니다.
+ *
+ * 노드 시간은 하위 구간을 포함한 시간(Inclusive)입니다.
+ *
+ * 트레이스 캡처(BeginTraceCapture) 중에는 EndFrame이 비우는 구간을 그대로 복사해 두었다가
+ * 지정한 프레임 수가 지나면 Chrome Trace Event JSON으로 저장합니다. (chrome://tracing, ui.perfetto.dev)
+ * 캡처와 별개로 최근 RECENT_EVENT_BUFFER_SIZE개의 구간을 항상 남겨 두므로, 히치 직후에
+ * WriteRecentTrace로 직전 몇 초를 같은 형식으로 저장할 수 있습니다.
+ */
+class FProfiler
+{
+public:
+	static constexpr uint32 MAX_STATS = 1024;
+	static constexpr uint32 MAX_THREADS = 32;
+	static constexpr uint32 MAX_NODES_PER_THREAD = 2048;
+	static constexpr uint32 MAX_SCOPE_DEPTH = 64;
+	static constexpr uint32 EVENT_BUFFER_SIZE = 1 << 15;
+	static constexpr uint32 HISTORY_FRAME_COUNT = 128;
+	static constexpr uint32 RECENT_EVENT_BUFFER_SIZE = 1 << 16;
+
+	// 종료 시점의 정적 객체 소멸 중에도 측정 구간이 닫힐 수 있으므로 해제하지 않음
+	static FProfiler& GetInstance()
+	{
+		static FProfiler* Instance = new FProfiler();
+		return *Instance;
+	}
+
+	/** @brief 이름을 등록하고 ID를 반환합니다. 같은 이름은 같은 ID를 받습니다. (측정 지점당 한 번 호출) */
+	uint32 RegisterStat(const char* InName);
+	const char* GetStatName(uint32 InStatIndex) const;
+
+	/** @brief 현재 스레드의 이름 (트리 표시용, 스레드 시작 시 한 번 호출) */
+	void SetCurrentThreadName(const char* InName);
+	const char* GetThreadName(uint32 InThreadIndex) const;
+
+	/** @brief 구간 시작. 반환값은 EndScope에 그대로 넘깁니다. (깊이 초과 등으로 기록하지 않으면 INVALID_INDEX) */
+	uint32 BeginScope(TStatId InStatId);
+	void EndScope(uint32 InNodeIndex, uint64 InStartCycles, uint64 InEndCycles);
+
+	/** @brief 모든 스레드의 이번 프레임 구간을 모아 노드별 기록에 추가합니다. (메인 스레드, 프레임마다 한 번) */
+	void EndFrame();
+
+	/** @brief 호출 트리를 스레드별 깊이 우선 순서로 펼쳐 반환합니다. (메인 스레드) */
+	void GetCallTree(TArray<FProfileNodeStats>& OutNodes) const;
+
+	/**
+	 * @brief 다음 프레임부터 InFrameCount 프레임 동안의 구간을 모아 InFilePath에 저장합니다. (메인 스레드)
+	 * 기록 경로는 평소와 같고 EndFrame에서 복사만 추가되므로, 캡처 중에도 측정 지점의 비용은 그대로입니다.
+	 * @return 이미 캡처 중이거나 프레임 수가 0이면 false
+	 */
+	bool BeginTraceCapture(uint32 InFrameCount, const FString& InFilePath);
+	bool IsCapturingTrace() const { return bTraceCapturePending || TraceFramesRemaining > 0; }
+
+	/**
+	 * @brief 최근 InSeconds초 동안 닫힌 구간을 Chrome Trace Event JSON으로 저장합니다. (메인 스레드)
+	 * 최근 구간 버퍼 크기를 넘는 과거는 포함되지 않습니다.
+	 */
+	bool WriteRecentTrace(double InSeconds, const FString& InFilePath) const;
+
+	uint64 GetFrameNumber() const { return FrameNumber; }
+	/** @brief 링 버퍼가 가득 차 버려진 구간 수 (누적) */
+	uint64 GetDroppedEventCount() const;
+
+	FProfiler(const FProfiler&) = delete;
+	FProfiler& operator=(const FProfiler&) = delete;
+
+private:
+	FProfiler() = default;
+	~FProfiler() = default;
+
+	/**
+	 * @brief 완료된 구간 하나
+	 */
+	struct FScopeEvent
+	{
+		uint64 StartCycles;
+		uint64 EndCycles;
+		uint32 NodeIndex;
+	};
+
+	/**
+	 * @brief 호출 트리 노드
+	 * Parent/StatIndex/Depth는 공개(NodeCount 증가) 이후 바뀌지 않으므로 메인 스레드가 읽을 수 있고,
+	 * FirstChild/NextSibling은 소유 스레드만 사용합니다.
+	 */
+	struct FCallNode
+	{
+		uint32 Parent;
+		uint32 StatIndex;
+		uint32 Depth;
+		uint32 FirstChild;
+		uint32 NextSibling;
+	};
+
+	/**
+	 * @brief 노드별 프레임 기록 (메인 스레드 전용)
+	 */
+	struct FNodeHistory
+	{
+		uint64 FrameCycles = 0;
+		uint32 FrameCallCount = 0;
+
+		double LastMilliseconds = 0.0;
+		uint32 LastCallCount = 0;
+
+		float Samples[HISTORY_FRAME_COUNT] = {};
+		uint32 SampleCount = 0;
+		uint32 NextSample = 0;
+	};
+
+	/**
+	 * @brief 트레이스 캡처용으로 복사한 구간
+	 */
+	struct FTraceEvent
+	{
+		uint64 StartCycles;
+		uint64 EndCycles;
+		uint32 StatIndex;
+		uint32 ThreadIndex;
+	};
+
+	struct FThreadState
+	{
+		const char* Name = "Thread";
+
+		// 소유 스레드 전용
+		uint32 CurrentNode = 0;
+		std::atomic<uint64> DroppedEvents{ 0 };
+
+		FCallNode Nodes[MAX_NODES_PER_THREAD];
+		std::atomic<uint32> NodeCount{ 0 };
+
+		// 단일 생산자(소유 스레드) / 단일 소비자(EndFrame) 링 버퍼
+		FScopeEvent Events[EVENT_BUFFER_SIZE];
+		std::atomic<uint64> WriteIndex{ 0 };
+		std::atomic<uint64> ReadIndex{ 0 };
+
+		// 메인 스레드 전용
+		TArray<FNodeHistory> Histories;
+	};
+
+	FThreadState& GetCurrentThreadState();
+	uint32 FindOrAddChild(FThreadState& InState, uint32 InParentNode, uint32 InStatIndex);
+	bool WriteTraceFile(const FString& InFilePath, const TArray<FTraceEvent>& InEvents, uint64 InStartCycles) const;
+	static void AppendSubtree(const FThreadState& InState, uint32 InThreadIndex, uint32 InNodeIndex,
+		const TArray<TArray<uint32>>& InChildren, TArray<FProfileNodeStats>& OutNodes);
+
+	static thread_local FThreadState* CurrentThreadState;
+
+	mutable std::mutex RegisterMutex;
+
+	const char* StatNames[MAX_STATS] = {};
+	std::atomic<uint32> StatCount{ 0 };
+
+	FThreadState* Threads[MAX_THREADS] = {};
+	std::atomic<uint32> ThreadCount{ 0 };
+
+	uint64 FrameNumber = 0;
+
+	// 트레이스 캡처 (메인 스레드 전용)
+	TArray<FTraceEvent> TraceEvents;
+	FString TraceFilePath;
+	uint32 TraceFrameCount = 0;
+	uint32 TraceFramesRemaining = 0;
+	uint64 TraceStartCycles = 0;
+	bool bTraceCapturePending = false;
+
+	// 최근 구간 링 버퍼 (메인 스레드 전용, 처음 쓸 때 할당)
+	TArray<FTraceEvent> RecentEvents;
+	uint64 RecentWriteIndex = 0;
+};
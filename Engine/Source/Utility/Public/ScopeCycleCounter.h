@@ -1,8 +1,11 @@
 ﻿#pragma once
-#include "Global/Types.h"
+#include "Utility/Public/Profiler.h"
 
 #ifdef _DEVELOP //_DEVELOP 이 정의 되어 있을때만 측정
-	#define TIME_PROFILE(Key) FScopeCycleCounter Key##Counter(#Key);
+	// 측정 지점마다 이름을 한 번만 등록하는 정적 ID를 두고, 이후에는 인덱스만 사용
+	#define TIME_PROFILE(Key) \
+	static const TStatId Key##StatId(#Key); \
+	FScopeCycleCounter Key##Counter(Key##StatId);
 #else
 	#define TIME_PROFILE(Key) //_DEVELOP 미정의시 빈칸
 #endif
@@ -14,93 +17,22 @@
 	#define TIME_PROFILE_END(Key)
 #endif
 
-class FWindowsPlatformTime
-{
-public:
-	static double GSecondsPerCycle; // 0
-	static bool bInitialized; // false
-
-	static void InitTiming()
-	{
-		if (!bInitialized)
-		{
-			bInitialized = true;
-
-			double Frequency = (double)GetFrequency();
-			if (Frequency <= 0.0)
-			{
-				Frequency = 1.0;
-			}
-
-			GSecondsPerCycle = 1.0 / Frequency;
-		}
-	}
-	static double GetSecondsPerCycle()
-	{
-		if (!bInitialized)
-		{
-			InitTiming();
-		}
-		return (double)GSecondsPerCycle;
-	}
-	static uint64 GetFrequency()
-	{
-		LARGE_INTEGER Frequency;
-		QueryPerformanceFrequency(&Frequency);
-		return Frequency.QuadPart;
-	}
-	static double ToMilliseconds(uint64 CycleDiff)
-	{
-		double Ms = static_cast<double>(CycleDiff)
-			* GetSecondsPerCycle()
-			* 1000.0;
-
-		return Ms;
-	}
-
-	static uint64 Cycles64()
-	{
-		LARGE_INTEGER CycleCount;
-		QueryPerformanceCounter(&CycleCount);
-		return (uint64)CycleCount.QuadPart;
-	}
-};
-
-struct TStatId
-{
-	FString Key;
-	TStatId() = default;
-	TStatId(const FString& InKey) : Key(InKey) {}
-};
-
-struct FTimeProfile
-{
-	double Milliseconds;
-	uint32 CallCount;
-
-	const char* GetConstChar() const
-	{
-		static char buffer[64]; // static으로 해야 반환 가능
-		snprintf(buffer, sizeof(buffer), " : %.3fms, Call : %d", Milliseconds, CallCount);
-		return buffer;
-	}
-};
-
-typedef FWindowsPlatformTime FPlatformTime;
-
+/**
+ * @brief 범위 시간 측정기
+ * TStatId를 넘기면 FProfiler의 현재 스레드 호출 트리에 구간으로 기록하고, 넘기지 않으면 시간만 잽니다.
+ * 구간은 생성된 역순으로 끝나야 합니다. (Finish로 일찍 끝내는 경우 포함)
+ */
 class FScopeCycleCounter
 {
 public:
-	FScopeCycleCounter(TStatId StatId)
-		: StartCycles(FPlatformTime::Cycles64()) //생성 시 사이클 저장
-		, UsedStatId(StatId) //키값 저장
-	{
-	}
-	FScopeCycleCounter() : StartCycles(FPlatformTime::Cycles64()), UsedStatId()
+	FScopeCycleCounter()
+		: StartCycles(FPlatformTime::Cycles64())
 	{
 	}
 
-	FScopeCycleCounter(const FString& Key) : StartCycles(FPlatformTime::Cycles64()), UsedStatId(TStatId(Key))
+	explicit FScopeCycleCounter(TStatId InStatId)
+		: NodeIndex(FProfiler::GetInstance().BeginScope(InStatId))
+		, StartCycles(FPlatformTime::Cycles64()) //생성 시 사이클 저장
 	{
 	}
 
@@ -109,6 +41,10 @@ public:
 		Finish();
 	}
 
+	FScopeCycleCounter(const FScopeCycleCounter&) = delete;
+	FScopeCycleCounter& operator=(const FScopeCycleCounter&) = delete;
+
+	/** @brief 측정을 끝내고 경과 시간(ms)을 반환합니다. 두 번째 호출부터는 0 */
 	double Finish()
 	{
 		if (bIsFinish == true)
@@ -117,26 +53,16 @@ public:
 		}
 		bIsFinish = true;
 		const uint64 EndCycles = FPlatformTime::Cycles64();
-		const uint64 CycleDiff = EndCycles - StartCycles;
 
-		double Milliseconds = FWindowsPlatformTime::ToMilliseconds(CycleDiff);
-		if (UsedStatId.Key.empty() == false)
+		if (NodeIndex != TStatId::INVALID_INDEX)
 		{
-			AddTimeProfile(UsedStatId, Milliseconds); //키 값이 있을경우 Map에 저장
+			FProfiler::GetInstance().EndScope(NodeIndex, StartCycles, EndCycles);
 		}
-		return Milliseconds;
+		return FPlatformTime::ToMilliseconds(EndCycles - StartCycles);
 	}
 
-	static void AddTimeProfile(const TStatId& Key, double InMilliseconds);
-	static void TimeProfileInit();
-
-	static const FTimeProfile& GetTimeProfile(const FString& Key); 
-	static const TArray<FString> GetTimeProfileKeys();
-	static const TArray<FTimeProfile> GetTimeProfileValues();
-
 private:
-	static TMap<FString, FTimeProfile> TimeProfileMap;
+	uint32 NodeIndex = TStatId::INVALID_INDEX;
 	bool bIsFinish = false;
 	uint64 StartCycles;
-	TStatId UsedStatId;
-};
\ No newline at end of file
+};
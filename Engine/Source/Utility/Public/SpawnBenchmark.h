@@ -0,0 +1,27 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 생성/소멸 벤치마크 항목 하나의 결과
+ */
+struct FSpawnBenchmarkResult
+{
+	const char* Name = nullptr;
+	double SpawnsPerSecond = 0.0;
+};
+
+/**
+ * @brief UObject 생성/소멸 처리량(초당 생성+소멸 쌍) 벤치마크
+ * 콘솔의 "bench spawn" 명령으로 실행하며, 라운드마다 객체 InObjectCount개를 만들고 섞인 순서로 소멸시킵니다.
+ * 같은 크기의 블록을 전역 operator new(기존 방식)와 FUObjectPool로 할당하는 경우와,
+ * USceneComponent를 생성/소멸하는 경우(생성자, UObject 배열 슬롯, Transform 저장소 등록 포함)를 측정합니다.
+ */
+class FSpawnBenchmark
+{
+public:
+	static constexpr uint32 DEFAULT_OBJECT_COUNT = 1000;
+	static constexpr uint32 DEFAULT_ROUND_COUNT = 200;
+
+	static void Run(TArray<FSpawnBenchmarkResult>& OutResults,
+		uint32 InObjectCount = DEFAULT_OBJECT_COUNT, uint32 InRoundCount = DEFAULT_ROUND_COUNT);
+};
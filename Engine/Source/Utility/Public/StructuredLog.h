@@ -0,0 +1,216 @@
+#pragma once
+#include "Utility/Public/LogQueue.h"
+#include "Utility/Public/Profiler.h"
+#include "Utility/Public/StructuredLogDecoder.h"
+
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @brief 지연 포맷 구조화 로그 (UE_LOG_DEFERRED)
+ *
+ * 호출 지점은 포맷 문자열을 한 번만 등록해 얻은 ID와 인자의 원시 값만 잠금 없는 바이너리 큐(FLogQueue)에 기록합니다.
+ * 워커 스레드가 이를 그대로 .ulog 파일에 쓰고 최근 RECENT_MESSAGE_COUNT개의 레코드를 보관하며,
+ * 문자열 포맷은 콘솔에서 "log recent"로 볼 때나 .ulog를 디코딩할 때(FStructuredLogDecoder, Tools/LogDecoder)만 수행합니다.
+ *
+ * Initialize 전이나 SetEnabled(false) 상태에서는 Record가 플래그 확인 후 바로 반환합니다.
+ */
+class FStructuredLog
+{
+public:
+	static constexpr uint32 MAX_RECORD_SIZE = 2048;
+	static constexpr uint32 MAX_STRING_LENGTH = 512;
+	static constexpr uint32 RECENT_MESSAGE_COUNT = 512;
+	static constexpr uint32 MAX_LOG_FILES = 20;
+
+	// 종료 시점의 정적 객체 소멸 중에도 로그가 기록될 수 있으므로 해제하지 않음
+	static FStructuredLog& GetInstance()
+	{
+		static FStructuredLog* Instance = new FStructuredLog();
+		return *Instance;
+	}
+
+	/** @brief InFilePath에 .ulog를 만들고 워커 스레드를 시작합니다. 이미 등록된 포맷은 파일 앞부분에 기록됩니다. */
+	bool Initialize(const FString& InFilePath);
+	void Shutdown();
+
+	bool IsRecording() const { return bIsRecording.load(std::memory_order_relaxed); }
+	void SetEnabled(bool bInEnabled);
+	bool IsEnabled() const { return bIsEnabled; }
+
+	/** @brief 호출 지점의 포맷을 등록하고 ID를 반환합니다. (호출 지점당 한 번, 모든 스레드) */
+	uint32 RegisterFormat(ELogType InType, const char* InFormat, const char* InFile, uint32 InLine);
+
+	/** @brief 포맷 ID와 인자를 기록합니다. (모든 스레드) */
+	template<typename... TArgs>
+	void Record(uint32 InFormatId, const TArgs&... InArgs)
+	{
+		if (!IsRecording())
+		{
+			return;
+		}
+
+		static_assert(sizeof...(TArgs) < 256, "UE_LOG_DEFERRED: too many arguments");
+
+		FRecordWriter Writer;
+		Writer.WritePrefix(StructuredLogFormat::ERecordKind::Message);
+		Writer.Write(InFormatId);
+		Writer.Write(FPlatformTime::Cycles64());
+		Writer.Write(static_cast<uint8>(sizeof...(TArgs)));
+		(EncodeArgument(Writer, InArgs), ...);
+		Submit(Writer);
+	}
+
+	/** @brief 최근 레코드 중 마지막 InCount개를 포맷해 반환합니다. (이때 처음 포맷됨) */
+	void GetRecentLines(uint32 InCount, TArray<FStructuredLogLine>& OutLines);
+
+	uint64 GetRecordCount() const { return RecordCount.load(std::memory_order_relaxed); }
+	uint64 GetDroppedCount() const { return Queue.GetDroppedCount(); }
+	const FString& GetFilePath() const { return FilePath; }
+
+	FStructuredLog(const FStructuredLog&) = delete;
+	FStructuredLog& operator=(const FStructuredLog&) = delete;
+
+private:
+	FStructuredLog() = default;
+	~FStructuredLog() = default;
+
+	/**
+	 * @brief 스택 버퍼에 레코드를 직렬화하는 도우미
+	 * 버퍼를 넘는 인자는 잘리지 않고 레코드 전체가 버려집니다. (bOverflow)
+	 */
+	struct FRecordWriter
+	{
+		uint8 Data[MAX_RECORD_SIZE];
+		uint32 Size = 0;
+		bool bOverflow = false;
+
+		void WriteBytes(const void* InData, uint32 InSize)
+		{
+			if (Size + InSize > MAX_RECORD_SIZE)
+			{
+				bOverflow = true;
+				return;
+			}
+			memcpy(Data + Size, InData, InSize);
+			Size += InSize;
+		}
+
+		template<typename T>
+		void Write(const T& InValue)
+		{
+			WriteBytes(&InValue, sizeof(T));
+		}
+
+		void WritePrefix(StructuredLogFormat::ERecordKind InKind)
+		{
+			Size = sizeof(uint32);
+			Write(static_cast<uint8>(InKind));
+		}
+
+		// 레코드 맨 앞에 전체 크기를 기록
+		void FinalizeSize()
+		{
+			memcpy(Data, &Size, sizeof(uint32));
+		}
+	};
+
+	static void EncodeString(FRecordWriter& InWriter, const char* InString, size_t InLength);
+	static void EncodeWideString(FRecordWriter& InWriter, const wchar_t* InString);
+
+	template<typename T>
+	static void EncodeArgument(FRecordWriter& InWriter, const T& InValue)
+	{
+		using namespace StructuredLogFormat;
+
+		if constexpr (std::is_array_v<T>)
+		{
+			EncodeArgument(InWriter, static_cast<const std::remove_extent_t<T>*>(InValue));
+		}
+		else if constexpr (std::is_same_v<T, bool>)
+		{
+			InWriter.Write(EArgumentTag::UInt64);
+			InWriter.Write(static_cast<uint64>(InValue));
+		}
+		else if constexpr (std::is_enum_v<T>)
+		{
+			InWriter.Write(EArgumentTag::Int64);
+			InWriter.Write(static_cast<int64>(InValue));
+		}
+		else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+		{
+			InWriter.Write(EArgumentTag::Int64);
+			InWriter.Write(static_cast<int64>(InValue));
+		}
+		else if constexpr (std::is_integral_v<T>)
+		{
+			InWriter.Write(EArgumentTag::UInt64);
+			InWriter.Write(static_cast<uint64>(InValue));
+		}
+		else if constexpr (std::is_floating_point_v<T>)
+		{
+			InWriter.Write(EArgumentTag::Double);
+			InWriter.Write(static_cast<double>(InValue));
+		}
+		else if constexpr (std::is_same_v<T, FString>)
+		{
+			EncodeString(InWriter, InValue.data(), InValue.size());
+		}
+		else if constexpr (std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>, char>)
+		{
+			EncodeString(InWriter, InValue ? InValue : "(null)", InValue ? strlen(InValue) : 6);
+		}
+		else if constexpr (std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>, wchar_t>)
+		{
+			EncodeWideString(InWriter, InValue ? InValue : L"(null)");
+		}
+		else if constexpr (std::is_pointer_v<T>)
+		{
+			InWriter.Write(EArgumentTag::Pointer);
+			InWriter.Write(static_cast<uint64>(reinterpret_cast<uintptr_t>(InValue)));
+		}
+		else
+		{
+			static_assert(std::is_pointer_v<T>, "UE_LOG_DEFERRED: unsupported argument type");
+		}
+	}
+
+	void Submit(FRecordWriter& InWriter);
+	void WorkerThreadFunc();
+	void RemoveOldLogFiles() const;
+
+	/**
+	 * @brief 등록된 포맷 (파일 앞부분에 다시 기록하기 위해 보관)
+	 */
+	struct FFormatDefinition
+	{
+		ELogType Type;
+		const char* Format;
+		const char* File;
+		uint32 Line;
+	};
+	void SubmitFormat(uint32 InFormatId, const FFormatDefinition& InDefinition);
+
+	FLogQueue Queue;
+	std::atomic<bool> bIsRecording{ false };
+	bool bIsEnabled = true;
+	bool bIsInitialized = false;
+
+	std::mutex FormatMutex;
+	TArray<FFormatDefinition> FormatDefinitions;
+
+	std::thread WorkerThread;
+	std::atomic<bool> bShouldStop{ false };
+	std::ofstream FileStream;
+	FString FilePath;
+	std::atomic<uint64> RecordCount{ 0 };
+
+	// 워커 스레드가 채우고 콘솔이 읽음
+	std::mutex RecentMutex;
+	FStructuredLogDecoder RecentDecoder;
+	std::deque<FString> RecentMessages;
+};
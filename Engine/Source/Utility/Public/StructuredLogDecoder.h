@@ -0,0 +1,98 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 구조화 로그(.ulog) 바이너리 형식
+ *
+ * 파일은 FFileHeader 뒤에 레코드가 이어집니다. 모든 레코드는 [uint32 Size][uint8 Kind]로 시작하며 Size는 레코드 전체 크기입니다.
+ * - Format : [uint32 FormatId][uint8 LogType][uint32 Line][File\0][Format\0]
+ * - Message: [uint32 FormatId][uint64 Cycles][uint8 ArgumentCount][인자...]
+ * 인자는 [uint8 Tag][값]이며, 문자열은 [uint32 길이][바이트], 와이드 문자열은 [uint32 길이][UTF-16 코드 단위]입니다.
+ * Format 레코드는 같은 FormatId의 Message보다 항상 먼저 기록됩니다.
+ */
+namespace StructuredLogFormat
+{
+	constexpr uint32 FILE_MAGIC = 0x474F4C55; // "ULOG"
+	constexpr uint32 FILE_VERSION = 1;
+
+	struct FFileHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		double SecondsPerCycle;
+		uint64 StartCycles;
+	};
+
+	// [uint32 Size][uint8 Kind]
+	constexpr uint32 RECORD_PREFIX_SIZE = 5;
+
+	enum class ERecordKind : uint8
+	{
+		Format = 1,
+		Message = 2,
+	};
+
+	enum class EArgumentTag : uint8
+	{
+		Int64 = 1,
+		UInt64,
+		Double,
+		String,
+		WideString,
+		Pointer,
+	};
+}
+
+/**
+ * @brief 디코딩된 로그 한 줄
+ */
+struct FStructuredLogLine
+{
+	uint8 LogType = 0;
+	double Seconds = 0.0;
+	FString Message;
+	const char* File = nullptr;
+	uint32 Line = 0;
+};
+
+/**
+ * @brief 구조화 로그 레코드를 텍스트로 되돌리는 디코더
+ * Format 레코드로 포맷 테이블을 채우고, Message 레코드를 만나면 인자를 printf 규칙으로 포맷합니다.
+ * 엔진 없이 동작하므로 오프라인 디코더(Tools/LogDecoder)와 콘솔의 "log recent"가 함께 사용합니다.
+ */
+class FStructuredLogDecoder
+{
+public:
+	void SetTimeBase(double InSecondsPerCycle, uint64 InStartCycles);
+
+	/**
+	 * @brief 이어 붙은 레코드를 차례로 해석합니다.
+	 * @param OutLines Message 레코드의 결과를 추가할 배열 (nullptr이면 Format 레코드만 등록)
+	 * @return 처리한 바이트 수 (끝의 불완전한 레코드는 제외)
+	 */
+	size_t Decode(const uint8* InData, size_t InSize, TArray<FStructuredLogLine>* OutLines);
+
+	/** @brief .ulog 파일 전체를 디코딩합니다. @return 헤더가 올바르지 않거나 열 수 없으면 false */
+	bool DecodeFile(const FString& InFilePath, TArray<FStructuredLogLine>& OutLines);
+
+	/** @brief 한 줄을 "[  12.345] [INFO] 메시지" 형태로 만듭니다. */
+	static FString ToText(const FStructuredLogLine& InLine);
+
+	// ConsoleWidget의 파일 로그 프리픽스와 같은 표기
+	static const char* GetLogTypePrefix(uint8 InLogType);
+
+private:
+	struct FFormatEntry
+	{
+		uint8 LogType = 0;
+		uint32 Line = 0;
+		FString File;
+		FString Format;
+	};
+
+	static FString FormatMessage(const FString& InFormat, const uint8* InArguments, const uint8* InEnd, uint32 InArgumentCount);
+
+	TArray<FFormatEntry> Formats;
+	double SecondsPerCycle = 0.0;
+	uint64 StartCycles = 0;
+};
@@ -0,0 +1,68 @@
+#include "pch.h"
+#include "Core/Public/Class.h"
+#include "Core/Public/Object.h"
+#include "TestHarness.h"
+
+#include <stdexcept>
+
+namespace
+{
+	// 테스트 전용 클래스 체인 (등록된 클래스 목록이 포인터를 보관하므로 해제하지 않음)
+	UClass* MakeClass(const char* InName, UClass* InSuperClass)
+	{
+		return new UClass(FName(FString(InName)), InSuperClass, sizeof(UObject), nullptr, true);
+	}
+}
+
+void AncestorChainAnswersIsChildOf()
+{
+	UClass* Base = MakeClass("UHierarchyTestBase", UObject::StaticClass());
+	UClass* Left = MakeClass("UHierarchyTestLeft", Base);
+	UClass* Right = MakeClass("UHierarchyTestRight", Base);
+	for (UClass* Class : { Base, Left, Right })
+	{
+		UClass::SignUpClass(Class);
+	}
+
+	TEST_CHECK_EQ(Left->GetClassDepth(), UObject::StaticClass()->GetClassDepth() + 2);
+	TEST_CHECK(Left->IsChildOf(Left));
+	TEST_CHECK(Left->IsChildOf(Base));
+	TEST_CHECK(Left->IsChildOf(UObject::StaticClass()));
+	TEST_CHECK(!Left->IsChildOf(Right));
+	TEST_CHECK(!Base->IsChildOf(Left));
+	TEST_CHECK(!Left->IsChildOf(nullptr));
+}
+
+void TooDeepHierarchyFailsInEveryConfiguration()
+{
+	// UObject(깊이 0)부터 MAX_CLASS_DEPTH - 1까지는 등록되고, 그보다 깊은 클래스는 조상 배열에 쓰기 전에 거부된다
+	UClass* Super = UObject::StaticClass();
+	char Name[64];
+	for (uint32 Depth = 1; Depth < UClass::MAX_CLASS_DEPTH; ++Depth)
+	{
+		(void)snprintf(Name, sizeof(Name), "UDepthTest%u", Depth);
+		UClass* Class = MakeClass(Name, Super);
+		UClass::SignUpClass(Class);
+		TEST_CHECK_EQ(Class->GetClassDepth(), Depth);
+		TEST_CHECK(Class->IsChildOf(UObject::StaticClass()));
+		Super = Class;
+	}
+
+	bool bThrown = false;
+	try
+	{
+		UClass::SignUpClass(MakeClass("UDepthTestOverflow", Super));
+	}
+	catch (const std::runtime_error&)
+	{
+		bThrown = true;
+	}
+	TEST_CHECK(bThrown);
+}
+
+int main()
+{
+	RUN_TEST(AncestorChainAnswersIsChildOf);
+	RUN_TEST(TooDeepHierarchyFailsInEveryConfiguration);
+	return FTestContext::GetExitCode();
+}
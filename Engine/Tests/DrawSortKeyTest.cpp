@@ -0,0 +1,196 @@
+#include "pch.h"
+#include "Optimization/Public/DrawSortKey.h"
+#include "TestHarness.h"
+
+#include <numeric>
+#include <random>
+
+namespace
+{
+	// 같은 키는 입력 순서를 유지해야 하므로 std::stable_sort 결과와 한 칸도 달라서는 안 된다
+	void CheckMatchesStableSort(const TArray<uint64>& InKeys)
+	{
+		TArray<uint32> Expected(InKeys.size());
+		std::iota(Expected.begin(), Expected.end(), 0u);
+		std::stable_sort(Expected.begin(), Expected.end(), [&InKeys](uint32 A, uint32 B) { return InKeys[A] < InKeys[B]; });
+
+		TArray<uint32> Order;
+		TArray<uint32> Scratch;
+		DrawSortKey::RadixSort(InKeys, Order, Scratch);
+		TEST_CHECK(Order == Expected);
+	}
+
+	TArray<uint64> MakeRandomKeys(uint32 InSeed, uint32 InCount)
+	{
+		std::mt19937 Random(InSeed);
+		TArray<uint64> Keys;
+		Keys.reserve(InCount);
+		for (uint32 i = 0; i < InCount; ++i)
+		{
+			// 필드 값 범위를 작게 잡아 같은 키가 많이 생기도록 한다
+			Keys.push_back(DrawSortKey::Make(Random() % 2, Random() % 4, Random() % 8, Random() % 8, Random() % 32,
+				Random() % 16));
+		}
+		return Keys;
+	}
+}
+
+void MakeRoundTripsEveryField()
+{
+	using namespace DrawSortKey;
+
+	const uint64 Key = Make(3, 200, 4000, 1234, 65000, 4095);
+	TEST_CHECK_EQ(GetField(Key, PASS_SHIFT, PASS_BITS), 3ull);
+	TEST_CHECK_EQ(GetField(Key, SHADER_SHIFT, SHADER_BITS), 200ull);
+	TEST_CHECK_EQ(GetField(Key, TEXTURE_SET_SHIFT, TEXTURE_SET_BITS), 4000ull);
+	TEST_CHECK_EQ(GetField(Key, MATERIAL_SHIFT, MATERIAL_BITS), 1234ull);
+	TEST_CHECK_EQ(GetField(Key, MESH_SHIFT, MESH_BITS), 65000ull);
+	TEST_CHECK_EQ(GetField(Key, DEPTH_SHIFT, DEPTH_BITS), 4095ull);
+
+	// 비트 폭을 넘는 값은 잘려서 이웃 필드를 침범하지 않는다
+	const uint64 Overflow = Make(0, 0, 0, 0, 0x10001, 0x1001);
+	TEST_CHECK_EQ(GetField(Overflow, MESH_SHIFT, MESH_BITS), 1ull);
+	TEST_CHECK_EQ(GetField(Overflow, DEPTH_SHIFT, DEPTH_BITS), 1ull);
+	TEST_CHECK_EQ(GetField(Overflow, MATERIAL_SHIFT, MATERIAL_BITS), 0ull);
+}
+
+void HigherFieldsDominateOrder()
+{
+	using namespace DrawSortKey;
+
+	// 상위 필드가 1만 커도 하위 필드가 모두 최대인 키보다 뒤에 온다
+	const uint32 MaxDepth = static_cast<uint32>(MaxValue(DEPTH_BITS));
+	const uint32 MaxMesh = static_cast<uint32>(MaxValue(MESH_BITS));
+	const uint32 MaxMaterial = static_cast<uint32>(MaxValue(MATERIAL_BITS));
+	const uint32 MaxTextureSet = static_cast<uint32>(MaxValue(TEXTURE_SET_BITS));
+	const uint32 MaxShader = static_cast<uint32>(MaxValue(SHADER_BITS));
+
+	TEST_CHECK(Make(0, 0, 0, 0, 1, 0) > Make(0, 0, 0, 0, 0, MaxDepth));
+	TEST_CHECK(Make(0, 0, 0, 1, 0, 0) > Make(0, 0, 0, 0, MaxMesh, MaxDepth));
+	TEST_CHECK(Make(0, 0, 1, 0, 0, 0) > Make(0, 0, 0, MaxMaterial, MaxMesh, MaxDepth));
+	TEST_CHECK(Make(0, 1, 0, 0, 0, 0) > Make(0, 0, MaxTextureSet, MaxMaterial, MaxMesh, MaxDepth));
+	TEST_CHECK(Make(1, 0, 0, 0, 0, 0) > Make(0, MaxShader, MaxTextureSet, MaxMaterial, MaxMesh, MaxDepth));
+}
+
+void QuantizeDepthIsMonotonicAndClamped()
+{
+	using namespace DrawSortKey;
+
+	const uint32 MaxDepth = static_cast<uint32>(MaxValue(DEPTH_BITS));
+	TEST_CHECK_EQ(QuantizeDepth(0.0f, 100.0f), 0u);
+	TEST_CHECK_EQ(QuantizeDepth(-5.0f, 100.0f), 0u);
+	TEST_CHECK_EQ(QuantizeDepth(10.0f, 0.0f), 0u);
+	TEST_CHECK_EQ(QuantizeDepth(100.0f, 100.0f), MaxDepth);
+	TEST_CHECK_EQ(QuantizeDepth(1000.0f, 100.0f), MaxDepth);
+
+	// 제곱근 분포: 거리의 1/4 지점이 버킷의 절반
+	TEST_CHECK_EQ(QuantizeDepth(25.0f, 100.0f), MaxDepth / 2);
+
+	uint32 PrevBucket = 0;
+	for (int Step = 0; Step <= 1000; ++Step)
+	{
+		const uint32 Bucket = QuantizeDepth(static_cast<float>(Step) * 0.1f, 100.0f);
+		TEST_CHECK(Bucket >= PrevBucket);
+		PrevBucket = Bucket;
+	}
+}
+
+void IdTableIssuesIdsInFirstSeenOrder()
+{
+	FSortKeyIdTable Table(2);
+
+	TEST_CHECK_EQ(Table.GetId(0xA0), 1u);
+	TEST_CHECK_EQ(Table.GetId(0xB0), 2u);
+	TEST_CHECK_EQ(Table.GetId(0xA0), 1u);
+
+	// 2비트 상한(3)을 넘으면 마지막 ID를 공유한다
+	TEST_CHECK_EQ(Table.GetId(0xC0), 3u);
+	TEST_CHECK_EQ(Table.GetId(0xD0), 3u);
+	TEST_CHECK_EQ(Table.GetId(0xB0), 2u);
+	TEST_CHECK_EQ(Table.Num(), 4u);
+
+	// 매 프레임 Reset 후 같은 순서로 요청하면 같은 ID가 나온다
+	Table.Reset();
+	TEST_CHECK_EQ(Table.Num(), 0u);
+	TEST_CHECK_EQ(Table.GetId(0xB0), 1u);
+	TEST_CHECK_EQ(Table.GetId(0xA0), 2u);
+}
+
+void RadixSortMatchesStableSort()
+{
+	CheckMatchesStableSort(MakeRandomKeys(29u, 5000));
+	CheckMatchesStableSort(MakeRandomKeys(1029u, 257));
+
+	// 상위 바이트만 다른 키 (하위 바이트 단계는 모두 건너뜀)
+	TArray<uint64> HighKeys;
+	for (uint32 i = 0; i < 64; ++i)
+	{
+		HighKeys.push_back(DrawSortKey::Make(15 - (i % 16), 0, 0, 0, 0, 0));
+	}
+	CheckMatchesStableSort(HighKeys);
+
+	// 모든 키가 같으면 입력 순서 그대로
+	CheckMatchesStableSort(TArray<uint64>(100, DrawSortKey::Make(1, 2, 3, 4, 5, 6)));
+}
+
+void RadixSortHandlesTinyInputsAndReusesScratch()
+{
+	TArray<uint32> Order;
+	TArray<uint32> Scratch;
+
+	DrawSortKey::RadixSort({}, Order, Scratch);
+	TEST_CHECK(Order.empty());
+
+	DrawSortKey::RadixSort({ 42 }, Order, Scratch);
+	TEST_CHECK(Order == TArray<uint32>({ 0 }));
+
+	// 이전 프레임보다 짧은 입력에서도 이전 결과가 남지 않는다
+	DrawSortKey::RadixSort(MakeRandomKeys(7u, 300), Order, Scratch);
+	DrawSortKey::RadixSort({ 3, 1, 2 }, Order, Scratch);
+	TEST_CHECK(Order == TArray<uint32>({ 1, 2, 0 }));
+}
+
+void CountStateChangesFollowsDrawOrder()
+{
+	using namespace DrawSortKey;
+
+	const TArray<uint64> Keys = {
+		Make(0, 2, 1, 1, 5, 10),
+		Make(0, 1, 1, 1, 3, 20),
+		Make(0, 2, 1, 1, 5, 5),
+		Make(0, 1, 2, 2, 3, 0),
+	};
+
+	// 첫 Draw는 모든 상태를 바인딩하므로 각각 1회로 센다
+	const FDrawStateChangeCount Unsorted = CountStateChanges(Keys);
+	TEST_CHECK_EQ(Unsorted.ShaderChanges, 4u);
+	TEST_CHECK_EQ(Unsorted.TextureSetChanges, 2u);
+	TEST_CHECK_EQ(Unsorted.MaterialChanges, 2u);
+	TEST_CHECK_EQ(Unsorted.MeshChanges, 4u);
+
+	TArray<uint32> Order;
+	TArray<uint32> Scratch;
+	RadixSort(Keys, Order, Scratch);
+	TEST_CHECK(Order == TArray<uint32>({ 1, 3, 2, 0 }));
+
+	const FDrawStateChangeCount Sorted = CountStateChanges(Keys, &Order);
+	TEST_CHECK_EQ(Sorted.ShaderChanges, 2u);
+	TEST_CHECK_EQ(Sorted.TextureSetChanges, 3u);
+	TEST_CHECK_EQ(Sorted.MaterialChanges, 3u);
+	TEST_CHECK_EQ(Sorted.MeshChanges, 2u);
+	TEST_CHECK(Sorted.GetTotal() < Unsorted.GetTotal());
+
+	TEST_CHECK_EQ(CountStateChanges({}).GetTotal(), 0u);
+}
+
+int main()
+{
+	RUN_TEST(MakeRoundTripsEveryField);
+	RUN_TEST(HigherFieldsDominateOrder);
+	RUN_TEST(QuantizeDepthIsMonotonicAndClamped);
+	RUN_TEST(IdTableIssuesIdsInFirstSeenOrder);
+	RUN_TEST(RadixSortMatchesStableSort);
+	RUN_TEST(RadixSortHandlesTinyInputsAndReusesScratch);
+	RUN_TEST(CountStateChangesFollowsDrawOrder);
+	return FTestContext::GetExitCode();
+}
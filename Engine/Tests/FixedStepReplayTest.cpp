@@ -0,0 +1,172 @@
+#include "pch.h"
+#include "Component/Public/ProjectileMovementComponent.h"
+#include "Component/Public/SceneTransformStore.h"
+#include "Level/Public/Level.h"
+#include "Level/Public/World.h"
+#include "Manager/Time/Public/FixedStepClock.h"
+#include "TestHarness.h"
+
+#include <random>
+
+namespace
+{
+	constexpr uint32 STEPS_PER_SECOND = 60;
+	constexpr uint32 REPLAY_STEP_COUNT = 600;
+
+	/**
+	 * @brief 스텝 하나가 끝난 뒤의 시뮬레이션 상태
+	 */
+	struct FReplaySample
+	{
+		FVector Location;
+		FQuaternion Rotation;
+		FMatrix WorldMatrix;
+		FVector Velocity;
+	};
+
+	bool IsBitwiseEqual(const FReplaySample& A, const FReplaySample& B)
+	{
+		return memcmp(&A.Location, &B.Location, sizeof(FVector)) == 0 &&
+			memcmp(&A.Rotation, &B.Rotation, sizeof(FQuaternion)) == 0 &&
+			memcmp(&A.WorldMatrix, &B.WorldMatrix, sizeof(FMatrix)) == 0 &&
+			memcmp(&A.Velocity, &B.Velocity, sizeof(FVector)) == 0;
+	}
+
+	/**
+	 * @brief 같은 투사체를 InNextFrameSeconds가 주는 프레임 시간으로 진행하며 스텝마다 상태를 기록합니다.
+	 * 루프는 ClientApp의 고정 스텝 경로와 같은 순서(스텝별 World Tick → 보간 → World 행렬 갱신 → 복원)를 따릅니다.
+	 */
+	template<typename TNextFrameSeconds>
+	TArray<FReplaySample> RunReplay(TNextFrameSeconds&& InNextFrameSeconds, uint64& OutDroppedStepCount)
+	{
+		UWorld* World = NewObject<UWorld>();
+		World->SetWorldType(EWorldType::Game);
+		GWorld = World;
+		World->CreateNewLevel();
+
+		AActor* Actor = World->SpawnActor(AActor::StaticClass());
+		Actor->SetActorLocation(FVector(0.0f, 0.0f, 100.0f));
+		Actor->SetCanTick(true);
+
+		auto* Projectile = Cast<UProjectileMovementComponent>(Actor->AddComponent(UProjectileMovementComponent::StaticClass()));
+		Projectile->SetVelocity(FVector(310.0f, 45.0f, 520.0f));
+		Projectile->SetGravityScale(980.0f);
+		Projectile->SetMaxSpeed(900.0f);
+		Projectile->SetRotationFollowsVelocity(true);
+
+		FSceneTransformStore& TransformStore = FSceneTransformStore::GetInstance();
+		TransformStore.ResetInterpolation();
+
+		FFixedStepClock FixedStepClock;
+		FixedStepClock.SetStepsPerSecond(STEPS_PER_SECOND);
+
+		TArray<FReplaySample> Samples;
+		Samples.reserve(REPLAY_STEP_COUNT);
+		while (Samples.size() < REPLAY_STEP_COUNT)
+		{
+			const uint32 StepCount = FixedStepClock.Advance(InNextFrameSeconds());
+			for (uint32 Step = 0; Step < StepCount && Samples.size() < REPLAY_STEP_COUNT; ++Step)
+			{
+				TransformStore.BeginSimulationStep();
+				World->Tick(FixedStepClock.GetStepSeconds());
+				TransformStore.EndSimulationStep();
+
+				FReplaySample Sample;
+				Sample.Location = Actor->GetActorLocation();
+				Sample.Rotation = Actor->GetActorRotation();
+				Sample.WorldMatrix = Actor->GetRootComponent()->GetWorldTransformMatrix();
+				Sample.Velocity = Projectile->GetVelocity();
+				Samples.push_back(Sample);
+			}
+
+			// 렌더링용 보간은 시뮬레이션 값을 바꾸지 않아야 한다
+			TransformStore.ApplyInterpolation(FixedStepClock.GetAlpha());
+			TransformStore.UpdateWorldTransforms();
+			TransformStore.RestoreSimulatedTransforms();
+
+			World->GetLevel()->ClearDirtyPrimitiveBounds();
+			FFrameArena::GetInstance().Reset();
+		}
+
+		OutDroppedStepCount = FixedStepClock.GetDroppedStepCount();
+
+		GWorld = nullptr;
+		delete World;
+		return Samples;
+	}
+
+	void CheckSameTrajectory(const TArray<FReplaySample>& InExpected, const TArray<FReplaySample>& InActual)
+	{
+		TEST_CHECK_EQ(InActual.size(), InExpected.size());
+		for (size_t Index = 0; Index < std::min(InExpected.size(), InActual.size()); ++Index)
+		{
+			if (!IsBitwiseEqual(InExpected[Index], InActual[Index]))
+			{
+				fprintf(stderr, "  step %zu diverged\n", Index);
+				TEST_CHECK(IsBitwiseEqual(InExpected[Index], InActual[Index]));
+				return;
+			}
+		}
+	}
+
+	TArray<FReplaySample> RunAt60Hz()
+	{
+		uint64 DroppedStepCount = 0;
+		TArray<FReplaySample> Samples = RunReplay([] { return 1.0 / 60.0; }, DroppedStepCount);
+		TEST_CHECK_EQ(DroppedStepCount, 0ull);
+		return Samples;
+	}
+}
+
+void ReferenceTrajectoryMoves()
+{
+	const TArray<FReplaySample> Reference = RunAt60Hz();
+	TEST_CHECK_EQ(Reference.size(), static_cast<size_t>(REPLAY_STEP_COUNT));
+
+	// 중력으로 포물선을 그리고 MaxSpeed에 걸려야(낙하 중 수평 속도가 줄어듦) 비교가 의미 있음
+	TEST_CHECK(Reference.back().Location.X > Reference.front().Location.X + 500.0f);
+	TEST_CHECK(Reference.back().Velocity.Z < 0.0f && Reference.front().Velocity.Z > 0.0f);
+	TEST_CHECK(Reference.back().Velocity.Length() <= 900.0f + 0.01f);
+	TEST_CHECK(!IsBitwiseEqual(Reference.front(), Reference[REPLAY_STEP_COUNT / 2]));
+}
+
+void RepeatedRunIsBitIdentical()
+{
+	CheckSameTrajectory(RunAt60Hz(), RunAt60Hz());
+}
+
+void AlternatingFrameRatesMatch60Hz()
+{
+	bool bIsFastFrame = false;
+	uint64 DroppedStepCount = 0;
+	const TArray<FReplaySample> Alternating = RunReplay([&bIsFastFrame]
+	{
+		bIsFastFrame = !bIsFastFrame;
+		return bIsFastFrame ? 1.0 / 144.0 : 1.0 / 30.0;
+	}, DroppedStepCount);
+
+	TEST_CHECK_EQ(DroppedStepCount, 0ull);
+	CheckSameTrajectory(RunAt60Hz(), Alternating);
+}
+
+void RandomFrameTimesMatch60Hz()
+{
+	std::mt19937 Random(20260418u);
+	std::uniform_real_distribution<double> FrameSeconds(0.002, 0.050);
+	uint64 DroppedStepCount = 0;
+	const TArray<FReplaySample> RandomFrames = RunReplay([&] { return FrameSeconds(Random); }, DroppedStepCount);
+
+	TEST_CHECK_EQ(DroppedStepCount, 0ull);
+	CheckSameTrajectory(RunAt60Hz(), RandomFrames);
+}
+
+int main()
+{
+	UConsoleWindow::SetStdoutEnabled(false);
+
+	RUN_TEST(ReferenceTrajectoryMoves);
+	RUN_TEST(RepeatedRunIsBitIdentical);
+	RUN_TEST(AlternatingFrameRatesMatch60Hz);
+	RUN_TEST(RandomFrameTimesMatch60Hz);
+	return FTestContext::GetExitCode();
+}
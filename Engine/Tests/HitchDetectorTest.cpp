@@ -0,0 +1,265 @@
+#include "pch.h"
+#include "Utility/Public/FrameTimeHistogram.h"
+#include "Utility/Public/HitchDetector.h"
+#include "Utility/Public/Profiler.h"
+#include "TestHarness.h"
+
+#include <random>
+
+namespace
+{
+	constexpr double FRAME_MILLISECONDS = 16.6;
+	constexpr double SPIKE_MILLISECONDS = 80.0;
+
+	// 버킷 상한은 실제 값보다 작지 않고, 상대 오차 1/64를 넘지 않아야 한다
+	bool IsWithinBucketError(double InReported, double InExact)
+	{
+		return InReported >= InExact - 0.001 && InReported <= InExact * (1.0 + 1.0 / 64.0) + 0.001;
+	}
+
+	FHitchDetector& ResetDetector()
+	{
+		FHitchDetector& Detector = FHitchDetector::GetInstance();
+		Detector.Reset();
+		Detector.SetDumpEnabled(false);
+		Detector.SetThresholdMilliseconds(50.0);
+		return Detector;
+	}
+
+	void SkipWarmup(FHitchDetector& InDetector)
+	{
+		for (uint32 i = 0; i < FHitchDetector::WARMUP_FRAME_COUNT; ++i)
+		{
+			InDetector.AddFrame(FRAME_MILLISECONDS);
+		}
+	}
+
+	uint64 MillisecondsToCycles(double InMilliseconds)
+	{
+		return static_cast<uint64>(InMilliseconds / 1000.0 / FPlatformTime::GetSecondsPerCycle() + 0.5);
+	}
+
+	// InStartMs에서 시작해 InDurationMs 동안 열린 구간을 기록 (자식 구간은 InBody 안에서 기록)
+	template<typename TBody>
+	void RecordScope(const TStatId& InStatId, uint64 InBaseCycles, double InStartMs, double InDurationMs, TBody&& InBody)
+	{
+		FProfiler& Profiler = FProfiler::GetInstance();
+		const uint32 NodeIndex = Profiler.BeginScope(InStatId);
+		InBody();
+		Profiler.EndScope(NodeIndex, InBaseCycles + MillisecondsToCycles(InStartMs),
+			InBaseCycles + MillisecondsToCycles(InStartMs + InDurationMs));
+	}
+}
+
+void BucketBoundsContainEveryValue()
+{
+	uint32 PrevIndex = 0;
+	for (uint64 Value = 0; Value < (1ull << FFrameTimeHistogram::MAX_VALUE_BITS); Value += 1 + Value / 300)
+	{
+		const uint32 Index = FFrameTimeHistogram::GetBucketIndex(Value);
+		TEST_CHECK(Index < FFrameTimeHistogram::BUCKET_COUNT);
+		TEST_CHECK(Index >= PrevIndex);
+		PrevIndex = Index;
+
+		// Value는 (이전 버킷 상한, 이 버킷 상한] 구간에 있어야 한다
+		const uint64 UpperBound = FFrameTimeHistogram::GetBucketUpperBound(Index);
+		TEST_CHECK(UpperBound >= Value);
+		if (Index > 0)
+		{
+			TEST_CHECK(FFrameTimeHistogram::GetBucketUpperBound(Index - 1) < Value);
+		}
+		if (Value >= FFrameTimeHistogram::LINEAR_BUCKET_COUNT)
+		{
+			TEST_CHECK(static_cast<double>(UpperBound - Value) <= static_cast<double>(Value) / 64.0);
+		}
+	}
+
+	TEST_CHECK_EQ(FFrameTimeHistogram::GetBucketIndex(127), 127u);
+	TEST_CHECK_EQ(FFrameTimeHistogram::GetBucketIndex(128), 128u);
+	TEST_CHECK_EQ(FFrameTimeHistogram::GetBucketIndex(1ull << 40), FFrameTimeHistogram::BUCKET_COUNT - 1);
+}
+
+void PercentilesStayWithinBucketError()
+{
+	FFrameTimeHistogram Histogram;
+	TEST_CHECK(Histogram.GetPercentile(50.0) == 0.0);
+
+	// 1.0, 1.1, ..., 400.9 ms를 섞어서 넣는다 (정확한 p는 정렬된 값의 올림 순위)
+	TArray<double> Samples;
+	for (uint32 i = 0; i < 4000; ++i)
+	{
+		Samples.push_back(1.0 + 0.1 * i);
+	}
+	std::mt19937 Random(45u);
+	std::shuffle(Samples.begin(), Samples.end(), Random);
+	for (double Sample : Samples)
+	{
+		Histogram.AddSample(Sample);
+	}
+	TEST_CHECK_EQ(Histogram.GetSampleCount(), 4000u);
+
+	std::sort(Samples.begin(), Samples.end());
+	for (double Percentile : { 1.0, 50.0, 95.0, 99.0, 99.9, 100.0 })
+	{
+		const size_t Rank = static_cast<size_t>(std::ceil(Percentile / 100.0 * Samples.size()));
+		TEST_CHECK(IsWithinBucketError(Histogram.GetPercentile(Percentile), Samples[Rank - 1]));
+	}
+
+	Histogram.Reset();
+	TEST_CHECK_EQ(Histogram.GetSampleCount(), 0u);
+	TEST_CHECK(Histogram.GetPercentile(99.0) == 0.0);
+}
+
+void HistogramWindowForgetsOldFrames()
+{
+	FFrameTimeHistogram Histogram;
+	for (uint32 i = 0; i < FFrameTimeHistogram::WINDOW_FRAME_COUNT; ++i)
+	{
+		Histogram.AddSample(100.0);
+	}
+	TEST_CHECK(IsWithinBucketError(Histogram.GetPercentile(0.0), 100.0));
+
+	// 창 크기만큼 새 프레임이 들어오면 이전 프레임은 분포에 남지 않는다
+	for (uint32 i = 0; i < FFrameTimeHistogram::WINDOW_FRAME_COUNT - 1; ++i)
+	{
+		Histogram.AddSample(10.0);
+	}
+	TEST_CHECK(IsWithinBucketError(Histogram.GetPercentile(100.0), 100.0));
+
+	Histogram.AddSample(10.0);
+	TEST_CHECK_EQ(Histogram.GetSampleCount(), FFrameTimeHistogram::WINDOW_FRAME_COUNT);
+	TEST_CHECK(IsWithinBucketError(Histogram.GetPercentile(100.0), 10.0));
+
+	// 빠른 프레임이 창에서 빠지면 하위 백분위도 느린 프레임으로 바뀐다
+	for (uint32 i = 0; i < FFrameTimeHistogram::WINDOW_FRAME_COUNT; ++i)
+	{
+		Histogram.AddSample(100.0);
+	}
+	TEST_CHECK(IsWithinBucketError(Histogram.GetPercentile(1.0), 100.0));
+}
+
+void DetectorSkipsWarmupFrames()
+{
+	FHitchDetector& Detector = ResetDetector();
+	for (uint32 i = 0; i < FHitchDetector::WARMUP_FRAME_COUNT; ++i)
+	{
+		TEST_CHECK(!Detector.AddFrame(500.0));
+	}
+	TEST_CHECK_EQ(Detector.GetHitchCount(), 0ull);
+	TEST_CHECK_EQ(Detector.GetHistogram().GetSampleCount(), 0u);
+
+	TEST_CHECK(Detector.AddFrame(500.0));
+	TEST_CHECK_EQ(Detector.GetHistogram().GetSampleCount(), 1u);
+}
+
+void DetectorFindsEverySyntheticSpike()
+{
+	FHitchDetector& Detector = ResetDetector();
+	SkipWarmup(Detector);
+
+	// 1% 프레임에 스파이크, 나머지는 60 Hz 근처에서 흔들림
+	std::mt19937 Random(4500u);
+	std::uniform_real_distribution<double> Jitter(-1.5, 1.5);
+	uint32 SpikeCount = 0;
+	uint32 DetectedCount = 0;
+	for (uint32 Frame = 0; Frame < 3000; ++Frame)
+	{
+		const bool bSpike = Frame % 100 == 37;
+		const bool bDetected = Detector.AddFrame(bSpike ? SPIKE_MILLISECONDS : FRAME_MILLISECONDS + Jitter(Random));
+		TEST_CHECK_EQ(bDetected, bSpike);
+		SpikeCount += bSpike ? 1 : 0;
+		DetectedCount += bDetected ? 1 : 0;
+	}
+
+	TEST_CHECK_EQ(DetectedCount, SpikeCount);
+	TEST_CHECK_EQ(Detector.GetHitchCount(), static_cast<uint64>(SpikeCount));
+
+	const FFrameTimeHistogram& Histogram = Detector.GetHistogram();
+	TEST_CHECK_EQ(Histogram.GetSampleCount(), 3000u);
+	TEST_CHECK(Histogram.GetPercentile(50.0) > FRAME_MILLISECONDS - 1.5);
+	TEST_CHECK(Histogram.GetPercentile(50.0) < FRAME_MILLISECONDS + 1.5);
+	TEST_CHECK(Histogram.GetPercentile(99.0) < SPIKE_MILLISECONDS);
+	TEST_CHECK(IsWithinBucketError(Histogram.GetPercentile(99.9), SPIKE_MILLISECONDS));
+}
+
+void DetectorFollowsThreshold()
+{
+	FHitchDetector& Detector = ResetDetector();
+	SkipWarmup(Detector);
+
+	// 임계값과 같은 프레임도 히치
+	TEST_CHECK(Detector.AddFrame(50.0));
+	TEST_CHECK(!Detector.AddFrame(49.9));
+
+	Detector.SetThresholdMilliseconds(20.0);
+	TEST_CHECK(Detector.AddFrame(25.0));
+
+	// 0 이하이면 감지하지 않지만 분포는 계속 기록
+	Detector.SetThresholdMilliseconds(0.0);
+	TEST_CHECK(!Detector.AddFrame(1000.0));
+	TEST_CHECK_EQ(Detector.GetHitchCount(), 2ull);
+	TEST_CHECK_EQ(Detector.GetHistogram().GetSampleCount(), 4u);
+
+	Detector.Reset();
+	TEST_CHECK_EQ(Detector.GetHitchCount(), 0ull);
+	TEST_CHECK(!Detector.AddFrame(1000.0));
+}
+
+void HitchReportsScopesBySelfTime()
+{
+	static const TStatId FrameStat("HitchTest.Frame");
+	static const TStatId PhysicsStat("HitchTest.Physics");
+	static const TStatId NarrowPhaseStat("HitchTest.NarrowPhase");
+	static const TStatId RenderStat("HitchTest.Render");
+
+	// Frame 80 = Physics 60 (NarrowPhase 45 포함) + Render 15 + 자체 5
+	const uint64 BaseCycles = FPlatformTime::Cycles64();
+	RecordScope(FrameStat, BaseCycles, 0.0, 80.0, [&]
+	{
+		RecordScope(PhysicsStat, BaseCycles, 0.0, 60.0, [&]
+		{
+			RecordScope(NarrowPhaseStat, BaseCycles, 10.0, 45.0, [] {});
+		});
+		RecordScope(RenderStat, BaseCycles, 62.0, 15.0, [] {});
+	});
+	FProfiler::GetInstance().EndFrame();
+
+	FHitchDetector& Detector = ResetDetector();
+	SkipWarmup(Detector);
+	TEST_CHECK(Detector.AddFrame(80.0));
+
+	const TArray<FHitchScope>& Scopes = Detector.GetLastHitchScopes();
+	TEST_CHECK_EQ(Scopes.size(), static_cast<size_t>(4));
+	if (Scopes.size() != 4)
+	{
+		return;
+	}
+
+	auto IsNear = [](double A, double B) { return std::abs(A - B) < 1.0e-3; };
+	TEST_CHECK(strcmp(Scopes[0].Name, "HitchTest.NarrowPhase") == 0);
+	TEST_CHECK(IsNear(Scopes[0].SelfMilliseconds, 45.0));
+	TEST_CHECK(IsNear(Scopes[0].InclusiveMilliseconds, 45.0));
+
+	// Physics(자체 15)와 Render(자체 15)는 순서가 정해지지 않음
+	TEST_CHECK(IsNear(Scopes[1].SelfMilliseconds, 15.0));
+	TEST_CHECK(IsNear(Scopes[2].SelfMilliseconds, 15.0));
+	TEST_CHECK(strcmp(Scopes[1].Name, Scopes[2].Name) != 0);
+
+	TEST_CHECK(strcmp(Scopes[3].Name, "HitchTest.Frame") == 0);
+	TEST_CHECK(IsNear(Scopes[3].SelfMilliseconds, 5.0));
+	TEST_CHECK(IsNear(Scopes[3].InclusiveMilliseconds, 80.0));
+}
+
+int main()
+{
+	UConsoleWindow::SetStdoutEnabled(false);
+
+	RUN_TEST(BucketBoundsContainEveryValue);
+	RUN_TEST(PercentilesStayWithinBucketError);
+	RUN_TEST(HistogramWindowForgetsOldFrames);
+	RUN_TEST(DetectorSkipsWarmupFrames);
+	RUN_TEST(DetectorFindsEverySyntheticSpike);
+	RUN_TEST(DetectorFollowsThreshold);
+	RUN_TEST(HitchReportsScopesBySelfTime);
+	return FTestContext::GetExitCode();
+}
@@ -0,0 +1,239 @@
+#include "pch.h"
+#include "Optimization/Public/DrawSortKey.h"
+#include "Optimization/Public/MeshInstancing.h"
+#include "TestHarness.h"
+
+#include <numeric>
+#include <random>
+
+namespace
+{
+	TArray<uint32> MakeIdentityOrder(uint32 InCount)
+	{
+		TArray<uint32> Order(InCount);
+		std::iota(Order.begin(), Order.end(), 0u);
+		return Order;
+	}
+
+	// 모든 command가 정확히 한 번씩 나오고, 묶음 안의 command는 키가 같으며 제출 순서를 유지하는지 확인
+	void CheckBatchInvariants(const FMeshInstanceBatcher& InBatcher, const TArray<uint64>& InBatchKeys,
+		const TArray<uint32>& InOrder)
+	{
+		TArray<uint32> SubmitPosition(InOrder.size());
+		for (uint32 i = 0; i < InOrder.size(); ++i)
+		{
+			SubmitPosition[InOrder[i]] = i;
+		}
+
+		const TArray<uint32>& InstanceCommands = InBatcher.GetInstanceCommands();
+		TEST_CHECK_EQ(InstanceCommands.size(), InOrder.size());
+
+		TArray<uint32> SeenCount(InOrder.size(), 0);
+		uint32 NextFirstInstance = 0;
+		uint32 NextBufferOffset = 0;
+		uint32 InstancedBatchCount = 0;
+		for (const FInstanceBatch& Batch : InBatcher.GetBatches())
+		{
+			TEST_CHECK_EQ(Batch.FirstInstance, NextFirstInstance);
+			TEST_CHECK(Batch.InstanceCount > 0);
+			NextFirstInstance += Batch.InstanceCount;
+
+			if (Batch.IsInstanced())
+			{
+				TEST_CHECK_EQ(Batch.InstanceBufferOffset, NextBufferOffset);
+				NextBufferOffset += Batch.InstanceCount;
+				++InstancedBatchCount;
+			}
+			else
+			{
+				TEST_CHECK_EQ(Batch.InstanceBufferOffset, FInstanceBatch::NO_INSTANCE_BUFFER);
+			}
+
+			const uint64 Key = InBatchKeys[InstanceCommands[Batch.FirstInstance]];
+			for (uint32 i = 0; i < Batch.InstanceCount; ++i)
+			{
+				const uint32 Command = InstanceCommands[Batch.FirstInstance + i];
+				++SeenCount[Command];
+				TEST_CHECK_EQ(InBatchKeys[Command], Key);
+				if (i > 0)
+				{
+					TEST_CHECK(SubmitPosition[Command] > SubmitPosition[InstanceCommands[Batch.FirstInstance + i - 1]]);
+				}
+			}
+			if (Batch.IsInstanced())
+			{
+				TEST_CHECK(Key != FMeshInstanceBatcher::NO_BATCH);
+			}
+		}
+
+		TEST_CHECK_EQ(NextFirstInstance, static_cast<uint32>(InOrder.size()));
+		TEST_CHECK_EQ(NextBufferOffset, InBatcher.GetInstanceBufferCount());
+		TEST_CHECK_EQ(InstancedBatchCount, InBatcher.GetInstancedBatchCount());
+		TEST_CHECK(std::all_of(SeenCount.begin(), SeenCount.end(), [](uint32 Count) { return Count == 1; }));
+	}
+}
+
+void MakeBatchKeyIgnoresDepthOnly()
+{
+	using namespace DrawSortKey;
+
+	const uint64 Near = Make(0, 1, 2, 3, 4, 10);
+	const uint64 Far = Make(0, 1, 2, 3, 4, 3000);
+
+	// 거리만 다르면 같은 묶음, 섹션/메시/머티리얼이 다르면 다른 묶음
+	TEST_CHECK_EQ(FMeshInstanceBatcher::MakeBatchKey(Near, 0), FMeshInstanceBatcher::MakeBatchKey(Far, 0));
+	TEST_CHECK(FMeshInstanceBatcher::MakeBatchKey(Near, 0) != FMeshInstanceBatcher::MakeBatchKey(Near, 1));
+	TEST_CHECK(FMeshInstanceBatcher::MakeBatchKey(Near, 0) != FMeshInstanceBatcher::MakeBatchKey(Make(0, 1, 2, 3, 5, 10), 0));
+	TEST_CHECK(FMeshInstanceBatcher::MakeBatchKey(Near, 0) != FMeshInstanceBatcher::MakeBatchKey(Make(0, 1, 2, 4, 4, 10), 0));
+	TEST_CHECK(FMeshInstanceBatcher::MakeBatchKey(Near, 0) != FMeshInstanceBatcher::MakeBatchKey(Make(0, 1, 3, 3, 4, 10), 0));
+
+	// 포화된 ID는 서로 다른 객체를 가리킬 수 있으므로 묶지 않는다
+	const uint32 MaxMesh = static_cast<uint32>(MaxValue(MESH_BITS));
+	const uint32 MaxMaterial = static_cast<uint32>(MaxValue(MATERIAL_BITS));
+	const uint32 MaxTextureSet = static_cast<uint32>(MaxValue(TEXTURE_SET_BITS));
+	TEST_CHECK_EQ(FMeshInstanceBatcher::MakeBatchKey(Make(0, 1, 2, 3, MaxMesh, 0), 0), FMeshInstanceBatcher::NO_BATCH);
+	TEST_CHECK_EQ(FMeshInstanceBatcher::MakeBatchKey(Make(0, 1, 2, MaxMaterial, 4, 0), 0), FMeshInstanceBatcher::NO_BATCH);
+	TEST_CHECK_EQ(FMeshInstanceBatcher::MakeBatchKey(Make(0, 1, MaxTextureSet, 3, 4, 0), 0), FMeshInstanceBatcher::NO_BATCH);
+
+	// 섹션 번호가 Depth 필드에 들어가지 않으면 묶지 않는다
+	const uint32 MaxSection = static_cast<uint32>(MaxValue(DEPTH_BITS));
+	TEST_CHECK(FMeshInstanceBatcher::MakeBatchKey(Near, MaxSection) != FMeshInstanceBatcher::NO_BATCH);
+	TEST_CHECK_EQ(FMeshInstanceBatcher::MakeBatchKey(Near, MaxSection + 1), FMeshInstanceBatcher::NO_BATCH);
+}
+
+void BuildGroupsEqualKeysInFirstSeenOrder()
+{
+	const TArray<uint64> Keys = { 10, 20, 10, 30, 20, 10 };
+
+	FMeshInstanceBatcher Batcher;
+	Batcher.Build(Keys, MakeIdentityOrder(6));
+
+	const TArray<FInstanceBatch>& Batches = Batcher.GetBatches();
+	TEST_CHECK_EQ(Batches.size(), static_cast<size_t>(3));
+	TEST_CHECK_EQ(Batches[0].InstanceCount, 3u);
+	TEST_CHECK_EQ(Batches[1].InstanceCount, 2u);
+	TEST_CHECK_EQ(Batches[2].InstanceCount, 1u);
+	TEST_CHECK(Batcher.GetInstanceCommands() == TArray<uint32>({ 0, 2, 5, 1, 4, 3 }));
+	TEST_CHECK_EQ(Batcher.GetInstancedBatchCount(), 2u);
+
+	// 인스턴스 버퍼는 인스턴싱 묶음만 차례로 차지한다
+	TEST_CHECK_EQ(Batches[0].InstanceBufferOffset, 0u);
+	TEST_CHECK_EQ(Batches[1].InstanceBufferOffset, 3u);
+	TEST_CHECK_EQ(Batches[2].InstanceBufferOffset, FInstanceBatch::NO_INSTANCE_BUFFER);
+	TEST_CHECK_EQ(Batcher.GetInstanceBufferCount(), 5u);
+
+	CheckBatchInvariants(Batcher, Keys, MakeIdentityOrder(6));
+}
+
+void BuildFollowsSubmissionOrder()
+{
+	const TArray<uint64> Keys = { 10, 20, 10, 20 };
+	const TArray<uint32> Order = { 3, 2, 1, 0 };
+
+	FMeshInstanceBatcher Batcher;
+	Batcher.Build(Keys, Order);
+
+	TEST_CHECK(Batcher.GetInstanceCommands() == TArray<uint32>({ 3, 1, 2, 0 }));
+	CheckBatchInvariants(Batcher, Keys, Order);
+}
+
+void NoBatchCommandsAreNeverGrouped()
+{
+	const uint64 NoBatch = FMeshInstanceBatcher::NO_BATCH;
+	const TArray<uint64> Keys = { NoBatch, 7, NoBatch, 7, NoBatch };
+
+	FMeshInstanceBatcher Batcher;
+	Batcher.Build(Keys, MakeIdentityOrder(5));
+
+	TEST_CHECK_EQ(Batcher.GetBatches().size(), static_cast<size_t>(4));
+	TEST_CHECK_EQ(Batcher.GetInstancedBatchCount(), 1u);
+	TEST_CHECK_EQ(Batcher.GetInstanceBufferCount(), 2u);
+	TEST_CHECK(Batcher.GetInstanceCommands() == TArray<uint32>({ 0, 1, 3, 2, 4 }));
+	CheckBatchInvariants(Batcher, Keys, MakeIdentityOrder(5));
+}
+
+void PackInstanceBufferMatchesBatchOffsets()
+{
+	const TArray<uint64> Keys = { 1, 2, 1, 3, 2, 1, 4, 3 };
+
+	FMeshInstanceBatcher Batcher;
+	Batcher.Build(Keys, MakeIdentityOrder(8));
+
+	// 버퍼 항목으로 command 인덱스를 그대로 사용
+	TArray<uint32> Buffer = { 99, 99 };
+	Batcher.PackInstanceBuffer(Buffer, [](uint32 InCommandIndex) { return InCommandIndex; });
+
+	TEST_CHECK_EQ(static_cast<uint32>(Buffer.size()), Batcher.GetInstanceBufferCount());
+	TEST_CHECK(Buffer == TArray<uint32>({ 0, 2, 5, 1, 4, 3, 7 }));
+
+	const TArray<uint32>& InstanceCommands = Batcher.GetInstanceCommands();
+	for (const FInstanceBatch& Batch : Batcher.GetBatches())
+	{
+		if (!Batch.IsInstanced()) { continue; }
+
+		for (uint32 i = 0; i < Batch.InstanceCount; ++i)
+		{
+			TEST_CHECK_EQ(Buffer[Batch.InstanceBufferOffset + i], InstanceCommands[Batch.FirstInstance + i]);
+		}
+	}
+}
+
+void RebuildDiscardsPreviousFrame()
+{
+	FMeshInstanceBatcher Batcher;
+	Batcher.Build({ 1, 1, 1, 2, 2 }, MakeIdentityOrder(5));
+	TEST_CHECK_EQ(Batcher.GetInstanceBufferCount(), 5u);
+
+	const TArray<uint64> Keys = { 5, 6 };
+	Batcher.Build(Keys, MakeIdentityOrder(2));
+	TEST_CHECK_EQ(Batcher.GetBatches().size(), static_cast<size_t>(2));
+	TEST_CHECK_EQ(Batcher.GetInstancedBatchCount(), 0u);
+	TEST_CHECK_EQ(Batcher.GetInstanceBufferCount(), 0u);
+	CheckBatchInvariants(Batcher, Keys, MakeIdentityOrder(2));
+
+	TArray<uint32> Buffer = { 1, 2, 3 };
+	Batcher.PackInstanceBuffer(Buffer, [](uint32 InCommandIndex) { return InCommandIndex; });
+	TEST_CHECK(Buffer.empty());
+
+	Batcher.Build({}, {});
+	TEST_CHECK(Batcher.GetBatches().empty());
+	TEST_CHECK(Batcher.GetInstanceCommands().empty());
+}
+
+void SortedRandomSceneKeepsInvariants()
+{
+	// StaticMeshPass와 같은 순서: 정렬 키 → Radix sort → 묶음 키 → Build
+	std::mt19937 Random(30u);
+	TArray<uint64> SortKeys;
+	TArray<uint64> BatchKeys;
+	for (uint32 i = 0; i < 2000; ++i)
+	{
+		const uint64 SortKey = DrawSortKey::Make(0, 1, Random() % 4, Random() % 6, Random() % 12, Random() % 4096);
+		SortKeys.push_back(SortKey);
+		BatchKeys.push_back(Random() % 10 == 0 ? FMeshInstanceBatcher::NO_BATCH : FMeshInstanceBatcher::MakeBatchKey(SortKey, Random() % 3));
+	}
+
+	TArray<uint32> Order;
+	TArray<uint32> Scratch;
+	DrawSortKey::RadixSort(SortKeys, Order, Scratch);
+
+	FMeshInstanceBatcher Batcher;
+	Batcher.Build(BatchKeys, Order);
+	CheckBatchInvariants(Batcher, BatchKeys, Order);
+
+	// 4 x 6 x 12 x 3 조합보다 묶음이 훨씬 적어야 인스턴싱 효과가 있다 (NO_BATCH 약 200개 포함)
+	TEST_CHECK(Batcher.GetBatches().size() < 1200);
+	TEST_CHECK(Batcher.GetInstancedBatchCount() > 100);
+}
+
+int main()
+{
+	RUN_TEST(MakeBatchKeyIgnoresDepthOnly);
+	RUN_TEST(BuildGroupsEqualKeysInFirstSeenOrder);
+	RUN_TEST(BuildFollowsSubmissionOrder);
+	RUN_TEST(NoBatchCommandsAreNeverGrouped);
+	RUN_TEST(PackInstanceBufferMatchesBatchOffsets);
+	RUN_TEST(RebuildDiscardsPreviousFrame);
+	RUN_TEST(SortedRandomSceneKeepsInvariants);
+	return FTestContext::GetExitCode();
+}
@@ -0,0 +1,287 @@
+#include "pch.h"
+#include "Render/Shadow/Public/ShadowAtlasAllocator.h"
+#include "TestHarness.h"
+
+namespace
+{
+	FShadowAtlasRequest MakeRequest(uint32 InResolution, uint32 InTileCount, float InPriority)
+	{
+		FShadowAtlasRequest Request;
+		Request.RequestedResolution = InResolution;
+		Request.TileCount = InTileCount;
+		Request.Priority = InPriority;
+		return Request;
+	}
+
+	bool IsOverlapping(const FShadowAtlasRect& A, const FShadowAtlasRect& B)
+	{
+		return A.X < B.X + B.Size && B.X < A.X + A.Size && A.Y < B.Y + B.Size && B.Y < A.Y + A.Size;
+	}
+
+	// 할당된 모든 타일이 Atlas 안에 있고, 서로 겹치지 않으며, 할당 해상도와 크기가 같은지 확인
+	void CheckPackedLayout(const FShadowAtlasAllocator& InAllocator, const TArray<FShadowAtlasRequest>& InRequests)
+	{
+		TArray<FShadowAtlasRect> Rects;
+		for (const FShadowAtlasRequest& Request : InRequests)
+		{
+			if (!Request.IsAllocated())
+			{
+				continue;
+			}
+
+			for (uint32 Tile = 0; Tile < Request.TileCount; ++Tile)
+			{
+				const FShadowAtlasRect& Rect = Request.Rects[Tile];
+				TEST_CHECK_EQ(Rect.Size, Request.AllocatedResolution);
+				TEST_CHECK(Rect.X + Rect.Size <= InAllocator.GetAtlasResolution());
+				TEST_CHECK(Rect.Y + Rect.Size <= InAllocator.GetAtlasResolution());
+				Rects.push_back(Rect);
+			}
+		}
+
+		for (size_t i = 0; i < Rects.size(); ++i)
+		{
+			for (size_t j = i + 1; j < Rects.size(); ++j)
+			{
+				TEST_CHECK(!IsOverlapping(Rects[i], Rects[j]));
+			}
+		}
+	}
+}
+
+void AllocateFillsAtlasWithoutOverlap()
+{
+	FShadowAtlasAllocator Allocator(1024, 64);
+
+	// 다양한 크기를 섞어 Atlas를 정확히 채운다 (512 x 2 + 256 x 6 + 128 x 8 = 1024 x 1024)
+	TArray<uint32> Resolutions = { 512, 256, 128, 512, 256, 256, 128, 128, 256, 128, 256, 128, 128, 256, 128, 128 };
+	TArray<FShadowAtlasRequest> Requests;
+	for (uint32 Resolution : Resolutions)
+	{
+		FShadowAtlasRequest Request = MakeRequest(Resolution, 1, 0.0f);
+		TEST_CHECK(Allocator.Allocate(Resolution, Request.Rects[0]));
+		Request.AllocatedResolution = Resolution;
+		Requests.push_back(Request);
+	}
+
+	CheckPackedLayout(Allocator, Requests);
+
+	FShadowAtlasRect Rect;
+	TEST_CHECK(!Allocator.CanAllocate(64, 1));
+	TEST_CHECK(!Allocator.Allocate(64, Rect));
+}
+
+void ClampResolutionRoundsToPowerOfTwo()
+{
+	FShadowAtlasAllocator Allocator(1024, 64);
+	TEST_CHECK_EQ(Allocator.ClampResolution(1), 64u);
+	TEST_CHECK_EQ(Allocator.ClampResolution(65), 128u);
+	TEST_CHECK_EQ(Allocator.ClampResolution(256), 256u);
+	TEST_CHECK_EQ(Allocator.ClampResolution(5000), 1024u);
+}
+
+void PackKeepsRequestedResolutionWhenItFits()
+{
+	FShadowAtlasAllocator Allocator(1024, 64);
+	TArray<FShadowAtlasRequest> Requests = {
+		MakeRequest(256, 4, 0.2f),
+		MakeRequest(300, 1, 0.9f),
+		MakeRequest(512, 2, FShadowAtlasRequest::FIXED_RESOLUTION_PRIORITY),
+	};
+
+	const FShadowAtlasPackStats Stats = Allocator.Pack(Requests);
+
+	TEST_CHECK_EQ(Requests[0].AllocatedResolution, 256u);
+	TEST_CHECK_EQ(Requests[1].AllocatedResolution, 512u);
+	TEST_CHECK_EQ(Requests[2].AllocatedResolution, 512u);
+	TEST_CHECK_EQ(Stats.DownscaledRequestCount, 0u);
+	TEST_CHECK_EQ(Stats.DroppedRequestCount, 0u);
+	TEST_CHECK_EQ(Stats.AllocatedTileCount, 7u);
+	CheckPackedLayout(Allocator, Requests);
+}
+
+void PackShrinksLowestPriorityToMinimumFirst()
+{
+	// 512 x 2 (고정) + 512 + 512 + 256 = 1088K texel > 1024K
+	FShadowAtlasAllocator Allocator(1024, 64);
+	TArray<FShadowAtlasRequest> Requests = {
+		MakeRequest(256, 1, 0.1f),
+		MakeRequest(512, 1, 0.5f),
+		MakeRequest(512, 2, FShadowAtlasRequest::FIXED_RESOLUTION_PRIORITY),
+		MakeRequest(512, 1, 0.9f),
+	};
+
+	const FShadowAtlasPackStats Stats = Allocator.Pack(Requests);
+
+	// 가장 낮은 요청이 최소 해상도까지 내려간 뒤에야 다음 요청을 낮춘다
+	TEST_CHECK_EQ(Requests[0].AllocatedResolution, 64u);
+	TEST_CHECK_EQ(Requests[1].AllocatedResolution, 256u);
+	TEST_CHECK_EQ(Requests[2].AllocatedResolution, 512u);
+	TEST_CHECK_EQ(Requests[3].AllocatedResolution, 512u);
+	TEST_CHECK_EQ(Stats.DownscaledRequestCount, 2u);
+	TEST_CHECK_EQ(Stats.DroppedRequestCount, 0u);
+	CheckPackedLayout(Allocator, Requests);
+}
+
+void PackNeverShrinksFixedResolutionRequests()
+{
+	// 고정 요청이 Atlas 전체를 차지하면 다른 요청은 최소 해상도로도 들어가지 못해 제외된다
+	FShadowAtlasAllocator Allocator(1024, 64);
+	TArray<FShadowAtlasRequest> Requests = {
+		MakeRequest(512, 4, FShadowAtlasRequest::FIXED_RESOLUTION_PRIORITY),
+		MakeRequest(256, 1, 0.5f),
+	};
+
+	const FShadowAtlasPackStats Stats = Allocator.Pack(Requests);
+
+	TEST_CHECK_EQ(Requests[0].AllocatedResolution, 512u);
+	TEST_CHECK(!Requests[1].IsAllocated());
+	TEST_CHECK_EQ(Stats.DroppedRequestCount, 1u);
+	CheckPackedLayout(Allocator, Requests);
+}
+
+void PackDropsLowestPriorityFirst()
+{
+	// 최소 해상도 타일 4개짜리 요청 6개(96K texel)는 256 x 256 Atlas(64K)에 4개만 들어간다
+	FShadowAtlasAllocator Allocator(256, 64);
+	const float Priorities[] = { 0.3f, 0.1f, 0.6f, 0.2f, 0.5f, 0.4f };
+	TArray<FShadowAtlasRequest> Requests;
+	for (float Priority : Priorities)
+	{
+		Requests.push_back(MakeRequest(64, 4, Priority));
+	}
+
+	const FShadowAtlasPackStats Stats = Allocator.Pack(Requests);
+
+	TEST_CHECK_EQ(Stats.RequestCount, 6u);
+	TEST_CHECK_EQ(Stats.DroppedRequestCount, 2u);
+	for (const FShadowAtlasRequest& Request : Requests)
+	{
+		TEST_CHECK_EQ(Request.IsAllocated(), Request.Priority > 0.25f);
+	}
+	TEST_CHECK(Stats.GetAtlasUsage() == 1.0f);
+	CheckPackedLayout(Allocator, Requests);
+}
+
+void PackIgnoresEmptyRequests()
+{
+	FShadowAtlasAllocator Allocator(1024, 64);
+	TArray<FShadowAtlasRequest> Requests = {
+		MakeRequest(0, 1, 1.0f),
+		MakeRequest(256, 0, 1.0f),
+		MakeRequest(128, 1, 0.5f),
+	};
+
+	const FShadowAtlasPackStats Stats = Allocator.Pack(Requests);
+
+	TEST_CHECK(!Requests[0].IsAllocated());
+	TEST_CHECK(!Requests[1].IsAllocated());
+	TEST_CHECK_EQ(Requests[2].AllocatedResolution, 128u);
+	TEST_CHECK_EQ(Stats.RequestCount, 1u);
+	TEST_CHECK_EQ(Stats.DroppedRequestCount, 0u);
+}
+
+void AllocateAtReservesExactRect()
+{
+	FShadowAtlasAllocator Allocator(256, 64);
+
+	TEST_CHECK(Allocator.AllocateAt({ 64, 128, 64 }));
+	TEST_CHECK(!Allocator.AllocateAt({ 64, 128, 64 }));		// 이미 사용 중
+	TEST_CHECK(!Allocator.AllocateAt({ 0, 128, 128 }));		// 사용 중인 타일을 포함
+	TEST_CHECK(!Allocator.AllocateAt({ 32, 0, 64 }));		// quadtree 노드와 맞지 않음
+	TEST_CHECK(!Allocator.AllocateAt({ 0, 0, 96 }));
+
+	// 남은 공간(64K - 4K)은 그대로 모두 할당할 수 있어야 한다
+	TEST_CHECK(Allocator.CanAllocate(128, 3));
+	TEST_CHECK(Allocator.CanAllocate(64, 15));
+	TEST_CHECK(!Allocator.CanAllocate(64, 16));
+}
+
+void PackKeepsPreviousRectsWhenPriorityOrderChanges()
+{
+	FShadowAtlasAllocator Allocator(1024, 64);
+	TArray<FShadowAtlasRequest> Requests = {
+		MakeRequest(256, 1, 0.9f),
+		MakeRequest(256, 1, 0.1f),
+		MakeRequest(128, 6, 0.5f),
+	};
+	Allocator.Pack(Requests);
+	const TArray<FShadowAtlasRequest> FirstFrame = Requests;
+
+	// 카메라가 움직여 우선순위가 뒤집히고 새 라이트가 추가되어도 기존 타일은 같은 자리에 남는다
+	Requests[0].Priority = 0.1f;
+	Requests[1].Priority = 0.9f;
+	Requests.push_back(MakeRequest(512, 1, 0.7f));
+	for (FShadowAtlasRequest& Request : Requests)
+	{
+		Request.SetPreviousAllocation(Request);
+	}
+	Allocator.Pack(Requests);
+
+	for (uint32 i = 0; i < FirstFrame.size(); ++i)
+	{
+		TEST_CHECK_EQ(Requests[i].AllocatedResolution, FirstFrame[i].AllocatedResolution);
+		for (uint32 Tile = 0; Tile < Requests[i].TileCount; ++Tile)
+		{
+			TEST_CHECK(Requests[i].Rects[Tile] == FirstFrame[i].Rects[Tile]);
+		}
+	}
+	TEST_CHECK_EQ(Requests[3].AllocatedResolution, 512u);
+	CheckPackedLayout(Allocator, Requests);
+}
+
+void PackHoldsPreviousResolutionWithinHysteresis()
+{
+	FShadowAtlasAllocator Allocator(2048, 64);
+
+	// 직전 512에 대해 (192, 640] 안의 요청은 512를 유지하고, 벗어나면 요청 해상도로 바뀐다
+	const uint32 RequestedResolutions[] = { 250, 600, 150, 700 };
+	const uint32 ExpectedResolutions[] = { 512, 512, 256, 1024 };
+	for (uint32 i = 0; i < 4; ++i)
+	{
+		TArray<FShadowAtlasRequest> Requests = { MakeRequest(512, 1, 0.5f) };
+		Allocator.Pack(Requests);
+		Requests[0].SetPreviousAllocation(Requests[0]);
+
+		Requests[0].RequestedResolution = RequestedResolutions[i];
+		const FShadowAtlasPackStats Stats = Allocator.Pack(Requests);
+		TEST_CHECK_EQ(Requests[0].AllocatedResolution, ExpectedResolutions[i]);
+		TEST_CHECK_EQ(Stats.DownscaledRequestCount, 0u);
+	}
+}
+
+void PackRepacksWhenPreviousRectsFragmentAtlas()
+{
+	// 직전 64 타일 두 개가 128 영역 두 곳을 나눠 쓰고 있으면 128 x 3 요청이 들어가지 않으므로 전부 다시 배치한다
+	FShadowAtlasAllocator Allocator(256, 64);
+	TArray<FShadowAtlasRequest> Requests = {
+		MakeRequest(64, 2, 0.9f),
+		MakeRequest(128, 3, 0.5f),
+	};
+	Requests[0].PreviousResolution = 64;
+	Requests[0].PreviousRects[0] = { 0, 0, 64 };
+	Requests[0].PreviousRects[1] = { 128, 0, 64 };
+
+	const FShadowAtlasPackStats Stats = Allocator.Pack(Requests);
+
+	TEST_CHECK_EQ(Requests[0].AllocatedResolution, 64u);
+	TEST_CHECK_EQ(Requests[1].AllocatedResolution, 128u);
+	TEST_CHECK_EQ(Stats.DroppedRequestCount, 0u);
+	CheckPackedLayout(Allocator, Requests);
+}
+
+int main()
+{
+	RUN_TEST(AllocateFillsAtlasWithoutOverlap);
+	RUN_TEST(ClampResolutionRoundsToPowerOfTwo);
+	RUN_TEST(PackKeepsRequestedResolutionWhenItFits);
+	RUN_TEST(PackShrinksLowestPriorityToMinimumFirst);
+	RUN_TEST(PackNeverShrinksFixedResolutionRequests);
+	RUN_TEST(PackDropsLowestPriorityFirst);
+	RUN_TEST(PackIgnoresEmptyRequests);
+	RUN_TEST(AllocateAtReservesExactRect);
+	RUN_TEST(PackKeepsPreviousRectsWhenPriorityOrderChanges);
+	RUN_TEST(PackHoldsPreviousResolutionWithinHysteresis);
+	RUN_TEST(PackRepacksWhenPreviousRectsFragmentAtlas);
+	return FTestContext::GetExitCode();
+}
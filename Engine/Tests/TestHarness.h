@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdio>
+
+/**
+ * @brief FutureEngineCore 헤드리스 테스트용 검사 매크로
+ *
+ * 테스트 실행 파일 하나가 main에서 RUN_TEST로 테스트 함수를 차례로 실행하고,
+ * FTestContext::GetExitCode()를 반환하면 실패가 하나라도 있을 때 ctest가 실패로 처리합니다.
+ */
+class FTestContext
+{
+public:
+	static void Fail(const char* InExpression, const char* InFile, int InLine)
+	{
+		++GetFailureCount();
+		fprintf(stderr, "  FAILED: %s (%s:%d)\n", InExpression, InFile, InLine);
+	}
+
+	template<typename TFunction>
+	static void Run(const char* InName, TFunction&& InFunction)
+	{
+		const int FailureCountBefore = GetFailureCount();
+		InFunction();
+		printf("[%s] %s\n", GetFailureCount() == FailureCountBefore ? " OK " : "FAIL", InName);
+	}
+
+	static int GetExitCode() { return GetFailureCount() == 0 ? 0 : 1; }
+
+private:
+	static int& GetFailureCount()
+	{
+		static int FailureCount = 0;
+		return FailureCount;
+	}
+};
+
+#define TEST_CHECK(Expression) \
+	do { if (!(Expression)) { FTestContext::Fail(#Expression, __FILE__, __LINE__); } } while (0)
+
+#define TEST_CHECK_EQ(Actual, Expected) \
+	do { if (!((Actual) == (Expected))) { FTestContext::Fail(#Actual " == " #Expected, __FILE__, __LINE__); } } while (0)
+
+#define RUN_TEST(Function) FTestContext::Run(#Function, Function)
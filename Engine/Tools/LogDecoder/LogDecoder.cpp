@@ -0,0 +1,45 @@
+#include "pch.h"
+#include "Utility/Public/StructuredLogDecoder.h"
+
+/**
+ * @brief 구조화 로그(.ulog)를 텍스트로 변환하는 오프라인 도구
+ *
+ * 빌드: FutureEngine.sln의 LogDecoder 프로젝트(LogDecoder.vcxproj) 또는 CMake의 LogDecoder 타깃
+ *       (Tools/LogDecoder와 Source를 include 경로로 두고 이 파일과 Source/Utility/Private/StructuredLogDecoder.cpp를 함께 컴파일)
+ * 사용: LogDecoder <input.ulog> [output.txt]   (출력 경로를 생략하면 표준 출력)
+ */
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "Usage: LogDecoder <input.ulog> [output.txt]\n");
+		return 1;
+	}
+
+	FStructuredLogDecoder Decoder;
+	TArray<FStructuredLogLine> Lines;
+	if (!Decoder.DecodeFile(argv[1], Lines))
+	{
+		fprintf(stderr, "LogDecoder: failed to read %s (missing file or not a .ulog)\n", argv[1]);
+		return 1;
+	}
+
+	FILE* Output = argc >= 3 ? fopen(argv[2], "w") : stdout;
+	if (!Output)
+	{
+		fprintf(stderr, "LogDecoder: failed to open %s\n", argv[2]);
+		return 1;
+	}
+
+	for (const FStructuredLogLine& Line : Lines)
+	{
+		const FString Text = FStructuredLogDecoder::ToText(Line);
+		fprintf(Output, "%s\n", Text.c_str());
+	}
+
+	if (Output != stdout)
+	{
+		fclose(Output);
+	}
+	return 0;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+// LogDecoder는 엔진 없이 빌드하므로, 디코더가 사용하는 표준 라이브러리와 기본 타입만 포함
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "Global/Types.h"
@@ -0,0 +1,155 @@
+#include "pch.h"
+#include "Utility/Public/CastBenchmark.h"
+#include "Utility/Public/DelegateBenchmark.h"
+#include "Utility/Public/LogBenchmark.h"
+#include "Utility/Public/MathBenchmark.h"
+#include "Utility/Public/SpawnBenchmark.h"
+
+/**
+ * @brief 헤드리스 마이크로 벤치마크
+ *
+ * 에디터 콘솔의 "bench <name>" 명령과 같은 벤치마크를 렌더러/에디터 없이 실행하고 결과를 stdout으로 출력합니다.
+ *
+ * 사용: MicroBenchmark [math | log | cast | spawn | delegate | all]... [--verbose]
+ *  인자가 없으면 all
+ *  --verbose 엔진 로그도 출력 (기본: 결과만 출력, 에러는 항상 stderr)
+ */
+namespace
+{
+	void RunMathBenchmark()
+	{
+		TArray<FMathBenchmarkResult> Results;
+		FMathBenchmark::Run(Results);
+
+		printf("Math Benchmark (%u elements x %u repeats):\n",
+			FMathBenchmark::DEFAULT_ELEMENT_COUNT, FMathBenchmark::DEFAULT_REPEAT_COUNT);
+		for (const FMathBenchmarkResult& Result : Results)
+		{
+			printf("  %-36s %8.2f ns/op\n", Result.Name, Result.NanosecondsPerOp);
+		}
+	}
+
+	void RunLogBenchmark()
+	{
+		TArray<FLogBenchmarkResult> Results;
+		FLogBenchmark::Run(Results);
+
+		printf("Log Queue Benchmark (%u messages per producer):\n", FLogBenchmark::DEFAULT_MESSAGES_PER_PRODUCER);
+		for (const FLogBenchmarkResult& Result : Results)
+		{
+			printf("  %-24s %u thread(s) %8.2f M delivered/s %8.2f M pushed/s (dropped %llu)\n", Result.Name, Result.ProducerCount,
+				Result.MessagesPerSecond / 1000000.0, Result.PushesPerSecond / 1000000.0, static_cast<unsigned long long>(Result.DroppedCount));
+		}
+	}
+
+	void RunCastBenchmark()
+	{
+		TArray<FCastBenchmarkResult> Results;
+		FCastBenchmark::Run(Results);
+
+		printf("Cast Benchmark (%u class pairs x %u repeats):\n",
+			FCastBenchmark::DEFAULT_PAIR_COUNT, FCastBenchmark::DEFAULT_REPEAT_COUNT);
+		for (const FCastBenchmarkResult& Result : Results)
+		{
+			printf("  %-36s %8.2f M casts/s\n", Result.Name, Result.CastsPerSecond / 1000000.0);
+		}
+	}
+
+	void RunSpawnBenchmark()
+	{
+		TArray<FSpawnBenchmarkResult> Results;
+		FSpawnBenchmark::Run(Results);
+
+		printf("Spawn Benchmark (%u objects x %u rounds, scattered destroy order):\n",
+			FSpawnBenchmark::DEFAULT_OBJECT_COUNT, FSpawnBenchmark::DEFAULT_ROUND_COUNT);
+		for (const FSpawnBenchmarkResult& Result : Results)
+		{
+			printf("  %-36s %8.2f M spawn+destroy/s\n", Result.Name, Result.SpawnsPerSecond / 1000000.0);
+		}
+	}
+
+	void RunDelegateBenchmark()
+	{
+		TArray<FDelegateBenchmarkResult> Results;
+		FDelegateBenchmark::Run(Results);
+
+		printf("Delegate Benchmark (%u AddDynamic + 1 lambda handlers, %u broadcasts):\n",
+			FDelegateBenchmark::DEFAULT_MEMBER_HANDLER_COUNT, FDelegateBenchmark::DEFAULT_BROADCAST_COUNT);
+		for (const FDelegateBenchmarkResult& Result : Results)
+		{
+			printf("  %-36s %8.2f ns/broadcast (%llu heap allocs to bind)\n", Result.Name,
+				Result.NanosecondsPerBroadcast, static_cast<unsigned long long>(Result.BindAllocationCount));
+		}
+	}
+
+	struct FBenchmarkEntry
+	{
+		const char* Name;
+		void (*Run)();
+	};
+
+	constexpr FBenchmarkEntry BENCHMARKS[] = {
+		{ "math", &RunMathBenchmark },
+		{ "log", &RunLogBenchmark },
+		{ "cast", &RunCastBenchmark },
+		{ "spawn", &RunSpawnBenchmark },
+		{ "delegate", &RunDelegateBenchmark },
+	};
+
+	void PrintUsage()
+	{
+		fprintf(stderr, "Usage: MicroBenchmark [math | log | cast | spawn | delegate | all]... [--verbose]\n");
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	TArray<const FBenchmarkEntry*> Selected;
+	bool bVerbose = false;
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		const FString Argument = argv[Index];
+		if (Argument == "--verbose")
+		{
+			bVerbose = true;
+			continue;
+		}
+
+		bool bFound = false;
+		for (const FBenchmarkEntry& Entry : BENCHMARKS)
+		{
+			if (Argument == Entry.Name || Argument == "all")
+			{
+				Selected.push_back(&Entry);
+				bFound = true;
+			}
+		}
+
+		if (!bFound)
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	if (Selected.empty())
+	{
+		for (const FBenchmarkEntry& Entry : BENCHMARKS)
+		{
+			Selected.push_back(&Entry);
+		}
+	}
+
+	UConsoleWindow::SetStdoutEnabled(bVerbose);
+
+	for (size_t Index = 0; Index < Selected.size(); ++Index)
+	{
+		if (Index > 0)
+		{
+			printf("\n");
+		}
+		Selected[Index]->Run();
+		fflush(stdout);
+	}
+	return 0;
+}
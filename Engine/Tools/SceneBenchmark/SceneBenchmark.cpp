@@ -0,0 +1,214 @@
+#include "pch.h"
+#include "Component/Public/SceneTransformStore.h"
+#include "Level/Public/Level.h"
+#include "Level/Public/World.h"
+#include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Path/Public/PathManager.h"
+#include "Manager/Time/Public/FixedStepClock.h"
+#include "Platform/Public/PlatformTime.h"
+
+/**
+ * @brief 헤드리스 씬 벤치마크
+ *
+ * .Scene을 Game 월드로 로드해 지정한 프레임 수만큼 ClientApp과 같은 순서(World Tick → Transform 갱신 → 프레임 아레나 초기화)로 진행하고,
+ * 프레임별 CPU 시간을 집계해 출력합니다. 렌더러와 에디터 없이 FutureEngineCore만 링크합니다.
+ *
+ * 사용: SceneBenchmark <file.Scene> [--frames N] [--warmup N] [--dt Seconds] [--fixed-step Hz] [--root Dir] [--verbose]
+ *  --root       Data/, Asset/이 있는 디렉토리 (기본: 현재 디렉토리), 상대 경로의 Scene도 이 기준
+ *  --fixed-step 0보다 크면 FFixedStepClock으로 고정 스텝 서브스텝을 진행 (기본: 가변 스텝, 매 프레임 --dt)
+ */
+namespace
+{
+	struct FBenchmarkOptions
+	{
+		path ScenePath;
+		path RootPath = std::filesystem::current_path();
+		uint32 FrameCount = 1000;
+		uint32 WarmupFrameCount = 60;
+		double FrameSeconds = 1.0 / 60.0;
+		uint32 FixedStepsPerSecond = 0;
+		bool bVerbose = false;
+	};
+
+	void PrintUsage()
+	{
+		fprintf(stderr, "Usage: SceneBenchmark <file.Scene> [--frames N] [--warmup N] [--dt Seconds] [--fixed-step Hz] [--root Dir] [--verbose]\n");
+	}
+
+	bool ParseOptions(int argc, char* argv[], FBenchmarkOptions& OutOptions)
+	{
+		for (int Index = 1; Index < argc; ++Index)
+		{
+			const FString Argument = argv[Index];
+			const bool bHasValue = Index + 1 < argc;
+
+			if (Argument == "--frames" && bHasValue)
+			{
+				OutOptions.FrameCount = static_cast<uint32>(std::max(1, atoi(argv[++Index])));
+			}
+			else if (Argument == "--warmup" && bHasValue)
+			{
+				OutOptions.WarmupFrameCount = static_cast<uint32>(std::max(0, atoi(argv[++Index])));
+			}
+			else if (Argument == "--dt" && bHasValue)
+			{
+				OutOptions.FrameSeconds = std::max(0.0, atof(argv[++Index]));
+			}
+			else if (Argument == "--fixed-step" && bHasValue)
+			{
+				OutOptions.FixedStepsPerSecond = static_cast<uint32>(std::max(0, atoi(argv[++Index])));
+			}
+			else if (Argument == "--root" && bHasValue)
+			{
+				OutOptions.RootPath = argv[++Index];
+			}
+			else if (Argument == "--verbose")
+			{
+				OutOptions.bVerbose = true;
+			}
+			else if (!Argument.empty() && Argument[0] != '-' && OutOptions.ScenePath.empty())
+			{
+				OutOptions.ScenePath = Argument;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		return !OutOptions.ScenePath.empty();
+	}
+
+	double GetPercentile(const TArray<double>& InSortedSamples, double InPercentile)
+	{
+		const size_t Index = static_cast<size_t>(InPercentile / 100.0 * static_cast<double>(InSortedSamples.size() - 1) + 0.5);
+		return InSortedSamples[std::min(Index, InSortedSamples.size() - 1)];
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	FBenchmarkOptions Options;
+	if (!ParseOptions(argc, argv, Options))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	// 에셋 로더는 현재 디렉토리 기준 "Data/"를 사용하므로, Root로 이동한 뒤 경로를 맞춤
+	std::error_code ErrorCode;
+	Options.RootPath = std::filesystem::absolute(Options.RootPath, ErrorCode);
+	Options.ScenePath = std::filesystem::absolute(Options.RootPath / Options.ScenePath, ErrorCode);
+	std::filesystem::current_path(Options.RootPath, ErrorCode);
+	if (ErrorCode)
+	{
+		fprintf(stderr, "SceneBenchmark: invalid root directory %s\n", Options.RootPath.string().c_str());
+		return 1;
+	}
+
+	if (!exists(Options.ScenePath))
+	{
+		fprintf(stderr, "SceneBenchmark: scene not found %s\n", Options.ScenePath.string().c_str());
+		return 1;
+	}
+
+	UConsoleWindow::SetStdoutEnabled(Options.bVerbose);
+
+	const uint64 LoadStartCycles = FPlatformTime::Cycles64();
+	UPathManager::GetInstance().SetRootPath(Options.RootPath);
+	UAssetManager::GetInstance().Initialize();
+	const uint64 AssetEndCycles = FPlatformTime::Cycles64();
+
+	UWorld* World = NewObject<UWorld>();
+	World->SetWorldType(EWorldType::Game);
+	GWorld = World;
+	if (!World->LoadLevel(Options.ScenePath))
+	{
+		fprintf(stderr, "SceneBenchmark: failed to load %s\n", Options.ScenePath.string().c_str());
+		return 1;
+	}
+	const uint64 LoadEndCycles = FPlatformTime::Cycles64();
+
+	FSceneTransformStore& TransformStore = FSceneTransformStore::GetInstance();
+	FFixedStepClock FixedStepClock;
+	const bool bIsFixedTimestep = Options.FixedStepsPerSecond > 0;
+	if (bIsFixedTimestep)
+	{
+		FixedStepClock.SetStepsPerSecond(Options.FixedStepsPerSecond);
+	}
+
+	const float FrameSeconds = static_cast<float>(Options.FrameSeconds);
+	const uint32 TotalFrameCount = Options.WarmupFrameCount + Options.FrameCount;
+	TArray<double> FrameMilliseconds;
+	FrameMilliseconds.reserve(Options.FrameCount);
+
+	for (uint32 Frame = 0; Frame < TotalFrameCount; ++Frame)
+	{
+		const uint64 FrameStartCycles = FPlatformTime::Cycles64();
+
+		if (bIsFixedTimestep)
+		{
+			const uint32 StepCount = FixedStepClock.Advance(Options.FrameSeconds);
+			for (uint32 Step = 0; Step < StepCount; ++Step)
+			{
+				TransformStore.BeginSimulationStep();
+				World->Tick(FixedStepClock.GetStepSeconds());
+				TransformStore.EndSimulationStep();
+			}
+		}
+		else
+		{
+			World->Tick(FrameSeconds);
+		}
+
+		TransformStore.UpdateWorldTransforms();
+
+		// 렌더러가 없으므로 그림자 패스 대신 프레임마다 변경 영역을 비워 누적되지 않게 함
+		if (ULevel* Level = World->GetLevel())
+		{
+			Level->ClearDirtyPrimitiveBounds();
+		}
+		FFrameArena::GetInstance().Reset();
+
+		if (Frame >= Options.WarmupFrameCount)
+		{
+			FrameMilliseconds.push_back(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStartCycles));
+		}
+	}
+
+	const size_t ActorCount = World->GetLevel() ? World->GetLevel()->GetLevelActors().size() : 0;
+
+	double TotalMilliseconds = 0.0;
+	for (double Milliseconds : FrameMilliseconds)
+	{
+		TotalMilliseconds += Milliseconds;
+	}
+	std::sort(FrameMilliseconds.begin(), FrameMilliseconds.end());
+
+	printf("Scene        : %s\n", Options.ScenePath.filename().string().c_str());
+	printf("Actors       : %zu\n", ActorCount);
+	printf("Asset init   : %.3f ms\n", FPlatformTime::ToMilliseconds(AssetEndCycles - LoadStartCycles));
+	printf("Level load   : %.3f ms\n", FPlatformTime::ToMilliseconds(LoadEndCycles - AssetEndCycles));
+	if (bIsFixedTimestep)
+	{
+		printf("Mode         : fixed step %u Hz, frame dt %.4f s (%llu steps, %llu dropped)\n",
+			FixedStepClock.GetStepsPerSecond(), Options.FrameSeconds,
+			static_cast<unsigned long long>(FixedStepClock.GetStepCount()),
+			static_cast<unsigned long long>(FixedStepClock.GetDroppedStepCount()));
+	}
+	else
+	{
+		printf("Mode         : variable step, dt %.4f s\n", Options.FrameSeconds);
+	}
+	printf("Frames       : %u (+%u warmup)\n", Options.FrameCount, Options.WarmupFrameCount);
+	printf("Total        : %.3f ms\n", TotalMilliseconds);
+	printf("Frame avg    : %.4f ms\n", TotalMilliseconds / static_cast<double>(FrameMilliseconds.size()));
+	printf("Frame min    : %.4f ms\n", FrameMilliseconds.front());
+	printf("Frame p50    : %.4f ms\n", GetPercentile(FrameMilliseconds, 50.0));
+	printf("Frame p99    : %.4f ms\n", GetPercentile(FrameMilliseconds, 99.0));
+	printf("Frame max    : %.4f ms\n", FrameMilliseconds.back());
+
+	// 에셋 캐시는 프로세스 종료 시 OS가 회수하므로 월드만 정리 (측정 대상이 아닌 종료 경로를 짧게 유지)
+	GWorld = nullptr;
+	delete World;
+	return 0;
+}
@@ -18,6 +18,9 @@
 #include <dwrite.h>
 #include <dxgi1_3.h>
 
+// Build Switch (WITH_EDITOR, WITH_RENDERER, WITH_LUA)
+#include "Source/Platform/Public/Platform.h"
+
 // Standard Library
 #include <cmath>
 #include <cassert>
@@ -35,6 +38,7 @@
 // Global Included
 #include "Source/Global/Types.h"
 #include "Source/Global/Memory.h"
+#include "Source/Global/FrameArena.h"
 #include "Source/Global/Constant.h"
 #include "Source/Global/Enum.h"
 #include "Source/Global/Matrix.h"
@@ -46,6 +50,8 @@
 #include "Source/Global/Function.h"
 #include "Source/Global/Color.h"
 #include "Source/Utility/Public/ScopeCycleCounter.h"
+#include "Source/Utility/Public/StructuredLog.h"
+#include "Source/Utility/Public/LogFormat.h"
 #include "Source/Editor/Public/EditorEngine.h"
 #include "Global/Delegate.h"
 #include "Global/WeakObjectPtr.h"